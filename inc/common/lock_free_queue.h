@@ -0,0 +1,214 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef INC_COMMON_LOCK_FREE_QUEUE_H_
+#define INC_COMMON_LOCK_FREE_QUEUE_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Bounded queue on a ring of cells, each cell carries a sequence number telling whether it is ready to be written
+// or read in the current lap, so producers and consumers only contend on their own position counter.
+// Consumers spin for a while before parking on a condition variable, and producers only touch the mutex when some
+// consumer is parked. The spin length adapts to whether spinning paid off recently.
+template <typename T>
+class LockFreeQueue {
+ public:
+  explicit LockFreeQueue(uint32_t max_size)
+      : mask_(RoundUpToPowerOfTwo(max_size) - 1), cells_(new (std::nothrow) Cell[mask_ + 1]) {
+    for (size_t i = 0; (cells_ != nullptr) && (i <= mask_); ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  ~LockFreeQueue() = default;
+
+  LockFreeQueue(const LockFreeQueue &) = delete;
+  LockFreeQueue &operator=(const LockFreeQueue &) = delete;
+
+  // return false if the queue is full or stopped
+  bool TryPush(T item) {
+    if ((cells_ == nullptr) || is_stoped_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    Cell *cell = nullptr;
+    size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      cell = &cells_[pos & mask_];
+      size_t seq = cell->sequence.load(std::memory_order_acquire);
+      intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    cell->item = std::move(item);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+
+    // pairs with the fence in Pop, either the parked consumer is seen here or the item is seen by the consumer
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (num_waiters_.load(std::memory_order_relaxed) > 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      cond_.notify_one();
+    }
+    return true;
+  }
+
+  // return false if the queue is empty
+  bool TryPop(T &item) {
+    if (cells_ == nullptr) {
+      return false;
+    }
+    Cell *cell = nullptr;
+    size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      cell = &cells_[pos & mask_];
+      size_t seq = cell->sequence.load(std::memory_order_acquire);
+      intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+      if (diff == 0) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    item = std::move(cell->item);
+    cell->item = T();
+    cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+  }
+
+  // wait until an item is available, return false if the queue is stopped
+  bool Pop(T &item) { return WaitForItem(item); }
+
+  // wait until an item is available, then take it with the ones queued after it, up to max_num in total
+  // return false if the queue is stopped
+  bool PopBatch(std::vector<T> &items, size_t max_num) {
+    T item;
+    if (!WaitForItem(item)) {
+      return false;
+    }
+    items.emplace_back(std::move(item));
+    while ((items.size() < max_num) && TryPop(item)) {
+      items.emplace_back(std::move(item));
+    }
+    return true;
+  }
+
+  void Stop() {
+    is_stoped_.store(true, std::memory_order_release);
+    std::lock_guard<std::mutex> lock(mutex_);
+    cond_.notify_all();
+  }
+
+  bool IsFull() const {
+    if (cells_ == nullptr) {
+      return true;
+    }
+    size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    size_t seq = cells_[pos & mask_].sequence.load(std::memory_order_acquire);
+    return static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos) < 0;
+  }
+
+ private:
+  struct Cell {
+    std::atomic<size_t> sequence{0};
+    T item;
+  };
+
+  static const uint32_t kMinSpinCount = 16;
+  static const uint32_t kMaxSpinCount = 4096;
+
+  static size_t RoundUpToPowerOfTwo(uint32_t size) {
+    size_t capacity = 2;
+    while (capacity < size) {
+      capacity <<= 1;
+    }
+    return capacity;
+  }
+
+  static void CpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#else
+    std::this_thread::yield();
+#endif
+  }
+
+  bool WaitForItem(T &item) {
+    uint32_t spin_count = spin_count_.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i < spin_count; ++i) {
+      if (is_stoped_.load(std::memory_order_acquire)) {
+        return false;
+      }
+      if (TryPop(item)) {
+        if (i > 0) {
+          // data arrived while spinning, spin longer next time
+          spin_count_.store((spin_count < kMaxSpinCount / 2) ? (spin_count * 2) : kMaxSpinCount,
+                            std::memory_order_relaxed);
+        }
+        return true;
+      }
+      CpuRelax();
+    }
+    spin_count_.store((spin_count > kMinSpinCount * 2) ? (spin_count / 2) : kMinSpinCount,
+                      std::memory_order_relaxed);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    num_waiters_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    bool has_item = false;
+    while (!is_stoped_.load(std::memory_order_acquire)) {
+      if (TryPop(item)) {
+        has_item = true;
+        break;
+      }
+      cond_.wait(lock);
+    }
+    num_waiters_.fetch_sub(1, std::memory_order_relaxed);
+    return has_item;
+  }
+
+  const size_t mask_;
+  std::unique_ptr<Cell[]> cells_;
+  // producers and consumers advance their own counter, keep them on separate cache lines
+  alignas(64) std::atomic<size_t> enqueue_pos_{0};
+  alignas(64) std::atomic<size_t> dequeue_pos_{0};
+  alignas(64) std::atomic<bool> is_stoped_{false};
+  std::atomic<uint32_t> num_waiters_{0};
+  std::atomic<uint32_t> spin_count_{kMinSpinCount};
+  std::mutex mutex_;
+  std::condition_variable cond_;
+};
+
+#endif  // INC_COMMON_LOCK_FREE_QUEUE_H_
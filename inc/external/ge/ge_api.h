@@ -98,6 +98,30 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY Session {
   ///
   Status RunGraphAsync(uint32_t graphId, const std::vector<ge::InputTensorInfo> &inputs, RunAsyncCallback callback);
 
+  ///
+  /// @ingroup ge_graph
+  /// @brief bind user buffers to the inputs and outputs of a graph, RunGraphWithIoBinding reads inputs from and
+  ///        writes outputs to them without staging copies
+  /// @param [in] graphId: graph id
+  /// @param [in] inputs: input buffers with their data type and shape, they must stay valid until unregistered
+  /// @param [in] outputs: output buffers, length of each is its capacity
+  /// @param [in] isDeviceMemory: buffers are device memory, otherwise host memory
+  /// @return Status result of function
+  ///
+  Status RegisterIoBinding(uint32_t graphId, const std::vector<ge::InputTensorInfo> &inputs,
+                           const std::vector<ge::InputTensorInfo> &outputs, bool isDeviceMemory);
+
+  Status UnregisterIoBinding(uint32_t graphId);
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief run a graph with its bound buffers, the graph is built and loaded by its first RunGraph
+  /// @param [in] graphId: graph id
+  /// @param [out] outputDesc: real descs of outputs written to the bound buffers
+  /// @return Status result of function
+  ///
+  Status RunGraphWithIoBinding(uint32_t graphId, std::vector<TensorDesc> &outputDesc);
+
   ///
   /// @ingroup ge_graph
   /// @brief get variables in the session with specific session id
@@ -107,6 +131,23 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY Session {
   ///
   Status GetVariables(const std::vector<std::string> &var_names, std::vector<Tensor> &var_values);
 
+  ///
+  /// @ingroup ge_graph
+  /// @brief save the variables of the session to a checkpoint file in background, it returns once the variables
+  ///        are copied out, graphs updating them must not be running until then
+  /// @param [in] filePath: checkpoint file path
+  /// @param [in] incremental: save only the variables changed since the last checkpoint
+  /// @return Status result of function
+  ///
+  Status SaveVarCheckpoint(const std::string &filePath, bool incremental);
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief wait for the checkpoint being saved
+  /// @return Status result of the last save
+  ///
+  Status WaitVarCheckpoint();
+
   ///
   /// @ingroup ge_graph
   /// @brief register callback func with specific summary or checkpoint by users
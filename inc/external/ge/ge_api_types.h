@@ -61,6 +61,20 @@ const char *const OPTION_EXEC_HCCL_FLAG = "ge.exec.hcclFlag";
 const char *const OPTION_EXEC_ATOMIC_FLAG = "ge.exec.enable_atomic";
 const char *const OPTION_EXEC_DISABLE_REUSED_MEMORY = "ge.exec.disableReuseMemory";
 const char *const OPTION_EXEC_ENABLE_TAILING_OPTIMIZATION = "ge.exec.isTailingOptimization";
+// Number of executor replicas loaded for one graph, the same graph can be run by this many RunGraph calls in
+// parallel, its value should be a positive integer, default value is "1"
+const char *const OPTION_EXEC_GRAPH_REPLICA_NUM = "ge.exec.graphReplicaNum";
+// Fast startup flag, if ge.exec.fastStartup=1, plugin libraries are prefetched in parallel and bound lazily, ops
+// kernel plugins and host cpu op libraries are initialized when the first graph needs them
+const char *const OPTION_EXEC_FAST_STARTUP = "ge.exec.fastStartup";
+// Directory of the startup cache in fast startup mode, which records the op type to host cpu op library mapping,
+// no cache is kept if it is not set
+const char *const OPTION_EXEC_STARTUP_CACHE_PATH = "ge.exec.startupCachePath";
+// Times a dynamic shape model is executed with the same input shapes before the inferred shapes and tiling data of
+// the execution are frozen into a plan for these input shapes, no plan is built if it is "0", default value is "0"
+const char *const OPTION_EXEC_SHAPE_PLAN_THRESHOLD = "ge.exec.shapePlanThreshold";
+// Max number of frozen shape plans kept by a dynamic shape model, default value is "8"
+const char *const OPTION_EXEC_SHAPE_PLAN_CAPACITY = "ge.exec.shapePlanCapacity";
 
 // Option key: memory init
 const char *const GRAPH_MEMORY_MAX_SIZE = "ge.graphMemoryMaxSize";
@@ -222,6 +236,14 @@ const char *const OPTION_GE_MAX_DUMP_OP_NUM = "ge.maxDumpOpNum";
 // Its value should be "0" or "1", default value is "1"
 const char *const ENABLE_PRINT_OP_PASS = "ge.enablePrintOpPass";
 
+// Configure whether consecutive small tbe kernels on one stream are launched as super kernels automatically
+// Its value should be "0" or "1", default value is "0"
+const char *const OPTION_AUTO_SUPER_KERNEL = "ge.autoSuperKernel";
+
+// Configure whether partitions optimized in former builds of the session are reused when a graph is rebuilt
+// Its value should be "0" or "1", default value is "0"
+const char *const OPTION_GRAPH_INCREMENTAL_BUILD = "ge.incrementalBuild";
+
 // Configure whether to use single stream.
 // Its value should be "true" or "false", default value is "false"
 const char *const ENABLE_SINGLE_STREAM = "ge.enableSingleStream";
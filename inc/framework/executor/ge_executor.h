@@ -234,6 +234,33 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY GeExecutor {
   ge::Status ExecModel(uint32_t model_id, void *stream, const ge::RunModelData &input_data,
                        ge::RunModelData &output_data, bool async_mode = false);
 
+  ///
+  /// @ingroup ge
+  /// @brief Bind user buffers to the inputs and outputs of a loaded model, ExecModelWithIoBinding reads inputs from
+  ///        and writes outputs to them without staging copies
+  /// @param [in] uint32_t model_id: Model ID
+  /// @param [in] inputs: input buffers, they must stay valid until unregistered or the model is unloaded
+  /// @param [in] input_desc: descs of inputs, required by dynamic shape models only
+  /// @param [in] outputs: output buffers, length of each is its capacity
+  /// @param [in] bool is_device_memory: buffers are device memory, static models require device memory
+  /// @return SUCCESS handle successfully / others handle failed
+  ///
+  ge::Status RegisterIoBinding(uint32_t model_id, const std::vector<DataBuffer> &inputs,
+                               const std::vector<GeTensorDesc> &input_desc, const std::vector<DataBuffer> &outputs,
+                               bool is_device_memory);
+
+  ge::Status UnregisterIoBinding(uint32_t model_id);
+
+  ///
+  /// @ingroup ge
+  /// @brief Synchronous execution of offline model with its bound buffers(Do not create thread)
+  /// @param [in] uint32_t model_id: Model ID to execute
+  /// @param [in] void* stream: stream to execute
+  /// @param [out] output_desc: real descs of outputs written to the bound buffers
+  /// @return SUCCESS handle successfully / others handle failed
+  ///
+  ge::Status ExecModelWithIoBinding(uint32_t model_id, void *stream, std::vector<GeTensorDesc> &output_desc);
+
   ///
   /// @ingroup ge
   /// @brief Get weight memory size from model file
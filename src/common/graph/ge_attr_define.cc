@@ -1083,4 +1083,8 @@ const std::string ATTR_OUTPUT_MEMORY_TYPE = "_output_memory_type";
 // input_output_offset
 const std::string ATTR_ZERO_COPY_BASIC_OFFSET = "_zero_copy_basic_offset";
 const std::string ATTR_ZERO_COPY_RELATIVE_OFFSET = "_zero_copy_relative_offset";
+
+// super kernel batch of the kernels launched as one task
+const std::string ATTR_NAME_SUPER_KERNEL_BATCH_KEY = "_super_kernel_batch_key";
+const std::string ATTR_NAME_SUPER_KERNEL_BATCH_END = "_super_kernel_batch_end";
 }  // namespace ge
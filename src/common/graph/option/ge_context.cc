@@ -25,6 +25,9 @@ namespace {
 const int64_t kMinTrainingTraceJobId = 256;
 const int kDecimal = 10;
 const char *kHostExecPlacement = "HOST";
+// Session id set by the calling thread, so that concurrent sessions do not overwrite each other.
+thread_local uint64_t thread_session_id = 0;
+thread_local bool thread_session_id_valid = false;
 }  // namespace
 GEContext &GetContext() {
   static GEContext ge_context{};
@@ -91,13 +94,17 @@ void GEContext::Init() {
   }
 }
 
-uint64_t GEContext::SessionId() { return session_id_; }
+uint64_t GEContext::SessionId() { return thread_session_id_valid ? thread_session_id : session_id_; }
 
 uint32_t GEContext::DeviceId() { return device_id_; }
 
 uint64_t GEContext::TraceId() { return trace_id_; }
 
-void GEContext::SetSessionId(uint64_t session_id) { session_id_ = session_id; }
+void GEContext::SetSessionId(uint64_t session_id) {
+  session_id_ = session_id;
+  thread_session_id = session_id;
+  thread_session_id_valid = true;
+}
 
 void GEContext::SetCtxDeviceId(uint32_t device_id) { device_id_ = device_id; }
 
@@ -394,6 +394,51 @@ Status Session::RunGraphAsync(uint32_t graph_id, const std::vector<InputTensorIn
   return SUCCESS;
 }
 
+Status Session::RegisterIoBinding(uint32_t graph_id, const std::vector<InputTensorInfo> &inputs,
+                                  const std::vector<InputTensorInfo> &outputs, bool is_device_memory) {
+  std::shared_ptr<GELib> instance_ptr = ge::GELib::GetInstance();
+  if (instance_ptr == nullptr || !instance_ptr->InitFlag()) {
+    GELOGE(GE_CLI_GE_NOT_INITIALIZED, "Session RegisterIoBinding failed");
+    return FAILED;
+  }
+  Status ret =
+    instance_ptr->SessionManagerObj().RegisterIoBinding(sessionId_, graph_id, inputs, outputs, is_device_memory);
+  if (ret != SUCCESS) {
+    GELOGE(ret, "SessionManager RegisterIoBinding failed");
+    return FAILED;
+  }
+  return SUCCESS;
+}
+
+Status Session::UnregisterIoBinding(uint32_t graph_id) {
+  std::shared_ptr<GELib> instance_ptr = ge::GELib::GetInstance();
+  if (instance_ptr == nullptr || !instance_ptr->InitFlag()) {
+    GELOGE(GE_CLI_GE_NOT_INITIALIZED, "Session UnregisterIoBinding failed");
+    return FAILED;
+  }
+  Status ret = instance_ptr->SessionManagerObj().UnregisterIoBinding(sessionId_, graph_id);
+  if (ret != SUCCESS) {
+    GELOGE(ret, "SessionManager UnregisterIoBinding failed");
+    return FAILED;
+  }
+  return SUCCESS;
+}
+
+Status Session::RunGraphWithIoBinding(uint32_t graph_id, std::vector<TensorDesc> &output_desc) {
+  std::shared_ptr<GELib> instance_ptr = ge::GELib::GetInstance();
+  if (instance_ptr == nullptr || !instance_ptr->InitFlag()) {
+    GELOGE(GE_CLI_GE_NOT_INITIALIZED, "Session RunGraphWithIoBinding failed");
+    return FAILED;
+  }
+  GELOGT(TRACE_RUNNING, "Running Graph with io binding");
+  Status ret = instance_ptr->SessionManagerObj().RunGraphWithIoBinding(sessionId_, graph_id, output_desc);
+  if (ret != SUCCESS) {
+    GELOGE(ret, "Session RunGraphWithIoBinding failed");
+    return FAILED;
+  }
+  return SUCCESS;
+}
+
 Status Session::GetVariables(const std::vector<std::string> &var_names, std::vector<Tensor> &var_values) {
   auto instance_ptr = ge::GELib::GetInstance();
   if (instance_ptr == nullptr || !instance_ptr->InitFlag()) {
@@ -409,6 +454,35 @@ Status Session::GetVariables(const std::vector<std::string> &var_names, std::vec
   return SUCCESS;
 }
 
+Status Session::SaveVarCheckpoint(const std::string &file_path, bool incremental) {
+  auto instance_ptr = ge::GELib::GetInstance();
+  if (instance_ptr == nullptr || !instance_ptr->InitFlag()) {
+    GELOGE(GE_CLI_GE_NOT_INITIALIZED, "Session SaveVarCheckpoint failed");
+    return FAILED;
+  }
+  GELOGT(TRACE_RUNNING, "Save variable checkpoint");
+  Status ret = instance_ptr->SessionManagerObj().SaveVarCheckpoint(sessionId_, file_path, incremental);
+  if (ret != SUCCESS) {
+    GELOGE(ret, "SessionManager SaveVarCheckpoint failed");
+    return FAILED;
+  }
+  return SUCCESS;
+}
+
+Status Session::WaitVarCheckpoint() {
+  auto instance_ptr = ge::GELib::GetInstance();
+  if (instance_ptr == nullptr || !instance_ptr->InitFlag()) {
+    GELOGE(GE_CLI_GE_NOT_INITIALIZED, "Session WaitVarCheckpoint failed");
+    return FAILED;
+  }
+  Status ret = instance_ptr->SessionManagerObj().WaitVarCheckpoint(sessionId_);
+  if (ret != SUCCESS) {
+    GELOGE(ret, "SessionManager WaitVarCheckpoint failed");
+    return FAILED;
+  }
+  return SUCCESS;
+}
+
 bool Session::IsGraphNeedRebuild(uint32_t graph_id) {
   return ge::GELib::GetInstance()->SessionManagerObj().IsGraphNeedRebuild(sessionId_, graph_id);
 }
@@ -23,6 +23,7 @@
 #include "common/formats/utils/formats_trans_utils.h"
 #include "common/fp16_t.h"
 #include "common/ge/ge_util.h"
+#include "common/thread_pool.h"
 #include "framework/common/debug/ge_log.h"
 #include "graph/utils/type_utils.h"
 #include "securec.h"
@@ -30,6 +31,8 @@
 namespace ge {
 namespace formats {
 namespace {
+const int64_t kCastParallelMinBlock = 65536;
+
 enum DataTypeTransMode {
   kTransferWithDatatypeFloatToFloat16,
   kTransferWithDatatypeFloatToInt32,
@@ -70,22 +73,32 @@ std::map<std::pair<DataType, DataType>, DataTypeTransMode> trans_mode_map{
 
 template <typename SrcT, typename DstT>
 Status TransDataSrc2Dst(const CastArgs &args, uint8_t *dst, const size_t data_size) {
-  SrcT src_data;
-  for (size_t idx = 0; idx != data_size; idx++) {
-    src_data = reinterpret_cast<const SrcT *>(args.data)[idx];
-    reinterpret_cast<DstT *>(dst)[idx] = static_cast<DstT>(src_data);
-  }
-  return SUCCESS;
+  auto src = reinterpret_cast<const SrcT *>(args.data);
+  auto dst_data = reinterpret_cast<DstT *>(dst);
+  return ThreadPool::ParallelFor(static_cast<int64_t>(data_size), kCastParallelMinBlock,
+                                 [src, dst_data](int64_t begin, int64_t end) -> Status {
+                                   SrcT src_data;
+                                   for (int64_t idx = begin; idx != end; idx++) {
+                                     src_data = src[idx];
+                                     dst_data[idx] = static_cast<DstT>(src_data);
+                                   }
+                                   return SUCCESS;
+                                 });
 }
 
 template <typename SrcT>
 Status TransDataSrc2Fp16(const CastArgs &args, uint8_t *dst, const size_t data_size) {
-  fp16_t src_data;
-  for (size_t idx = 0; idx != data_size; idx++) {
-    src_data = reinterpret_cast<const SrcT *>(args.data)[idx];
-    reinterpret_cast<uint16_t *>(dst)[idx] = src_data.val;
-  }
-  return SUCCESS;
+  auto src = reinterpret_cast<const SrcT *>(args.data);
+  auto dst_data = reinterpret_cast<uint16_t *>(dst);
+  return ThreadPool::ParallelFor(static_cast<int64_t>(data_size), kCastParallelMinBlock,
+                                 [src, dst_data](int64_t begin, int64_t end) -> Status {
+                                   fp16_t src_data;
+                                   for (int64_t idx = begin; idx != end; idx++) {
+                                     src_data = src[idx];
+                                     dst_data[idx] = src_data.val;
+                                   }
+                                   return SUCCESS;
+                                 });
 }
 
 Status CastKernel(const CastArgs &args, uint8_t *dst, const size_t data_size, const DataTypeTransMode trans_mode) {
@@ -17,9 +17,13 @@
 #include "common/formats/format_transfers/format_transfer_transpose.h"
 
 #include <securec.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
 #include <memory>
 
 #include "common/formats/utils/formats_trans_utils.h"
+#include "common/thread_pool.h"
 #include "framework/common/debug/ge_log.h"
 #include "framework/common/debug/log.h"
 #include "graph/utils/type_utils.h"
@@ -27,6 +31,8 @@
 namespace ge {
 namespace formats {
 namespace {
+const int64_t kTransposeParallelMinBytes = 262144;
+
 std::map<Format, std::map<Format, std::vector<int64_t>>> perm_args{
   {FORMAT_NCHW,
    {{FORMAT_NHWC, std::vector<int64_t>({0, 2, 3, 1})},
@@ -125,6 +131,58 @@ void AddOne(const std::vector<int64_t> &shape, std::vector<int64_t> &indexes) {
   }
 }
 
+template <size_t N>
+void CopyStridedElements(uint8_t *dst, const uint8_t *src, int64_t src_stride, int64_t count) {
+  for (int64_t i = 0; i < count; ++i) {
+    memcpy(dst + i * static_cast<int64_t>(N), src + i * src_stride, N);
+  }
+}
+
+/// copy `count` elements to a contiguous dst, reading the src with a fixed byte stride
+int CopyRun(uint8_t *dst, int64_t dst_max, const uint8_t *src, int64_t src_stride, int64_t data_size,
+            int64_t count) {
+  if (src_stride == data_size) {
+    int64_t total = 0;
+    while (total < count * data_size) {
+      auto copy_size = std::min(count * data_size - total, static_cast<int64_t>(SECUREC_MEM_MAX_LEN));
+      auto protected_size = std::min(dst_max - total, static_cast<int64_t>(SECUREC_MEM_MAX_LEN));
+      auto ret = memcpy_s(dst + total, static_cast<size_t>(protected_size), src + total, static_cast<size_t>(copy_size));
+      if (ret != EOK) {
+        return ret;
+      }
+      total += copy_size;
+    }
+    return EOK;
+  }
+  if (count * data_size > dst_max) {
+    return ERANGE;
+  }
+  switch (data_size) {
+    case sizeof(uint8_t):
+      CopyStridedElements<sizeof(uint8_t)>(dst, src, src_stride, count);
+      break;
+    case sizeof(uint16_t):
+      CopyStridedElements<sizeof(uint16_t)>(dst, src, src_stride, count);
+      break;
+    case sizeof(uint32_t):
+      CopyStridedElements<sizeof(uint32_t)>(dst, src, src_stride, count);
+      break;
+    case sizeof(uint64_t):
+      CopyStridedElements<sizeof(uint64_t)>(dst, src, src_stride, count);
+      break;
+    default:
+      for (int64_t i = 0; i < count; ++i) {
+        auto ret = memcpy_s(dst + i * data_size, static_cast<size_t>(dst_max - i * data_size), src + i * src_stride,
+                            static_cast<size_t>(data_size));
+        if (ret != EOK) {
+          return ret;
+        }
+      }
+      break;
+  }
+  return EOK;
+}
+
 std::vector<int64_t> TransShapeByPerm(const std::vector<int64_t> &src_shape, const std::vector<int64_t> &perm_arg) {
   std::vector<int64_t> dst_shape(src_shape.size());
   for (size_t i = 0; i < perm_arg.size(); ++i) {
@@ -157,26 +215,47 @@ Status Transpose(const uint8_t *src, const std::vector<int64_t> &src_shape, Data
   }
 
   std::shared_ptr<uint8_t> dst(new (std::nothrow) uint8_t[dst_size], std::default_delete<uint8_t[]>());
-  int64_t dst_index = 0;
-  std::vector<int64_t> dst_indexes(dst_shape.size());
-  while (dst_index < dst_ele_num) {
-    auto src_offset = GenOffset(src_heads, dst_indexes) * data_size;
-    auto dst_offset_bytes = dst_index * data_size;
-    auto protected_size = dst_size - dst_offset_bytes < static_cast<int64_t>(SECUREC_MEM_MAX_LEN)
-                            ? dst_size - dst_offset_bytes
-                            : static_cast<int64_t>(SECUREC_MEM_MAX_LEN);
-    auto ret = memcpy_s(dst.get() + dst_offset_bytes, static_cast<size_t>(protected_size), src + src_offset,
-                        static_cast<size_t>(data_size));
-    if (ret != EOK) {
-      GELOGE(INTERNAL_ERROR,
-             "Failed to transpose, src shape %s, perm arg %s, dst shape %s, "
-             "failed to write to dst offset %ld, current dim offset %s",
-             ShapeToString(src_shape).c_str(), ShapeToString(perm_arg).c_str(), ShapeToString(dst_shape).c_str(),
-             dst_offset_bytes, ShapeToString(dst_indexes).c_str());
-      return INTERNAL_ERROR;
+  if (dst == nullptr) {
+    GELOGE(OUT_OF_MEMORY, "Failed to transpose, can not alloc the memory for dst buf %ld", dst_size);
+    return OUT_OF_MEMORY;
+  }
+  // The dst is written in order, one run of the innermost dst dim at a time. Within a run the src offset
+  // advances by a fixed stride, and the outer dims are stepped like an odometer instead of recomputing
+  // the offset of every element. Disjoint dst ranges are filled by the host thread pool.
+  int64_t inner_dim = dst_shape.back();
+  int64_t inner_stride = src_heads.back() * data_size;
+  int64_t min_block = std::max(kTransposeParallelMinBytes / data_size, static_cast<int64_t>(1));
+  uint8_t *dst_data = dst.get();
+  auto ret = ThreadPool::ParallelFor(dst_ele_num, min_block, [&](int64_t begin, int64_t end) -> Status {
+    std::vector<int64_t> dst_indexes(dst_shape.size());
+    int64_t rest = begin;
+    for (auto i = static_cast<int64_t>(dst_shape.size() - 1); i >= 0; --i) {
+      dst_indexes[i] = rest % dst_shape[i];
+      rest /= dst_shape[i];
+    }
+    int64_t dst_index = begin;
+    while (dst_index < end) {
+      auto src_offset = GenOffset(src_heads, dst_indexes) * data_size;
+      auto count = std::min(inner_dim - dst_indexes.back(), end - dst_index);
+      auto dst_offset_bytes = dst_index * data_size;
+      auto copy_ret = CopyRun(dst_data + dst_offset_bytes, dst_size - dst_offset_bytes, src + src_offset, inner_stride,
+                         data_size, count);
+      if (copy_ret != EOK) {
+        GELOGE(INTERNAL_ERROR,
+               "Failed to transpose, src shape %s, perm arg %s, dst shape %s, "
+               "failed to write to dst offset %ld, current dim offset %s",
+               ShapeToString(src_shape).c_str(), ShapeToString(perm_arg).c_str(), ShapeToString(dst_shape).c_str(),
+               dst_offset_bytes, ShapeToString(dst_indexes).c_str());
+        return INTERNAL_ERROR;
+      }
+      dst_indexes.back() += count - 1;
+      AddOne(dst_shape, dst_indexes);
+      dst_index += count;
     }
-    AddOne(dst_shape, dst_indexes);
-    ++dst_index;
+    return SUCCESS;
+  });
+  if (ret != SUCCESS) {
+    return ret;
   }
 
   result.data = dst;
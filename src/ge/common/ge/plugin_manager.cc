@@ -17,17 +17,21 @@
 #include "common/ge/plugin_manager.h"
 
 #include <dirent.h>
+#include <fcntl.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #include <algorithm>
+#include <cstdio>
 #include <cstring>
 #include <fstream>
 #include <iostream>
 #include <memory>
 #include <string>
 
+#include "common/thread_pool.h"
 #include "framework/common/debug/log.h"
 #include "framework/common/util.h"
+#include "graph/common/ge_call_wrapper.h"
 
 namespace {
 const int kMaxNumOfSo = 64;
@@ -88,11 +92,15 @@ Status PluginManager::LoadSo(const string &path, const vector<string> &func_chec
   uint32_t num_of_loaded_so = 0;
   int64_t size_of_loaded_so = 0;
   so_list_.clear();
+  so_path_list_.clear();
   ClearHandles_();
 
   std::vector<std::string> path_vec;
   SplitPath(path, path_vec);
-  for (const auto &single_path : path_vec) {
+  std::vector<std::string> real_paths;
+  ResolveSoPaths(path_vec, real_paths);
+  for (size_t i = 0; i < path_vec.size(); ++i) {
+    const auto &single_path = path_vec[i];
     GE_IF_BOOL_EXEC(single_path.length() >= PATH_MAX,
                     GELOGE(GE_PLGMGR_PATH_INVALID, "The shared library file path is too long!");
                     continue);
@@ -106,7 +114,7 @@ Status PluginManager::LoadSo(const string &path, const vector<string> &func_chec
     }
 
     std::string file_name = single_path.substr(single_path.rfind('/') + 1, string::npos);
-    string file_path_dlopen = RealPath(single_path.c_str());
+    const string &file_path_dlopen = real_paths[i];
     if (file_path_dlopen.empty()) {
       GELOGW("Failed to get realpath of %s!", single_path.c_str());
       continue;
@@ -121,7 +129,7 @@ Status PluginManager::LoadSo(const string &path, const vector<string> &func_chec
     GELOGI("dlopen the shared library path name: %s.", file_path_dlopen.c_str());
 
     // load continue when dlopen is failed
-    auto handle = dlopen(file_path_dlopen.c_str(), RTLD_NOW | RTLD_GLOBAL);
+    auto handle = dlopen(file_path_dlopen.c_str(), GetDlopenFlags());
     if (handle == nullptr) {
       GELOGE(GE_PLGMGR_PATH_INVALID, "Failed to dlopen %s!", dlerror());
       continue;
@@ -146,6 +154,7 @@ Status PluginManager::LoadSo(const string &path, const vector<string> &func_chec
     // add file to list
     size_of_loaded_so += file_size;
     so_list_.emplace_back(file_name);
+    so_path_list_.emplace_back(file_path_dlopen);
     handles_[string(file_name)] = handle;
     num_of_loaded_so++;
   }
@@ -163,6 +172,51 @@ Status PluginManager::LoadSo(const string &path, const vector<string> &func_chec
   return SUCCESS;
 }
 
+void PluginManager::ResolveSoPaths(const vector<string> &path_vec, vector<string> &real_paths) const {
+  real_paths.assign(path_vec.size(), string());
+  auto resolve_func = [&path_vec, &real_paths, this](int64_t begin, int64_t end) -> Status {
+    for (int64_t i = begin; i < end; ++i) {
+      if (path_vec[i].length() >= PATH_MAX) {
+        continue;
+      }
+      real_paths[i] = RealPath(path_vec[i].c_str());
+      if (fast_load_ && !real_paths[i].empty()) {
+        PrefetchSo(real_paths[i]);
+      }
+    }
+    return SUCCESS;
+  };
+  if (!fast_load_) {
+    (void)resolve_func(0, static_cast<int64_t>(path_vec.size()));
+    return;
+  }
+
+  // dlopen is serialized by the loader lock, so only the file system work is spread over threads, and libraries
+  // are still opened one by one in the given order, which decides how global symbols are resolved
+  GE_TIMESTAMP_START(ResolveSoPaths);
+  (void)ThreadPool::ParallelFor(static_cast<int64_t>(path_vec.size()), 1, resolve_func);
+  GE_TIMESTAMP_END(ResolveSoPaths, "PluginManager::ResolveSoPaths");
+}
+
+void PluginManager::PrefetchSo(const string &file_path) {
+  // start reading the whole file into page cache, so that dlopen does not stall on page faults one page at a time
+  int fd = open(file_path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    GELOGD("Open %s for prefetch failed, skip it", file_path.c_str());
+    return;
+  }
+  int ret = posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+  if (ret != 0) {
+    GELOGD("Prefetch %s failed, ret = %d", file_path.c_str(), ret);
+  }
+  (void)close(fd);
+}
+
+int PluginManager::GetDlopenFlags() const {
+  // symbols of lazily bound libraries are resolved on first call instead of all at once in dlopen
+  return fast_load_ ? (RTLD_LAZY | RTLD_GLOBAL) : (RTLD_NOW | RTLD_GLOBAL);
+}
+
 Status PluginManager::ValidateSo(const string &file_path, int64_t size_of_loaded_so, int64_t &file_size) const {
   // read file size
   struct stat stat_buf;
@@ -197,6 +251,7 @@ Status PluginManager::Load(const string &path, const vector<string> &func_check_
   const unsigned char is_folder = 0x4;
   const std::string ext = kExt;
   so_list_.clear();
+  so_path_list_.clear();
   ClearHandles_();
 
   char canonical_path[PATH_MAX] = {0};
@@ -213,6 +268,7 @@ Status PluginManager::Load(const string &path, const vector<string> &func_check_
     return SUCCESS;
   }
 
+  std::vector<std::string> file_names;
   struct dirent *entry = nullptr;
   while ((entry = readdir(dir)) != nullptr) {
     // read fileName and fileType
@@ -228,7 +284,18 @@ Status PluginManager::Load(const string &path, const vector<string> &func_check_
     if (invalid_file) {
       continue;
     }
+    file_names.emplace_back(file_name);
+  }
+  closedir(dir);
 
+  std::vector<std::string> path_vec;
+  for (const auto &file_name : file_names) {
+    path_vec.emplace_back(std::string(canonical_path) + "/" + file_name);
+  }
+  std::vector<std::string> real_paths;
+  ResolveSoPaths(path_vec, real_paths);
+  for (size_t i = 0; i < file_names.size(); ++i) {
+    const std::string &file_name = file_names[i];
     // load break when number of loaded so reach maximum
     if (num_of_loaded_so >= kMaxNumOfSo) {
       GELOGW(
@@ -238,8 +305,8 @@ Status PluginManager::Load(const string &path, const vector<string> &func_check_
       break;
     }
 
-    std::string canonical_path_str = (std::string(canonical_path) + "/" + file_name);
-    string file_path_dlopen = RealPath(canonical_path_str.c_str());
+    const std::string &canonical_path_str = path_vec[i];
+    const string &file_path_dlopen = real_paths[i];
     if (file_path_dlopen.empty()) {
       GELOGW("failed to get realpath of %s", canonical_path_str.c_str());
       continue;
@@ -254,7 +321,7 @@ Status PluginManager::Load(const string &path, const vector<string> &func_check_
     GELOGI("Dlopen so path name: %s. ", file_path_dlopen.c_str());
 
     // load continue when dlopen is failed
-    auto handle = dlopen(file_path_dlopen.c_str(), RTLD_NOW | RTLD_GLOBAL);
+    auto handle = dlopen(file_path_dlopen.c_str(), GetDlopenFlags());
     if (handle == nullptr) {
       GELOGW("Failed in dlopen %s!", dlerror());
       continue;
@@ -280,10 +347,10 @@ Status PluginManager::Load(const string &path, const vector<string> &func_check_
     // add file to list
     size_of_loaded_so += file_size;
     so_list_.emplace_back(file_name);
+    so_path_list_.emplace_back(file_path_dlopen);
     handles_[string(file_name)] = handle;
     num_of_loaded_so++;
   }
-  closedir(dir);
   if (num_of_loaded_so == 0) {
     GELOGW("No loadable shared library found in the path: %s", path.c_str());
     return SUCCESS;
@@ -293,4 +360,61 @@ Status PluginManager::Load(const string &path, const vector<string> &func_check_
 }
 
 const vector<string> &PluginManager::GetSoList() const { return so_list_; }
+
+string PluginManager::GetFingerprint(const vector<string> &file_paths) {
+  string fingerprint;
+  for (const auto &file_path : file_paths) {
+    struct stat stat_buf;
+    if (stat(file_path.c_str(), &stat_buf) != 0) {
+      GELOGW("Failed to stat file: %s", file_path.c_str());
+      continue;
+    }
+    fingerprint += file_path + ":" + std::to_string(stat_buf.st_size) + ":" + std::to_string(stat_buf.st_mtime) + ";";
+  }
+  return fingerprint;
+}
+
+void PluginManager::LoadStartupCache(const string &file_path, const string &fingerprint, vector<string> &lines) {
+  std::ifstream ifs(file_path);
+  if (!ifs.is_open()) {
+    GELOGI("Startup cache %s does not exist.", file_path.c_str());
+    return;
+  }
+  string line;
+  if (!std::getline(ifs, line) || (line != fingerprint)) {
+    GELOGI("Libraries are changed, startup cache %s is outdated.", file_path.c_str());
+    return;
+  }
+  while (std::getline(ifs, line)) {
+    lines.emplace_back(line);
+  }
+}
+
+Status PluginManager::SaveStartupCache(const string &file_path, const string &fingerprint,
+                                       const vector<string> &lines) {
+  string cache_dir = file_path.substr(0, file_path.rfind('/'));
+  if (CreateDirectory(cache_dir) != 0) {
+    GELOGW("Failed to create startup cache dir: %s", cache_dir.c_str());
+    return FAILED;
+  }
+
+  // processes sharing the cache may save it at the same time, write a private file and replace the cache with it
+  string tmp_file = file_path + "." + std::to_string(getpid());
+  std::ofstream ofs(tmp_file, std::ios::trunc);
+  if (!ofs.is_open()) {
+    GELOGW("Failed to open file: %s", tmp_file.c_str());
+    return FAILED;
+  }
+  ofs << fingerprint << '\n';
+  for (const auto &line : lines) {
+    ofs << line << '\n';
+  }
+  ofs.close();
+  if (ofs.fail() || (rename(tmp_file.c_str(), file_path.c_str()) != 0)) {
+    GELOGW("Failed to save startup cache: %s", file_path.c_str());
+    (void)remove(tmp_file.c_str());
+    return FAILED;
+  }
+  return SUCCESS;
+}
 }  // namespace ge
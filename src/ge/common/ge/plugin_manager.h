@@ -54,6 +54,35 @@ class PluginManager {
 
   const vector<string> &GetSoList() const;
 
+  // real paths of the libraries loaded, in the order of GetSoList
+  const vector<string> &GetSoPathList() const { return so_path_list_; }
+
+  ///
+  /// @ingroup ge
+  /// @brief fingerprint of library files by their path, size and mtime, a startup cache built from the libraries is
+  ///        only valid with the same fingerprint
+  ///
+  static string GetFingerprint(const vector<string> &file_paths);
+
+  ///
+  /// @ingroup ge
+  /// @brief read the lines of a startup cache file, nothing is read if it was saved with another fingerprint
+  ///
+  static void LoadStartupCache(const string &file_path, const string &fingerprint, vector<string> &lines);
+
+  ///
+  /// @ingroup ge
+  /// @brief save the lines of a startup cache file, the file is replaced at once since processes may share it
+  ///
+  static Status SaveStartupCache(const string &file_path, const string &fingerprint, const vector<string> &lines);
+
+  ///
+  /// @ingroup ge
+  /// @brief in fast load mode, library files are resolved and prefetched by several threads before being opened,
+  ///        and their functions are bound on first call
+  ///
+  void SetFastLoad(bool fast_load) { fast_load_ = fast_load; }
+
   template <typename R, typename... Types>
   Status GetAllFunctions(const string &func_name, map<string, function<R(Types... args)>> &funcs) {
     for (const auto &handle : handles_) {
@@ -147,9 +176,14 @@ class PluginManager {
  private:
   void ClearHandles_() noexcept;
   Status ValidateSo(const string &file_path, int64_t size_of_loaded_so, int64_t &file_size) const;
+  void ResolveSoPaths(const vector<string> &path_vec, vector<string> &real_paths) const;
+  static void PrefetchSo(const string &file_path);
+  int GetDlopenFlags() const;
 
   vector<string> so_list_;
+  vector<string> so_path_list_;
   SoToHandleMap handles_;
+  bool fast_load_ = false;
 };
 }  // namespace ge
 
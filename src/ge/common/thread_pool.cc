@@ -16,6 +16,7 @@
 
 #include "common/thread_pool.h"
 
+#include <algorithm>
 #include <atomic>
 #include <functional>
 #include <queue>
@@ -26,6 +27,11 @@
 #include "register/register_types.h"
 
 namespace ge {
+namespace {
+const uint32_t kMaxParallelForThreadNum = 16;
+thread_local bool is_parallel_for_worker = false;
+}  // namespace
+
 FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY ThreadPool::ThreadPool(uint32_t size) : is_stoped_(false) {
   idle_thrd_num_ = size < 1 ? 1 : size;
 
@@ -75,4 +81,48 @@ void ThreadPool::ThreadFunc(ThreadPool *thread_pool) {
     ++thread_pool->idle_thrd_num_;
   }
 }
+
+Status ThreadPool::ParallelFor(int64_t total, int64_t min_block_size,
+                               const std::function<Status(int64_t, int64_t)> &func) {
+  if (func == nullptr) {
+    GELOGE(PARAM_INVALID, "ParallelFor func is null.");
+    return PARAM_INVALID;
+  }
+  if (total <= 0) {
+    return SUCCESS;
+  }
+  static const uint32_t thread_num =
+    std::max(1U, std::min(std::thread::hardware_concurrency(), kMaxParallelForThreadNum));
+  min_block_size = std::max(min_block_size, static_cast<int64_t>(1));
+  int64_t block_num = std::min((total + min_block_size - 1) / min_block_size, static_cast<int64_t>(thread_num));
+  if ((block_num <= 1) || is_parallel_for_worker) {
+    return func(0, total);
+  }
+
+  static ThreadPool pool(thread_num - 1);
+  int64_t block_size = (total + block_num - 1) / block_num;
+  std::vector<std::future<Status>> futures;
+  Status ret = SUCCESS;
+  for (int64_t begin = block_size; begin < total; begin += block_size) {
+    int64_t end = std::min(begin + block_size, total);
+    auto future = pool.commit([&func, begin, end]() -> Status {
+      is_parallel_for_worker = true;
+      return func(begin, end);
+    });
+    if (future.valid()) {
+      futures.emplace_back(std::move(future));
+    } else {
+      Status block_ret = func(begin, end);
+      ret = (ret == SUCCESS) ? block_ret : ret;
+    }
+  }
+
+  Status first_ret = func(0, std::min(block_size, total));
+  ret = (ret == SUCCESS) ? first_ret : ret;
+  for (auto &future : futures) {
+    Status block_ret = future.get();
+    ret = (ret == SUCCESS) ? block_ret : ret;
+  }
+  return ret;
+}
 }  // namespace ge
@@ -70,6 +70,17 @@ class GE_FUNC_DEV_VISIBILITY GE_FUNC_HOST_VISIBILITY ThreadPool {
 
   static void ThreadFunc(ThreadPool *thread_pool);
 
+  ///
+  /// @brief split [0, total) into blocks of at least min_block_size and run them on a process wide pool.
+  ///        The calling thread executes the first block, nested calls from pool workers run inline.
+  /// @param [in] total number of work items
+  /// @param [in] min_block_size smallest range worth handing to another thread
+  /// @param [in] func called as func(begin, end) for each block
+  /// @return first failure returned by func, SUCCESS otherwise
+  ///
+  static Status ParallelFor(int64_t total, int64_t min_block_size,
+                            const std::function<Status(int64_t, int64_t)> &func);
+
  private:
   std::vector<std::thread> pool_;
   std::queue<ThreadTask> tasks_;
@@ -27,6 +27,7 @@
 #include "common/util/error_manager/error_manager.h"
 #include "framework/common/debug/ge_log.h"
 #include "analyzer/analyzer.h"
+#include "graph/common/op_signature.h"
 #include "graph/ge_context.h"
 #include "graph/utils/graph_utils.h"
 #include "graph/utils/node_utils.h"
@@ -47,6 +48,9 @@ const char *const kAIcoreEngine = "AIcoreEngine";
 const char *const kCustomOpFlag = "_custom_op_flag";
 const char *const kHostCpuEngineName = "DNN_VM_HOST_CPU";
 const char *const kHostCpuOpKernelLibName = "DNN_VM_HOST_CPU_OP_STORE";
+// options which may change the result of CheckSupported, they are part of the placement key
+const std::vector<std::string> kPlacementOptions = {ge::CORE_TYPE, ge::PRECISION_MODE, ge::OP_SELECT_IMPL_MODE,
+                                                    ge::OPTYPELIST_FOR_IMPLMODE};
 }  // namespace
 
 namespace ge {
@@ -69,6 +73,8 @@ Status DNNEngineManager::Initialize(const std::map<std::string, std::string> &op
   path.append(so_path);
   std::string so_api_func = "GetDNNEngineObjs";
   std::vector<std::string> so_func{so_api_func};
+  auto fast_startup_iter = options.find(OPTION_EXEC_FAST_STARTUP);
+  plugin_mgr_.SetFastLoad((fast_startup_iter != options.end()) && (fast_startup_iter->second == "1"));
   Status status = plugin_mgr_.Load(path, so_func);
   if (status != SUCCESS) {
     GELOGE(status, "Load engine's so failed. LibPath is %s", path.c_str());
@@ -121,6 +127,8 @@ Status DNNEngineManager::Initialize(const std::map<std::string, std::string> &op
     return status;
   }
 
+  // placements made with the kernel info stores of last initialization are stale
+  ClearPlacementCache();
   init_flag_ = true;
 
   return SUCCESS;
@@ -145,6 +153,7 @@ Status DNNEngineManager::Finalize() {
   }
   init_flag_ = false;
   engines_map_.clear();
+  ClearPlacementCache();
   return SUCCESS;
 }
 
@@ -170,6 +179,90 @@ bool DNNEngineManager::IsEngineRegistered(const std::string &name) {
 void DNNEngineManager::InitPerformanceStaistic() {
   std::lock_guard<std::mutex> lock(mutex_);
   checksupport_cost_.clear();
+  placement_hit_count_ = 0;
+  placement_miss_count_ = 0;
+}
+
+void DNNEngineManager::GetPlacementCacheStatistic(uint64_t &hit_count, uint64_t &miss_count) const {
+  hit_count = placement_hit_count_.load();
+  miss_count = placement_miss_count_.load();
+}
+
+void DNNEngineManager::ClearPlacementCache() {
+  std::lock_guard<std::mutex> lock(placement_mutex_);
+  placement_cache_.clear();
+}
+
+bool DNNEngineManager::GeneratePlacementKey(const OpDescPtr &op_desc, std::string &placement_key) {
+  if (!OpSignature::Generate(op_desc, placement_key)) {
+    return false;
+  }
+  for (const auto &option_key : kPlacementOptions) {
+    std::string option_value;
+    (void)ge::GetContext().GetOption(option_key, option_value);
+    OpSignature::AppendString(placement_key, option_value);
+  }
+  return true;
+}
+
+bool DNNEngineManager::FindPlacement(const std::string &placement_key, const OpDescPtr &op_desc,
+                                     std::string &engine_name) {
+  std::string kernel_name;
+  {
+    std::lock_guard<std::mutex> lock(placement_mutex_);
+    auto iter = placement_cache_.find(placement_key);
+    if (iter == placement_cache_.end()) {
+      return false;
+    }
+    engine_name = iter->second.engine_name;
+    kernel_name = iter->second.kernel_lib_name;
+    // replay what CheckSupported wrote on the op desc of the node placed first
+    for (const auto &attr : iter->second.attrs) {
+      (void)op_desc->SetAttr(attr.first, attr.second);
+    }
+  }
+  op_desc->SetOpEngineName(engine_name);
+  op_desc->SetOpKernelLibName(kernel_name);
+  (void)AttrUtils::SetStr(op_desc, ATTR_NAME_ENGINE_NAME_FOR_LX, engine_name);
+  (void)AttrUtils::SetStr(op_desc, ATTR_NAME_KKERNEL_LIB_NAME_FOR_LX, kernel_name);
+  placement_hit_count_++;
+  GELOGD("DNNEngineManager:Reuse placement of OpKernelLibName %s and engine name %s for op_desc %s",
+         kernel_name.c_str(), engine_name.c_str(), op_desc->GetName().c_str());
+  return true;
+}
+
+void DNNEngineManager::AddPlacement(const std::string &placement_key, const OpDescPtr &op_desc,
+                                    const std::string &engine_name,
+                                    const std::map<std::string, GeAttrValue> &attrs_before,
+                                    const std::string &descs_before) {
+  // Only attrs added or changed by CheckSupported can be replayed on a hit, placements which changed the tensor
+  // descs or removed attrs are made again for every node.
+  std::string descs_after;
+  OpSignature::AppendTensorDescs(descs_after, op_desc);
+  if (descs_after != descs_before) {
+    GELOGD("Tensor descs of op %s are changed by its placement, not to cache it.", op_desc->GetName().c_str());
+    return;
+  }
+  Placement placement;
+  placement.engine_name = engine_name;
+  placement.kernel_lib_name = op_desc->GetOpKernelLibName();
+  const auto attrs_after = op_desc->GetAllAttrs();
+  for (const auto &attr : attrs_before) {
+    if (attrs_after.count(attr.first) == 0) {
+      GELOGD("Attr %s of op %s is removed by its placement, not to cache it.", attr.first.c_str(),
+             op_desc->GetName().c_str());
+      return;
+    }
+  }
+  for (const auto &attr : attrs_after) {
+    auto iter = attrs_before.find(attr.first);
+    if ((iter == attrs_before.end()) || !(iter->second == attr.second)) {
+      placement.attrs.emplace(attr.first, attr.second);
+    }
+  }
+  placement_miss_count_++;
+  std::lock_guard<std::mutex> placement_lock(placement_mutex_);
+  placement_cache_[placement_key] = std::move(placement);
 }
 
 const map<string, uint64_t> &DNNEngineManager::GetCheckSupportCost() const {
@@ -178,8 +271,6 @@ const map<string, uint64_t> &DNNEngineManager::GetCheckSupportCost() const {
 }
 
 std::string DNNEngineManager::GetDNNEngineName(const ge::NodePtr &node_ptr) {
-  std::lock_guard<std::mutex> lock(mutex_);
-
   GE_IF_BOOL_EXEC(node_ptr == nullptr, GELOGE(GE_CLI_GE_NOT_INITIALIZED, "DNNEngineManager: node_ptr is nullptr");
                   return "");
   auto op_desc = node_ptr->GetOpDesc();
@@ -191,7 +282,37 @@ std::string DNNEngineManager::GetDNNEngineName(const ge::NodePtr &node_ptr) {
     GELOGE(GE_CLI_GE_NOT_INITIALIZED, "GetDNNEngineName failed.");
     return "";
   }
-  OpsKernelManager &ops_kernel_manager = instance_ptr->OpsKernelManagerObj();
+
+  // Placement on host is decided by op type only, which is cheap enough to skip the cache
+  std::string placement_key;
+  bool use_cache = !ge::GetContext().GetHostExecFlag() && GeneratePlacementKey(op_desc, placement_key);
+  std::string engine_name;
+  if (use_cache && FindPlacement(placement_key, op_desc, engine_name)) {
+    return engine_name;
+  }
+
+  // CheckSupported of kernel info stores is not promised to be reentrant
+  std::lock_guard<std::mutex> lock(mutex_);
+  // the same placement may be made by another thread while waiting for the lock
+  if (use_cache && FindPlacement(placement_key, op_desc, engine_name)) {
+    return engine_name;
+  }
+  std::map<std::string, GeAttrValue> attrs_before;
+  std::string descs_before;
+  if (use_cache) {
+    attrs_before = op_desc->GetAllAttrs();
+    OpSignature::AppendTensorDescs(descs_before, op_desc);
+  }
+  engine_name = DoGetDNNEngineName(node_ptr, op_desc, *instance_ptr);
+  if (use_cache && !engine_name.empty()) {
+    AddPlacement(placement_key, op_desc, engine_name, attrs_before, descs_before);
+  }
+  return engine_name;
+}
+
+std::string DNNEngineManager::DoGetDNNEngineName(const ge::NodePtr &node_ptr, const OpDescPtr &op_desc,
+                                                 GELib &instance) {
+  OpsKernelManager &ops_kernel_manager = instance.OpsKernelManagerObj();
   std::vector<OpInfo> op_infos = ops_kernel_manager.GetOpsKernelInfo(op_desc->GetType());
   if (op_infos.empty()) {
     GELOGI("DNNEngineManager: Can not get op info by op type %s", op_desc->GetType().c_str());
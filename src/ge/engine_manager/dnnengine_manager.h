@@ -17,9 +17,11 @@
 #ifndef GE_ENGINE_MANAGER_DNNENGINE_MANAGER_H_
 #define GE_ENGINE_MANAGER_DNNENGINE_MANAGER_H_
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <mutex>
 
@@ -57,6 +59,8 @@ struct SchedulerConf {
 
 using DNNEnginePtr = std::shared_ptr<DNNEngine>;
 
+class GELib;
+
 class DNNEngineManager {
  public:
   friend class GELib;
@@ -66,7 +70,11 @@ class DNNEngineManager {
   string GetDNNEngineName(const ge::NodePtr &node_ptr);
   const map<string, SchedulerConf> &GetSchedulers() const;
   const map<string, uint64_t> &GetCheckSupportCost() const;
+  // real paths of the engine libraries loaded
+  const std::vector<std::string> &GetEngineSoPaths() const { return plugin_mgr_.GetSoPathList(); }
   void InitPerformanceStaistic();
+  // Placements reused from and added to the placement cache since last InitPerformanceStaistic
+  void GetPlacementCacheStatistic(uint64_t &hit_count, uint64_t &miss_count) const;
 
  private:
   DNNEngineManager();
@@ -79,6 +87,12 @@ class DNNEngineManager {
                              map<string, EngineConfPtr> &engines);
   Status CheckJsonFile();
   std::string GetHostCpuEngineName(const std::vector<OpInfo> &op_infos, const OpDescPtr &op_desc) const;
+  std::string DoGetDNNEngineName(const ge::NodePtr &node_ptr, const OpDescPtr &op_desc, GELib &instance);
+  static bool GeneratePlacementKey(const OpDescPtr &op_desc, std::string &placement_key);
+  bool FindPlacement(const std::string &placement_key, const OpDescPtr &op_desc, std::string &engine_name);
+  void AddPlacement(const std::string &placement_key, const OpDescPtr &op_desc, const std::string &engine_name,
+                    const std::map<std::string, GeAttrValue> &attrs_before, const std::string &descs_before);
+  void ClearPlacementCache();
   PluginManager plugin_mgr_;
   std::map<std::string, DNNEnginePtr> engines_map_;
   std::map<std::string, ge::DNNEngineAttribute> engines_attrs_map_;
@@ -86,6 +100,18 @@ class DNNEngineManager {
   std::map<string, uint64_t> checksupport_cost_;
   bool init_flag_;
   mutable std::mutex mutex_;
+
+  // placement of a node, with the attrs the kernel info store wrote on the op desc while checking it
+  struct Placement {
+    std::string engine_name;
+    std::string kernel_lib_name;
+    std::map<std::string, GeAttrValue> attrs;
+  };
+  // Placement of nodes keyed by op signature and the options affecting CheckSupported
+  std::unordered_map<std::string, Placement> placement_cache_;
+  std::mutex placement_mutex_;
+  std::atomic<uint64_t> placement_hit_count_{0};
+  std::atomic<uint64_t> placement_miss_count_{0};
 };
 }  // namespace ge
 
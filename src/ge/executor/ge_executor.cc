@@ -19,6 +19,8 @@
 #include <cce/compiler_stub.h>
 #include <ctime>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include "common/debug/log.h"
 #include "common/ge/ge_util.h"
 #include "common/helper/model_helper.h"
@@ -31,6 +33,7 @@
 #include "graph/load/graph_loader.h"
 #include "graph/load/new_model_manager/davinci_model_parser.h"
 #include "graph/load/new_model_manager/model_manager.h"
+#include "graph/manager/graph_manager_utils.h"
 #include "graph/manager/graph_mem_allocator.h"
 #include "graph/model.h"
 #include "graph/utils/graph_utils.h"
@@ -49,6 +52,10 @@ const size_t kDynamicImageSizeVecSize = 2;
 const size_t kDynamicImageSizeInputSize = 2;
 const char *const kBatchLabel = "Batch_";
 
+// buffers bound to loaded models by RegisterIoBinding, keyed by model id
+std::mutex io_binding_mutex;
+std::map<uint32_t, ge::GraphIoBinding> io_bindings;
+
 ge::Status TransferDomiErrorCode(const uint32_t errorCode) {
   switch (errorCode) {
     case ge::PARAM_INVALID:
@@ -590,6 +597,7 @@ Status GeExecutor::UnloadModel(uint32_t model_id) {
     uint64_t session_id = davinci_model->GetSessionId();
     VarManagerPool::Instance().RemoveVarManager(session_id);
   }
+  (void)UnregisterIoBinding(model_id);
   return GraphLoader::UnloadModel(model_id);
 }
 
@@ -952,6 +960,57 @@ Status GeExecutor::ExecModel(uint32_t model_id, void *stream, const ge::RunModel
   return GraphLoader::ExecuteModel(model_id, stream, async_mode, input_data, output_data);
 }
 
+Status GeExecutor::RegisterIoBinding(uint32_t model_id, const std::vector<DataBuffer> &inputs,
+                                     const std::vector<GeTensorDesc> &input_desc,
+                                     const std::vector<DataBuffer> &outputs, bool is_device_memory) {
+  if (!isInit_) {
+    GELOGE(GE_EXEC_NOT_INIT, "GeExecutor has not been initialized!");
+    return GE_EXEC_NOT_INIT;
+  }
+  GraphIoBinding io_binding;
+  io_binding.inputs = inputs;
+  io_binding.input_desc = input_desc;
+  io_binding.outputs = outputs;
+  io_binding.is_device_memory = is_device_memory;
+  if (GraphExecutor::CheckIoBinding(io_binding) != SUCCESS) {
+    GELOGE(PARAM_INVALID, "Io binding of model %u is invalid.", model_id);
+    return PARAM_INVALID;
+  }
+
+  std::lock_guard<std::mutex> lock(io_binding_mutex);
+  io_bindings[model_id] = io_binding;
+  GELOGI("Register io binding of model %u, input num = %zu, output num = %zu, device memory = %d.", model_id,
+         inputs.size(), outputs.size(), is_device_memory);
+  return SUCCESS;
+}
+
+Status GeExecutor::UnregisterIoBinding(uint32_t model_id) {
+  std::lock_guard<std::mutex> lock(io_binding_mutex);
+  if (io_bindings.erase(model_id) > 0) {
+    GELOGI("Unregister io binding of model %u.", model_id);
+  }
+  return SUCCESS;
+}
+
+Status GeExecutor::ExecModelWithIoBinding(uint32_t model_id, void *stream, std::vector<GeTensorDesc> &output_desc) {
+  GELOGI("Execute model with io binding begin.");
+  if (!isInit_) {
+    GELOGE(GE_EXEC_NOT_INIT, "GeExecutor has not been initialized!");
+    return GE_EXEC_NOT_INIT;
+  }
+  GraphIoBinding io_binding;
+  {
+    std::lock_guard<std::mutex> lock(io_binding_mutex);
+    auto iter = io_bindings.find(model_id);
+    if (iter == io_bindings.end()) {
+      GELOGE(PARAM_INVALID, "Io binding of model %u is not registered.", model_id);
+      return PARAM_INVALID;
+    }
+    io_binding = iter->second;
+  }
+  return GraphExecutor::ExecuteModelWithIoBinding(model_id, stream, io_binding, output_desc);
+}
+
 /**
 * @ingroup ge
 * @brief Get weight memory size from model file
@@ -9,6 +9,7 @@ local_ge_executor_src_files :=  \
     ../common/ge/plugin_manager.cc \
     ../common/ge/op_tiling_manager.cc \
     ../graph/load/graph_loader.cc \
+    ../graph/common/op_signature.cc \
     ../graph/execute/graph_execute.cc \
     ../omm/csa_interact.cc \
     ../graph/manager/graph_manager_utils.cc \
@@ -29,6 +30,7 @@ local_ge_executor_src_files :=  \
     ../graph/load/new_model_manager/aipp_utils.cc \
     ../graph/load/new_model_manager/data_inputer.cc \
     ../graph/load/new_model_manager/data_dumper.cc \
+    ../graph/load/new_model_manager/task_args_arena.cc \
     ../graph/load/new_model_manager/zero_copy_task.cc \
     ../graph/load/new_model_manager/zero_copy_offset.cc \
     ../graph/load/new_model_manager/task_info/task_info.cc                  \
@@ -53,7 +55,9 @@ local_ge_executor_src_files :=  \
     ../single_op/single_op_manager.cc \
     ../single_op/single_op_model.cc \
     ../single_op/single_op.cc \
+    ../single_op/compiled_single_op.cc \
     ../single_op/stream_resource.cc \
+    ../single_op/workspace_arena.cc \
     ../single_op/task/op_task.cc \
     ../single_op/task/build_task_utils.cc \
     ../single_op/task/tbe_task_builder.cc \
@@ -56,10 +56,12 @@ GRAPH_MANAGER_LOCAL_SRC_FILES := \
     graph/build/graph_builder.cc \
     graph/partition/engine_place.cc \
     graph/partition/graph_partition.cc \
+    graph/partition/optimized_partition_cache.cc \
     graph/partition/dynamic_shape_partition.cc \
     generator/ge_generator.cc \
     generator/generator_api.cc \
     graph/manager/graph_var_manager.cc \
+    graph/manager/var_checkpoint_engine.cc \
     graph/manager/rdma_pool_allocator.cc \
     graph/manager/graph_mem_allocator.cc \
     graph/manager/graph_caching_allocator.cc \
@@ -82,6 +84,7 @@ OMG_HOST_SRC_FILES := \
     graph/passes/base_pass.cc \
     graph/passes/bitcast_pass.cc \
     graph/passes/constant_folding_pass.cc \
+    graph/passes/constant_folding_cache.cc \
     graph/passes/aicpu_constant_folding_pass.cc \
     graph/passes/reshape_remove_pass.cc \
     graph/passes/reshape_recovery_pass.cc \
@@ -109,6 +112,7 @@ OMG_HOST_SRC_FILES := \
     graph/common/omg_util.cc \
     graph/common/bcast.cc \
     graph/common/local_context.cc \
+    graph/common/op_signature.cc \
     graph/passes/dimension_compute_pass.cc \
     graph/passes/dimension_adjust_pass.cc \
     graph/passes/get_original_format_pass.cc \
@@ -223,6 +227,7 @@ OME_HOST_SRC_FILES := \
     graph/load/new_model_manager/aipp_utils.cc                           \
     graph/load/new_model_manager/tbe_handle_store.cc                     \
     graph/load/new_model_manager/cpu_queue_schedule.cc                   \
+    graph/load/new_model_manager/task_args_arena.cc                      \
     graph/load/new_model_manager/zero_copy_task.cc                       \
     graph/load/new_model_manager/zero_copy_offset.cc                     \
     graph/load/new_model_manager/data_dumper.cc                          \
@@ -252,7 +257,9 @@ OME_HOST_SRC_FILES := \
     single_op/task/aicpu_kernel_task_builder.cc                          \
     single_op/single_op.cc                                               \
     single_op/single_op_model.cc                                         \
+    single_op/compiled_single_op.cc                                      \
     single_op/stream_resource.cc                                         \
+    single_op/workspace_arena.cc                                         \
     single_op/single_op_manager.cc                                       \
     hybrid/hybrid_davinci_model_stub.cc                                  \
     hybrid/node_executor/aicpu/aicpu_ext_info.cc                         \
@@ -16,6 +16,7 @@
 
 #include "host_cpu_engine.h"
 #include <dlfcn.h>
+#include <algorithm>
 #include "graph/common/omg_util.h"
 #include "graph/utils/op_desc_utils.h"
 #include "graph/utils/tensor_adapter.h"
@@ -26,6 +27,9 @@
 #include "graph/utils/type_utils.h"
 #include "common/fp16_t.h"
 #include "common/math/math_util.h"
+#include "framework/common/util.h"
+#include "ge/ge_api_types.h"
+#include "graph/common/ge_call_wrapper.h"
 
 namespace {
 #define CREATE_OUTPUT_CASE(DTYPE, TYPE)                                                                               \
@@ -85,12 +89,33 @@ namespace {
     named_outputs.emplace(tensor_name, tensor);                                                                       \
     break;                                                                                                            \
   }
+
+#define SUPPORTED_OUTPUT_CASE(DTYPE, TYPE) \
+  case (DTYPE):                            \
+    return true;
+
+// output data types the host cpu kernels are able to produce
+#define HOST_CPU_OUTPUT_DATA_TYPES(OUTPUT_CASE) \
+  OUTPUT_CASE(DT_BOOL, bool)                    \
+  OUTPUT_CASE(DT_INT8, int8_t)                  \
+  OUTPUT_CASE(DT_INT16, int16_t)                \
+  OUTPUT_CASE(DT_INT32, int32_t)                \
+  OUTPUT_CASE(DT_INT64, int64_t)                \
+  OUTPUT_CASE(DT_UINT8, uint8_t)                \
+  OUTPUT_CASE(DT_UINT16, uint16_t)              \
+  OUTPUT_CASE(DT_UINT32, uint32_t)              \
+  OUTPUT_CASE(DT_UINT64, uint64_t)              \
+  OUTPUT_CASE(DT_FLOAT16, fp16_t)               \
+  OUTPUT_CASE(DT_FLOAT, float)                  \
+  OUTPUT_CASE(DT_DOUBLE, double)
 }  // namespace
 
 namespace ge {
 namespace {
 const char *kEnvKeyOppPath = "ASCEND_OPP_PATH";
 const char *kHostCpuLibRelativePath = "/op_impl/built-in/host_cpu";
+const char *kOpLibCacheFileName = "host_cpu_op_libs.cache";
+const char kOpLibCacheSeparator = '\t';
 }  // namespace
 
 void HostCpuEngine::CloseSo() {
@@ -102,7 +127,7 @@ void HostCpuEngine::CloseSo() {
   lib_handles_.clear();
 }
 
-ge::Status HostCpuEngine::Initialize() {
+ge::Status HostCpuEngine::Initialize(const std::map<std::string, std::string> &options) {
   std::lock_guard<std::mutex> lock(mu_);
   if (initialized_) {
     GELOGI("HostCpuEngine is already initialized");
@@ -113,16 +138,26 @@ ge::Status HostCpuEngine::Initialize() {
 
   std::vector<std::string> so_paths;
   if (ListSoFiles(lib_dir, so_paths) == SUCCESS) {
-    (void)LoadLibs(so_paths);
+    auto iter = options.find(OPTION_EXEC_FAST_STARTUP);
+    if ((iter != options.end()) && (iter->second == "1")) {
+      InitLazyLoad(so_paths, options);
+    } else {
+      (void)LoadLibs(so_paths);
+    }
   }
 
   initialized_ = true;
   return SUCCESS;
 }
 
-void HostCpuEngine::Finalize() { GELOGI("start HostCpuEngine::Finalize"); }
+void HostCpuEngine::Finalize() {
+  GELOGI("start HostCpuEngine::Finalize");
+  std::lock_guard<std::mutex> lock(mu_);
+  SaveOpLibCache();
+}
 
 bool HostCpuEngine::CheckSupported(const string &op_type) {
+  GetInstance().EnsureOpKernelLoaded(op_type);
   return OpKernelRegistry::GetInstance().IsRegistered(op_type);
 }
 
@@ -131,6 +166,7 @@ Status HostCpuEngine::FindOpKernel(const ge::NodePtr &node, std::unique_ptr<Host
   auto status = GetOriginalType(node, op_type);
   GE_CHK_BOOL_EXEC_NOLOG(status == SUCCESS, return status);
 
+  GetInstance().EnsureOpKernelLoaded(op_type);
   auto kernel = OpKernelRegistry::GetInstance().CreateHostCpuOp(op_type);
   if (kernel == nullptr) {
     GELOGD("Op of type %s is not supported by host cpu engine", op_type.c_str());
@@ -177,18 +213,7 @@ Status HostCpuEngine::PrepareOutputs(const ge::ConstOpDescPtr &op_desc, vector<G
   for (size_t i = 0; i < op_desc->GetOutputsSize(); ++i) {
     const auto &out_desc = op_desc->GetOutputDesc(i);
     switch (out_desc.GetDataType()) {
-      CREATE_OUTPUT_CASE(DT_BOOL, bool)
-      CREATE_OUTPUT_CASE(DT_INT8, int8_t)
-      CREATE_OUTPUT_CASE(DT_INT16, int16_t)
-      CREATE_OUTPUT_CASE(DT_INT32, int32_t)
-      CREATE_OUTPUT_CASE(DT_INT64, int64_t)
-      CREATE_OUTPUT_CASE(DT_UINT8, uint8_t)
-      CREATE_OUTPUT_CASE(DT_UINT16, uint16_t)
-      CREATE_OUTPUT_CASE(DT_UINT32, uint32_t)
-      CREATE_OUTPUT_CASE(DT_UINT64, uint64_t)
-      CREATE_OUTPUT_CASE(DT_FLOAT16, fp16_t)
-      CREATE_OUTPUT_CASE(DT_FLOAT, float)
-      CREATE_OUTPUT_CASE(DT_DOUBLE, double)
+      HOST_CPU_OUTPUT_DATA_TYPES(CREATE_OUTPUT_CASE)
       default:
         GELOGE(PARAM_INVALID, "data type %s not support.",
                TypeUtils::DataTypeToSerialString(out_desc.GetDataType()).c_str());
@@ -199,6 +224,14 @@ Status HostCpuEngine::PrepareOutputs(const ge::ConstOpDescPtr &op_desc, vector<G
   return SUCCESS;
 }
 
+bool HostCpuEngine::IsOutputDataTypeSupported(DataType data_type) {
+  switch (data_type) {
+    HOST_CPU_OUTPUT_DATA_TYPES(SUPPORTED_OUTPUT_CASE)
+    default:
+      return false;
+  }
+}
+
 Status HostCpuEngine::RunInternal(const ge::OpDescPtr &op_desc, HostCpuOp &op_kernel,
                                   map<std::string, const Tensor> &named_inputs,
                                   map<std::string, Tensor> &named_outputs) {
@@ -325,6 +358,121 @@ Status HostCpuEngine::LoadLib(const std::string &lib_path) {
   return SUCCESS;
 }
 
+void HostCpuEngine::InitLazyLoad(std::vector<std::string> &lib_paths, const std::map<std::string, std::string> &options) {
+  // libs are searched in a fixed order, so the same op type always resolves to the same lib
+  std::sort(lib_paths.begin(), lib_paths.end());
+  for (auto &lib_path : lib_paths) {
+    if (GetRealPath(lib_path) == SUCCESS) {
+      pending_lib_paths_.emplace_back(lib_path);
+    }
+  }
+  lib_fingerprint_ = PluginManager::GetFingerprint(pending_lib_paths_);
+  all_libs_loaded_.store(pending_lib_paths_.empty(), std::memory_order_release);
+
+  auto iter = options.find(OPTION_EXEC_STARTUP_CACHE_PATH);
+  if ((iter != options.end()) && !iter->second.empty()) {
+    op_lib_cache_file_ = iter->second + "/" + kOpLibCacheFileName;
+    LoadOpLibCache();
+  }
+  lazy_load_.store(true, std::memory_order_release);
+  GELOGI("Loading of %zu host cpu libs is deferred, %zu op types are found in cache", pending_lib_paths_.size(),
+         op_lib_cache_.size());
+}
+
+void HostCpuEngine::EnsureOpKernelLoaded(const std::string &op_type) {
+  if (!lazy_load_.load(std::memory_order_acquire)) {
+    return;
+  }
+  // the libs in cache are loaded together on the first lookup, later lookups of their op types take no lock
+  std::call_once(cached_libs_flag_, [this]() { LoadCachedLibs(); });
+  auto &registry = OpKernelRegistry::GetInstance();
+  if (registry.IsRegistered(op_type) || all_libs_loaded_.load(std::memory_order_acquire)) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mu_);
+  if (registry.IsRegistered(op_type)) {
+    return;
+  }
+  auto iter = op_lib_cache_.find(op_type);
+  if (iter != op_lib_cache_.end()) {
+    if (iter->second.empty()) {
+      return;
+    }
+    LoadPendingLib(iter->second);
+    if (registry.IsRegistered(op_type)) {
+      return;
+    }
+    GELOGW("Op type %s is not registered by lib %s as cached, search all libs", op_type.c_str(),
+           iter->second.c_str());
+  }
+
+  // load the rest libs one by one until one of them registers the op type, so that it can be cached
+  std::string lib_registering_op;
+  while (!pending_lib_paths_.empty()) {
+    std::string lib_path = pending_lib_paths_.front();
+    LoadPendingLib(lib_path);
+    if (registry.IsRegistered(op_type)) {
+      lib_registering_op = lib_path;
+      break;
+    }
+  }
+  op_lib_cache_[op_type] = lib_registering_op;
+  op_lib_cache_dirty_ = true;
+}
+
+void HostCpuEngine::LoadCachedLibs() {
+  std::lock_guard<std::mutex> lock(mu_);
+  GE_TIMESTAMP_START(LoadCachedLibs);
+  for (const auto &op_and_lib : op_lib_cache_) {
+    if (!op_and_lib.second.empty()) {
+      LoadPendingLib(op_and_lib.second);
+    }
+  }
+  GE_TIMESTAMP_EVENT_END(LoadCachedLibs, "HostCpuEngine::LoadCachedLibs");
+}
+
+void HostCpuEngine::LoadPendingLib(const std::string &lib_path) {
+  auto iter = std::find(pending_lib_paths_.begin(), pending_lib_paths_.end(), lib_path);
+  if (iter == pending_lib_paths_.end()) {
+    return;
+  }
+  (void)pending_lib_paths_.erase(iter);
+  GE_TIMESTAMP_START(LoadLib);
+  (void)LoadLib(lib_path);
+  GE_TIMESTAMP_EVENT_END(LoadLib, "HostCpuEngine::LoadLib");
+  if (pending_lib_paths_.empty()) {
+    all_libs_loaded_.store(true, std::memory_order_release);
+  }
+}
+
+void HostCpuEngine::LoadOpLibCache() {
+  std::vector<std::string> lines;
+  PluginManager::LoadStartupCache(op_lib_cache_file_, lib_fingerprint_, lines);
+  for (const auto &line : lines) {
+    auto pos = line.find(kOpLibCacheSeparator);
+    if (pos == std::string::npos) {
+      continue;
+    }
+    op_lib_cache_[line.substr(0, pos)] = line.substr(pos + 1);
+  }
+}
+
+void HostCpuEngine::SaveOpLibCache() {
+  if (op_lib_cache_file_.empty() || !op_lib_cache_dirty_) {
+    return;
+  }
+  std::vector<std::string> lines;
+  for (const auto &op_and_lib : op_lib_cache_) {
+    lines.emplace_back(op_and_lib.first + kOpLibCacheSeparator + op_and_lib.second);
+  }
+  if (PluginManager::SaveStartupCache(op_lib_cache_file_, lib_fingerprint_, lines) != SUCCESS) {
+    return;
+  }
+  op_lib_cache_dirty_ = false;
+  GELOGI("Host cpu op lib cache saved, %zu op types cached.", op_lib_cache_.size());
+}
+
 Status HostCpuEngine::GetRealPath(std::string &path) {
   std::string real_path = RealPath(path.c_str());
   if (real_path.empty()) {
@@ -17,7 +17,11 @@
 #ifndef GE_GE_LOCAL_ENGINE_ENGINE_HOST_CPU_ENGINE_H_
 #define GE_GE_LOCAL_ENGINE_ENGINE_HOST_CPU_ENGINE_H_
 
+#include <atomic>
+#include <map>
 #include <mutex>
+#include <string>
+#include <vector>
 #include "framework/common/ge_inner_error_codes.h"
 #include "graph/node.h"
 #include "graph/operator.h"
@@ -33,7 +37,13 @@ class HostCpuEngine {
     return instance;
   }
 
-  ge::Status Initialize();
+  ///
+  /// @ingroup ge
+  /// @brief load the host cpu op libraries, in fast startup mode a library is only loaded when one of its op types
+  ///        is first looked up, and the op type to library mapping is kept in the startup cache if configured. The
+  ///        libraries named in the cache are loaded together on the first lookup
+  ///
+  ge::Status Initialize(const std::map<std::string, std::string> &options = {});
 
   void Finalize();
 
@@ -41,6 +51,18 @@ class HostCpuEngine {
 
   ge::Status Run(NodePtr &node, const vector<ConstGeTensorPtr> &inputs, std::vector<GeTensorPtr> &outputs);
 
+  ///
+  /// @ingroup ge
+  /// @brief whether the host cpu kernels are able to produce an output of the data type
+  ///
+  static bool IsOutputDataTypeSupported(DataType data_type);
+
+  static ge::Status FindOpKernel(const NodePtr &node, std::unique_ptr<HostCpuOp> &op_kernel);
+
+  static ge::Status RunInternal(const OpDescPtr &op_desc, HostCpuOp &op_kernel,
+                                std::map<std::string, const Tensor> &named_inputs,
+                                std::map<std::string, Tensor> &named_outputs);
+
  private:
   HostCpuEngine() = default;
 
@@ -50,6 +72,18 @@ class HostCpuEngine {
 
   ge::Status LoadLib(const std::string &lib_path);
 
+  void InitLazyLoad(std::vector<std::string> &lib_paths, const std::map<std::string, std::string> &options);
+
+  void EnsureOpKernelLoaded(const std::string &op_type);
+
+  void LoadCachedLibs();
+
+  void LoadPendingLib(const std::string &lib_path);
+
+  void LoadOpLibCache();
+
+  void SaveOpLibCache();
+
   static ge::Status GetRealPath(std::string &path);
 
   static ge::Status GetLibPath(std::string &lib_path);
@@ -58,21 +92,27 @@ class HostCpuEngine {
 
   static bool IsSoFile(const std::string &file_name);
 
-  static ge::Status FindOpKernel(const NodePtr &node, std::unique_ptr<HostCpuOp> &op_kernel);
-
   static ge::Status PrepareInputs(const ConstOpDescPtr &op_desc, const vector<ConstGeTensorPtr> &inputs,
                                   std::map<std::string, const Tensor> &named_inputs);
 
   static ge::Status PrepareOutputs(const ConstOpDescPtr &op_desc, vector<GeTensorPtr> &outputs,
                                    std::map<std::string, Tensor> &named_outputs);
 
-  static ge::Status RunInternal(const OpDescPtr &op_desc, HostCpuOp &op_kernel,
-                                std::map<std::string, const Tensor> &named_inputs,
-                                std::map<std::string, Tensor> &named_outputs);
-
   std::mutex mu_;
   std::vector<void *> lib_handles_;
   bool initialized_ = false;
+
+  // fast startup mode, libs are loaded on demand
+  std::atomic<bool> lazy_load_{false};
+  std::once_flag cached_libs_flag_;
+  // no lib is left to search, lookups of the op types no lib registers take no lock either
+  std::atomic<bool> all_libs_loaded_{false};
+  std::vector<std::string> pending_lib_paths_;
+  // op type -> path of the lib registering it, empty if no lib does
+  std::map<std::string, std::string> op_lib_cache_;
+  std::string op_lib_cache_file_;
+  std::string lib_fingerprint_;
+  bool op_lib_cache_dirty_ = false;
 };
 }  // namespace ge
 #endif  // GE_GE_LOCAL_ENGINE_ENGINE_HOST_CPU_ENGINE_H_
@@ -43,6 +43,7 @@ LIBGE_LOCAL_SRC_FILES := \
     graph/build/task_generator.cc \
     graph/common/bcast.cc \
     graph/common/local_context.cc \
+    graph/common/op_signature.cc \
     graph/common/omg_util.cc \
     graph/common/transop_util.cc \
     graph/execute/graph_execute.cc \
@@ -81,6 +82,7 @@ LIBGE_LOCAL_SRC_FILES := \
     graph/load/new_model_manager/task_info/super_kernel/super_kernel_factory.cc   \
     graph/load/new_model_manager/task_info/task_info.cc \
     graph/load/new_model_manager/tbe_handle_store.cc \
+    graph/load/new_model_manager/task_args_arena.cc \
     graph/load/new_model_manager/zero_copy_task.cc \
     graph/load/new_model_manager/zero_copy_offset.cc    \
     graph/manager/graph_context.cc \
@@ -92,6 +94,7 @@ LIBGE_LOCAL_SRC_FILES := \
     graph/manager/rdma_pool_allocator.cc \
     graph/manager/model_manager/event_manager.cc        \
     graph/manager/trans_var_data_utils.cc \
+    graph/manager/var_checkpoint_engine.cc \
     graph/manager/util/debug.cc                       \
     graph/manager/util/hcom_util.cc                 \
     graph/manager/util/rt_context_util.cc               \
@@ -101,6 +104,7 @@ LIBGE_LOCAL_SRC_FILES := \
     graph/optimize/summary_optimize.cc \
     graph/partition/engine_place.cc \
     graph/partition/graph_partition.cc \
+    graph/partition/optimized_partition_cache.cc \
     graph/passes/addn_pass.cc \
     graph/passes/aicpu_constant_folding_pass.cc \
     graph/passes/assert_pass.cc \
@@ -117,6 +121,7 @@ LIBGE_LOCAL_SRC_FILES := \
     graph/passes/transop_symmetry_elimination_pass.cc \
     graph/passes/compile_nodes_pass.cc \
     graph/passes/constant_folding_pass.cc \
+    graph/passes/constant_folding_cache.cc \
     graph/passes/constant_fuse_same_pass.cc \
     graph/passes/control_trigger_pass.cc \
     graph/passes/dimension_adjust_pass.cc \
@@ -245,7 +250,9 @@ LIBGE_LOCAL_SRC_FILES := \
     single_op/single_op.cc \
     single_op/single_op_manager.cc \
     single_op/single_op_model.cc \
+    single_op/compiled_single_op.cc \
     single_op/stream_resource.cc \
+    single_op/workspace_arena.cc \
     single_op/task/build_task_utils.cc \
     single_op/task/op_task.cc \
     single_op/task/tbe_task_builder.cc \
@@ -253,9 +260,11 @@ LIBGE_LOCAL_SRC_FILES := \
     single_op/task/aicpu_kernel_task_builder.cc \
     hybrid/common/tensor_value.cc                                        \
     hybrid/common/npu_memory_allocator.cc                                \
+    hybrid/executor/args_staging_ring.cc                                 \
     hybrid/executor/rt_callback_manager.cc                               \
     hybrid/executor/node_state.cc                                        \
     hybrid/executor/node_done_manager.cc                                 \
+    hybrid/executor/shape_plan_cache.cc                                  \
     hybrid/executor/hybrid_profiler.cc                                   \
     hybrid/executor/hybrid_model_executor.cc                             \
     hybrid/executor/hybrid_model_async_executor.cc                       \
@@ -205,28 +205,46 @@ void MemoryBlock::AddLifeReuseBlock(MemoryBlock *block, DependStreamLife &total_
     AddContinuousLifeReuseBlock(block, total_node_depend_stream_life);
     return;
   }
+  if (block->GetDependLifeBegin(stream_id_, total_node_depend_stream_life) > GetLifeEnd()) {
+    (void)MergeLifeReuseBlock(block);
+  }
+}
+
+bool MemoryBlock::AddLifeReuseBlockByEvent(MemoryBlock *block) {
+  if (CanNotLifeReuse(this) || CanNotLifeReuse(block) || continuous_block_ || block->continuous_block_) {
+    return false;
+  }
+  // the caller makes the first node of block wait for the last users of this block
+  if ((stream_id_ < 0) || (block->stream_id_ < 0) || (stream_id_ == block->stream_id_) ||
+      (block->GetLifeBegin() <= GetLifeEnd())) {
+    return false;
+  }
+  return MergeLifeReuseBlock(block);
+}
+
+bool MemoryBlock::MergeLifeReuseBlock(MemoryBlock *block) {
   MemoryBlock *parent = nullptr;
   MemoryBlock *child = nullptr;
   // merge small block to large block
-  if (block->GetDependLifeBegin(stream_id_, total_node_depend_stream_life) > GetLifeEnd()) {
-    if ((child_offset_ + block->AlignSize()) <= AlignSize()) {
-      parent = this;
-      child = block;
-    } else if ((block->child_offset_ + AlignSize()) <= block->AlignSize()) {
-      parent = block;
-      child = this;
-    }
-  }
-  if ((parent != nullptr) && (child != nullptr) && child->child_blocks_.empty()) {
-    parent->child_blocks_.emplace_back(child);
-    parent->child_offset_ += child->AlignSize();
-    child->deleted_block_ = true;
-    GELOGI(
-      "Add block[%p size:%zu, stream id:%ld life time[begin:%zu, end:%zu]] to"
-      " block[%p size:%zu, stream id:%ld, life time[begin:%zu, end:%zu]]",
-      child, child->block_size_, child->stream_id_, child->GetLifeBegin(), child->GetLifeEnd(), parent,
-      parent->block_size_, parent->stream_id_, parent->GetLifeBegin(), parent->GetLifeEnd());
+  if ((child_offset_ + block->AlignSize()) <= AlignSize()) {
+    parent = this;
+    child = block;
+  } else if ((block->child_offset_ + AlignSize()) <= block->AlignSize()) {
+    parent = block;
+    child = this;
+  }
+  if ((parent == nullptr) || (child == nullptr) || !child->child_blocks_.empty()) {
+    return false;
   }
+  parent->child_blocks_.emplace_back(child);
+  parent->child_offset_ += child->AlignSize();
+  child->deleted_block_ = true;
+  GELOGI(
+    "Add block[%p size:%zu, stream id:%ld life time[begin:%zu, end:%zu]] to"
+    " block[%p size:%zu, stream id:%ld, life time[begin:%zu, end:%zu]]",
+    child, child->block_size_, child->stream_id_, child->GetLifeBegin(), child->GetLifeEnd(), parent,
+    parent->block_size_, parent->stream_id_, parent->GetLifeBegin(), parent->GetLifeEnd());
+  return true;
 }
 
 size_t MemoryBlock::GetLifeBegin() {
@@ -251,6 +269,8 @@ size_t MemoryBlock::GetLifeBegin() {
 /// |--block---|   |--block7--|
 /// |--block---|   |--block---|
 /// block7's first node's input node's life begin > block2's life end, block7 can reuse block1~block2
+/// The depend life also follows the node order on each stream, block7 depends on every node which is before
+/// any of its depended nodes on their own streams, since events keep that order across streams.
 size_t MemoryBlock::GetDependLifeBegin(int64_t stream_id, DependStreamLife &total_node_depend_stream_life) {
   AddDependLifeBegin(total_node_depend_stream_life);
   auto it = depend_stream_life_.find(stream_id);
@@ -260,64 +280,17 @@ size_t MemoryBlock::GetDependLifeBegin(int64_t stream_id, DependStreamLife &tota
   return it->second;
 }
 
-void AddDependLife(const ge::NodePtr &org_node, const ge::NodePtr &node, int64_t stream_id,
-                   std::map<int64_t, size_t> &depend_stream_life, DependStreamLife &total_node_depend_stream_life) {
-  GE_CHECK_NOTNULL_EXEC(node, return );
-  auto node_desc = node->GetOpDesc();
-  GE_CHECK_NOTNULL_EXEC(node_desc, return );
-  auto node_id = node_desc->GetId();
-  auto stream_life = total_node_depend_stream_life.find(node_id);
-  if (stream_life != total_node_depend_stream_life.end()) {
-    for (auto &it : stream_life->second) {
-      if (depend_stream_life.find(it.first) == depend_stream_life.end()) {
-        depend_stream_life[it.first] = it.second;
-      }
-    }
-    return;
-  }
-
-  for (const auto &in_anchor : node->GetAllInAnchors()) {
-    GE_CHECK_NOTNULL_EXEC(in_anchor, continue);
-    for (auto peer_out_anchor : in_anchor->GetPeerAnchors()) {
-      GE_CHECK_NOTNULL_EXEC(peer_out_anchor, continue);
-      auto peer_node = peer_out_anchor->GetOwnerNode();
-      GE_CHECK_NOTNULL_EXEC(peer_node, continue);
-      auto peer_node_desc = peer_node->GetOpDesc();
-      GE_CHECK_NOTNULL_EXEC(peer_node_desc, continue);
-      auto peer_node_stream_id = peer_node_desc->GetStreamId();
-      if (peer_node_stream_id < 0) {
-        continue;
-      }
-      size_t peer_node_life_time = peer_node_desc->GetId();
-      auto it = depend_stream_life.find(peer_node_stream_id);
-      if (it == depend_stream_life.end() || peer_node_life_time > it->second) {
-        depend_stream_life[peer_node_stream_id] = peer_node_life_time;
-        if (peer_node_stream_id != stream_id) {
-          GELOGI("Node:%s stream id:%ld depend node:%s stream id:%ld index[%d] life time[%zu].",
-                 org_node->GetName().c_str(), stream_id, peer_node_desc->GetName().c_str(), peer_node_stream_id,
-                 peer_out_anchor->GetIdx(), peer_node_life_time);
-        }
-        AddDependLife(org_node, peer_node, stream_id, depend_stream_life, total_node_depend_stream_life);
-      }
-    }
-  }
-
-  // save on node to save next calculation
-  for (auto &it : depend_stream_life) {
-    if (total_node_depend_stream_life[node_id].find(it.first) == total_node_depend_stream_life[node_id].end()) {
-      total_node_depend_stream_life[node_id][it.first] = it.second;
-    }
-  }
-}
-
 void MemoryBlock::AddDependLifeBegin(DependStreamLife &total_node_depend_stream_life) {
   if (!depend_stream_life_.empty()) {
     return;
   }
   if (!node_type_index_list_.empty()) {
     auto node = node_type_index_list_.front().node;
-    if (node != nullptr) {
-      AddDependLife(node, node, stream_id_, depend_stream_life_, total_node_depend_stream_life);
+    if ((node != nullptr) && (node->GetOpDesc() != nullptr)) {
+      auto it = total_node_depend_stream_life.find(node->GetOpDesc()->GetId());
+      if (it != total_node_depend_stream_life.end()) {
+        depend_stream_life_ = it->second;
+      }
     }
   }
   depend_stream_life_[stream_id_] = GetLifeBegin();
@@ -1437,11 +1410,200 @@ void BlockMemAssigner::AssignContinuousBlocks() {
   }
 }
 
+size_t GetTotalBlockSize(const vector<MemoryBlock *> &memory_blocks) {
+  size_t total_size = 0;
+  for (auto memory_block : memory_blocks) {
+    if ((memory_block != nullptr) && !memory_block->deleted_block_) {
+      total_size += memory_block->AlignSize();
+    }
+  }
+  return total_size;
+}
+
+///
+/// @ingroup GE
+/// @brief Build the happens-before relation of nodes over streams. Nodes on one stream run in the order of id,
+///        a cross stream data or control edge becomes a send/recv event pair, and OptimizeSyncEvents only removes
+///        events implied by the others. So every node depends on the latest node of each stream which is
+///        before one of its in nodes or the previous node on its own stream.
+///
+void BlockMemAssigner::InitDependStreamLife() {
+  total_node_depend_stream_life_.clear();
+  vector<NodePtr> nodes;
+  for (const auto &node : compute_graph_->GetAllNodes()) {
+    if ((node != nullptr) && (node->GetOpDesc() != nullptr)) {
+      nodes.emplace_back(node);
+    }
+  }
+  std::stable_sort(nodes.begin(), nodes.end(), [](const NodePtr &lhs, const NodePtr &rhs) {
+    return lhs->GetOpDesc()->GetId() < rhs->GetOpDesc()->GetId();
+  });
+
+  map<int64_t, int64_t> stream_last_node;
+  for (const auto &node : nodes) {
+    auto node_id = node->GetOpDesc()->GetId();
+    auto &depend_life = total_node_depend_stream_life_[node_id];
+    auto add_depend_node = [&depend_life, node_id, this](int64_t depend_id, int64_t depend_stream_id) {
+      if ((depend_id >= node_id) || (depend_stream_id < 0)) {
+        return;
+      }
+      size_t &life = depend_life[depend_stream_id];
+      life = std::max(life, static_cast<size_t>(depend_id));
+      auto it = total_node_depend_stream_life_.find(depend_id);
+      if (it == total_node_depend_stream_life_.end()) {
+        return;
+      }
+      for (const auto &stream_life : it->second) {
+        size_t &depend_stream_life = depend_life[stream_life.first];
+        depend_stream_life = std::max(depend_stream_life, stream_life.second);
+      }
+    };
+
+    for (const auto &in_node : node->GetInAllNodes()) {
+      if ((in_node != nullptr) && (in_node->GetOpDesc() != nullptr)) {
+        add_depend_node(in_node->GetOpDesc()->GetId(), in_node->GetOpDesc()->GetStreamId());
+      }
+    }
+    auto stream_id = node->GetOpDesc()->GetStreamId();
+    if (stream_id < 0) {
+      continue;
+    }
+    auto last_node = stream_last_node.find(stream_id);
+    if (last_node != stream_last_node.end()) {
+      add_depend_node(last_node->second, stream_id);
+    }
+    stream_last_node[stream_id] = node_id;
+  }
+}
+
+///
+/// @ingroup GE
+/// @brief Get the last user of block on each stream. The users are the nodes of the block and the consumers of its
+///        outputs. Fails when a user has no stream, the order to it can not be kept by an event.
+///
+bool GetStreamLastUsers(const MemoryBlock *block, map<int64_t, NodePtr> &stream_last_users) {
+  auto add_user = [&stream_last_users](const NodePtr &user) -> bool {
+    if ((user == nullptr) || (user->GetOpDesc() == nullptr) || (user->GetOpDesc()->GetStreamId() < 0)) {
+      return false;
+    }
+    auto &last_user = stream_last_users[user->GetOpDesc()->GetStreamId()];
+    if ((last_user == nullptr) || (last_user->GetOpDesc()->GetId() < user->GetOpDesc()->GetId())) {
+      last_user = user;
+    }
+    return true;
+  };
+  for (const auto &node_type_index : block->NodeTypeIndexList()) {
+    if (!add_user(node_type_index.node)) {
+      return false;
+    }
+    if (node_type_index.mem_type != kOutput) {
+      continue;
+    }
+    auto out_anchor = node_type_index.node->GetOutDataAnchor(node_type_index.index);
+    if (out_anchor == nullptr) {
+      return false;
+    }
+    for (const auto &peer_in_anchor : out_anchor->GetPeerInDataAnchors()) {
+      if ((peer_in_anchor == nullptr) || !add_user(peer_in_anchor->GetOwnerNode())) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool HasStreamLabel(const NodePtr &node) {
+  string stream_label;
+  return AttrUtils::GetStr(node->GetOpDesc(), ATTR_NAME_STREAM_LABEL, stream_label) && !stream_label.empty();
+}
+
+///
+/// @ingroup GE
+/// @brief Reuse block of another stream which is not ordered after the parent yet. The first node of the child
+///        waits for the last users of the parent on other streams by control edges, StreamAllocator inserts the
+///        events for them. Only nodes of one graph and without stream label are linked, and the edges follow the
+///        node order, so no cycle is made.
+///
+bool BlockMemAssigner::ReuseBlockByEvent(MemoryBlock *parent, MemoryBlock *child) {
+  if (CanNotLifeReuse(parent) || CanNotLifeReuse(child) || child->NodeTypeIndexList().empty()) {
+    return false;
+  }
+  // the last users are only collected for a child of another stream which begins after the parent ends
+  if ((parent->stream_id_ == child->stream_id_) || (child->GetLifeBegin() <= parent->GetLifeEnd())) {
+    return false;
+  }
+  const NodePtr &first_node = child->NodeTypeIndexList().front().node;
+  if ((first_node == nullptr) || (first_node->GetOpDesc() == nullptr) || HasStreamLabel(first_node)) {
+    return false;
+  }
+  map<int64_t, NodePtr> stream_last_users;
+  if (!GetStreamLastUsers(parent, stream_last_users)) {
+    return false;
+  }
+  auto first_node_id = first_node->GetOpDesc()->GetId();
+  auto first_node_stream_id = first_node->GetOpDesc()->GetStreamId();
+  vector<NodePtr> wait_nodes;
+  for (const auto &stream_last_user : stream_last_users) {
+    const NodePtr &last_user = stream_last_user.second;
+    if ((last_user->GetOpDesc()->GetId() >= first_node_id) ||
+        (last_user->GetOwnerComputeGraph() != first_node->GetOwnerComputeGraph()) || HasStreamLabel(last_user)) {
+      return false;
+    }
+    // nodes before the first node on its own stream are ordered by the stream
+    if (stream_last_user.first != first_node_stream_id) {
+      wait_nodes.emplace_back(last_user);
+    }
+  }
+  if (!parent->AddLifeReuseBlockByEvent(child)) {
+    return false;
+  }
+
+  auto &depend_stream_life = child->depend_stream_life_;
+  for (const auto &wait_node : wait_nodes) {
+    reuse_wait_edges_.emplace_back(wait_node, first_node);
+    auto wait_node_id = wait_node->GetOpDesc()->GetId();
+    size_t &life = depend_stream_life[wait_node->GetOpDesc()->GetStreamId()];
+    life = std::max(life, static_cast<size_t>(wait_node_id));
+    auto it = total_node_depend_stream_life_.find(wait_node_id);
+    if (it == total_node_depend_stream_life_.end()) {
+      continue;
+    }
+    for (const auto &stream_life : it->second) {
+      size_t &wait_stream_life = depend_stream_life[stream_life.first];
+      wait_stream_life = std::max(wait_stream_life, stream_life.second);
+    }
+  }
+  GELOGI("Node %s waits for %zu nodes of other streams to reuse their memory.", first_node->GetName().c_str(),
+         wait_nodes.size());
+  return true;
+}
+
+Status BlockMemAssigner::AddReuseWaitEdges() {
+  for (const auto &wait_edge : reuse_wait_edges_) {
+    const NodePtr &wait_node = wait_edge.first;
+    const NodePtr &node = wait_edge.second;
+    if (wait_node->GetOutControlAnchor()->IsLinkedWith(node->GetInControlAnchor())) {
+      continue;
+    }
+    if (GraphUtils::AddEdge(wait_node->GetOutControlAnchor(), node->GetInControlAnchor()) != GRAPH_SUCCESS) {
+      GELOGE(FAILED, "Add control edge from %s to %s for memory reuse failed.", wait_node->GetName().c_str(),
+             node->GetName().c_str());
+      return FAILED;
+    }
+  }
+  GELOGI("Add %zu control edges for memory reuse across streams.", reuse_wait_edges_.size());
+  return SUCCESS;
+}
+
 void BlockMemAssigner::ReuseBlocksByLifeTime(size_t range_size) {
   // 1 means block size is same so no need to do this
   if (range_size <= 1) {
     return;
   }
+  InitDependStreamLife();
+  reuse_wait_edges_.clear();
+  life_reuse_stat_ = LifeReuseStat();
+  life_reuse_stat_.size_before_reuse = GetTotalBlockSize(memory_blocks_);
   for (size_t i = 0; i < memory_blocks_.size(); ++i) {
     auto parent = memory_blocks_[i];
     if (parent == nullptr || parent->deleted_block_ || parent->continuous_block_) {
@@ -1462,9 +1624,46 @@ void BlockMemAssigner::ReuseBlocksByLifeTime(size_t range_size) {
           continue;
         }
       }
+      bool is_deleted = parent->deleted_block_ || child->deleted_block_;
       parent->AddLifeReuseBlock(child, total_node_depend_stream_life_);
+      if (!is_deleted && (parent->deleted_block_ || child->deleted_block_) &&
+          (parent->stream_id_ != child->stream_id_)) {
+        ++life_reuse_stat_.cross_stream_reuse_num;
+      }
     }
   }
+  life_reuse_stat_.size_after_ordered_reuse = GetTotalBlockSize(memory_blocks_);
+
+  // blocks left are not ordered after each other yet, reuse them by adding events
+  for (size_t i = 0; i < memory_blocks_.size(); ++i) {
+    auto parent = memory_blocks_[i];
+    if ((parent == nullptr) || parent->continuous_block_) {
+      continue;
+    }
+    for (size_t j = i + 1; j < memory_blocks_.size(); ++j) {
+      auto child = memory_blocks_[j];
+      if ((child == nullptr) || child->continuous_block_) {
+        continue;
+      }
+      if (parent->deleted_block_ || child->deleted_block_) {
+        continue;
+      }
+      // the events added before may already order the blocks
+      parent->AddLifeReuseBlock(child, total_node_depend_stream_life_);
+      if (parent->deleted_block_ || child->deleted_block_) {
+        ++life_reuse_stat_.cross_stream_reuse_num;
+      } else if (ReuseBlockByEvent(parent, child)) {
+        ++life_reuse_stat_.event_reuse_num;
+      }
+    }
+  }
+  life_reuse_stat_.size_after_reuse = GetTotalBlockSize(memory_blocks_);
+  life_reuse_stat_.wait_edge_num = reuse_wait_edges_.size();
+  GELOGI(
+    "Reuse blocks by life time, memory size before:%zu, after ordered reuse:%zu, after reuse by events:%zu, "
+    "blocks reused across streams:%zu, blocks reused by events:%zu, control edges for events:%zu.",
+    life_reuse_stat_.size_before_reuse, life_reuse_stat_.size_after_ordered_reuse, life_reuse_stat_.size_after_reuse,
+    life_reuse_stat_.cross_stream_reuse_num, life_reuse_stat_.event_reuse_num, life_reuse_stat_.wait_edge_num);
 }
 
 ///
@@ -1605,6 +1804,7 @@ Status BlockMemAssigner::Assign() {
   }
   GE_IF_BOOL_EXEC(ranges.empty(), return SUCCESS);
   AssignMemoryWithReuse(ranges);
+  GE_CHK_STATUS_RET(AddReuseWaitEdges(), "Add control edges for memory reuse failed.");
 
   SetOpMemOffset(false);
 
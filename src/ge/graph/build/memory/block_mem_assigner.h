@@ -38,6 +38,16 @@ using DependStreamLife = std::map<int64_t, std::map<int64_t, size_t>>;
 
 enum MemoryType { kOutput, kWorkspace };
 
+// memory size of blocks before and after reuse by life time, and the reuse across streams
+struct LifeReuseStat {
+  size_t size_before_reuse = 0;
+  size_t size_after_ordered_reuse = 0;
+  size_t size_after_reuse = 0;
+  size_t cross_stream_reuse_num = 0;
+  size_t event_reuse_num = 0;
+  size_t wait_edge_num = 0;
+};
+
 struct NodeTypeIndex {
   NodeTypeIndex(ge::NodePtr node, MemoryType mem_type, uint32_t index, bool ref_input = false)
       : node(std::move(node)), mem_type(mem_type), index(index), ref_input(ref_input) {}
@@ -124,6 +134,14 @@ class MemoryBlock {
 
   void AddLifeReuseBlock(MemoryBlock *block, DependStreamLife &node_depend_stream_life);
 
+  ///
+  /// @ingroup GE
+  /// @brief reuse block of another stream which begins after this block ends in node order but is not ordered
+  ///        after it by streams and events, the caller makes block wait for the last users of this block
+  /// @return bool whether the blocks are merged
+  ///
+  bool AddLifeReuseBlockByEvent(MemoryBlock *block);
+
   void SetLifeTimeEnd(size_t time);
 
   size_t GetLifeBegin();
@@ -146,6 +164,8 @@ class MemoryBlock {
   std::map<int64_t, size_t> depend_stream_life_;
 
  private:
+  bool MergeLifeReuseBlock(MemoryBlock *block);
+
   size_t block_size_;
   std::vector<size_t> real_size_list_;
   std::vector<size_t> no_align_size_list_;
@@ -176,6 +196,16 @@ class BlockMemAssigner : public MemAssigner {
 
   std::vector<MemoryBlock *> GetMemoryBlocks() const { return memory_blocks_; };
 
+  const LifeReuseStat &GetLifeReuseStat() const { return life_reuse_stat_; }
+
+  ///
+  /// @ingroup GE
+  /// @brief add the control edges that memory reused across streams waits for, StreamAllocator inserts events for
+  ///        them. Only called for the assigner whose memory offsets are used.
+  /// @return Status result
+  ///
+  Status AddReuseWaitEdges();
+
   ///
   /// @ingroup domi
   /// @brief   memory size fixed for reuse. get memory range
@@ -371,6 +401,20 @@ class BlockMemAssigner : public MemAssigner {
   ///
   void ReuseBlocksByLifeTime(size_t range_size);
 
+  ///
+  /// @ingroup GE
+  /// @brief calculate the depend life of every node on each stream, by edges and node order on streams
+  /// @return void
+  ///
+  void InitDependStreamLife();
+
+  ///
+  /// @ingroup GE
+  /// @brief reuse parent for child by making the first node of child wait for the last users of parent
+  /// @return bool whether the blocks are merged
+  ///
+  bool ReuseBlockByEvent(MemoryBlock *parent, MemoryBlock *child);
+
   bool IsContinuousOutput(const NodePtr &n);
 
   MemoryBlock *ApplyContinuousMemory(const NodePtr &n, const vector<int64_t> &ranges, const bool is_op_reuse_mem);
@@ -403,6 +447,11 @@ class BlockMemAssigner : public MemAssigner {
   int64_t atomic_addr_clean_id_ = 0;
 
   DependStreamLife total_node_depend_stream_life_;
+
+  // <last user of reused block, first node of the block reusing it>
+  std::vector<std::pair<NodePtr, NodePtr>> reuse_wait_edges_;
+
+  LifeReuseStat life_reuse_stat_;
 };
 }  // namespace ge
 #endif  // GE_GRAPH_BUILD_MEMORY_BLOCK_MEM_ASSIGNER_H_
@@ -71,6 +71,7 @@ Status HybridMemAssigner::Assign() {
     priority_assigner = std::move(max_assigner);
   }
 
+  GE_CHK_STATUS_RET(priority_assigner->AddReuseWaitEdges(), "Add control edges for memory reuse failed.");
   priority_assigner->SetOpMemOffset(false);
   mem_offset_ = priority_assigner->GetMemOffset();
   priority_assigner_ = std::move(priority_assigner);
@@ -17,6 +17,7 @@
 #include "graph/build/task_generator.h"
 #include <string>
 #include <utility>
+#include "cce/taskdown_common.hpp"
 #include "common/profiling/profiling_manager.h"
 #include "common/types.h"
 #include "common/util.h"
@@ -58,6 +59,42 @@ const uint64_t kProfilingArEndLogid = 4;
 const uint64_t kProfilingIterEndLogid = 255;
 const int64_t kHashFactor = 100000;
 const int64_t kInvalidGroupId = -1;
+// batch keys are negative so that they never meet the fusion group keys
+const int64_t kSuperKernelBatchKeyBase = -2;
+const size_t kMaxSuperKernelBatchSize = 32;
+const uint32_t kSuperKernelBatchBlockDim = 1;
+// launch cost model: a kernel running shorter than its launch leaves the stream waiting on the host, fusing it into a
+// super kernel saves the launch but adds a call through the nav table. The run time is estimated from the io bytes.
+const uint64_t kKernelLaunchCostNs = 5000;
+const uint64_t kSubKernelCallCostNs = 300;
+const uint64_t kKernelBytesPerNs = 100;
+
+uint64_t EstimateKernelTimeNs(const ge::OpDescPtr &op_desc) {
+  uint64_t io_bytes = 0;
+  auto add_tensor_size = [&io_bytes](const ge::GeTensorDescPtr &tensor_desc) {
+    int64_t size = 0;
+    if ((tensor_desc != nullptr) && (ge::TensorUtils::GetSize(*tensor_desc, size) == ge::GRAPH_SUCCESS) && (size > 0)) {
+      io_bytes += static_cast<uint64_t>(size);
+    }
+  };
+  for (const auto &tensor_desc : op_desc->GetAllInputsDescPtr()) {
+    add_tensor_size(tensor_desc);
+  }
+  for (const auto &tensor_desc : op_desc->GetAllOutputsDescPtr()) {
+    add_tensor_size(tensor_desc);
+  }
+  return io_bytes / kKernelBytesPerNs;
+}
+
+// launch time saved by running kernel_num kernels as one super kernel, 0 if it does not pay off
+uint64_t EstimateBatchSavingNs(size_t kernel_num) {
+  if (kernel_num < 2) {
+    return 0;
+  }
+  uint64_t launch_saving = (kernel_num - 1) * kKernelLaunchCostNs;
+  uint64_t call_cost = kernel_num * kSubKernelCallCostNs;
+  return (launch_saving > call_cost) ? (launch_saving - call_cost) : 0;
+}
 }  // namespace
 namespace ge {
 TaskGenerator::TaskGenerator(uint8_t *var_mem_base, uint64_t var_mem_size) {
@@ -85,6 +122,8 @@ Status TaskGenerator::GetTaskInfo(Model &model, ComputeGraphPtr &graph, uint64_t
     return ret;
   }
 
+  GE_CHK_STATUS_RET(BatchSmallKernels(graph, task_def_list, op_name_map), "Batch small kernels failed.");
+
   // op_name_map used when graph load
   graph->SetGraphOpName(op_name_map);
 
@@ -603,6 +642,125 @@ Status TaskGenerator::MarkFirstAndLastOps(const vector<OpDescPtr> &ops, bool is_
   return SUCCESS;
 }
 
+Status TaskGenerator::BatchSmallKernels(const ComputeGraphPtr &graph, const vector<TaskDef> &task_def_list,
+                                        const map<uint32_t, string> &op_name_map) const {
+  // batches of the last generation are dropped, the tasks may have changed or the option may be off now
+  for (const auto &node : graph->GetNodes(graph->GetGraphUnknownFlag())) {
+    GE_CHECK_NOTNULL(node->GetOpDesc());
+    (void)node->GetOpDesc()->DelAttr(ATTR_NAME_SUPER_KERNEL_BATCH_KEY);
+    (void)node->GetOpDesc()->DelAttr(ATTR_NAME_SUPER_KERNEL_BATCH_END);
+  }
+  string auto_super_kernel;
+  if ((GetContext().GetOption(OPTION_AUTO_SUPER_KERNEL, auto_super_kernel) != GRAPH_SUCCESS) ||
+      (auto_super_kernel != "1")) {
+    return SUCCESS;
+  }
+  // unknown shape graphs are not sunk, their kernels are launched by the hybrid executor
+  if (graph->GetGraphUnknownFlag() || GetContext().GetHostExecFlag()) {
+    GELOGI("Graph %s is not sunk, no need to batch small kernels.", graph->GetName().c_str());
+    return SUCCESS;
+  }
+
+  map<string, NodePtr> name_to_node;
+  for (const auto &node : graph->GetNodes(graph->GetGraphUnknownFlag())) {
+    name_to_node[node->GetName()] = node;
+  }
+  map<string, size_t> task_num_of_op;
+  for (const auto &index_and_name : op_name_map) {
+    task_num_of_op[index_and_name.second]++;
+  }
+
+  /// a node is batched only if its single task is a launch bound tbe kernel which no fusion group owns. The sub
+  /// kernels of a super kernel are not synchronized across blocks, a block may read an output of the previous sub
+  /// kernel which another block has not written yet. Kernels of a single block keep the data flow in the block.
+  auto get_candidate = [&](uint32_t task_index) -> NodePtr {
+    const TaskDef &task_def = task_def_list[task_index];
+    auto name_iter = op_name_map.find(task_index);
+    if ((static_cast<rtModelTaskType_t>(task_def.type()) != RT_MODEL_TASK_KERNEL) ||
+        (static_cast<cce::ccKernelType>(task_def.kernel().context().kernel_type()) != cce::ccKernelType::TE) ||
+        (task_def.kernel().block_dim() != kSuperKernelBatchBlockDim) ||
+        (name_iter == op_name_map.end()) || (task_num_of_op[name_iter->second] != 1)) {
+      return nullptr;
+    }
+    auto node_iter = name_to_node.find(name_iter->second);
+    if ((node_iter == name_to_node.end()) || (node_iter->second->GetOpDesc() == nullptr)) {
+      return nullptr;
+    }
+    OpDescPtr op_desc = node_iter->second->GetOpDesc();
+    bool is_n_batch_split = false;
+    if (AttrUtils::HasAttr(op_desc, ATTR_NAME_FUSION_GROUP_KEY) ||
+        (AttrUtils::GetBool(op_desc, ATTR_N_BATCH_SPILT, is_n_batch_split) && is_n_batch_split) ||
+        (EstimateKernelTimeNs(op_desc) >= kKernelLaunchCostNs)) {
+      return nullptr;
+    }
+    return node_iter->second;
+  };
+  // the fused kernels run one by one, so a batch only extends along a data dependency chain on the same stream
+  auto can_append = [&](const vector<NodePtr> &batch, uint32_t task_index, const NodePtr &node) -> bool {
+    if (batch.empty()) {
+      return true;
+    }
+    const TaskDef &last_task = task_def_list[task_index - 1];
+    const TaskDef &task = task_def_list[task_index];
+    bool is_last_node = false;
+    (void)AttrUtils::GetBool(batch.back()->GetOpDesc(), kIsLastNode, is_last_node);
+    if ((batch.size() >= kMaxSuperKernelBatchSize) || is_last_node || (last_task.stream_id() != task.stream_id())) {
+      return false;
+    }
+    for (const auto &in_node : node->GetInDataNodes()) {
+      if (in_node == batch.back()) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  vector<vector<NodePtr>> batches(1);
+  for (uint32_t task_index = 0; task_index < task_def_list.size(); ++task_index) {
+    NodePtr node = get_candidate(task_index);
+    if ((node != nullptr) && can_append(batches.back(), task_index, node)) {
+      batches.back().emplace_back(node);
+      continue;
+    }
+    if (!batches.back().empty()) {
+      batches.emplace_back();
+    }
+    if (node != nullptr) {
+      batches.back().emplace_back(node);
+    }
+  }
+
+  int64_t batch_key = kSuperKernelBatchKeyBase;
+  size_t batched_kernel_num = 0;
+  size_t batch_num = 0;
+  uint64_t total_saving_ns = 0;
+  for (const auto &batch : batches) {
+    uint64_t saving_ns = EstimateBatchSavingNs(batch.size());
+    if (saving_ns == 0) {
+      continue;
+    }
+    for (const auto &node : batch) {
+      GE_CHK_BOOL_EXEC(AttrUtils::SetInt(node->GetOpDesc(), ATTR_NAME_SUPER_KERNEL_BATCH_KEY, batch_key),
+                       GELOGE(FAILED, "SetInt failed.");
+                       return FAILED);
+    }
+    GE_CHK_BOOL_EXEC(AttrUtils::SetBool(batch.back()->GetOpDesc(), ATTR_NAME_SUPER_KERNEL_BATCH_END, true),
+                     GELOGE(FAILED, "SetBool failed.");
+                     return FAILED);
+    GELOGD("Super kernel batch %ld: %zu kernels from %s to %s, estimated saving %lu ns.", batch_key, batch.size(),
+           batch.front()->GetName().c_str(), batch.back()->GetName().c_str(), saving_ns);
+    --batch_key;
+    ++batch_num;
+    batched_kernel_num += batch.size();
+    total_saving_ns += saving_ns;
+  }
+  GELOGI("Graph %s batches %zu small kernels into %zu super kernels, launched tasks %zu -> %zu, "
+         "estimated launch saving %lu ns per run.",
+         graph->GetName().c_str(), batched_kernel_num, batch_num, task_def_list.size(),
+         task_def_list.size() - batched_kernel_num + batch_num, total_saving_ns);
+  return SUCCESS;
+}
+
 Status TaskGenerator::AutoFindFpOpIndex(const ComputeGraphPtr &graph, ProfilingPoint &profiling_point) const {
   GELOGI("Start AutoFindFpOpIndex");
   OpDescPtr fp_op_desc = nullptr;
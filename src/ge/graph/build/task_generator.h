@@ -108,6 +108,18 @@ class TaskGenerator {
   // Mark first and last op according to the same stream and engine
   Status MarkFirstAndLastOps(const vector<OpDescPtr> &ops, bool is_single_stream) const;
 
+  ///
+  /// group consecutive small single block tbe kernel tasks of a stream into super kernel batches, if
+  /// ge.autoSuperKernel is on. Batches of the last generation are dropped first.
+  /// @param graph compute graph
+  /// @param task_def_list task def list generate by engine
+  /// @param op_name_map relation of task index and op
+  /// @return SUCCESS:seccess
+  ///         Other: failed
+  ///
+  Status BatchSmallKernels(const ComputeGraphPtr &graph, const std::vector<domi::TaskDef> &task_def_list,
+                           const std::map<uint32_t, string> &op_name_map) const;
+
   // profiling interface
   Status AutoFindFpOpIndex(const ComputeGraphPtr &graph, ProfilingPoint &profiling_point) const;
   Status AutoFindBpOpIndex(const ComputeGraphPtr &graph, ProfilingPoint &profiling_point,
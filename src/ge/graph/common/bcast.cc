@@ -165,4 +165,26 @@ void BCast::BCastIndexes(kVecInt &x_indexes, kVecInt &y_indexes) {
   Reverse(y_reshape_);
   Reverse(output_);
 }
+
+void BCast::BCastStrides(kVecInt &x_strides, kVecInt &y_strides) const {
+  const size_t dim_num = output_.size();
+  x_strides.assign(dim_num, 0);
+  y_strides.assign(dim_num, 0);
+  int64_t x_stride = 1;
+  int64_t y_stride = 1;
+  for (size_t i = dim_num; i > 0; --i) {
+    x_strides[i - 1] = (x_reshape_[i - 1] == 1) ? 0 : x_stride;
+    y_strides[i - 1] = (y_reshape_[i - 1] == 1) ? 0 : y_stride;
+    x_stride *= x_reshape_[i - 1];
+    y_stride *= y_reshape_[i - 1];
+  }
+}
+
+int64_t BCast::GetOutputElementNum() const {
+  int64_t num = 1;
+  for (auto dim : output_) {
+    num *= dim;
+  }
+  return num;
+}
 }  // namespace ge
@@ -18,10 +18,14 @@
 #define GE_GRAPH_COMMON_BCAST_H_
 
 #include <stdint.h>
+#include <algorithm>
+#include <atomic>
 #include <functional>
+#include <memory>
 #include <vector>
 
 #include "common/debug/log.h"
+#include "common/thread_pool.h"
 #include "common/types.h"
 #include "framework/common/debug/ge_log.h"
 #include "framework/common/ge_inner_error_codes.h"
@@ -31,6 +35,8 @@
 
 namespace ge {
 static const size_t kMinDimNum = 2;
+// output elements below this count are computed on the calling thread only
+static const int64_t kBCastParallelMinBlock = 32768;
 class BCast {
  public:
   ///
@@ -106,6 +112,129 @@ class BCast {
   static kVecInt TransShapeToDimVec(const GeTensorDesc &shape);
 
   void BCastIndexes(kVecInt &x_indexes, kVecInt &y_indexes);
+
+  ///
+  /// @ingroup domi_calibration
+  /// @brief get element strides of x and y for every output dim, 0 for broadcast dims
+  /// @param [out] x_strides   strides of first input
+  /// @param [out] y_strides   strides of second input
+  ///
+  void BCastStrides(kVecInt &x_strides, kVecInt &y_strides) const;
+
+  ///
+  /// @ingroup domi_calibration
+  /// @brief get element num of broadcast output
+  ///
+  int64_t GetOutputElementNum() const;
+
+  ///
+  /// @ingroup domi_calibration
+  /// @brief visit output elements [begin, end) as contiguous runs of the innermost dim, no index table is built
+  /// @param [in] func   called as func(out_index, x_index, x_step, y_index, y_step, count), steps are 0 or 1
+  /// @return     first failure returned by func
+  ///
+  template <typename Func>
+  Status BCastForEachRun(int64_t begin, int64_t end, const kVecInt &x_strides, const kVecInt &y_strides,
+                         Func &&func) const {
+    if (begin >= end) {
+      return SUCCESS;
+    }
+    const size_t dim_num = output_.size();
+    if (dim_num == 0) {
+      // x and y are both scalar
+      return func(0, 0, 0, 0, 0, 1);
+    }
+    kVecInt indexes(dim_num, 0);
+    int64_t remain = begin;
+    int64_t x_index = 0;
+    int64_t y_index = 0;
+    for (size_t i = dim_num; i > 0; --i) {
+      indexes[i - 1] = remain % output_[i - 1];
+      remain /= output_[i - 1];
+      x_index += indexes[i - 1] * x_strides[i - 1];
+      y_index += indexes[i - 1] * y_strides[i - 1];
+    }
+
+    const size_t last = dim_num - 1;
+    int64_t pos = begin;
+    while (pos < end) {
+      int64_t count = std::min(end - pos, output_[last] - indexes[last]);
+      Status ret = func(pos, x_index, x_strides[last], y_index, y_strides[last], count);
+      if (ret != SUCCESS) {
+        return ret;
+      }
+      pos += count;
+      indexes[last] += count;
+      x_index += count * x_strides[last];
+      y_index += count * y_strides[last];
+      for (size_t i = last; (i > 0) && (indexes[i] >= output_[i]); --i) {
+        x_index += x_strides[i - 1] - indexes[i] * x_strides[i];
+        y_index += y_strides[i - 1] - indexes[i] * y_strides[i];
+        indexes[i] = 0;
+        indexes[i - 1]++;
+      }
+    }
+    return SUCCESS;
+  }
+
+  ///
+  /// @ingroup domi_calibration
+  /// @brief elementwise compute of two broadcast inputs, large outputs are split across threads
+  /// @param [in] x     first input data
+  /// @param [in] y     second input data
+  /// @param [out] out  output buffer with GetOutputElementNum() elements
+  /// @param [in] func  called as func(x_value, y_value, out_value), returns SUCCESS or the status to stop with
+  /// @return     SUCCESS or the failure returned by func, computing stops at the first failure
+  ///
+  template <typename InT, typename OutT, typename Func>
+  Status BCastElementwise(const InT *x, const InT *y, OutT *out, const Func &func) const {
+    kVecInt x_strides;
+    kVecInt y_strides;
+    BCastStrides(x_strides, y_strides);
+    // set by the first failed run, the remaining runs of all threads are skipped then
+    std::atomic<bool> failed(false);
+    auto run_func = [x, y, out, &func, &failed](int64_t out_index, int64_t x_index, int64_t x_step, int64_t y_index,
+                                                int64_t y_step, int64_t count) -> Status {
+      if (failed.load(std::memory_order_relaxed)) {
+        return SUCCESS;
+      }
+      const InT *x_run = x + x_index;
+      const InT *y_run = y + y_index;
+      OutT *out_run = out + out_index;
+      Status ret = SUCCESS;
+      // keep the step cases apart so the inner loops stay simple
+      if ((x_step == 1) && (y_step == 1)) {
+        for (int64_t i = 0; (i < count) && (ret == SUCCESS); ++i) {
+          ret = func(x_run[i], y_run[i], out_run[i]);
+        }
+      } else if (x_step == 1) {
+        const InT y_value = *y_run;
+        for (int64_t i = 0; (i < count) && (ret == SUCCESS); ++i) {
+          ret = func(x_run[i], y_value, out_run[i]);
+        }
+      } else if (y_step == 1) {
+        const InT x_value = *x_run;
+        for (int64_t i = 0; (i < count) && (ret == SUCCESS); ++i) {
+          ret = func(x_value, y_run[i], out_run[i]);
+        }
+      } else {
+        const InT x_value = *x_run;
+        const InT y_value = *y_run;
+        for (int64_t i = 0; (i < count) && (ret == SUCCESS); ++i) {
+          ret = func(x_value, y_value, out_run[i]);
+        }
+      }
+      if (ret != SUCCESS) {
+        failed.store(true, std::memory_order_relaxed);
+      }
+      return ret;
+    };
+    return ThreadPool::ParallelFor(GetOutputElementNum(), kBCastParallelMinBlock,
+                                   [this, &x_strides, &y_strides, &run_func](int64_t begin, int64_t end) -> Status {
+                                     return BCastForEachRun(begin, end, x_strides, y_strides, run_func);
+                                   });
+  }
+
   template <typename InT, typename OutT>
   Status BCastCompute(const std::vector<ConstGeTensorPtr> &input, std::vector<OutT> &v_output,
                       const std::function<OutT(InT const &, InT const &)> &func) {
@@ -127,22 +256,15 @@ class BCast {
       return ret;
     }
 
-    kVecInt x_indexes;
-    kVecInt y_indexes;
-    BCastIndexes(x_indexes, y_indexes);
-
-    const void *x1_data = input[0]->GetData().data();
-    const void *x2_data = input[1]->GetData().data();
-
-    for (size_t i = 0; i < x_indexes.size(); i++) {
-      int64_t x_index = x_indexes[i];
-      int64_t y_index = y_indexes[i];
-      auto value = func((*(reinterpret_cast<const InT *>(x1_data) + x_index)),
-                        (*(reinterpret_cast<const InT *>(x2_data) + y_index)));
-      v_output.push_back(value);
-    }
-
-    return domi::SUCCESS;
+    const InT *x1_data = reinterpret_cast<const InT *>(input[0]->GetData().data());
+    const InT *x2_data = reinterpret_cast<const InT *>(input[1]->GetData().data());
+    size_t output_base = v_output.size();
+    v_output.resize(output_base + static_cast<size_t>(GetOutputElementNum()));
+    return BCastElementwise(x1_data, x2_data, v_output.data() + output_base,
+                            [&func](const InT &x, const InT &y, OutT &out) -> Status {
+                              out = func(x, y);
+                              return SUCCESS;
+                            });
   }
 
   template <typename InT, typename OutT>
@@ -166,23 +288,20 @@ class BCast {
     }
 
     DataType data_type = input[0]->GetTensorDesc().GetDataType();
-    kVecInt x_indexes;
-    kVecInt y_indexes;
-    BCastIndexes(x_indexes, y_indexes);
-
-    const void *x1_data = input[0]->GetData().data();
-    const void *x2_data = input[1]->GetData().data();
-
-    for (size_t i = 0; i < x_indexes.size(); i++) {
-      int64_t x_index = x_indexes[i];
-      int64_t y_index = y_indexes[i];
-      auto value = func((*(reinterpret_cast<const InT *>(x1_data) + x_index)),
-                        (*(reinterpret_cast<const InT *>(x2_data) + y_index)), data_type, ret);
-      if (ret != SUCCESS) {
-        GELOGE(ret, "BCastComputeCheck func execute failed, datatype is %d.", data_type);
-        return ret;
-      }
-      v_output.push_back(value);
+    const InT *x1_data = reinterpret_cast<const InT *>(input[0]->GetData().data());
+    const InT *x2_data = reinterpret_cast<const InT *>(input[1]->GetData().data());
+    size_t output_base = v_output.size();
+    v_output.resize(output_base + static_cast<size_t>(GetOutputElementNum()));
+    ret = BCastElementwise(x1_data, x2_data, v_output.data() + output_base,
+                           [&func, data_type](const InT &x, const InT &y, OutT &out) -> Status {
+                             DataType type = data_type;
+                             Status func_ret = SUCCESS;
+                             out = func(x, y, type, func_ret);
+                             return func_ret;
+                           });
+    if (ret != SUCCESS) {
+      GELOGE(ret, "BCastComputeCheck func execute failed, datatype is %d.", data_type);
+      return ret;
     }
 
     return SUCCESS;
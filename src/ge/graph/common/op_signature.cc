@@ -0,0 +1,213 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "graph/common/op_signature.h"
+
+#include <cstring>
+#include <vector>
+
+#include "framework/common/debug/ge_log.h"
+#include "graph/ge_attr_value.h"
+
+namespace ge {
+namespace {
+const uint64_t kFnvOffsetBasis = 0xcbf29ce484222325ULL;
+const uint64_t kFnvPrime = 0x100000001b3ULL;
+const uint64_t kMixPrime = 0x9e3779b97f4a7c15ULL;
+const uint64_t kMixAdd = 0x52dce729ULL;
+const int kMixRotate = 27;
+const int kMixShift = 32;
+
+template <typename T>
+void AppendList(std::string &signature, const std::vector<T> &values) {
+  OpSignature::AppendValue(signature, values.size());
+  for (const auto &value : values) {
+    OpSignature::AppendValue(signature, static_cast<T>(value));
+  }
+}
+
+void AppendList(std::string &signature, const std::vector<std::string> &values) {
+  OpSignature::AppendValue(signature, values.size());
+  for (const auto &value : values) {
+    OpSignature::AppendString(signature, value);
+  }
+}
+
+uint64_t MixWord(uint64_t hash, uint64_t word) {
+  hash ^= word * kMixPrime;
+  hash = (hash << kMixRotate) | (hash >> (64 - kMixRotate));
+  return hash * 5 + kMixAdd;
+}
+
+bool AppendAttrValue(std::string &signature, const GeAttrValue &value) {
+  auto value_type = value.GetValueType();
+  OpSignature::AppendValue(signature, static_cast<int32_t>(value_type));
+  switch (value_type) {
+    case GeAttrValue::VT_STRING: {
+      std::string val;
+      (void)value.GetValue<GeAttrValue::STR>(val);
+      OpSignature::AppendString(signature, val);
+      return true;
+    }
+    case GeAttrValue::VT_FLOAT: {
+      float val = 0;
+      (void)value.GetValue<GeAttrValue::FLOAT>(val);
+      OpSignature::AppendValue(signature, val);
+      return true;
+    }
+    case GeAttrValue::VT_BOOL: {
+      bool val = false;
+      (void)value.GetValue<GeAttrValue::BOOL>(val);
+      OpSignature::AppendValue(signature, val);
+      return true;
+    }
+    case GeAttrValue::VT_INT: {
+      int64_t val = 0;
+      (void)value.GetValue<GeAttrValue::INT>(val);
+      OpSignature::AppendValue(signature, val);
+      return true;
+    }
+    case GeAttrValue::VT_DATA_TYPE: {
+      DataType val = DT_UNDEFINED;
+      (void)value.GetValue<GeAttrValue::DATA_TYPE>(val);
+      OpSignature::AppendValue(signature, static_cast<int32_t>(val));
+      return true;
+    }
+    case GeAttrValue::VT_TENSOR_DESC: {
+      GeTensorDesc val;
+      (void)value.GetValue<GeAttrValue::TENSOR_DESC>(val);
+      OpSignature::AppendTensorDesc(signature, val);
+      return true;
+    }
+    case GeAttrValue::VT_LIST_STRING: {
+      std::vector<std::string> val;
+      (void)value.GetValue<GeAttrValue::LIST_STR>(val);
+      AppendList(signature, val);
+      return true;
+    }
+    case GeAttrValue::VT_LIST_FLOAT: {
+      std::vector<float> val;
+      (void)value.GetValue<GeAttrValue::LIST_FLOAT>(val);
+      AppendList(signature, val);
+      return true;
+    }
+    case GeAttrValue::VT_LIST_BOOL: {
+      std::vector<bool> val;
+      (void)value.GetValue<GeAttrValue::LIST_BOOL>(val);
+      AppendList(signature, val);
+      return true;
+    }
+    case GeAttrValue::VT_LIST_INT: {
+      std::vector<int64_t> val;
+      (void)value.GetValue<GeAttrValue::LIST_INT>(val);
+      AppendList(signature, val);
+      return true;
+    }
+    case GeAttrValue::VT_LIST_DATA_TYPE: {
+      std::vector<DataType> val;
+      (void)value.GetValue<GeAttrValue::LIST_DATA_TYPE>(val);
+      AppendList(signature, val);
+      return true;
+    }
+    case GeAttrValue::VT_LIST_LIST_INT: {
+      std::vector<std::vector<int64_t>> val;
+      (void)value.GetValue<GeAttrValue::LIST_LIST_INT>(val);
+      OpSignature::AppendValue(signature, val.size());
+      for (const auto &item : val) {
+        AppendList(signature, item);
+      }
+      return true;
+    }
+    default:
+      // tensors, graphs, bytes and named attrs are not keyed
+      return false;
+  }
+}
+}  // namespace
+
+bool OpSignature::Generate(const OpDescPtr &op_desc, std::string &signature) {
+  if (op_desc == nullptr) {
+    return false;
+  }
+  signature.clear();
+  AppendString(signature, op_desc->GetType());
+  for (const auto &name_to_value : op_desc->GetAllAttrs()) {
+    const auto &name = name_to_value.first;
+    if (name.empty() || name[0] == '_') {
+      continue;
+    }
+    AppendString(signature, name);
+    if (!AppendAttrValue(signature, name_to_value.second)) {
+      GELOGD("Attr %s of node %s can not be keyed.", name.c_str(), op_desc->GetName().c_str());
+      return false;
+    }
+  }
+
+  AppendTensorDescs(signature, op_desc);
+  return true;
+}
+
+void OpSignature::AppendTensorDescs(std::string &signature, const OpDescPtr &op_desc) {
+  AppendValue(signature, op_desc->GetAllInputsSize());
+  for (const auto &input_desc : op_desc->GetAllInputsDescPtr()) {
+    if (input_desc != nullptr) {
+      AppendTensorDesc(signature, *input_desc);
+    }
+  }
+  AppendValue(signature, op_desc->GetOutputsSize());
+  for (const auto &output_desc : op_desc->GetAllOutputsDescPtr()) {
+    if (output_desc != nullptr) {
+      AppendTensorDesc(signature, *output_desc);
+    }
+  }
+}
+
+void OpSignature::AppendTensorDesc(std::string &signature, const GeTensorDesc &desc) {
+  AppendValue(signature, static_cast<int32_t>(desc.GetDataType()));
+  AppendValue(signature, static_cast<int32_t>(desc.GetFormat()));
+  AppendList(signature, desc.GetShape().GetDims());
+  // kernel info stores select kernels by the origin format and shape as well
+  AppendValue(signature, static_cast<int32_t>(desc.GetOriginFormat()));
+  AppendList(signature, desc.GetOriginShape().GetDims());
+}
+
+void OpSignature::AppendDigest(std::string &signature, const uint8_t *data, size_t size) {
+  uint64_t fnv_hash = kFnvOffsetBasis;
+  uint64_t mix_hash = kMixPrime ^ size;
+  size_t offset = 0;
+  for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t)) {
+    uint64_t word = 0;
+    memcpy(&word, data + offset, sizeof(uint64_t));
+    fnv_hash = (fnv_hash ^ word) * kFnvPrime;
+    fnv_hash ^= fnv_hash >> kMixShift;
+    mix_hash = MixWord(mix_hash, word);
+  }
+  if (offset < size) {
+    uint64_t word = 0;
+    memcpy(&word, data + offset, size - offset);
+    fnv_hash = (fnv_hash ^ word) * kFnvPrime;
+    mix_hash = MixWord(mix_hash, word);
+  }
+  AppendValue(signature, size);
+  AppendValue(signature, fnv_hash);
+  AppendValue(signature, mix_hash);
+}
+
+void OpSignature::AppendTensor(std::string &signature, const GeTensor &tensor) {
+  AppendTensorDesc(signature, tensor.GetTensorDesc());
+  AppendDigest(signature, tensor.GetData().data(), tensor.GetData().size());
+}
+}  // namespace ge
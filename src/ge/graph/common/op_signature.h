@@ -0,0 +1,79 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GE_GRAPH_COMMON_OP_SIGNATURE_H_
+#define GE_GRAPH_COMMON_OP_SIGNATURE_H_
+
+#include <cstdint>
+#include <string>
+
+#include "graph/ge_tensor.h"
+#include "graph/op_desc.h"
+
+namespace ge {
+///
+/// @ingroup ge_graph
+/// @brief Binary signature of an op built from its content, nodes with the same signature are interchangeable for
+///        computing: op type, non private attrs and the data type, format and shape (origin ones as well) of every
+///        input and output.
+///        Private attrs (named with prefix '_') are graph bookkeeping such as origin names, batch labels and stream
+///        labels, so clones of a node share the signature.
+///
+class GE_FUNC_HOST_VISIBILITY GE_FUNC_DEV_VISIBILITY OpSignature {
+ public:
+  ///
+  /// @ingroup ge_graph
+  /// @brief generate the signature of op
+  /// @param [in] op_desc op desc
+  /// @param [out] signature signature of op
+  /// @return false if the op carries attrs which can not be keyed, such as tensors and graphs
+  ///
+  static bool Generate(const OpDescPtr &op_desc, std::string &signature);
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief append the data type, format, shape, origin format and origin shape of every input and output of op
+  ///
+  static void AppendTensorDescs(std::string &signature, const OpDescPtr &op_desc);
+
+  static void AppendTensorDesc(std::string &signature, const GeTensorDesc &desc);
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief append the size and two independent 64 bits hashes of data, wide enough that distinct data never share
+  ///        a signature in practice
+  ///
+  static void AppendDigest(std::string &signature, const uint8_t *data, size_t size);
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief append the tensor desc and the digest of the data of tensor
+  ///
+  static void AppendTensor(std::string &signature, const GeTensor &tensor);
+
+  template <typename T>
+  static void AppendValue(std::string &signature, const T &value) {
+    signature.append(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+
+  static void AppendString(std::string &signature, const std::string &value) {
+    AppendValue(signature, value.size());
+    signature.append(value);
+  }
+};
+}  // namespace ge
+
+#endif  // GE_GRAPH_COMMON_OP_SIGNATURE_H_
@@ -21,6 +21,7 @@
 
 #include "common/ge_inner_error_codes.h"
 #include "common/model_parser/base.h"
+#include "graph/common/ge_call_wrapper.h"
 #include "graph/load/new_model_manager/model_manager.h"
 #include "omm/csa_interact.h"
 #include "runtime/dev.h"
@@ -268,19 +269,9 @@ Status GraphExecutor::SyncExecuteModel(uint32_t model_id, const std::vector<GeTe
   GELOGI("[GraphExecutor] input data push to wrapper finish, waiting for result...");
 
   // Pending until async execute graph complete
-  {
-    std::unique_lock<std::mutex> ulock(*sync_run_mutex_);
-    if (!graph_run_listener_->IsFinished()) {
-      (*condition_).wait(ulock);
-    }
-
-    // Run graph return
-    uint32_t result_code = graph_run_listener_->GetResultCode();
-    if (result_code != SUCCESS && result_code != END_OF_SEQUENCE) {
-      GELOGE(GE_GRAPH_EXECUTE_FAILED, "[GraphExecutor] execute model failed, ret=%u, modelId=%u.", result_code,
-             model_id);
-      return GE_GRAPH_EXECUTE_FAILED;
-    }
+  ret = WaitExecuteResult(model_id);
+  if (ret != SUCCESS) {
+    return ret;
   }
   for (size_t i = 0; i < output_data.blobs.size(); ++i) {
     DataBuffer outputDataTmp = output_data.blobs[i];
@@ -316,6 +307,177 @@ Status GraphExecutor::SyncExecuteModel(uint32_t model_id, const std::vector<GeTe
   return SUCCESS;
 }
 
+Status GraphExecutor::WaitExecuteResult(uint32_t model_id) {
+  std::unique_lock<std::mutex> ulock(*sync_run_mutex_);
+  while (!graph_run_listener_->IsFinished()) {
+    (*condition_).wait(ulock);
+  }
+
+  // Run graph return
+  uint32_t result_code = graph_run_listener_->GetResultCode();
+  if (result_code != SUCCESS && result_code != END_OF_SEQUENCE) {
+    GELOGE(GE_GRAPH_EXECUTE_FAILED, "[GraphExecutor] execute model failed, ret=%u, modelId=%u.", result_code,
+           model_id);
+    return GE_GRAPH_EXECUTE_FAILED;
+  }
+  return SUCCESS;
+}
+
+Status GraphExecutor::CheckIoBinding(const GraphIoBinding &io_binding) {
+  for (const auto &buffer : io_binding.inputs) {
+    if ((buffer.data == nullptr) && (buffer.length != 0)) {
+      GELOGE(PARAM_INVALID, "[GraphExecutor] bound input buffer is null.");
+      return PARAM_INVALID;
+    }
+  }
+  for (const auto &buffer : io_binding.outputs) {
+    if ((buffer.data == nullptr) && (buffer.length != 0)) {
+      GELOGE(PARAM_INVALID, "[GraphExecutor] bound output buffer is null.");
+      return PARAM_INVALID;
+    }
+  }
+  return SUCCESS;
+}
+
+Status GraphExecutor::ExecuteModelWithIoBinding(uint32_t model_id, rtStream_t stream, const GraphIoBinding &io_binding,
+                                                std::vector<GeTensorDesc> &output_desc) {
+  auto model_manager = ge::ModelManager::GetInstance();
+  GE_CHECK_NOTNULL(model_manager);
+  std::vector<DataBuffer> outputs = io_binding.outputs;
+  if (model_manager->IsDynamicShape(model_id)) {
+    GELOGI("[ExecuteGraph] Execute with io binding via dynamic shape model executor, modelId=%u", model_id);
+    return model_manager->SyncExecuteModel(model_id, io_binding.inputs, io_binding.input_desc, outputs, output_desc,
+                                           io_binding.is_device_memory);
+  }
+  if (!io_binding.is_device_memory) {
+    GELOGE(PARAM_INVALID, "[GraphExecutor] static model is executed on bound device buffers only, modelId=%u.",
+           model_id);
+    return PARAM_INVALID;
+  }
+
+  std::vector<InputOutputDescInfo> outputs_desc;
+  InputData input_data;
+  OutputData output_data;
+  Status ret = PrepareIoBindingData(model_id, io_binding, outputs_desc, input_data, output_data);
+  if (ret != SUCCESS) {
+    return ret;
+  }
+  // Zero copy: tasks of the model address the bound device buffers directly.
+  GELOGI("[ExecuteGraph] Execute with device io binding, modelId=%u.", model_id);
+  ret = model_manager->ExecuteModel(model_id, stream, false, input_data, output_data);
+  if (ret != SUCCESS) {
+    GELOGE(GE_GRAPH_EXECUTE_FAILED, "[GraphExecutor] execute model failed, ret=%u, modelId=%u.", ret, model_id);
+    return GE_GRAPH_EXECUTE_FAILED;
+  }
+  ConvertIoBindingOutputDesc(outputs_desc, output_desc);
+  return SUCCESS;
+}
+
+Status GraphExecutor::PrepareIoBindingData(uint32_t model_id, const GraphIoBinding &io_binding,
+                                           std::vector<InputOutputDescInfo> &outputs_desc, InputData &input_data,
+                                           OutputData &output_data) {
+  std::vector<InputOutputDescInfo> inputs_desc;
+  Status ret = GetInputOutputDescInfo(model_id, inputs_desc, outputs_desc);
+  if (ret != SUCCESS) {
+    GELOGE(GE_GRAPH_GET_IN_OUT_FAILED, "[GraphExecutor] GetInputOutputDescInfo failed, modelId=%u.", model_id);
+    return GE_GRAPH_GET_IN_OUT_FAILED;
+  }
+  if (io_binding.outputs.size() != outputs_desc.size()) {
+    GELOGE(PARAM_INVALID, "[GraphExecutor] output buffer num %zu does not match model output num %zu, modelId=%u.",
+           io_binding.outputs.size(), outputs_desc.size(), model_id);
+    return PARAM_INVALID;
+  }
+
+  input_data.index = 0;
+  input_data.timeout = 0;
+  input_data.timestamp = 0;
+  input_data.model_id = model_id;
+  input_data.blobs = io_binding.inputs;
+  output_data.index = 0;
+  output_data.model_id = model_id;
+  output_data.blobs = io_binding.outputs;
+  return SUCCESS;
+}
+
+void GraphExecutor::ConvertIoBindingOutputDesc(const std::vector<InputOutputDescInfo> &outputs_desc,
+                                               std::vector<GeTensorDesc> &output_desc) {
+  output_desc.clear();
+  for (const auto &desc : outputs_desc) {
+    std::vector<int64_t> dims(desc.shape_info.dims.begin(), desc.shape_info.dims.end());
+    output_desc.emplace_back(GeShape(dims), FORMAT_ND, static_cast<DataType>(desc.data_type));
+  }
+}
+
+Status GraphExecutor::SyncExecuteModelWithIoBinding(uint32_t model_id, const GraphIoBinding &io_binding,
+                                                    std::vector<GeTensorDesc> &output_desc) {
+  auto model_manager = ge::ModelManager::GetInstance();
+  GE_CHECK_NOTNULL(model_manager);
+  if (io_binding.is_device_memory || model_manager->IsDynamicShape(model_id)) {
+    return ExecuteModelWithIoBinding(model_id, nullptr, io_binding, output_desc);
+  }
+
+  std::vector<InputOutputDescInfo> outputs_desc;
+  InputData input_data;
+  OutputData output_data;
+  Status ret = PrepareIoBindingData(model_id, io_binding, outputs_desc, input_data, output_data);
+  if (ret != SUCCESS) {
+    return ret;
+  }
+  outputs_desc_.assign(outputs_desc.begin(), outputs_desc.end());
+
+  // The model run thread copies inputs from and outputs to the bound host buffers, each byte once.
+  if (graph_run_listener_->ResetResult() != SUCCESS) {
+    GELOGE(GE_GRAPH_EXECUTE_FAILED, "Reset result failed");
+    return GE_GRAPH_EXECUTE_FAILED;
+  }
+  ret = DataInput(input_data, output_data);
+  if (ret != SUCCESS) {
+    GELOGE(GE_GRAPH_DATA_INPUT_FAILED, "[GraphExecutor] push data failed, modelId=%u.", model_id);
+    return GE_GRAPH_DATA_INPUT_FAILED;
+  }
+  ret = WaitExecuteResult(model_id);
+  if (ret != SUCCESS) {
+    return ret;
+  }
+  ConvertIoBindingOutputDesc(outputs_desc, output_desc);
+  return SUCCESS;
+}
+
+Status GraphExecutor::ExecuteGraphWithIoBinding(GraphId graph_id, uint32_t model_id, const GraphIoBinding &io_binding,
+                                                std::vector<GeTensorDesc> &output_desc) {
+  if (!init_flag_) {
+    GELOGE(GE_GRAPH_EXECUTE_NOT_INIT, "[GraphExecutor] AI Core Engine without calling SetCondition!");
+    return GE_GRAPH_EXECUTE_NOT_INIT;
+  }
+  if (CheckIoBinding(io_binding) != SUCCESS) {
+    GELOGE(PARAM_INVALID, "[GraphExecutor] io binding is invalid, graph_id=%u.", graph_id);
+    return PARAM_INVALID;
+  }
+  // variables of train graph are synchronized by the model run thread, which device binding bypasses
+  if (io_binding.is_device_memory && train_graph_flag_) {
+    GELOGE(PARAM_INVALID, "[GraphExecutor] device io binding is not supported by train graph, graph_id=%u.", graph_id);
+    return PARAM_INVALID;
+  }
+
+  // the staging buffers are not used by runs with binding
+  if (graph_id != last_graph_id_) {
+    auto ret = FreeExecuteMemory();
+    if (ret != SUCCESS) {
+      return ret;
+    }
+  }
+  last_graph_id_ = graph_id;
+
+  GE_TIMESTAMP_START(SyncExecuteModelWithIoBinding);
+  Status ret = SyncExecuteModelWithIoBinding(model_id, io_binding, output_desc);
+  GE_TIMESTAMP_END(SyncExecuteModelWithIoBinding, "GraphExecutor::ExecuteGraphWithIoBinding");
+  if (ret != SUCCESS) {
+    GELOGE(GE_GRAPH_SYNC_MODEL_FAILED, "[GraphExecutor] SyncExecuteModelWithIoBinding Error!");
+    return GE_GRAPH_SYNC_MODEL_FAILED;
+  }
+  return SUCCESS;
+}
+
 void GraphExecutor::InitModelIdInfo(std::vector<uint32_t> &out_model_id_info,
                                     std::vector<SubGraphInfoPtr> &sub_graph_vec, uint32_t output_size) {
   for (uint32_t i = 0; i < output_size; i++) {
@@ -339,6 +501,12 @@ Status GraphExecutor::FreeExecuteMemory() {
 
 Status GraphExecutor::ExecuteGraph(GraphId graph_id, const GeRootModelPtr &ge_root_model,
                                    const std::vector<GeTensor> &input_tensor, std::vector<GeTensor> &output_tensor) {
+  GE_CHECK_NOTNULL_EXEC(ge_root_model, return FAILED);
+  return ExecuteGraph(graph_id, ge_root_model->GetModelId(), input_tensor, output_tensor);
+}
+
+Status GraphExecutor::ExecuteGraph(GraphId graph_id, uint32_t model_id, const std::vector<GeTensor> &input_tensor,
+                                   std::vector<GeTensor> &output_tensor) {
   if (graph_id != last_graph_id_) {
     auto ret = FreeExecuteMemory();
     if (ret != SUCCESS) {
@@ -351,8 +519,7 @@ Status GraphExecutor::ExecuteGraph(GraphId graph_id, const GeRootModelPtr &ge_ro
     GELOGE(GE_GRAPH_EXECUTE_NOT_INIT, "[GraphExecutor] AI Core Engine without calling SetCondition!");
     return GE_GRAPH_EXECUTE_NOT_INIT;
   }
-  GE_CHECK_NOTNULL_EXEC(ge_root_model, return FAILED);
-  Status ret = SyncExecuteModel(ge_root_model->GetModelId(), input_tensor, output_tensor);
+  Status ret = SyncExecuteModel(model_id, input_tensor, output_tensor);
   if (ret != SUCCESS) {
     GELOGE(GE_GRAPH_SYNC_MODEL_FAILED, "[GraphExecutor] SyncExecuteModel Error!");
     return GE_GRAPH_SYNC_MODEL_FAILED;
@@ -49,9 +49,40 @@ class GraphExecutor {
   Status ExecuteGraph(GraphId graph_id, const GeRootModelPtr &ge_root_model, const std::vector<GeTensor> &input_tensor,
                       std::vector<GeTensor> &output_tensor);
 
+  Status ExecuteGraph(GraphId graph_id, uint32_t model_id, const std::vector<GeTensor> &input_tensor,
+                      std::vector<GeTensor> &output_tensor);
+
   ge::Status ExecuteGraphAsync(GraphId graph_id, const GeRootModelPtr &ge_root_model,
                                const std::vector<InputTensorInfo> &input_tensor);
 
+  ///
+  /// @ingroup ge
+  /// @brief execute graph with buffers bound by user, inputs are read from and outputs are written to the bound
+  ///        buffers without staging copies
+  /// @param [in] graph_id graph id
+  /// @param [in] model_id id of the loaded model of graph
+  /// @param [in] io_binding bound buffers
+  /// @param [out] output_desc real descs of outputs written to the bound buffers
+  /// @return execute result
+  ///
+  Status ExecuteGraphWithIoBinding(GraphId graph_id, uint32_t model_id, const GraphIoBinding &io_binding,
+                                   std::vector<GeTensorDesc> &output_desc);
+
+  ///
+  /// @ingroup ge
+  /// @brief execute a loaded model with buffers bound by user on the caller thread: dynamic shape models by the
+  ///        hybrid executor, static models by zero copy of the bound device buffers
+  /// @param [in] model_id id of the loaded model
+  /// @param [in] stream stream to execute static model on, null for the stream of the model
+  /// @param [in] io_binding bound buffers, they must be device memory for static models
+  /// @param [out] output_desc real descs of outputs written to the bound buffers
+  /// @return execute result
+  ///
+  static Status ExecuteModelWithIoBinding(uint32_t model_id, rtStream_t stream, const GraphIoBinding &io_binding,
+                                          std::vector<GeTensorDesc> &output_desc);
+
+  static Status CheckIoBinding(const GraphIoBinding &io_binding);
+
   Status SetCondition(std::mutex *mutex, std::condition_variable *cond, std::shared_ptr<GraphModelListener> listener);
 
   Status SetGraphContext(GraphContextPtr graph_context_ptr);
@@ -129,6 +160,18 @@ class GraphExecutor {
 
   Status AsyncExecuteModel(uint32_t model_id, const std::vector<InputTensorInfo> &input_tensor);
 
+  Status SyncExecuteModelWithIoBinding(uint32_t model_id, const GraphIoBinding &io_binding,
+                                       std::vector<GeTensorDesc> &output_desc);
+
+  static Status PrepareIoBindingData(uint32_t model_id, const GraphIoBinding &io_binding,
+                                     std::vector<InputOutputDescInfo> &outputs_desc, InputData &input_data,
+                                     OutputData &output_data);
+
+  static void ConvertIoBindingOutputDesc(const std::vector<InputOutputDescInfo> &outputs_desc,
+                                         std::vector<GeTensorDesc> &output_desc);
+
+  Status WaitExecuteResult(uint32_t model_id);
+
   void InitModelIdInfo(std::vector<uint32_t> &out_model_id_info, std::vector<SubGraphInfoPtr> &sub_graph_vec,
                        uint32_t output_size);
 
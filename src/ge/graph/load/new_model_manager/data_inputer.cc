@@ -19,10 +19,69 @@
 #include <securec.h>
 
 #include "common/debug/log.h"
+#include "common/ge/ge_util.h"
 #include "common/scope_guard.h"
 #include "common/types.h"
 
 namespace ge {
+namespace {
+// wrappers beyond it are freed when released, the pool only needs to cover the requests in flight
+const uint32_t kMaxPooledWrapperNum = 256;
+
+class InputDataWrapperPool {
+ public:
+  InputDataWrapperPool() : wrappers_(kMaxPooledWrapperNum) {}
+
+  ~InputDataWrapperPool() {
+    InputDataWrapper *wrapper = nullptr;
+    while (wrappers_.TryPop(wrapper)) {
+      delete wrapper;
+    }
+  }
+
+  InputDataWrapper *Take() {
+    InputDataWrapper *wrapper = nullptr;
+    if (wrappers_.TryPop(wrapper)) {
+      return wrapper;
+    }
+    return new (std::nothrow) InputDataWrapper();
+  }
+
+  void Give(InputDataWrapper *wrapper) {
+    wrapper->Reset();
+    if (!wrappers_.TryPush(wrapper)) {
+      delete wrapper;
+    }
+  }
+
+ private:
+  LockFreeQueue<InputDataWrapper *> wrappers_;
+};
+}  // namespace
+
+std::shared_ptr<InputDataWrapper> InputDataWrapper::Acquire() {
+  // wrappers released after static destruction still find the pool alive through their deleters
+  static std::shared_ptr<InputDataWrapperPool> pool = MakeShared<InputDataWrapperPool>();
+  if (pool == nullptr) {
+    return nullptr;
+  }
+  InputDataWrapper *wrapper = pool->Take();
+  if (wrapper == nullptr) {
+    return nullptr;
+  }
+  auto wrapper_pool = pool;
+  return std::shared_ptr<InputDataWrapper>(wrapper,
+                                           [wrapper_pool](InputDataWrapper *item) { wrapper_pool->Give(item); });
+}
+
+void InputDataWrapper::Reset() {
+  input_.blobs.clear();
+  input_.batch_label.clear();
+  input_.is_dynamic_batch = false;
+  output_.blobs.clear();
+  is_init = false;
+}
+
 domi::Status InputDataWrapper::Init(const InputData &input, const OutputData &output) {
   GE_CHK_BOOL_RET_STATUS(!is_init, domi::INTERNAL_ERROR, "InputDataWrapper is re-initialized");
 
@@ -23,6 +23,7 @@
 
 #include "common/blocking_queue.h"
 #include "common/ge_types.h"
+#include "common/lock_free_queue.h"
 #include "common/types.h"
 
 namespace ge {
@@ -37,6 +38,19 @@ class InputDataWrapper {
 
   ~InputDataWrapper() {}
 
+  ///
+  /// @ingroup domi_ome
+  /// @brief get a wrapper from the process wide pool, it goes back to the pool when the last reference is dropped
+  /// @return wrapper not initialized, nullptr if failed
+  ///
+  static std::shared_ptr<InputDataWrapper> Acquire();
+
+  ///
+  /// @ingroup domi_ome
+  /// @brief drop the data and keep the buffers of containers, so that the wrapper can be initialized again
+  ///
+  void Reset();
+
   ///
   /// @ingroup domi_ome
   /// @brief init InputData
@@ -81,7 +95,7 @@ class DataInputer {
   /// @ingroup domi_ome
   /// @brief constructor
   ///
-  DataInputer() {}
+  DataInputer() : queue_(kDefaultMaxQueueSize) {}
 
   ///
   /// @ingroup domi_ome
@@ -112,7 +126,7 @@ class DataInputer {
   /// @return INTERNAL_ERROR  add failed
   ///
   domi::Status Push(const std::shared_ptr<InputDataWrapper> &data) {
-    bool success = queue_.Push(data, false);
+    bool success = queue_.TryPush(data);
     return success ? domi::SUCCESS : domi::INTERNAL_ERROR;
   }
 
@@ -128,6 +142,19 @@ class DataInputer {
     return success ? domi::SUCCESS : domi::INTERNAL_ERROR;
   }
 
+  ///
+  /// @ingroup domi_ome
+  /// @brief wait for input data, and pop it together with the data queued after it
+  /// @param [out] data popped input data appended to it, in push order
+  /// @param [in] max_num max number of data to pop
+  /// @return SUCCESS pop success
+  /// @return INTERNAL_ERROR  pop fail
+  ///
+  domi::Status PopBatch(std::vector<std::shared_ptr<InputDataWrapper>> &data, size_t max_num) {
+    bool success = queue_.PopBatch(data, max_num);
+    return success ? domi::SUCCESS : domi::INTERNAL_ERROR;
+  }
+
   ///
   /// @ingroup domi_ome
   /// @brief stop receiving data, invoke thread at Pop
@@ -139,7 +166,7 @@ class DataInputer {
   /// @ingroup domi_ome
   /// @brief save input data queue
   ///
-  BlockingQueue<std::shared_ptr<InputDataWrapper>> queue_;
+  LockFreeQueue<std::shared_ptr<InputDataWrapper>> queue_;
 };
 }  // namespace ge
 
@@ -23,6 +23,7 @@
 #include <sched.h>
 #include <sys/prctl.h>
 #include <algorithm>
+#include <chrono>
 #include <map>
 #include <utility>
 
@@ -88,6 +89,7 @@ const uint32_t kDataMemAlignSizeCompare = 64;
 const uint32_t kDumpL1FusionOpMByteSize = 2 * 1024 * 1024;
 const uint32_t kDumpFlagOfL1Fusion = 0;
 const char *const kDefaultBatchLable = "Batch_default";
+const size_t kMaxDataBatchSize = 16;
 
 inline bool IsDataOp(const std::string &node_type) {
   return node_type == DATA_TYPE || node_type == AIPP_DATA_TYPE || node_type == ANN_DATA_TYPE;
@@ -1170,6 +1172,13 @@ Status DavinciModel::InitLabelSet(const OpDescPtr &op_desc) {
 
 Status DavinciModel::InitVariable(const OpDescPtr &op_desc) {
   variable_op_list_.push_back(op_desc);
+  string var_is_broadcast;
+  if (AttrUtils::GetStr(op_desc, VAR_ATTR_VAR_IS_BROADCAST, var_is_broadcast)) {
+    broadcast_variable_op_list_.push_back(op_desc);
+  }
+  if (op_desc->GetName() == NODE_NAME_GLOBAL_STEP) {
+    global_step_op_ = op_desc;
+  }
   return SUCCESS;
 }
 
@@ -1875,7 +1884,7 @@ Status DavinciModel::SyncVarData() {
   GELOGI("Sync var data, model id:%u", model_id_);
   Status ret = SUCCESS;
 
-  OpDescPtr global_step = GetVariableOp(NODE_NAME_GLOBAL_STEP);
+  const OpDescPtr &global_step = global_step_op_;
   if (global_step != nullptr) {
     auto v_output_size = ModelUtils::GetOutputSize(global_step);
     auto v_output_addr = ModelUtils::GetOutputDataAddrs(runtime_param_, global_step);
@@ -1889,7 +1898,7 @@ Status DavinciModel::SyncVarData() {
                            RT_MEMCPY_HOST_TO_DEVICE));
   }
 
-  for (auto op_desc : variable_op_list_) {
+  for (auto op_desc : broadcast_variable_op_list_) {
     ret =
       VarManager::Instance(session_id_)->SyncVarData(runtime_param_.graph_id, op_desc->GetName(), op_desc, mem_base_);
     GE_CHK_BOOL_EXEC(ret == SUCCESS, break, "sync var data ret failed, model id:%u, op name:%s.", model_id_,
@@ -2356,7 +2365,7 @@ Status DavinciModel::ReturnResult(uint32_t data_id, const bool rslt_flg, const b
 ///
 Status DavinciModel::ReturnNoOutput(uint32_t data_id) {
   GELOGI("ReturnNoOutput model id:%u", model_id_);
-  for (auto op_desc : variable_op_list_) {
+  for (auto op_desc : broadcast_variable_op_list_) {
     Status ret = VarManager::Instance(session_id_)
                    ->SyncBroadCastData2Var(runtime_param_.graph_id, op_desc->GetName(), op_desc, mem_base_);
     GE_CHK_BOOL_EXEC(ret == SUCCESS, break, "sync var data ret failed, model id:%u, op name:%s.", model_id_,
@@ -2386,6 +2395,9 @@ void *DavinciModel::Run(DavinciModel *model) {
   // DeviceReset before thread run finished!
   GE_MAKE_GUARD(not_used_var, [&] { GE_CHK_RT(rtDeviceReset(device_id)); });
 
+  // data queued while the model is running are taken in one go, without waking up for each of them
+  std::vector<std::shared_ptr<InputDataWrapper>> data_wrappers;
+  size_t next_data_pos = 0;
   while (model->RunFlag()) {
     bool rslt_flg = true;
     if (model->GetDataInputer() == nullptr) {
@@ -2394,9 +2406,18 @@ void *DavinciModel::Run(DavinciModel *model) {
       break;
     }
 
-    std::shared_ptr<InputDataWrapper> data_wrapper;
-    Status ret = model->GetDataInputer()->Pop(data_wrapper);
-    if (data_wrapper == nullptr || ret != SUCCESS) {
+    Status ret = SUCCESS;
+    if (next_data_pos >= data_wrappers.size()) {
+      data_wrappers.clear();
+      next_data_pos = 0;
+      ret = model->GetDataInputer()->PopBatch(data_wrappers, kMaxDataBatchSize);
+    }
+    if (ret != SUCCESS || next_data_pos >= data_wrappers.size()) {
+      GELOGI("data_wrapper is null!");
+      continue;
+    }
+    std::shared_ptr<InputDataWrapper> data_wrapper = std::move(data_wrappers[next_data_pos++]);
+    if (data_wrapper == nullptr) {
       GELOGI("data_wrapper is null!");
       continue;
     }
@@ -2404,7 +2425,7 @@ void *DavinciModel::Run(DavinciModel *model) {
 
     GE_IF_BOOL_EXEC(!model->RunFlag(), break);
 
-    InputData current_data = data_wrapper->GetInput();
+    const InputData &current_data = data_wrapper->GetInput();
     GELOGI("Model thread Run begin, model id:%u, data index:%u.", model_id, current_data.index);
 
     GE_TIMESTAMP_START(Model_SyncVarData);
@@ -2418,7 +2439,10 @@ void *DavinciModel::Run(DavinciModel *model) {
     GELOGI("Copy input data, model id:%u", model_id);
     GE_IF_BOOL_EXEC(ProfilingManager::Instance().ProfilingModelExecuteOn(),
                     model->SetProfileTime(MODEL_PRE_PROC_START));
-    ret = model->CopyInputData(current_data, false);
+    ret = model->RestoreIoTaskArgs();
+    if (ret == SUCCESS) {
+      ret = model->CopyInputData(current_data, false);
+    }
     GE_CHK_BOOL_TRUE_EXEC_WITH_LOG(
       ret != SUCCESS, (void)model->ReturnResult(current_data.index, false, false, data_wrapper->GetOutput());
       CsaInteract::GetInstance().StoreInternalErrorCode(ret, ERROR_MODULE_FMK, JOBSUBSTATE_GRAPH_EXEC);
@@ -2607,82 +2631,94 @@ void DavinciModel::UnbindTaskSinkStream() {
   }
 }
 
-Status DavinciModel::CreateKnownZeroCopyMap(const vector<void *> &inputs, const vector<void *> &outputs) {
-  GELOGI("DavinciModel::CreateKnownZeroCopyMap in.");
-  if (inputs.size() > data_op_list_.size()) {
-    GELOGE(FAILED, "input data addr %u should less than input op number %u.", inputs.size(), data_op_list_.size());
-    return FAILED;
+Status DavinciModel::UpdateKnownTaskIoAddrs() {
+  total_io_addrs_.clear();
+  for (size_t task_index = 0; task_index < task_list_.size(); ++task_index) {
+    auto &task = task_list_[task_index];
+    if (task != nullptr) {
+      Status ret = task->UpdateArgs();
+      if (ret != SUCCESS) {
+        GELOGE(FAILED, "task %zu created by davinci model update args failed.", task_index);
+        return FAILED;
+      }
+    }
   }
-  // remove zero copy addr in last iteration
-  knonw_input_data_info_.clear();
-  knonw_output_data_info_.clear();
-  for (size_t i = 0; i < inputs.size(); ++i) {
+  // cache latest iterator io addr
+  orig_total_io_addrs_ = total_io_addrs_;
+  return SUCCESS;
+}
+
+Status DavinciModel::BuildKnownIoArgSlots() {
+  GELOGI("DavinciModel::BuildKnownIoArgSlots in.");
+  std::map<const void *, size_t> input_indexes;
+  for (size_t i = 0; i < data_op_list_.size(); ++i) {
     const vector<void *> addr_list = ModelUtils::GetOutputDataAddrs(runtime_param_, data_op_list_[i]);
-    knonw_input_data_info_[addr_list[kDataIndex]] = inputs[i];
-    GELOGI("DavinciModel::CreateKnownZeroCopyMap input %d,v addr %p,p addr %p .", i, addr_list[kDataIndex], inputs[i]);
+    GE_CHK_BOOL_RET_STATUS(addr_list.size() > kDataIndex, FAILED, "output addr of data op %zu is empty.", i);
+    input_indexes[addr_list[kDataIndex]] = i;
   }
+  std::map<const void *, size_t> output_indexes;
   if (output_op_list_.size() < kOutputNum) {
-    GELOGW("output op num in graph is %u.", output_op_list_.size());
-    return SUCCESS;
-  }
-  const vector<void *> addr_list = ModelUtils::GetInputDataAddrs(runtime_param_, output_op_list_[kDataIndex]);
-  for (size_t i = 0; i < addr_list.size() && i < outputs.size(); ++i) {
-    knonw_output_data_info_[addr_list[i]] = outputs[i];
-    GELOGI("DavinciModel::CreateKnownZeroCopyMap output %d,v addr %p,p addr %p .", i, addr_list[i], outputs[i]);
+    GELOGW("output op num in graph is %zu.", output_op_list_.size());
+  } else {
+    const vector<void *> addr_list = ModelUtils::GetInputDataAddrs(runtime_param_, output_op_list_[kDataIndex]);
+    for (size_t i = 0; i < addr_list.size(); ++i) {
+      output_indexes[addr_list[i]] = i;
+    }
   }
-  GELOGI("DavinciModel::CreateKnownZeroCopyMap success.");
-  return SUCCESS;
-}
 
-Status DavinciModel::UpdateKnownZeroCopyAddr() {
-  for (size_t i = 0; i < total_io_addrs_.size(); ++i) {
-    auto it_in = knonw_input_data_info_.find(total_io_addrs_[i]);
-    if (it_in != knonw_input_data_info_.end()) {
-      GELOGI("DavinciModel::UpdateKnownZeroCopyAddr input %d,v addr %p,p addr %p .", i, total_io_addrs_[i],
-             knonw_input_data_info_.at(total_io_addrs_[i]));
-      total_io_addrs_[i] = knonw_input_data_info_.at(total_io_addrs_[i]);
+  known_io_arg_slots_.clear();
+  for (size_t i = 0; i < orig_total_io_addrs_.size(); ++i) {
+    auto it_in = input_indexes.find(orig_total_io_addrs_[i]);
+    if (it_in != input_indexes.end()) {
+      known_io_arg_slots_.push_back({i, true, it_in->second});
+      continue;
     }
-    auto it_out = knonw_output_data_info_.find(total_io_addrs_[i]);
-    if (it_out != knonw_output_data_info_.end()) {
-      GELOGI("DavinciModel::UpdateKnownZeroCopyAddr output %d,v addr %p,p addr %p .", i, total_io_addrs_[i],
-             knonw_output_data_info_.at(total_io_addrs_[i]));
-      total_io_addrs_[i] = knonw_output_data_info_.at(total_io_addrs_[i]);
+    auto it_out = output_indexes.find(orig_total_io_addrs_[i]);
+    if (it_out != output_indexes.end()) {
+      known_io_arg_slots_.push_back({i, false, it_out->second});
     }
   }
-  GELOGI("DavinciModel::UpdateKnownZeroCopyAddr success.");
+  GELOGI("DavinciModel::BuildKnownIoArgSlots success, %zu of %zu args are model inputs or outputs.",
+         known_io_arg_slots_.size(), orig_total_io_addrs_.size());
+  return SUCCESS;
+}
+
+Status DavinciModel::InitKnownNodeArgs() {
+  GE_CHK_STATUS_RET(UpdateKnownTaskIoAddrs(), "DavinciModel::InitKnownNodeArgs update io addrs of tasks failed.");
+  GE_CHK_STATUS_RET(BuildKnownIoArgSlots(), "DavinciModel::InitKnownNodeArgs build io args slots failed.");
+  base_addr_not_changed_ = true;
   return SUCCESS;
 }
 
 Status DavinciModel::UpdateKnownNodeArgs(const vector<void *> &inputs, const vector<void *> &outputs) {
   GELOGI("DavinciModel::UpdateKnownNodeArgs in");
-  GE_CHK_STATUS_RET(CreateKnownZeroCopyMap(inputs, outputs),
-                    "DavinciModel::UpdateKnownNodeArgs create map for input/output zero copy.");
   if (!base_addr_not_changed_) {
-    total_io_addrs_.clear();
-    orig_total_io_addrs_.clear();
-    for (size_t task_index = 0; task_index < task_list_.size(); ++task_index) {
-      auto &task = task_list_[task_index];
-      if (task != nullptr) {
-        Status ret = task->UpdateArgs();
-        if (ret != SUCCESS) {
-          GELOGE(FAILED, "task %d created by davinci model is nullptr.", task_index);
-          return FAILED;
-        }
-      }
-    }
-    // cache latest iterator io addr
-    orig_total_io_addrs_ = total_io_addrs_;
-  } else {
-    total_io_addrs_ = orig_total_io_addrs_;
+    // io addrs in the feature map move with the mem base, the slots holding model inputs and outputs stay
+    GE_CHK_STATUS_RET(UpdateKnownTaskIoAddrs(), "DavinciModel::UpdateKnownNodeArgs update io addrs of tasks failed.");
+    base_addr_not_changed_ = true;
+  } else if (known_args_uploaded_ && (inputs == last_known_inputs_) && (outputs == last_known_outputs_)) {
+    GELOGI("DavinciModel::UpdateKnownNodeArgs addresses not changed, skip updating device args.");
+    return SUCCESS;
+  }
+
+  total_io_addrs_ = orig_total_io_addrs_;
+  for (const auto &slot : known_io_arg_slots_) {
+    const vector<void *> &addrs = slot.is_input ? inputs : outputs;
+    GE_CHK_BOOL_RET_STATUS(slot.io_index < addrs.size(), PARAM_INVALID, "%s %zu of known node is missing, size %zu.",
+                           slot.is_input ? "input" : "output", slot.io_index, addrs.size());
+    total_io_addrs_[slot.io_addr_index] = addrs[slot.io_index];
   }
-  GE_CHK_STATUS_RET(UpdateKnownZeroCopyAddr(), "DavinciModel::UpdateKnownZeroCopyAddr failed.");
 
   uint32_t total_addr_size = total_io_addrs_.size() * sizeof(uint64_t);
   GELOGI("DavinciModel::UpdateKnownNodeArgs device args %p, dst size %u, src size %u", args_, total_args_size_,
          total_addr_size);
 
+  known_args_uploaded_ = false;
   Status rt_ret = rtMemcpy(args_, total_args_size_, total_io_addrs_.data(), total_addr_size, RT_MEMCPY_HOST_TO_DEVICE);
   GE_IF_BOOL_EXEC(rt_ret != RT_ERROR_NONE, GELOGE(rt_ret, "rtMemcpy error, ret: Ox%X", rt_ret); return FAILED;)
+  last_known_inputs_ = inputs;
+  last_known_outputs_ = outputs;
+  known_args_uploaded_ = true;
 
   GELOGI("DavinciModel::UpdateKnownNodeArgs success");
   return SUCCESS;
@@ -2690,6 +2726,7 @@ Status DavinciModel::UpdateKnownNodeArgs(const vector<void *> &inputs, const vec
 
 Status DavinciModel::InitTaskInfo(domi::ModelTaskDef &model_task_def) {
   GELOGI("InitTaskInfo in, task size %zu", model_task_def.task().size());
+  auto start_time = std::chrono::steady_clock::now();
   task_list_.resize(model_task_def.task_size());
   for (int i = 0; i < model_task_def.task_size(); ++i) {
     // dynamic shape will create task_list_ before
@@ -2698,13 +2735,28 @@ Status DavinciModel::InitTaskInfo(domi::ModelTaskDef &model_task_def) {
       task_list_[i] = TaskInfoFactory::Instance().Create(static_cast<rtModelTaskType_t>(task.type()));
     }
     GE_CHECK_NOTNULL(task_list_[i]);
-    Status ret = task_list_[i]->Init(task, this);
+    // args of known node are in the memory malloced by MallocKnownArgs
+    if (!known_node_) {
+      GE_CHK_STATUS_RET(task_list_[i]->ReserveArgs(task, this), "Task index %d reserve args failed.", i);
+    }
+  }
+  GE_CHK_STATUS_RET(args_arena_.Malloc(), "Malloc task args arena failed.");
+
+  for (int i = 0; i < model_task_def.task_size(); ++i) {
+    Status ret = task_list_[i]->Init(model_task_def.task(i), this);
     if (ret != SUCCESS) {
       GELOGE(ret, "Task index %d init failed.", i);
       return ret;
     }
   }
-  GELOGI("InitTaskInfo out");
+  GE_CHK_STATUS_RET(args_arena_.Upload(), "Upload task args arena failed.");
+  // host time of the init, with the arena counts it shows whether the args of the tasks still cost a copy each
+  auto cost_us =
+    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time).count();
+  const TaskArgsArenaStats &arena_stats = args_arena_.GetStats();
+  GELOGI("InitTaskInfo out, %d tasks inited in %ld us, %lu args buffers in arena, %lu allocated alone",
+         model_task_def.task_size(), static_cast<int64_t>(cost_us), arena_stats.alloc_count,
+         arena_stats.fallback_count);
   return SUCCESS;
 }
 
@@ -3063,7 +3115,7 @@ Status DavinciModel::UpdateIoTaskArgs(const std::map<uint32_t, ZeroCopyOffset> &
     void *basic_addr = data.second.GetBasicAddr();
     uint64_t data_size = data.second.GetDataSize();
     if (copy_only_addrs_.count(basic_addr) > 0) {
-      if (is_input) {
+      if (is_input && (buffer.data != basic_addr)) {
         GELOGI("[IMAS] Find addr %p need direct copy from user malloc input %p", basic_addr, buffer.data);
         if (rtMemcpy(basic_addr, data_size, buffer.data, buffer.length, RT_MEMCPY_DEVICE_TO_DEVICE) != RT_ERROR_NONE) {
           GELOGE(FAILED, "Non-zero copy data node copy failed");
@@ -3097,6 +3149,41 @@ Status DavinciModel::UpdateIoTaskArgs(const std::map<uint32_t, ZeroCopyOffset> &
   return SUCCESS;
 }
 
+Status DavinciModel::RestoreIoTaskArgs() {
+  if (!is_io_args_bound_) {
+    return SUCCESS;
+  }
+
+  // Model io memory fed as user buffers maps every virtual address of zero copy tasks to itself.
+  auto gen_blobs = [](const std::map<uint32_t, ZeroCopyOffset> &data_info, vector<DataBuffer> &blobs) {
+    blobs.resize(data_info.size());
+    for (const auto &data : data_info) {
+      if (data.first >= blobs.size()) {
+        GELOGE(FAILED, "Invalid data index %u, data num is %zu", data.first, blobs.size());
+        return FAILED;
+      }
+      blobs[data.first] = DataBuffer(data.second.GetBasicAddr(), data.second.GetDataSize(), false);
+    }
+    return SUCCESS;
+  };
+
+  vector<DataBuffer> input_blobs;
+  vector<DataBuffer> output_blobs;
+  GE_CHK_STATUS_RET(gen_blobs(new_input_data_info_, input_blobs), "[ZCPY] Generate input blobs failed.");
+  GE_CHK_STATUS_RET(gen_blobs(new_output_data_info_, output_blobs), "[ZCPY] Generate output blobs failed.");
+  GE_CHK_STATUS_RET(UpdateIoTaskArgs(new_input_data_info_, true, input_blobs, false, io_args_batch_label_),
+                    "[ZCPY] Restore input task args failed.");
+  GE_CHK_STATUS_RET(UpdateIoTaskArgs(new_output_data_info_, false, output_blobs, false, io_args_batch_label_),
+                    "[ZCPY] Restore output task args failed.");
+  for (ZeroCopyTask &task : zero_copy_tasks_) {
+    GE_CHK_STATUS_RET(task.DistributeParam(false, rt_model_stream_), "[ZCPY] Restore args failed.");
+  }
+
+  is_io_args_bound_ = false;
+  GELOGI("[ZCPY] Task args restored to model io memory, model id: %u", model_id_);
+  return SUCCESS;
+}
+
 ///
 /// @ingroup ge
 /// @brief get unique identification for op when load two or more models
@@ -3455,6 +3542,8 @@ Status DavinciModel::NnExecute(rtStream_t stream, bool async_mode, const InputDa
   Status ret = CopyModelData(input_data, output_data, is_dynamic_);
   GE_CHK_BOOL_TRUE_EXEC_WITH_LOG(ret != SUCCESS, return ret, "Copy input data to model failed. model id: %u",
                                  model_id_);
+  is_io_args_bound_ = true;
+  io_args_batch_label_ = input_data.batch_label;
 
   GELOGI("current_data.index=%u", input_data.index);
   GE_IF_BOOL_EXEC(ProfilingManager::Instance().ProfilingModelExecuteOn(), SetProfileTime(MODEL_PRE_PROC_END));
@@ -36,6 +36,7 @@
 #include "graph/load/new_model_manager/data_dumper.h"
 #include "graph/load/new_model_manager/data_inputer.h"
 #include "graph/load/new_model_manager/model_utils.h"
+#include "graph/load/new_model_manager/task_args_arena.h"
 #include "graph/load/new_model_manager/zero_copy_offset.h"
 #include "graph/load/new_model_manager/zero_copy_task.h"
 #include "graph/model.h"
@@ -458,6 +459,7 @@ class DavinciModel {
     runtime_param_.mem_base = mem_base;
     mem_base_ = mem_base;
   }
+  TaskArgsArena &GetArgsArena() { return args_arena_; }
   void SetTotalArgsSize(uint32_t args_size) { total_args_size_ += args_size; }
   uint32_t GetTotalArgsSize() { return total_args_size_; }
   void *GetCurrentArgsAddr(uint32_t offset) {
@@ -483,9 +485,13 @@ class DavinciModel {
   void SetKnownNode(bool known_node) { known_node_ = known_node; }
   bool IsKnownNode() { return known_node_; }
   Status MallocKnownArgs();
+  ///
+  /// @ingroup ge
+  /// @brief resolve the args slots holding model inputs and outputs, once the known node model is initialized
+  /// @return Status
+  ///
+  Status InitKnownNodeArgs();
   Status UpdateKnownNodeArgs(const vector<void *> &inputs, const vector<void *> &outputs);
-  Status CreateKnownZeroCopyMap(const vector<void *> &inputs, const vector<void *> &outputs);
-  Status UpdateKnownZeroCopyAddr();
   void SetKnownNodeAddrNotChanged(bool base_addr_not_changed) { base_addr_not_changed_ = base_addr_not_changed; }
 
   Status GetOrigInputInfo(uint32_t index, OriginInputInfo &orig_input_info);
@@ -573,6 +579,14 @@ class DavinciModel {
   Status UpdateIoTaskArgs(const std::map<uint32_t, ZeroCopyOffset> &data_info, bool is_input,
                           const vector<DataBuffer> &blobs, bool is_dynamic, const string &batch_label);
 
+  ///
+  /// @ingroup ge
+  /// @brief Point zero copy tasks back to model io memory after NnExecute patched them with user buffers, the model
+  ///        run thread copies data into model io memory and relies on it.
+  /// @return SUCCESS handle successfully / others handle failed
+  ///
+  Status RestoreIoTaskArgs();
+
   Status CopyInputData(const InputData &input_data, bool device_data = false);
 
   Status CopyOutputData(uint32_t data_id, OutputData &output_data, rtMemcpyKind_t kind);
@@ -614,6 +628,11 @@ class DavinciModel {
   ///
   void Shrink();
 
+  // recollect the io addrs of the tasks of a known node model for the current mem base
+  Status UpdateKnownTaskIoAddrs();
+
+  Status BuildKnownIoArgSlots();
+
   ///
   /// @ingroup ge
   /// @brief Travel all nodes and do some init.
@@ -839,6 +858,9 @@ class DavinciModel {
   vector<OpDescPtr> output_op_list_;
 
   vector<OpDescPtr> variable_op_list_;
+  // variables with broadcast info, the only ones each run syncs data for
+  vector<OpDescPtr> broadcast_variable_op_list_;
+  OpDescPtr global_step_op_;
 
   std::map<uint32_t, ZeroCopyOffset> new_input_data_info_;
   std::map<uint32_t, ZeroCopyOffset> new_output_data_info_;
@@ -892,6 +914,9 @@ class DavinciModel {
   bool is_inner_model_stream_;
 
   bool is_async_mode_;  // For NN execute, Async mode use rtMemcpyAsync on rt_model_stream_.
+  // zero copy tasks address user buffers of the last NnExecute
+  bool is_io_args_bound_{false};
+  std::string io_args_batch_label_;
   ExecuteMode last_execute_mode_;
 
   bool is_stream_list_bind_{false};
@@ -943,10 +968,22 @@ class DavinciModel {
   void *args_host_ = nullptr;
   void *fixed_addrs_ = nullptr;
   int64_t total_fixed_addr_size_ = 0;
-  std::map<const void *, void *> knonw_input_data_info_;
-  std::map<const void *, void *> knonw_output_data_info_;
+  // slot of the known node args which holds a model input or output address, patched by the caller's tensors
+  struct KnownIoArgSlot {
+    size_t io_addr_index;
+    bool is_input;
+    size_t io_index;
+  };
+  // resolved once when the model is loaded, so each iteration patches the slots instead of matching every address.
+  // the slots do not depend on the mem base, which moves every address of the feature map alike
+  std::vector<KnownIoArgSlot> known_io_arg_slots_;
+  std::vector<void *> last_known_inputs_;
+  std::vector<void *> last_known_outputs_;
+  bool known_args_uploaded_ = false;
   vector<void *> total_io_addrs_;
   vector<void *> orig_total_io_addrs_;
+  // args of the tasks of a task sink model, allocated and copied to device at once
+  TaskArgsArena args_arena_;
   bool base_addr_not_changed_ = false;
 
   vector<vector<int64_t>> batch_info_;
@@ -17,8 +17,10 @@
 #include "graph/load/new_model_manager/model_manager.h"
 
 #include <string>
+#include <thread>
 
 #include "common/dump/dump_manager.h"
+#include "common/ge/ge_util.h"
 #include "common/l2_cache_optimize.h"
 #include "common/profiling/profiling_manager.h"
 #include "common/properties_manager.h"
@@ -62,6 +64,10 @@ std::shared_ptr<ModelManager> ModelManager::GetInstance() {
 }
 
 ModelManager::ModelManager() {
+  model_map_ = MakeShared<const DavinciModelMap>();
+  hybrid_model_map_ = MakeShared<const HybridModelMap>();
+  published_model_map_.store(model_map_.get());
+  published_hybrid_model_map_.store(hybrid_model_map_.get());
   max_model_id_ = 0;
   session_id_bias_ = 0;
 }
@@ -194,13 +200,12 @@ void ModelManager::DestroyAicpuSession(uint64_t session_id) {
 
 ge::Status ModelManager::DestroyAicpuSessionForInfer(uint32_t model_id) {
   GELOGI("Destroy aicpu session for infer, model id is %u.", model_id);
-  std::lock_guard<std::mutex> lock(map_mutex_);
-  auto it = model_map_.find(model_id);
-  if (it == model_map_.end()) {
+  auto davinci_model = GetModel(model_id);
+  if (davinci_model == nullptr) {
     GELOGE(GE_EXEC_MODEL_ID_INVALID, "model id %u does not exists.", model_id);
     return GE_EXEC_MODEL_ID_INVALID;
   }
-  uint64_t session_id = it->second->GetSessionId();
+  uint64_t session_id = davinci_model->GetSessionId();
   GELOGI("Destroy aicpu session for infer, session id is %lu.", session_id);
   DestroyAicpuSession(session_id);
   return SUCCESS;
@@ -234,7 +239,7 @@ ge::Status ModelManager::CreateAicpuKernel(uint64_t session_id, uint32_t model_i
 
 ModelManager::~ModelManager() {
   std::lock_guard<std::mutex> lock(map_mutex_);
-  model_map_.clear();
+  PublishModelMap(MakeShared<const DavinciModelMap>());
   model_aicpu_kernel_.clear();
 
   GE_IF_BOOL_EXEC(device_count > 0, GE_CHK_RT(rtDeviceReset(0)));
@@ -343,30 +348,43 @@ Status ModelManager::LoadModelOnline(uint32_t &model_id, const shared_ptr<ge::Ge
 void ModelManager::InsertModel(uint32_t id, std::shared_ptr<DavinciModel> &davinci_model) {
   GE_CHK_BOOL_EXEC(davinci_model != nullptr, return, "davinci_model ptr is null, id: %u", id);
   std::lock_guard<std::mutex> lock(map_mutex_);
-  model_map_[id] = davinci_model;
+  auto new_map = MakeShared<DavinciModelMap>(*model_map_);
+  GE_CHK_BOOL_EXEC(new_map != nullptr, return, "Make shared failed, insert model failed, id: %u", id);
+  (*new_map)[id] = davinci_model;
+  PublishModelMap(new_map);
 }
 
 void ModelManager::InsertModel(uint32_t id, shared_ptr<hybrid::HybridDavinciModel> &hybrid_model) {
   GE_CHK_BOOL_EXEC(hybrid_model != nullptr, return, "hybrid_model ptr is null, id: %u", id);
   std::lock_guard<std::mutex> lock(map_mutex_);
-  hybrid_model_map_[id] = hybrid_model;
+  auto new_map = MakeShared<HybridModelMap>(*hybrid_model_map_);
+  GE_CHK_BOOL_EXEC(new_map != nullptr, return, "Make shared failed, insert hybrid model failed, id: %u", id);
+  (*new_map)[id] = hybrid_model;
+  PublishHybridModelMap(new_map);
 }
 
 Status ModelManager::DeleteModel(uint32_t id) {
   std::lock_guard<std::mutex> lock(map_mutex_);
 
-  auto it = model_map_.find(id);
-  auto hybrid_model_it = hybrid_model_map_.find(id);
-  if (it != model_map_.end()) {
+  auto it = model_map_->find(id);
+  auto hybrid_model_it = hybrid_model_map_->find(id);
+  if (it != model_map_->end()) {
     uint64_t session_id = it->second->GetSessionId();
     std::string model_key = std::to_string(session_id) + "_" + std::to_string(id);
     auto iter_aicpu_kernel = model_aicpu_kernel_.find(model_key);
     if (iter_aicpu_kernel != model_aicpu_kernel_.end()) {
       (void)model_aicpu_kernel_.erase(iter_aicpu_kernel);
     }
-    (void)model_map_.erase(it);
-  } else if (hybrid_model_it != hybrid_model_map_.end()) {
-    (void)hybrid_model_map_.erase(hybrid_model_it);
+    auto new_map = MakeShared<DavinciModelMap>(*model_map_);
+    GE_CHECK_NOTNULL(new_map);
+    (void)new_map->erase(id);
+    // executions that already fetched the model keep it alive until they return
+    PublishModelMap(new_map);
+  } else if (hybrid_model_it != hybrid_model_map_->end()) {
+    auto new_map = MakeShared<HybridModelMap>(*hybrid_model_map_);
+    GE_CHECK_NOTNULL(new_map);
+    (void)new_map->erase(id);
+    PublishHybridModelMap(new_map);
   } else {
     GELOGE(GE_EXEC_MODEL_ID_INVALID, "model id %u does not exists.", id);
     return GE_EXEC_MODEL_ID_INVALID;
@@ -376,17 +394,66 @@ Status ModelManager::DeleteModel(uint32_t id) {
 }
 
 std::shared_ptr<DavinciModel> ModelManager::GetModel(uint32_t id) {
-  std::lock_guard<std::mutex> lock(map_mutex_);
-
-  auto it = model_map_.find(id);
-  return (it == model_map_.end()) ? nullptr : it->second;
+  uint32_t reader_index = EnterRead();
+  const DavinciModelMap *model_map = published_model_map_.load();
+  auto it = model_map->find(id);
+  std::shared_ptr<DavinciModel> davinci_model = (it == model_map->end()) ? nullptr : it->second;
+  ExitRead(reader_index);
+  return davinci_model;
 }
 
 std::shared_ptr<hybrid::HybridDavinciModel> ModelManager::GetHybridModel(uint32_t id) {
+  uint32_t reader_index = EnterRead();
+  const HybridModelMap *hybrid_model_map = published_hybrid_model_map_.load();
+  auto it = hybrid_model_map->find(id);
+  std::shared_ptr<hybrid::HybridDavinciModel> hybrid_model = (it == hybrid_model_map->end()) ? nullptr : it->second;
+  ExitRead(reader_index);
+  return hybrid_model;
+}
+
+std::shared_ptr<const ModelManager::DavinciModelMap> ModelManager::GetModelMapSnapshot() {
   std::lock_guard<std::mutex> lock(map_mutex_);
+  return model_map_;
+}
+
+void ModelManager::PublishModelMap(const std::shared_ptr<const DavinciModelMap> &model_map) {
+  GE_CHK_BOOL_EXEC(model_map != nullptr, return, "model map to publish is null");
+  std::shared_ptr<const DavinciModelMap> replaced_map = model_map_;
+  model_map_ = model_map;
+  published_model_map_.store(model_map_.get());
+  // the replaced map and the models only it holds are released after the lookups that may read it
+  WaitForReaders();
+}
+
+void ModelManager::PublishHybridModelMap(const std::shared_ptr<const HybridModelMap> &hybrid_model_map) {
+  GE_CHK_BOOL_EXEC(hybrid_model_map != nullptr, return, "hybrid model map to publish is null");
+  std::shared_ptr<const HybridModelMap> replaced_map = hybrid_model_map_;
+  hybrid_model_map_ = hybrid_model_map;
+  published_hybrid_model_map_.store(hybrid_model_map_.get());
+  WaitForReaders();
+}
+
+uint32_t ModelManager::EnterRead() {
+  while (true) {
+    uint32_t epoch = reader_epoch_.load();
+    uint32_t reader_index = epoch & 1U;
+    (void)reader_counts_[reader_index].fetch_add(1);
+    // a writer that flipped the epoch in between may not wait for this counter, count again
+    if (reader_epoch_.load() == epoch) {
+      return reader_index;
+    }
+    (void)reader_counts_[reader_index].fetch_sub(1);
+  }
+}
+
+void ModelManager::ExitRead(uint32_t reader_index) { (void)reader_counts_[reader_index].fetch_sub(1); }
 
-  auto it = hybrid_model_map_.find(id);
-  return (it == hybrid_model_map_.end()) ? nullptr : it->second;
+void ModelManager::WaitForReaders() {
+  // later lookups are counted on the other counter and only see the maps published before the flip
+  uint32_t reader_index = reader_epoch_.fetch_add(1) & 1U;
+  while (reader_counts_[reader_index].load() != 0) {
+    std::this_thread::yield();
+  }
 }
 
 Status ModelManager::Unload(uint32_t model_id) {
@@ -410,7 +477,7 @@ Status ModelManager::UnloadModeldef(uint32_t model_id) {
 
 Status ModelManager::DataInput(const InputData &input_data, OutputData &output_data) {
   GELOGI("calling the DataInput");
-  shared_ptr<InputDataWrapper> data_wrap(new (std::nothrow) InputDataWrapper());
+  shared_ptr<InputDataWrapper> data_wrap = InputDataWrapper::Acquire();
   GE_CHECK_NOTNULL(data_wrap);
 
   Status status = data_wrap->Init(input_data, output_data);
@@ -468,7 +535,7 @@ Status ModelManager::DataInputTensor(uint32_t model_id, const std::vector<InputT
   output_data.model_id = model_id;
   output_data.index = 0;
 
-  shared_ptr<InputDataWrapper> data_wrap(new (std::nothrow) InputDataWrapper());
+  shared_ptr<InputDataWrapper> data_wrap = InputDataWrapper::Acquire();
   GE_CHECK_NOTNULL(data_wrap);
 
   GE_CHK_STATUS_EXEC(data_wrap->Init(input_data, output_data), return domi::PUSH_DATA_FAILED,
@@ -1250,8 +1317,21 @@ ge::Status ModelManager::SyncExecuteModel(uint32_t model_id, const vector<GeTens
   return model->Execute(inputs, outputs);
 }
 
+ge::Status ModelManager::SyncExecuteModel(uint32_t model_id, const std::vector<DataBuffer> &inputs,
+                                          const std::vector<GeTensorDesc> &input_desc, std::vector<DataBuffer> &outputs,
+                                          std::vector<GeTensorDesc> &output_desc, bool is_device_memory) {
+  auto model = GetHybridModel(model_id);
+  if (model == nullptr) {
+    GELOGE(FAILED, "Hybrid model not found. model id = %u.", model_id);
+    return FAILED;
+  }
+
+  return model->Execute(inputs, input_desc, outputs, output_desc, is_device_memory);
+}
+
 Status ModelManager::GetOpDescInfo(uint32_t device_id, uint32_t stream_id, uint32_t task_id, OpDescInfo &op_desc_info) {
-  for (const auto &model : model_map_) {
+  auto model_map = GetModelMapSnapshot();
+  for (const auto &model : *model_map) {
     auto davinci_model = model.second;
     if (davinci_model->GetDeviceId() == device_id) {
       GELOGI("Start to GetOpDescInfo of device_id: %u.", device_id);
@@ -21,8 +21,10 @@
 #include <pthread.h>
 #include <stdint.h>
 #include <algorithm>
+#include <atomic>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
@@ -144,6 +146,20 @@ class FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY ModelManager {
 
   ge::Status SyncExecuteModel(uint32_t model_id, const std::vector<GeTensor> &inputs, std::vector<GeTensor> &outputs);
 
+  ///
+  /// @ingroup domi_ome
+  /// @brief execute dynamic shape model with buffers bound by user
+  /// @param [in] model_id  model id
+  /// @param [in] inputs  input buffers
+  /// @param [in] input_desc  descs of inputs
+  /// @param [in] outputs  output buffers
+  /// @param [out] output_desc  real descs of outputs
+  /// @param [in] is_device_memory  buffers are device memory or host memory
+  ///
+  ge::Status SyncExecuteModel(uint32_t model_id, const std::vector<DataBuffer> &inputs,
+                              const std::vector<GeTensorDesc> &input_desc, std::vector<DataBuffer> &outputs,
+                              std::vector<GeTensorDesc> &output_desc, bool is_device_memory);
+
   ///
   /// @ingroup domi_ome
   /// @brief model stop
@@ -328,8 +344,44 @@ class FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY ModelManager {
 
   void GenModelId(uint32_t *id);
 
-  std::map<uint32_t, std::shared_ptr<DavinciModel>> model_map_;
-  std::map<uint32_t, std::shared_ptr<hybrid::HybridDavinciModel>> hybrid_model_map_;
+  using DavinciModelMap = std::map<uint32_t, std::shared_ptr<DavinciModel>>;
+  using HybridModelMap = std::map<uint32_t, std::shared_ptr<hybrid::HybridDavinciModel>>;
+
+  ///
+  /// @ingroup domi_ome
+  /// @brief get read-only snapshot of model registry, takes map_mutex_ so not for the execute path
+  ///
+  std::shared_ptr<const DavinciModelMap> GetModelMapSnapshot();
+
+  ///
+  /// @ingroup domi_ome
+  /// @brief replace the published model registry, caller holds map_mutex_
+  ///
+  void PublishModelMap(const std::shared_ptr<const DavinciModelMap> &model_map);
+  void PublishHybridModelMap(const std::shared_ptr<const HybridModelMap> &hybrid_model_map);
+
+  ///
+  /// @ingroup domi_ome
+  /// @brief count a lookup of the published registries, returns the reader counter to leave
+  ///
+  uint32_t EnterRead();
+  void ExitRead(uint32_t reader_index);
+
+  ///
+  /// @ingroup domi_ome
+  /// @brief wait until no lookup can still see the registries replaced before the call
+  ///
+  void WaitForReaders();
+
+  // Model registries are published copy-on-write: load/unload serialize on map_mutex_, replace the whole map and
+  // wait for the lookups counted before the replacement to leave before the replaced map is released. Lookups on the
+  // execute path never take a lock, they read the published map while counted on reader_counts_.
+  std::shared_ptr<const DavinciModelMap> model_map_;
+  std::shared_ptr<const HybridModelMap> hybrid_model_map_;
+  std::atomic<const DavinciModelMap *> published_model_map_{nullptr};
+  std::atomic<const HybridModelMap *> published_hybrid_model_map_{nullptr};
+  std::atomic<uint32_t> reader_epoch_{0};
+  std::atomic<uint32_t> reader_counts_[2] = {{0}, {0}};
   std::map<std::string, std::vector<uint64_t>> model_aicpu_kernel_;
   uint32_t max_model_id_;
   std::mutex map_mutex_;
@@ -0,0 +1,98 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "graph/load/new_model_manager/task_args_arena.h"
+
+#include "framework/common/debug/ge_log.h"
+#include "framework/common/debug/log.h"
+#include "runtime/mem.h"
+#include "securec.h"
+
+namespace ge {
+namespace {
+// every buffer starts on its own cache line, as if it was allocated alone
+const size_t kArgsAlign = 64;
+}  // namespace
+
+TaskArgsArena::~TaskArgsArena() {
+  if (device_base_ != nullptr) {
+    GE_CHK_RT(rtFree(device_base_));
+    device_base_ = nullptr;
+  }
+}
+
+size_t TaskArgsArena::AlignSize(size_t size) { return (size + kArgsAlign - 1) / kArgsAlign * kArgsAlign; }
+
+void TaskArgsArena::Reserve(size_t size) {
+  if (device_base_ == nullptr) {
+    stats_.reserved_size += AlignSize(size);
+  }
+}
+
+Status TaskArgsArena::Malloc() {
+  if (device_base_ != nullptr || stats_.reserved_size == 0) {
+    return SUCCESS;
+  }
+  host_staging_.resize(stats_.reserved_size);
+  rtError_t rt_ret = rtMalloc(reinterpret_cast<void **>(&device_base_), stats_.reserved_size, RT_MEMORY_HBM);
+  if (rt_ret != RT_ERROR_NONE) {
+    GELOGE(RT_FAILED, "Call rtMalloc failed, size = %zu, ret: 0x%X", stats_.reserved_size, rt_ret);
+    return RT_ERROR_TO_GE_STATUS(rt_ret);
+  }
+  GE_PRINT_DYNAMIC_MEMORY(rtMalloc, "task args arena.", stats_.reserved_size)
+  GELOGI("Task args arena allocated, size = %zu", stats_.reserved_size);
+  return SUCCESS;
+}
+
+void *TaskArgsArena::Allocate(const void *data, size_t size) {
+  size_t aligned_size = AlignSize(size);
+  if (device_base_ == nullptr || uploaded_ || size == 0 || aligned_size > stats_.reserved_size - stats_.used_size) {
+    stats_.fallback_count++;
+    return nullptr;
+  }
+  size_t offset = stats_.used_size;
+  if (data != nullptr) {
+    errno_t sec_ret = memcpy_s(host_staging_.data() + offset, host_staging_.size() - offset, data, size);
+    if (sec_ret != EOK) {
+      GELOGE(FAILED, "memcpy failed, ret: %d", sec_ret);
+      return nullptr;
+    }
+  }
+  stats_.used_size += aligned_size;
+  stats_.alloc_count++;
+  return device_base_ + offset;
+}
+
+Status TaskArgsArena::Upload() {
+  if (device_base_ == nullptr || uploaded_) {
+    return SUCCESS;
+  }
+  if (stats_.used_size > 0) {
+    GE_CHK_RT_RET(
+      rtMemcpy(device_base_, stats_.reserved_size, host_staging_.data(), stats_.used_size, RT_MEMCPY_HOST_TO_DEVICE));
+  }
+  uploaded_ = true;
+  std::vector<uint8_t>().swap(host_staging_);
+  GELOGI("Task args arena uploaded, %lu buffers in %zu bytes, %lu buffers allocated alone", stats_.alloc_count,
+         stats_.used_size, stats_.fallback_count);
+  return SUCCESS;
+}
+
+bool TaskArgsArena::Contains(const void *addr) const {
+  auto ptr = static_cast<const uint8_t *>(addr);
+  return (device_base_ != nullptr) && (ptr >= device_base_) && (ptr < device_base_ + stats_.reserved_size);
+}
+}  // namespace ge
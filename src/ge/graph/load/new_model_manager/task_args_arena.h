@@ -0,0 +1,91 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GE_GRAPH_LOAD_NEW_MODEL_MANAGER_TASK_ARGS_ARENA_H_
+#define GE_GRAPH_LOAD_NEW_MODEL_MANAGER_TASK_ARGS_ARENA_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "common/ge_inner_error_codes.h"
+
+namespace ge {
+struct TaskArgsArenaStats {
+  size_t reserved_size = 0;     // device memory held by the arena
+  size_t used_size = 0;         // memory handed out to tasks
+  uint64_t alloc_count = 0;     // buffers placed in the arena
+  uint64_t fallback_count = 0;  // buffers which did not fit and were left to the caller
+};
+
+///
+/// @ingroup ge
+/// @brief Device memory of the task args of a model. The sizes are reserved for all tasks before they are
+///        initialized, then the arena is allocated from device at once. Tasks are handed out device addresses as
+///        usual, while their content is only written to a host staging buffer, and the whole arena is copied to
+///        device with one copy before the tasks are distributed.
+///
+class TaskArgsArena {
+ public:
+  TaskArgsArena() = default;
+  ~TaskArgsArena();
+
+  TaskArgsArena(const TaskArgsArena &) = delete;
+  TaskArgsArena &operator=(const TaskArgsArena &) = delete;
+
+  ///
+  /// @ingroup ge
+  /// @brief reserve size for a buffer allocated later, only valid before Malloc
+  ///
+  void Reserve(size_t size);
+
+  ///
+  /// @ingroup ge
+  /// @brief allocate device memory for all the reserved buffers and the host staging buffer
+  /// @return Status
+  ///
+  Status Malloc();
+
+  ///
+  /// @ingroup ge
+  /// @brief place a buffer in the arena and stage its content for upload
+  /// @param [in] data content of buffer, nullptr to leave it uninitialized
+  /// @param [in] size size of buffer
+  /// @return device address, nullptr if the arena is not allocated, already uploaded or out of space
+  ///
+  void *Allocate(const void *data, size_t size);
+
+  ///
+  /// @ingroup ge
+  /// @brief copy the staged content to device and release the staging buffer
+  /// @return Status
+  ///
+  Status Upload();
+
+  bool Contains(const void *addr) const;
+
+  const TaskArgsArenaStats &GetStats() const { return stats_; }
+
+ private:
+  static size_t AlignSize(size_t size);
+
+  uint8_t *device_base_ = nullptr;
+  std::vector<uint8_t> host_staging_;
+  bool uploaded_ = false;
+  TaskArgsArenaStats stats_;
+};
+}  // namespace ge
+
+#endif  // GE_GRAPH_LOAD_NEW_MODEL_MANAGER_TASK_ARGS_ARENA_H_
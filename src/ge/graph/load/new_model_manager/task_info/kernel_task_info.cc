@@ -72,6 +72,13 @@ Status KernelTaskInfo::Init(const domi::TaskDef &task_def, DavinciModel *davinci
   (void)AttrUtils::GetBool(*op_desc_, ATTR_N_BATCH_SPILT, is_n_batch_spilt_);
   GELOGD("node[%s] is_n_batch_spilt %d", op_desc_->GetName().c_str(), is_n_batch_spilt_);
   (void)AttrUtils::GetInt(*op_desc_, ATTR_NAME_FUSION_GROUP_KEY, group_key_);
+  // kernels batched at build time are fused like a fusion group, if the super kernel lib is there
+  if ((group_key_ == kInvalidGroupKey) && AttrUtils::HasAttr(*op_desc_, ATTR_NAME_SUPER_KERNEL_BATCH_KEY) &&
+      skt::SuperKernelFactory::GetInstance().IsAvailable()) {
+    (void)AttrUtils::GetInt(*op_desc_, ATTR_NAME_SUPER_KERNEL_BATCH_KEY, group_key_);
+    (void)AttrUtils::GetBool(*op_desc_, ATTR_NAME_SUPER_KERNEL_BATCH_END, is_batch_end_);
+    is_auto_batch_ = true;
+  }
   has_group_key_ = (group_key_ != kInvalidGroupKey);
   GELOGD("node[%s] has_group_key_ %ld, group key is [%ld]", op_desc_->GetName().c_str(), has_group_key_, group_key_);
   // fusion_op_info
@@ -275,8 +282,8 @@ Status KernelTaskInfo::SaveSuperKernelInfo() {
   skt_info_.last_group_key = group_key_;
   skt_info_.last_dump_args = reinterpret_cast<uintptr_t>(skt_dump_args_);
   skt_info_.last_op = op_desc_;
-  // last node in a stream, just launch
-  if (IsMarkedLastNode()) {
+  // last node in a stream or a batch, just launch
+  if (is_batch_end_ || IsMarkedLastNode()) {
     return SuperKernelLaunch();
   }
   return SUCCESS;
@@ -369,7 +376,7 @@ Status KernelTaskInfo::Distribute() {
   rtError_t rt_ret = RT_ERROR_NONE;
   char *skt_enable_env = getenv("SKT_ENABLE");
   int64_t env_flag = (skt_enable_env != nullptr) ? strtol(skt_enable_env, nullptr, 10) : 0;
-  bool call_skt = ((env_flag != 0) || is_l1_fusion_enable_);
+  bool call_skt = ((env_flag != 0) || is_l1_fusion_enable_ || is_auto_batch_);
   if (kernel_type_ == cce::ccKernelType::AI_CPU || kernel_type_ == cce::ccKernelType::CUST_AI_CPU) {
     GELOGI("distribute task info kernel_type %d, flag %d", kernel_type_, dump_flag_);
     // blockDim is reserved parameter, set to 1
@@ -554,6 +561,58 @@ Status KernelTaskInfo::CalculateArgs(const domi::TaskDef &task_def, DavinciModel
   return SUCCESS;
 }
 
+Status KernelTaskInfo::ReserveArgs(const domi::TaskDef &task_def, DavinciModel *davinci_model) {
+  GE_CHECK_NOTNULL(davinci_model);
+  // the sizes mirror the buffers allocated by Init, a buffer which is not reserved is simply allocated alone
+  const domi::KernelDef &kernel_def = task_def.kernel();
+  const domi::KernelContext &context = kernel_def.context();
+  TaskArgsArena &arena = davinci_model->GetArgsArena();
+  auto kernel_type = static_cast<cce::ccKernelType>(context.kernel_type());
+  if (kernel_type == cce::ccKernelType::CUSTOMIZED) {
+    OpDescPtr op_desc = davinci_model->GetOpByIndex(context.op_index());
+    GE_CHECK_NOTNULL(op_desc);
+    size_t input_size = ModelUtils::GetInputDescs(op_desc).size();
+    size_t output_size = ModelUtils::GetOutputDescs(op_desc).size();
+    arena.Reserve(sizeof(opTensor_t) * input_size);
+    arena.Reserve(kAddrLen * input_size);
+    arena.Reserve(sizeof(opTensor_t) * output_size);
+    arena.Reserve(kAddrLen * output_size);
+    Buffer buffer;
+    if (AttrUtils::GetBytes(op_desc, ATTR_NAME_OPATTR, buffer)) {
+      arena.Reserve(buffer.GetSize());
+    }
+  } else if (kernel_type == cce::ccKernelType::AI_CPU || kernel_type == cce::ccKernelType::CUST_AI_CPU) {
+    arena.Reserve(kernel_def.kernel_ext_info().size());
+  } else if (kernel_type != cce::ccKernelType::TE && context.is_flowtable()) {
+    arena.Reserve(kernel_def.flowtable().size());
+  }
+  arena.Reserve(kernel_def.args_size());
+  return SUCCESS;
+}
+
+Status KernelTaskInfo::MallocArgsMem(void **addr, const void *data, size_t size) {
+  *addr = davinci_model_->GetArgsArena().Allocate(data, size);
+  if (*addr != nullptr) {
+    return SUCCESS;
+  }
+
+  rtError_t rt_ret = rtMalloc(addr, size, RT_MEMORY_HBM);
+  if (rt_ret != RT_ERROR_NONE) {
+    GELOGE(RT_FAILED, "Call rt api(rtMalloc) failed, size: %zu, ret: 0x%X", size, rt_ret);
+    return RT_ERROR_TO_GE_STATUS(rt_ret);
+  }
+  GE_PRINT_DYNAMIC_MEMORY(rtMalloc, "task args memory.", size)
+
+  if (data != nullptr) {
+    rt_ret = rtMemcpy(*addr, size, data, size, RT_MEMCPY_HOST_TO_DEVICE);
+    if (rt_ret != RT_ERROR_NONE) {
+      GELOGE(RT_FAILED, "Call rt api(rtMemcpy) failed, size: %zu, ret: 0x%X", size, rt_ret);
+      return RT_ERROR_TO_GE_STATUS(rt_ret);
+    }
+  }
+  return SUCCESS;
+}
+
 Status KernelTaskInfo::InitTVMTask(uint16_t offset, const domi::KernelDef &kernel_def) {
   GELOGD("Do InitTVMTask.");
   GE_CHECK_NOTNULL(davinci_model_);
@@ -589,19 +648,7 @@ Status KernelTaskInfo::InitTVMTask(uint16_t offset, const domi::KernelDef &kerne
   tensor_device_addrs.insert(tensor_device_addrs.end(), output_data_addrs.begin(), output_data_addrs.end());
   tensor_device_addrs.insert(tensor_device_addrs.end(), workspace_data_addrs.begin(), workspace_data_addrs.end());
 
-  // malloc args memory
-  rt_ret = rtMalloc(&args_, args_size_, RT_MEMORY_HBM);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_ERROR_TO_GE_STATUS(rt_ret);
-  }
-
   // copy orign args
-  rt_ret = rtMemcpy(args_, args_size_, kernel_def.args().data(), args_size_, RT_MEMCPY_HOST_TO_DEVICE);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_ERROR_TO_GE_STATUS(rt_ret);
-  }
   vector<uint8_t> args_info(args_size_);
   errno_t sec_ret = memcpy_s(args_info.data(), args_size_, kernel_def.args().data(), args_size_);
   if (sec_ret != EOK) {
@@ -615,18 +662,18 @@ Status KernelTaskInfo::InitTVMTask(uint16_t offset, const domi::KernelDef &kerne
   }
 
   // copy args
-  rt_ret = rtMemcpy(static_cast<char *>(args_) + offset, args_size_ - offset, tensor_device_addrs.data(),
-                    kAddrLen * tensor_device_addrs.size(), RT_MEMCPY_HOST_TO_DEVICE);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_ERROR_TO_GE_STATUS(rt_ret);
-  }
   sec_ret = memcpy_s(args_info.data() + offset, args_size_ - offset, tensor_device_addrs.data(),
                      kAddrLen * tensor_device_addrs.size());
   if (sec_ret != EOK) {
     GELOGE(FAILED, "memcpy failed, ret: %d", sec_ret);
     return FAILED;
   }
+
+  // malloc args memory with the args built
+  Status ret = MallocArgsMem(&args_, args_info.data(), args_size_);
+  if (ret != SUCCESS) {
+    return ret;
+  }
   skt_dump_args_ = static_cast<char *>(args_) + offset;
   if (davinci_model_->GetDumpProperties().IsLayerNeedDump(davinci_model_->Name(), davinci_model_->OmName(),
                                                           op_desc->GetName())) {
@@ -721,16 +768,9 @@ Status KernelTaskInfo::InitAICPUCustomTask(uint32_t op_index, const domi::Kernel
     return PARAM_INVALID;
   }
 
-  rtError_t rt_ret = rtMalloc(&custom_info_.attr_handle, op_attr_size, RT_MEMORY_HBM);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_ERROR_TO_GE_STATUS(rt_ret);
-  }
-
-  rt_ret = rtMemcpy(custom_info_.attr_handle, op_attr_size, buffer.GetData(), op_attr_size, RT_MEMCPY_HOST_TO_DEVICE);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_ERROR_TO_GE_STATUS(rt_ret);
+  ret = MallocArgsMem(&custom_info_.attr_handle, buffer.GetData(), op_attr_size);
+  if (ret != SUCCESS) {
+    return ret;
   }
 
   // args
@@ -754,17 +794,9 @@ Status KernelTaskInfo::InitAICPUCustomTask(uint32_t op_index, const domi::Kernel
   *(reinterpret_cast<uint64_t *>(args + ctx_.argsOffset[4])) =
     reinterpret_cast<uint64_t>(reinterpret_cast<uintptr_t>(custom_info_.attr_handle));  // arg 4
 
-  rt_ret = rtMalloc(&args_, args_size_, RT_MEMORY_HBM);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_ERROR_TO_GE_STATUS(rt_ret);
-  }
-
-  rt_ret =
-    rtMemcpy(args_, kernel_def.args_size(), kernel_def.args().data(), kernel_def.args_size(), RT_MEMCPY_HOST_TO_DEVICE);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_ERROR_TO_GE_STATUS(rt_ret);
+  ret = MallocArgsMem(&args_, kernel_def.args().data(), kernel_def.args_size());
+  if (ret != SUCCESS) {
+    return ret;
   }
 
   davinci_model_->SetZeroCopyAddr(op_desc, input_data_addrs, input_data_addrs.data(), custom_info_.input_addrs,
@@ -824,23 +856,14 @@ Status KernelTaskInfo::InitCceTask(const domi::KernelDef &kernel_def) {
   }
 
   // args
-  rtError_t rt_ret = rtMalloc(&args_, kernel_def.args_size(), RT_MEMORY_HBM);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_ERROR_TO_GE_STATUS(rt_ret);
-  }
-  GE_PRINT_DYNAMIC_MEMORY(rtMalloc, "cce task physical memory.", kernel_def.args_size())
-
-  rt_ret =
-    rtMemcpy(args_, kernel_def.args_size(), kernel_def.args().data(), kernel_def.args_size(), RT_MEMCPY_HOST_TO_DEVICE);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_ERROR_TO_GE_STATUS(rt_ret);
+  ret = MallocArgsMem(&args_, kernel_def.args().data(), kernel_def.args_size());
+  if (ret != SUCCESS) {
+    return ret;
   }
 
   // L2
   if (!sm_desc.empty()) {
-    rt_ret = rtMemAllocManaged(&sm_desc_, sm_desc.size(), RT_MEMORY_SPM);
+    rtError_t rt_ret = rtMemAllocManaged(&sm_desc_, sm_desc.size(), RT_MEMORY_SPM);
     if (rt_ret != RT_ERROR_NONE) {
       GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
       return RT_ERROR_TO_GE_STATUS(rt_ret);
@@ -912,19 +935,10 @@ Status KernelTaskInfo::InitAicpuTask(uint32_t op_index, const domi::KernelDef &k
   aicpu_param_head->extInfoAddr = reinterpret_cast<uintptr_t>(aicpu_ext_info_addr_);
   aicpu_param_head->extInfoLength = reinterpret_cast<uintptr_t>(ext_info.size());
 
-  // malloc device memory for args
-  rtError_t rt_ret = rtMalloc(static_cast<void **>(&args_), args_size_, RT_MEMORY_HBM);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api(rtMalloc) failed, ret: 0x%X", rt_ret);
-    return RT_ERROR_TO_GE_STATUS(rt_ret);
-  }
-  GE_PRINT_DYNAMIC_MEMORY(rtMalloc, "cce task physical memory.", args_size_)
-
-  // copy args to device
-  rt_ret = rtMemcpy(args_, args_size_, args_addr.get(), args_size_, RT_MEMCPY_HOST_TO_DEVICE);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api(rtMemcpy) failed, ret: 0x%X", rt_ret);
-    return RT_ERROR_TO_GE_STATUS(rt_ret);
+  // malloc device memory for args and copy args to device
+  init_ret = MallocArgsMem(&args_, args_addr.get(), args_size_);
+  if (init_ret != SUCCESS) {
+    return init_ret;
   }
 
   if (davinci_model_->GetDumpProperties().IsLayerNeedDump(davinci_model_->Name(), davinci_model_->OmName(),
@@ -949,18 +963,7 @@ Status KernelTaskInfo::InitAicpuTaskExtInfo(const std::string &ext_info) {
   if (ext_info.empty()) {
     return SUCCESS;
   }
-  auto rt_ret = rtMalloc(&aicpu_ext_info_addr_, ext_info.size(), RT_MEMORY_HBM);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "rtMalloc ext_info error: 0x%X, size=%zu", rt_ret, ext_info.size());
-    return RT_ERROR_TO_GE_STATUS(rt_ret);
-  }
-  rt_ret = rtMemcpy(aicpu_ext_info_addr_, ext_info.size(), ext_info.c_str(), ext_info.size(), RT_MEMCPY_HOST_TO_DEVICE);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "rtMemcpy ext_info error: 0x%X, size=%zu", rt_ret, ext_info.size());
-    return RT_ERROR_TO_GE_STATUS(rt_ret);
-  }
-
-  return SUCCESS;
+  return MallocArgsMem(&aicpu_ext_info_addr_, ext_info.c_str(), ext_info.size());
 }
 
 Status KernelTaskInfo::StoreInputOutputTensor(const std::vector<void *> &input_data_addrs,
@@ -969,70 +972,23 @@ Status KernelTaskInfo::StoreInputOutputTensor(const std::vector<void *> &input_d
                                               const std::vector<::tagCcAICPUTensor> &output_descs) {
   auto input_size = input_descs.size();
   auto output_size = output_descs.size();
-
-  // inputDescs
-  rtError_t rt_ret = rtMalloc(&custom_info_.input_descs, sizeof(opTensor_t) * input_size, RT_MEMORY_HBM);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_ERROR_TO_GE_STATUS(rt_ret);
-  }
-
-  for (std::size_t i = 0; i < input_size; ++i) {
-    rt_ret = rtMemcpy(static_cast<opTensor_t *>(custom_info_.input_descs) + i, sizeof(opTensor_t),
-                      const_cast<tagOpTensor *>(&input_descs[i]), sizeof(opTensor_t), RT_MEMCPY_HOST_TO_DEVICE);
-    if (rt_ret != RT_ERROR_NONE) {
-      GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-      return RT_ERROR_TO_GE_STATUS(rt_ret);
-    }
-  }
-
-  // inputAddrs
-  rt_ret = rtMalloc(&custom_info_.input_addrs, sizeof(opTensor_t) * input_size, RT_MEMORY_HBM);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_ERROR_TO_GE_STATUS(rt_ret);
-  }
-
-  if (!input_data_addrs.empty()) {
-    rt_ret = rtMemcpy(custom_info_.input_addrs, kAddrLen * input_size, &input_data_addrs[0], kAddrLen * input_size,
-                      RT_MEMCPY_HOST_TO_DEVICE);
-    if (rt_ret != RT_ERROR_NONE) {
-      GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-      return RT_ERROR_TO_GE_STATUS(rt_ret);
-    }
-  }
-
-  // outputDescs
-  rt_ret = rtMalloc(&custom_info_.output_descs, sizeof(opTensor_t) * output_size, RT_MEMORY_HBM);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_ERROR_TO_GE_STATUS(rt_ret);
-  }
-  for (std::size_t i = 0; i < output_size; ++i) {
-    rt_ret = rtMemcpy(static_cast<opTensor_t *>(custom_info_.output_descs) + i, sizeof(opTensor_t),
-                      const_cast<tagOpTensor *>(&input_descs[i]), sizeof(opTensor_t), RT_MEMCPY_HOST_TO_DEVICE);
-    if (rt_ret != RT_ERROR_NONE) {
-      GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-      return RT_ERROR_TO_GE_STATUS(rt_ret);
-    }
-  }
-
-  // outputAddrs
-  rt_ret = rtMalloc(&custom_info_.output_addrs, sizeof(opTensor_t) * output_size, RT_MEMORY_HBM);
-  if (rt_ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-    return RT_ERROR_TO_GE_STATUS(rt_ret);
-  }
-
-  if (!output_data_addrs.empty()) {
-    rt_ret = rtMemcpy(custom_info_.output_addrs, kAddrLen * output_size, &output_data_addrs[0], kAddrLen * output_size,
-                      RT_MEMCPY_HOST_TO_DEVICE);
-    if (rt_ret != RT_ERROR_NONE) {
-      GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-      return RT_ERROR_TO_GE_STATUS(rt_ret);
-    }
+  if (input_data_addrs.size() > input_size || output_data_addrs.size() > output_size) {
+    GELOGE(PARAM_INVALID, "Addr num [%zu, %zu] is more than tensor num [%zu, %zu]", input_data_addrs.size(),
+           output_data_addrs.size(), input_size, output_size);
+    return PARAM_INVALID;
   }
 
+  // every table is built on host and copied at once
+  std::vector<void *> input_addrs(input_data_addrs);
+  input_addrs.resize(input_size, nullptr);
+  std::vector<void *> output_addrs(output_data_addrs);
+  output_addrs.resize(output_size, nullptr);
+  GE_CHK_STATUS_RET_NOLOG(
+    MallocArgsMem(&custom_info_.input_descs, input_descs.data(), sizeof(opTensor_t) * input_size));
+  GE_CHK_STATUS_RET_NOLOG(MallocArgsMem(&custom_info_.input_addrs, input_addrs.data(), kAddrLen * input_size));
+  GE_CHK_STATUS_RET_NOLOG(
+    MallocArgsMem(&custom_info_.output_descs, output_descs.data(), sizeof(opTensor_t) * output_size));
+  GE_CHK_STATUS_RET_NOLOG(MallocArgsMem(&custom_info_.output_addrs, output_addrs.data(), kAddrLen * output_size));
   return SUCCESS;
 }
 
@@ -1071,6 +1027,11 @@ void KernelTaskInfo::FreeRtMem(void **ptr) {
   if (ptr == nullptr || *ptr == nullptr) {
     return;
   }
+  // memory in args arena is freed with the model
+  if (davinci_model_ != nullptr && davinci_model_->GetArgsArena().Contains(*ptr)) {
+    *ptr = nullptr;
+    return;
+  }
   rtError_t ret = rtFree(*ptr);
   if (ret != RT_ERROR_NONE) {
     GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", ret);
@@ -1155,17 +1116,9 @@ Status KernelTaskInfo::CceUpdateKernelArgs(const domi::KernelContext &context, u
 Status KernelTaskInfo::SetFlowtable(std::string &flowtable, const domi::KernelDef &kernel_def) {
   const domi::KernelContext &context = kernel_def.context();
   if (context.is_flowtable()) {
-    rtError_t rt_ret = rtMalloc(&flowtable_, flowtable.size(), RT_MEMORY_HBM);
-    if (rt_ret != RT_ERROR_NONE) {
-      GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-      return RT_ERROR_TO_GE_STATUS(rt_ret);
-    }
-    GE_PRINT_DYNAMIC_MEMORY(rtMalloc, "flowtable refresh of cce scence.", flowtable.size())
-
-    rt_ret = rtMemcpy(flowtable_, flowtable.size(), flowtable.data(), flowtable.size(), RT_MEMCPY_HOST_TO_DEVICE);
-    if (rt_ret != RT_ERROR_NONE) {
-      GELOGE(RT_FAILED, "Call rt api failed, ret: 0x%X", rt_ret);
-      return RT_ERROR_TO_GE_STATUS(rt_ret);
+    Status ret = MallocArgsMem(&flowtable_, flowtable.data(), flowtable.size());
+    if (ret != SUCCESS) {
+      return ret;
     }
 
     // modify flowtable addr in args
@@ -73,6 +73,8 @@ class KernelTaskInfo : public TaskInfo {
 
   Status CalculateArgs(const domi::TaskDef &task_def, DavinciModel *davinci_model) override;
 
+  Status ReserveArgs(const domi::TaskDef &task_def, DavinciModel *davinci_model) override;
+
   Status Release() override;
 
   cce::ccOpContext *GetCtx() override { return &ctx_; }
@@ -124,7 +126,9 @@ class KernelTaskInfo : public TaskInfo {
 
   uint8_t IsL2CpToDDR(uint8_t origain_L2_load_to_ddr);
 
-  static void FreeRtMem(void **ptr);
+  Status MallocArgsMem(void **addr, const void *data, size_t size);
+
+  void FreeRtMem(void **ptr);
 
   Status SuperKernelDistribute();
   bool IsL1FusionOp(const OpDescPtr &op_desc);
@@ -173,6 +177,9 @@ class KernelTaskInfo : public TaskInfo {
   bool is_n_batch_spilt_;
   int64_t group_key_;
   bool has_group_key_;
+  // in a super kernel batch grouped at build time, the batch is launched at its end
+  bool is_auto_batch_ = false;
+  bool is_batch_end_ = false;
   uint32_t skt_dump_flag_ = RT_KERNEL_DEFAULT;
   void *superkernel_device_args_addr_ = nullptr;
   void *superkernel_dev_nav_table_ = nullptr;
@@ -25,6 +25,11 @@ SuperKernelFactory &SuperKernelFactory::GetInstance() {
 }
 
 Status SuperKernelFactory::Init() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return InitWithoutLock();
+}
+
+Status SuperKernelFactory::InitWithoutLock() {
   if (!is_init_) {
     std::string skt_bin = "libcce_aicore.so";
     handle_ = dlopen(skt_bin.c_str(), RTLD_NOW | RTLD_GLOBAL);
@@ -52,7 +57,18 @@ Status SuperKernelFactory::Init() {
   return SUCCESS;
 }
 
+bool SuperKernelFactory::IsAvailable() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!is_checked_) {
+    is_available_ = (InitWithoutLock() == SUCCESS);
+    is_checked_ = true;
+    GELOGI("SKT: super kernel is %s.", is_available_ ? "available" : "not available");
+  }
+  return is_available_;
+}
+
 Status SuperKernelFactory::Uninitialize() {
+  std::lock_guard<std::mutex> lock(mutex_);
   is_init_ = false;
   func_stub_ = nullptr;
   func_ptr_ = nullptr;
@@ -68,7 +84,12 @@ Status SuperKernelFactory::FuseKernels(const std::vector<void *> &stub_func_list
   // Generate the nav table contents. The format is as follows:
   // [[fn_ptr_address, args_addr1], [fn_ptr_address2, args_addr2],
   // ...]
-  if (this->func_stub_ == nullptr) {
+  void *func_stub = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    func_stub = this->func_stub_;
+  }
+  if (func_stub == nullptr) {
     GELOGW("SKT: func_stub_ is empty. Please make sure init() is run first");
     return FAILED;
   }
@@ -113,7 +134,7 @@ Status SuperKernelFactory::FuseKernels(const std::vector<void *> &stub_func_list
                   GE_CHK_RT(rtFree(hbm_nav_table_addr)); return RT_ERROR_TO_GE_STATUS(rt_ret);)
   // Create the necessary metadata for the super kernel
   h =
-    std::unique_ptr<skt::SuperKernel>(new SuperKernel(this->func_stub_, hbm_nav_table_addr, nav_table_size, block_dim));
+    std::unique_ptr<skt::SuperKernel>(new SuperKernel(func_stub, hbm_nav_table_addr, nav_table_size, block_dim));
   return SUCCESS;
 }
 }  // namespace skt
@@ -17,6 +17,7 @@
 #ifndef SUPER_KERNEL_FACTORY_H
 #define SUPER_KERNEL_FACTORY_H
 
+#include <mutex>
 #include <vector>
 #include "super_kernel.h"
 #include "framework/common/debug/log.h"
@@ -30,6 +31,10 @@ class SuperKernelFactory {
   void *handle_ = nullptr;
   std::string sk_stub_name_ = "_Z21super_kernel_templatePmm";
   bool is_init_ = false;
+  bool is_checked_ = false;
+  bool is_available_ = false;
+  // models are loaded in parallel, their kernel tasks init the factory from different threads
+  std::mutex mutex_;
   SuperKernelFactory(){};
   ~SuperKernelFactory() {
     if (handle_ != nullptr) {
@@ -39,6 +44,7 @@ class SuperKernelFactory {
       }
     }
   };
+  Status InitWithoutLock();
 
  public:
   SuperKernelFactory(SuperKernelFactory const &) = delete;
@@ -46,6 +52,8 @@ class SuperKernelFactory {
   static SuperKernelFactory &GetInstance();
   Status Init();
   Status Uninitialize();
+  // whether the super kernel lib can be loaded, only tried once
+  bool IsAvailable();
   Status FuseKernels(const std::vector<void *> &stub_func_list, const std::vector<void *> &args_addr_list,
                      uint32_t block_dim, std::unique_ptr<skt::SuperKernel> &h);
 };
@@ -66,6 +66,9 @@ class TaskInfo {
 
   virtual Status CalculateArgs(const domi::TaskDef &task_def, DavinciModel *davinci_model) { return SUCCESS; }
 
+  // reserve the device memory of args in the args arena of model, called for all tasks before any of them is inited
+  virtual Status ReserveArgs(const domi::TaskDef &task_def, DavinciModel *davinci_model) { return SUCCESS; }
+
   virtual Status Release() { return SUCCESS; }
 
   virtual cce::ccOpContext *GetCtx() { return nullptr; }
@@ -116,6 +116,19 @@ const char *const kCheckPointGraph = "checkpoint_graph";
 const char *const kVectorEngine = "VectorEngine";
 const char *const kAIcoreEngine = "AIcoreEngine";
 const char *const kOffOptimize = "off_optimize";
+const uint32_t kDefaultGraphReplicaNum = 1;
+const uint32_t kMaxGraphReplicaNum = 64;
+const size_t kMaxCachedPartitions = 128;
+
+// with GE_USE_STATIC_MEMORY all models share one feature map, so no two runs of the process may overlap
+std::mutex static_memory_run_mutex;
+
+std::unique_lock<std::mutex> LockRunForStaticMemory() {
+  if (getenv(ge::kEnvGeuseStaticMemory) != nullptr) {
+    return std::unique_lock<std::mutex>(static_memory_run_mutex);
+  }
+  return std::unique_lock<std::mutex>();
+}
 
 bool IsTailingOptimization() {
   string is_tailing_optimization_option;
@@ -128,11 +141,36 @@ bool IsTailingOptimization() {
   GELOGW("OPTION_EXEC_ENABLE_TAILING_OPTIMIZATION not set, use BFSTopologicalSorting by default.");
   return false;
 }
+
+bool IsIncrementalBuild() {
+  string incremental_build;
+  if (ge::GetContext().GetOption(ge::OPTION_GRAPH_INCREMENTAL_BUILD, incremental_build) == ge::GRAPH_SUCCESS) {
+    return incremental_build == "1";
+  }
+  return false;
+}
+
+// options which change how the engines optimize and compile a partition
+std::string GetPartitionBuildContext() {
+  std::string build_context;
+  for (const std::string &option : {ge::SOC_VERSION, ge::CORE_TYPE, ge::PRECISION_MODE, ge::OP_SELECT_IMPL_MODE,
+                                     ge::BUFFER_OPTIMIZE, ge::ENABLE_SMALL_CHANNEL, ge::FUSION_SWITCH_FILE,
+                                     ge::ENABLE_COMPRESS_WEIGHT, ge::AUTO_TUNE_MODE}) {
+    std::string value;
+    (void)ge::GetContext().GetOption(option, value);
+    build_context.append(option).append("=").append(value).append(";");
+  }
+  return build_context;
+}
 }  // namespace
 
 namespace ge {
 GraphManager::GraphManager(OmgContext &omg_context)
-    : thread_run_flag_(false), graph_run_listener_(nullptr), init_flag_(false), omg_context_(omg_context) {
+    : thread_run_flag_(false),
+      graph_run_listener_(nullptr),
+      init_flag_(false),
+      omg_context_(omg_context),
+      optimized_partition_cache_(kMaxCachedPartitions) {
   SetLocalOmgContext(omg_context);
 }
 
@@ -207,12 +245,13 @@ Status GraphManager::Finalize() {
   }
 
   // check graph whether running or not
+  std::lock_guard<std::mutex> lock(run_mutex_);
   Status unload_model_ret = SUCCESS;
   Status ret;
   rtError_t rt_ret;
   for (auto iter = graph_map_.begin(); iter != graph_map_.end(); ++iter) {
     GraphNodePtr graph_node = iter->second;
-    if (graph_node->GetRunFlag()) {
+    if (graph_node->GetRunFlag() || graph_node->IsExecuting()) {
       GELOGW("[GraphManager] finalize failed, graphId=%u.", iter->first);
       unload_model_ret = GE_GRAPH_GRAPH_IS_RUNNING;
       continue;
@@ -232,6 +271,10 @@ Status GraphManager::Finalize() {
         GELOGW("[GraphManager] unload model failed, modelId=%u, graphId=%u.", ge_root_model->GetModelId(), iter->first);
         unload_model_ret = ret;
       }
+      ret = UnloadRunReplicas(graph_node);
+      if (ret != SUCCESS) {
+        unload_model_ret = ret;
+      }
       rt_ret = rtDeviceReset(GetContext().DeviceId());
       if (rt_ret != RT_ERROR_NONE) {
         GELOGW("[GraphManager] rtDeviceReset failed, modelId=%u, graphId=%u.", ge_root_model->GetModelId(),
@@ -243,6 +286,7 @@ Status GraphManager::Finalize() {
   }
   graph_map_.clear();
   cache_helper_map_.clear();
+  optimized_partition_cache_.Clear();
 
   // graph context
   if (graph_context_ != nullptr) {
@@ -486,9 +530,9 @@ Status GraphManager::ReplaceSubgraphWithOriGraph(const ComputeGraphPtr &compute_
   return SUCCESS;
 }
 
-Status GraphManager::SetSubgraph(uint64_t session_id, ComputeGraphPtr compute_graph) {
+Status GraphManager::SetSubgraph(uint64_t session_id, ComputeGraphPtr compute_graph,
+                                 Graph2SubGraphInfoList &sub_graph_map) {
   GE_CHECK_NOTNULL(compute_graph);
-  auto sub_graph_map = graph_partitioner_.GetSubGraphMap();
   std::string buffer_optimize;
   graphStatus graph_status = ge::GetContext().GetOption(BUFFER_OPTIMIZE, buffer_optimize);
   bool need_lx_fusion = (graph_status == GRAPH_SUCCESS) && (buffer_optimize != kOffOptimize);
@@ -637,6 +681,12 @@ Status GraphManager::PreRun(const GraphNodePtr &graph_node, const std::vector<Ge
   GE_CHECK_NOTNULL(graph_node->GetGraph());
   auto compute_graph = GraphUtils::GetComputeGraph(*graph_node->GetGraph());
   GE_CHECK_NOTNULL(compute_graph);
+  // in fast startup mode the ops kernel plugins are initialized here, by the first graph, and fail it as they
+  // would have failed the initialization of GE
+  std::shared_ptr<GELib> instance_ptr = GELib::GetInstance();
+  GE_CHECK_NOTNULL(instance_ptr);
+  GE_CHK_STATUS_RET(instance_ptr->OpsKernelManagerObj().EnsurePluginsInitialized(),
+                    "Initialize ops kernel plugins failed.");
   compute_graph->SetSessionID(session_id);
   auto analyzer_instance = Analyzer::GetInstance();
   GE_CHK_STATUS_RET(analyzer_instance->BuildJsonObject(session_id, compute_graph->GetGraphID()),
@@ -773,8 +823,6 @@ Status GraphManager::LoadGraph(const GeRootModelPtr &ge_root_model, const GraphN
   GELOGI("[LoadGraph] run_graph_flag[%d], graph_id[%u]", options_.run_graph_flag, graph_node->GetGraphId());
   if (options_.run_graph_flag && ge_root_model != nullptr) {
     // synchronization run graph with model
-    std::shared_ptr<GraphModelListener> model_listener = GetModelListener();
-    ModelIdInfo model_id_info;
     bool is_unknown_shape = false;
     GE_CHK_STATUS_RET(ge_root_model->CheckIsUnknownShape(is_unknown_shape));
     if (!is_unknown_shape) {
@@ -789,20 +837,105 @@ Status GraphManager::LoadGraph(const GeRootModelPtr &ge_root_model, const GraphN
       }
     }
     GE_TIMESTAMP_START(LoadGraph);
-    Status ret = GraphLoader::LoadModelOnline(model_id_info.model_id, ge_root_model, model_listener);
-    GE_TIMESTAMP_EVENT_END(LoadGraph, "GraphManager::LoadGraph");
-    if (ret != SUCCESS) {
-      GELOGE(ret, "[StartForRunGraph] LoadGraph Failed");
-      graph_node->SetRunFlag(false);
-      return ret;
+    // replicas of a former load are still loaded models, which are not referred to by the root model any more
+    std::vector<GraphRunReplicaPtr> former_replicas = graph_node->GetRunReplicas();
+    if (!former_replicas.empty()) {
+      GELOGI("[LoadGraph] unload %zu replicas of the former load, graph_id[%u].", former_replicas.size(),
+             graph_node->GetGraphId());
+      (void)GraphLoader::UnloadModel(former_replicas.front()->model_id);
+      (void)UnloadRunReplicas(graph_node);
+    }
+    // every replica is a separately loaded model with its own listener, so runs on different replicas never share
+    // the model's input queue or the completion condition
+    uint32_t replica_num = GetGraphReplicaNum();
+    for (uint32_t i = 0; i < replica_num; ++i) {
+      GraphRunReplicaPtr replica = CreateRunReplica();
+      Status ret = (replica == nullptr) ? MEMALLOC_FAILED
+                                        : GraphLoader::LoadModelOnline(replica->model_id, ge_root_model,
+                                                                       replica->listener);
+      if (ret != SUCCESS) {
+        GELOGE(ret, "[StartForRunGraph] LoadGraph Failed, replica index[%u].", i);
+        if (i > 0) {
+          ge_root_model->SetModelId(graph_node->GetRunReplicas().front()->model_id);
+          (void)GraphLoader::UnloadModel(ge_root_model->GetModelId());
+          (void)UnloadRunReplicas(graph_node);
+        }
+        graph_node->SetRunFlag(false);
+        return ret;
+      }
+      graph_node->AddRunReplica(replica);
     }
+    GE_TIMESTAMP_EVENT_END(LoadGraph, "GraphManager::LoadGraph");
     graph_node->SetLoadFlag(true);
-    ge_root_model->SetModelId(model_id_info.model_id);
+    ge_root_model->SetModelId(graph_node->GetRunReplicas().front()->model_id);
     graph_node->SetGeRootModel(ge_root_model);
+    GELOGI("[LoadGraph] graph_id[%u] is loaded with %u replicas.", graph_node->GetGraphId(), replica_num);
   }
   return SUCCESS;
 }
 
+GraphRunReplicaPtr GraphManager::CreateRunReplica() {
+  GraphRunReplicaPtr replica = MakeShared<GraphRunReplica>();
+  if (replica == nullptr) {
+    GELOGE(MEMALLOC_FAILED, "Make shared failed");
+    return nullptr;
+  }
+  replica->listener = MakeShared<GraphModelListener>(replica->sync_run_mutex, replica->condition);
+  replica->executor = MakeShared<GraphExecutor>();
+  if ((replica->listener == nullptr) || (replica->executor == nullptr)) {
+    GELOGE(MEMALLOC_FAILED, "Make shared failed");
+    return nullptr;
+  }
+  if (replica->executor->SetCondition(&replica->sync_run_mutex, &replica->condition, replica->listener) != SUCCESS) {
+    GELOGE(GE_GRAPH_RUNGRAPH_FAILED, "[LoadGraph] set condition failed.");
+    return nullptr;
+  }
+  return replica;
+}
+
+uint32_t GraphManager::GetGraphReplicaNum() {
+  std::string replica_num_str;
+  if ((ge::GetContext().GetOption(OPTION_EXEC_GRAPH_REPLICA_NUM, replica_num_str) != GRAPH_SUCCESS) ||
+      replica_num_str.empty()) {
+    return kDefaultGraphReplicaNum;
+  }
+  if (getenv(kEnvGeuseStaticMemory) != nullptr) {
+    GELOGW("Option %s=%s is ignored, runs are serialized with %s.", OPTION_EXEC_GRAPH_REPLICA_NUM,
+           replica_num_str.c_str(), kEnvGeuseStaticMemory);
+    return kDefaultGraphReplicaNum;
+  }
+  int64_t replica_num = 0;
+  try {
+    replica_num = std::stoll(replica_num_str);
+  } catch (std::invalid_argument &) {
+    replica_num = 0;
+  } catch (std::out_of_range &) {
+    replica_num = 0;
+  }
+  if ((replica_num <= 0) || (replica_num > kMaxGraphReplicaNum)) {
+    GELOGW("Option %s=%s is invalid, it should be in range [1, %u], use %u.", OPTION_EXEC_GRAPH_REPLICA_NUM,
+           replica_num_str.c_str(), kMaxGraphReplicaNum, kDefaultGraphReplicaNum);
+    return kDefaultGraphReplicaNum;
+  }
+  return static_cast<uint32_t>(replica_num);
+}
+
+// The first replica shares the model id of the root model, which is unloaded by the caller.
+Status GraphManager::UnloadRunReplicas(const GraphNodePtr &graph_node) {
+  std::vector<GraphRunReplicaPtr> replicas = graph_node->GetRunReplicas();
+  graph_node->ClearRunReplicas();
+  Status ret = SUCCESS;
+  for (size_t i = 1; i < replicas.size(); ++i) {
+    Status unload_ret = GraphLoader::UnloadModel(replicas[i]->model_id);
+    if (unload_ret != SUCCESS) {
+      GELOGW("[GraphManager] unload replica model failed, modelId=%u, graphId=%u.", replicas[i]->model_id,
+             graph_node->GetGraphId());
+      ret = unload_ret;
+    }
+  }
+  return ret;
+}
+
 Status GraphManager::LoadFromCache(const GraphNodePtr &graph_node, const ModelCacheHelperPtr &cache_helper,
                                    GeModelPtr &ge_model) {
   auto graph_id = graph_node->GetGraphId();
@@ -887,82 +1020,171 @@ Status GraphManager::SaveCacheAfterBuild(uint32_t graph_id, ge::ComputeGraphPtr
   return SUCCESS;
 }
 
-Status GraphManager::InnerRunGraph(GraphNodePtr &graph_node, const GraphId &graph_id,
+Status GraphManager::InnerRunGraph(const GraphRunReplicaPtr &replica, const GraphId &graph_id,
                                    const std::vector<GeTensor> &inputs, std::vector<GeTensor> &outputs) {
-  Status ret = graph_executor_.SetCondition(&sync_run_mutex_, &condition_, graph_run_listener_);
+  GraphExecutor &executor = *replica->executor;
+  if (GetTrainFlag()) {
+    GE_CHK_STATUS_RET(executor.SetGraphContext(GetGraphContext()));
+    executor.SetTrainFlag(options_.train_graph_flag);
+  }
+  Status ret = executor.ExecuteGraph(graph_id, replica->model_id, inputs, outputs);
   if (ret != SUCCESS) {
-    GELOGE(GE_GRAPH_RUNGRAPH_FAILED, "[RunGraph] set condition failed, graph_id = %u.", graph_id);
-    graph_node->SetRunFlag(false);
-    return GE_GRAPH_RUNGRAPH_FAILED;
+    GELOGE(ret, "[RunGraph] execute graph failed, graph_id = %u, model_id = %u.", graph_id, replica->model_id);
+    return ret;
   }
+  return SUCCESS;
+}
 
-  if (GetTrainFlag()) {
-    GE_CHK_STATUS_RET(graph_executor_.SetGraphContext(GetGraphContext()));
-    graph_executor_.SetTrainFlag(options_.train_graph_flag);
+Status GraphManager::ExecuteOnRunReplica(const GraphNodePtr &graph_node,
+                                         const std::function<Status(const GraphRunReplicaPtr &)> &execute) {
+  Status ret = SUCCESS;
+  GraphRunReplicaPtr replica = graph_node->AcquireRunReplica();
+  if (replica != nullptr) {
+    std::unique_lock<std::mutex> static_memory_lock = LockRunForStaticMemory();
+    ret = execute(replica);
+    graph_node->ReleaseRunReplica(replica);
+  } else {
+    GELOGE(GE_GRAPH_NOT_INIT, "Graph is not loaded for synchronous run, graph_id = %u.", graph_node->GetGraphId());
+    ret = GE_GRAPH_NOT_INIT;
   }
-  ret = graph_executor_.ExecuteGraph(graph_id, graph_node->GetGeRootModel(), inputs, outputs);
+  graph_node->UnpinForRun();
+  return ret;
+}
 
-  graph_node->SetRunFlag(false);
-  if (ret != SUCCESS) {
-    GELOGE(ret, "[RunGraph] execute graph failed, graph_id = %u.", graph_id);
-    return ret;
+Status GraphManager::RegisterIoBinding(const GraphId &graph_id, const GraphIoBinding &io_binding) {
+  for (const auto &buffer : io_binding.inputs) {
+    GE_CHK_BOOL_RET_STATUS(buffer.data != nullptr || buffer.length == 0, PARAM_INVALID,
+                           "[RegisterIoBinding] input buffer is null, graph_id = %u.", graph_id);
+  }
+  for (const auto &buffer : io_binding.outputs) {
+    GE_CHK_BOOL_RET_STATUS(buffer.data != nullptr || buffer.length == 0, PARAM_INVALID,
+                           "[RegisterIoBinding] output buffer is null, graph_id = %u.", graph_id);
   }
+
+  std::lock_guard<std::mutex> lock(io_binding_mutex_);
+  io_bindings_[graph_id] = io_binding;
+  GELOGI("[RegisterIoBinding] graph_id = %u, input num = %zu, output num = %zu, device memory = %d.", graph_id,
+         io_binding.inputs.size(), io_binding.outputs.size(), io_binding.is_device_memory);
   return SUCCESS;
 }
 
-Status GraphManager::RunGraph(const GraphId &graph_id, const std::vector<GeTensor> &inputs,
-                              std::vector<GeTensor> &outputs, uint64_t session_id) {
-  std::lock_guard<std::mutex> lock(run_mutex_);
-  GELOGI("[RunGraph] start to run graph, graph_id = %u, is_train_graph: %d", graph_id, GetTrainFlag());
+Status GraphManager::UnregisterIoBinding(const GraphId &graph_id) {
+  std::lock_guard<std::mutex> lock(io_binding_mutex_);
+  if (io_bindings_.erase(graph_id) > 0) {
+    GELOGI("[UnregisterIoBinding] graph_id = %u.", graph_id);
+  }
+  return SUCCESS;
+}
 
-  if (inputs.empty()) {
-    GELOGI("[RunGraph] initialize sub graph has no inputs");
+Status GraphManager::RunGraphWithIoBinding(const GraphId &graph_id, std::vector<GeTensorDesc> &output_desc) {
+  GraphIoBinding io_binding;
+  {
+    std::lock_guard<std::mutex> lock(io_binding_mutex_);
+    auto iter = io_bindings_.find(graph_id);
+    if (iter == io_bindings_.end()) {
+      GELOGE(PARAM_INVALID, "[RunGraphWithIoBinding] io binding of graph is not registered, graph_id = %u.", graph_id);
+      return PARAM_INVALID;
+    }
+    io_binding = iter->second;
   }
 
-  // find graph
   GraphNodePtr graph_node = nullptr;
-  Status ret = GetGraphNode(graph_id, graph_node);
+  {
+    std::lock_guard<std::mutex> lock(run_mutex_);
+    Status ret = GetGraphNode(graph_id, graph_node);
+    if (ret != SUCCESS) {
+      GELOGE(ret, "[RunGraphWithIoBinding] graph not exist, graph_id = %u.", graph_id);
+      return ret;
+    }
+    GE_CHECK_NOTNULL(graph_node);
+    // binding does not carry tensors to build the graph with, it is built and loaded by its first RunGraph
+    if (!graph_node->GetLoadFlag() || (graph_node->GetGeRootModel() == nullptr)) {
+      GELOGE(GE_GRAPH_NOT_INIT, "[RunGraphWithIoBinding] graph is not loaded, graph_id = %u.", graph_id);
+      return GE_GRAPH_NOT_INIT;
+    }
+    graph_node->PinForRun();
+  }
+
+  Status ret = ExecuteOnRunReplica(graph_node, [&](const GraphRunReplicaPtr &replica) {
+    GraphExecutor &executor = *replica->executor;
+    if (GetTrainFlag()) {
+      executor.SetTrainFlag(options_.train_graph_flag);
+    }
+    return executor.ExecuteGraphWithIoBinding(graph_id, replica->model_id, io_binding, output_desc);
+  });
   if (ret != SUCCESS) {
-    GELOGE(ret, "[RunGraph] graph not exist, graph_id = %u.", graph_id);
+    GELOGE(ret, "[RunGraphWithIoBinding] execute graph failed, graph_id = %u.", graph_id);
     return ret;
   }
+  return SUCCESS;
+}
 
-  if (graph_node == nullptr) {
-    GELOGE(GE_GRAPH_GRAPH_NODE_NULL, "[RunGraph] graph node is NULL, graph_id = %u.", graph_id);
-    return GE_GRAPH_GRAPH_NODE_NULL;
-  }
+Status GraphManager::RunGraph(const GraphId &graph_id, const std::vector<GeTensor> &inputs,
+                              std::vector<GeTensor> &outputs, uint64_t session_id) {
+  GraphNodePtr graph_node = nullptr;
+  ComputeGraphPtr compute_graph_tmp = nullptr;
+  Status ret = SUCCESS;
+  {
+    // Build and load are serialized, the execution below only holds one replica of the graph.
+    std::lock_guard<std::mutex> lock(run_mutex_);
+    GELOGI("[RunGraph] start to run graph, graph_id = %u, is_train_graph: %d", graph_id, GetTrainFlag());
 
-  if (graph_node->GetRunFlag()) {
-    GELOGE(GE_GRAPH_ALREADY_RUNNING, "[RunGraph] graph already running, graph id = %u", graph_id);
-    return GE_GRAPH_ALREADY_RUNNING;
-  }
-  // set graph's run flag
-  graph_node->SetRunFlag(true);
-  ComputeGraphPtr compute_graph_tmp = GraphUtils::GetComputeGraph(*(graph_node->GetGraph()));
+    if (inputs.empty()) {
+      GELOGI("[RunGraph] initialize sub graph has no inputs");
+    }
 
-  GE_IF_BOOL_EXEC(
-    GetTrainFlag(),
-    GE_IF_BOOL_EXEC(compute_graph_tmp == nullptr,
-                    GELOGE(GE_GRAPH_GRAPH_NODE_NULL, "[RunGraph] compute_graph_tmp is NULL, graph id = %u.", graph_id);
-                    return GE_GRAPH_GRAPH_NODE_NULL;))
+    // find graph
+    ret = GetGraphNode(graph_id, graph_node);
+    if (ret != SUCCESS) {
+      GELOGE(ret, "[RunGraph] graph not exist, graph_id = %u.", graph_id);
+      return ret;
+    }
 
-  // when set incre build, add cache helper map
-  AddModelCacheHelperToMap(graph_id, session_id, compute_graph_tmp);
+    if (graph_node == nullptr) {
+      GELOGE(GE_GRAPH_GRAPH_NODE_NULL, "[RunGraph] graph node is NULL, graph_id = %u.", graph_id);
+      return GE_GRAPH_GRAPH_NODE_NULL;
+    }
 
-  if (options_.local_fmk_op_flag) {
-    graph_optimize_.TranFrameOp(compute_graph_tmp);
-  }
+    if (graph_node->GetRunFlag()) {
+      GELOGE(GE_GRAPH_ALREADY_RUNNING, "[RunGraph] graph already running, graph id = %u", graph_id);
+      return GE_GRAPH_ALREADY_RUNNING;
+    }
+    // set graph's run flag
+    graph_node->SetRunFlag(true);
+    compute_graph_tmp = GraphUtils::GetComputeGraph(*(graph_node->GetGraph()));
 
-  GeRootModelPtr ge_root_model = nullptr;
-  ret = StartForRunGraph(graph_node, inputs, ge_root_model, session_id);
-  if (ret != SUCCESS) {
-    GELOGE(ret, "[RunGraph] StartForRunGraph failed!");
+    GE_IF_BOOL_EXEC(GetTrainFlag(),
+                    GE_IF_BOOL_EXEC(compute_graph_tmp == nullptr,
+                                    GELOGE(GE_GRAPH_GRAPH_NODE_NULL,
+                                           "[RunGraph] compute_graph_tmp is NULL, graph id = %u.", graph_id);
+                                    graph_node->SetRunFlag(false); return GE_GRAPH_GRAPH_NODE_NULL;))
+
+    // when set incre build, add cache helper map
+    AddModelCacheHelperToMap(graph_id, session_id, compute_graph_tmp);
+
+    if (options_.local_fmk_op_flag) {
+      graph_optimize_.TranFrameOp(compute_graph_tmp);
+    }
+
+    GeRootModelPtr ge_root_model = nullptr;
+    ret = StartForRunGraph(graph_node, inputs, ge_root_model, session_id);
+    if (ret != SUCCESS) {
+      GELOGE(ret, "[RunGraph] StartForRunGraph failed!");
+      graph_node->SetRunFlag(false);
+      return ret;
+    }
+    // the loaded model is kept until the execution below unpins it, RemoveGraph and memory release skip it
+    graph_node->PinForRun();
     graph_node->SetRunFlag(false);
-    return ret;
   }
 
   // excute graph
-  ret = InnerRunGraph(graph_node, graph_id, inputs, outputs);
+  std::vector<InputOutputDescInfo> outputs_desc;
+  ret = ExecuteOnRunReplica(graph_node, [&](const GraphRunReplicaPtr &replica) {
+    Status run_ret = InnerRunGraph(replica, graph_id, inputs, outputs);
+    outputs_desc = replica->executor->GetOutputsDesc();
+    return run_ret;
+  });
   if (ret != SUCCESS) {
     return ret;
   }
@@ -980,7 +1202,7 @@ Status GraphManager::RunGraph(const GraphId &graph_id, const std::vector<GeTenso
       GELOGI("Start CheckpointHandle.");
       auto checkPointGraph = root_model->GetRootGraph();
       if (IsCheckpointGraph(checkPointGraph)) {
-        ret = CheckpointHandle(graph_id, checkPointGraph, outputs);
+        ret = CheckpointHandle(graph_id, checkPointGraph, outputs, outputs_desc);
         if (ret != SUCCESS) {
           GELOGE(ret, "[RunGraph] CheckpointHandle failed!");
         }
@@ -1072,6 +1294,8 @@ Status GraphManager::BuildGraphForUnregisteredOp(const GraphId &graph_id, const
 Status GraphManager::BuildGraph(const GraphId &graph_id, const std::vector<GeTensor> &inputs,
                                 GeRootModelPtr &ge_root_model, uint64_t session_id, bool async) {
   GELOGI("[BuildGraph] start to build graph, graph_id=%u.", graph_id);
+  // loading may release the memory of other graphs, which must not race with their runs
+  std::lock_guard<std::mutex> lock(run_mutex_);
   if (inputs.empty()) {
     GELOGW("[BuildGraph] BuildGraph warning: empty GeTensor inputs");
   }
@@ -1150,6 +1374,8 @@ bool GraphManager::CheckModelLoad(const GeRootModelPtr &ge_root_model, bool load
 }
 
 Status GraphManager::RemoveGraph(const GraphId &graph_id) {
+  // a run pins the graph under run_mutex_, so the graph can not start executing once it is checked below
+  std::lock_guard<std::mutex> lock(run_mutex_);
   auto it = graph_map_.find(graph_id);
   if (it == graph_map_.end()) {
     GELOGE(GE_GRAPH_GRAPH_NOT_EXIST, "[GraphManager] Id %u does not exists.", graph_id);
@@ -1157,7 +1383,7 @@ Status GraphManager::RemoveGraph(const GraphId &graph_id) {
   }
 
   GraphNodePtr graph_node = it->second;
-  if ((graph_node == nullptr) || (graph_node->GetRunFlag())) {
+  if ((graph_node == nullptr) || graph_node->GetRunFlag() || graph_node->IsExecuting()) {
     GELOGE(GE_GRAPH_GRAPH_IS_RUNNING, "[GraphManager] Id %u is running, can't be deleted.", graph_id);
     return GE_GRAPH_GRAPH_IS_RUNNING;
   }
@@ -1198,6 +1424,7 @@ Status GraphManager::RemoveGraph(const GraphId &graph_id) {
   }
   var_acc_ctrl_.RemoveGraph(graph_id);
   graph_map_.erase(it);
+  (void)UnregisterIoBinding(graph_id);
 
   RemoveModelCacheHelper(graph_id);
 
@@ -1216,6 +1443,10 @@ Status GraphManager::RemoveGraph(const GraphId &graph_id) {
              graph_id);
       ret = middle_ret;
     }
+    middle_ret = UnloadRunReplicas(graph_node);
+    if (middle_ret != SUCCESS) {
+      ret = middle_ret;
+    }
     rt_ret = rtDeviceReset(GetContext().DeviceId());
     if (rt_ret != RT_ERROR_NONE) {
       GELOGE(RT_FAILED, "[GraphManager:] rtDeviceReset failed, modelId=%u, graphId=%u.", ge_root_model->GetModelId(),
@@ -1599,9 +1830,9 @@ Status GraphManager::SummaryHandle(const GraphId &graph_id, std::vector<GeTensor
 }
 
 Status GraphManager::CheckpointHandle(const GraphId &graph_id, const ComputeGraphPtr &compute_graph,
-                                      const std::vector<GeTensor> &outputs) {
+                                      const std::vector<GeTensor> &outputs,
+                                      const std::vector<InputOutputDescInfo> &outputs_desc) {
   GELOGI("[GraphManager] CheckpointHandle, outputsSize=%zu.", outputs.size());
-  std::vector<InputOutputDescInfo> outputs_desc = graph_executor_.GetOutputsDesc();
   GELOGI("[GraphManager] CheckpointHandle, outputsDescSize=%zu.", outputs_desc.size());
 
   std::map<string, Tensor> save_results;
@@ -2225,6 +2456,10 @@ Status GraphManager::CheckAndReleaseMemory(const GeModelPtr &ge_model, const Gra
       GELOGI("CheckAndReleaseMemory graph[%u] has not been loaded.", graph_id);
       continue;
     }
+    if (it.second->IsExecuting()) {
+      GELOGI("CheckAndReleaseMemory graph[%u] is executing, can not be unloaded.", graph_id);
+      continue;
+    }
     uint64_t max_memory_size = 0;
     result = GraphLoader::GetMaxUsedMemory(model_id, max_memory_size);
     if (result != SUCCESS) {
@@ -2241,6 +2476,7 @@ Status GraphManager::CheckAndReleaseMemory(const GeModelPtr &ge_model, const Gra
     if (result != SUCCESS) {
       GELOGW("[GraphManager:] unload model failed, modelId=%u, graphId=%u.", model_id, graph_id);
     }
+    (void)UnloadRunReplicas(it.second);
     result = GraphLoader::DestroyAicpuKernel(session_id, model_id);
     if (result != SUCCESS) {
       GELOGW("[GraphManager:] destroy aicpu kernel failed when dynamic memory, modelId=%u, graphId=%u.", model_id,
@@ -2483,7 +2719,11 @@ void GraphManager::RunThread(GraphManager *graph_manager) {
 
     Status ret;
     if (!args.graph_node->GetLoadFlag()) {
-      ret = graph_manager->LoadGraphAsync(args.ge_root_model, args.graph_node);
+      {
+        // loading may release the memory of other graphs, which must not race with their runs
+        std::lock_guard<std::mutex> lock(graph_manager->run_mutex_);
+        ret = graph_manager->LoadGraphAsync(args.ge_root_model, args.graph_node);
+      }
       if (ret != SUCCESS || args.ge_root_model == nullptr) {
         StopQueue(graph_manager);
         ReturnError(graph_manager, args.callback, ret, "LoadGraphAsync failed, thread exit.");
@@ -2653,13 +2893,28 @@ Status GraphManager::OptimizeSubgraph(const GraphNodePtr &graph_node, ComputeGra
     return ret;
   }
   GE_TIMESTAMP_EVENT_END(GraphPartition, "OptimizeSubgraph::Partition1");
+  auto sub_graph_map = graph_partitioner_.GetSubGraphMap();
+  PartitionFingerprints dirty_partitions;
+  bool is_incremental_build = options_.build_mode.empty() && IsIncrementalBuild();
+  if (is_incremental_build) {
+    GE_TIMESTAMP_START(ReuseOptimizedSubgraph);
+    ret = ReuseOptimizedSubgraph(session_id, compute_graph, sub_graph_map, dirty_partitions);
+    if (ret != SUCCESS) {
+      GELOGE(ret, "Reuse optimized subgraph Failed");
+      return ret;
+    }
+    GE_TIMESTAMP_EVENT_END(ReuseOptimizedSubgraph, "OptimizeSubgraph::ReuseOptimizedSubgraph");
+  }
   GE_TIMESTAMP_START(SetSubgraph);
-  ret = SetSubgraph(session_id, compute_graph);
+  ret = SetSubgraph(session_id, compute_graph, sub_graph_map);
   if (ret != SUCCESS) {
     GELOGE(ret, "Graph set subgraph Failed");
     return ret;
   }
   GE_TIMESTAMP_EVENT_END(SetSubgraph, "OptimizeSubgraph::SetSubGraph");
+  if (is_incremental_build) {
+    SaveOptimizedSubgraph(dirty_partitions);
+  }
   if ((options_.build_mode == BUILD_MODE_TUNING) &&
       (options_.build_step == BUILD_STEP_BEFORE_UB_MATCH || options_.build_step == BUILD_STEP_AFTER_BUILDER ||
        options_.build_step == BUILD_STEP_AFTER_BUILDER_SUB)) {
@@ -2702,6 +2957,63 @@ Status GraphManager::OptimizeSubgraph(const GraphNodePtr &graph_node, ComputeGra
   return SUCCESS;
 }
 
+Status GraphManager::ReuseOptimizedSubgraph(uint64_t session_id, const ComputeGraphPtr &compute_graph,
+                                            Graph2SubGraphInfoList &sub_graph_map,
+                                            PartitionFingerprints &dirty_partitions) {
+  GE_CHECK_NOTNULL(compute_graph);
+  std::vector<ComputeGraphPtr> partitioned_graphs = {compute_graph};
+  for (const auto &function_graph : compute_graph->GetAllSubgraphs()) {
+    partitioned_graphs.emplace_back(function_graph);
+  }
+  const std::string build_context = GetPartitionBuildContext();
+  size_t reused_num = 0;
+  for (const auto &partitioned_graph : partitioned_graphs) {
+    auto iter = sub_graph_map.find(partitioned_graph);
+    if (iter == sub_graph_map.end()) {
+      continue;
+    }
+    std::vector<SubGraphInfoPtr> dirty_subgraphs;
+    for (const auto &sub_graph_info : iter->second) {
+      GE_CHECK_NOTNULL(sub_graph_info);
+      std::string fingerprint;
+      std::map<std::string, std::string> cut_edge_names;
+      Status ret = graph_partitioner_.GetPartitionFingerprint(partitioned_graph, sub_graph_info, build_context,
+                                                              fingerprint, cut_edge_names);
+      if (ret != SUCCESS) {
+        GELOGE(ret, "Get fingerprint of subgraph %s failed.", sub_graph_info->GetSubGraph()->GetName().c_str());
+        return ret;
+      }
+      ComputeGraphPtr optimized_graph = nullptr;
+      std::map<std::string, std::string> optimized_cut_edge_names;
+      if (optimized_partition_cache_.Find(fingerprint, sub_graph_info->GetSubGraph(), optimized_graph,
+                                          optimized_cut_edge_names) &&
+          (graph_partitioner_.ReplacePartition(partitioned_graph, sub_graph_info, optimized_graph,
+                                               optimized_cut_edge_names) == SUCCESS)) {
+        optimized_graph->SetSessionID(session_id);
+        GELOGD("Subgraph %s reuses an optimized partition.", optimized_graph->GetName().c_str());
+        ++reused_num;
+        continue;
+      }
+      dirty_partitions[sub_graph_info] = std::make_pair(std::move(fingerprint), cut_edge_names);
+      dirty_subgraphs.emplace_back(sub_graph_info);
+    }
+    iter->second.swap(dirty_subgraphs);
+  }
+  GELOGI("Graph %s reuses %zu optimized subgraphs, %zu subgraphs need optimizing.", compute_graph->GetName().c_str(),
+         reused_num, dirty_partitions.size());
+  return SUCCESS;
+}
+
+void GraphManager::SaveOptimizedSubgraph(const PartitionFingerprints &dirty_partitions) {
+  // a failed save only costs optimizing the partition again in the next build
+  for (const auto &partition : dirty_partitions) {
+    const ComputeGraphPtr &sub_graph = partition.first->GetSubGraph();
+    if (optimized_partition_cache_.Save(partition.second.first, sub_graph, partition.second.second) != SUCCESS) {
+      GELOGW("Save optimized subgraph %s failed.", sub_graph->GetName().c_str());
+    }
+  }
+}
+
 Status GraphManager::ConvertGraphToFile(ComputeGraphPtr &compute_graph, std::string path, bool exe_flag) {
   GE_CHECK_NOTNULL(compute_graph);
   GELOGI("compute_graph [%s] path [%s] Enter ConvertGraphToFile.", compute_graph->GetName().c_str(), path.c_str());
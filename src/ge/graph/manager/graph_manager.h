@@ -17,6 +17,7 @@
 #ifndef GE_GRAPH_MANAGER_GRAPH_MANAGER_H_
 #define GE_GRAPH_MANAGER_GRAPH_MANAGER_H_
 
+#include <functional>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -38,6 +39,7 @@
 #include "graph/manager/util/variable_accelerate_ctrl.h"
 #include "graph/optimize/graph_optimize.h"
 #include "graph/partition/graph_partition.h"
+#include "graph/partition/optimized_partition_cache.h"
 #include "graph/preprocess/graph_preprocess.h"
 #include "graph/tuning_utils.h"
 #include "model/ge_model.h"
@@ -140,6 +142,26 @@ class GraphManager {
   Status RunGraphAsync(const GraphId &graph_id, const std::vector<ge::InputTensorInfo> &inputs, uint64_t session_id,
                        RunAsyncCallback callback);
 
+  ///
+  /// @ingroup ge_graph
+  /// @brief bind user buffers to the inputs and outputs of graph, replacing the former binding
+  /// @param [in] graph_id graph id
+  /// @param [in] io_binding buffers to bind, they must stay valid until unregistered
+  /// @return Status result of function
+  ///
+  Status RegisterIoBinding(const GraphId &graph_id, const GraphIoBinding &io_binding);
+
+  Status UnregisterIoBinding(const GraphId &graph_id);
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief run a loaded graph with its bound buffers, the caller must not run one binding concurrently
+  /// @param [in] graph_id graph id
+  /// @param [out] output_desc real descs of outputs written to the bound buffers
+  /// @return Status result of function
+  ///
+  Status RunGraphWithIoBinding(const GraphId &graph_id, std::vector<GeTensorDesc> &output_desc);
+
   ///
   /// @ingroup ge_graph
   /// @brief me register the callback function to get the result of summary or checkpoin
@@ -202,9 +224,19 @@ class GraphManager {
   Status StartForRunGraph(const GraphNodePtr &graph_node, const std::vector<GeTensor> &inputs,
                           GeRootModelPtr &ge_root_model, uint64_t session_id = INVALID_SESSION_ID);
 
-  Status InnerRunGraph(GraphNodePtr &graph_node, const GraphId &graph_id, const std::vector<GeTensor> &inputs,
+  Status InnerRunGraph(const GraphRunReplicaPtr &replica, const GraphId &graph_id, const std::vector<GeTensor> &inputs,
                        std::vector<GeTensor> &outputs);
 
+  ///
+  /// @ingroup ge_graph
+  /// @brief execute a graph pinned for run on one of its replicas, then unpin it
+  /// @param [in] graph_node graph pinned by PinForRun under run_mutex_
+  /// @param [in] execute execution of the graph on the replica
+  /// @return Status result of execute, GE_GRAPH_NOT_INIT if the graph is not loaded for synchronous run
+  ///
+  Status ExecuteOnRunReplica(const GraphNodePtr &graph_node,
+                             const std::function<Status(const GraphRunReplicaPtr &)> &execute);
+
   Status ParseOptions(const std::map<std::string, std::string> &options);
 
   static void ParseOption(const std::map<std::string, std::string> &options, const std::string &key,
@@ -231,7 +263,7 @@ class GraphManager {
   Status SummaryHandle(const GraphId &graph_id, std::vector<GeTensor> &outputs);
 
   Status CheckpointHandle(const GraphId &graph_id, const ComputeGraphPtr &compute_graph,
-                          const std::vector<GeTensor> &outputs);
+                          const std::vector<GeTensor> &outputs, const std::vector<InputOutputDescInfo> &outputs_desc);
 
   // call the callback function of ME to push summary result data to ME
   Status PushSummaryData2ME(const GraphId &graph_id, const std::map<std::string, ge::Tensor> &summary_data);
@@ -251,7 +283,26 @@ class GraphManager {
 
   Status ConvertGraphToFile(ComputeGraphPtr &compute_graph, std::string file_path, bool exe_flag = false);
 
-  Status SetSubgraph(uint64_t session_id, ComputeGraphPtr compute_graph);
+  Status SetSubgraph(uint64_t session_id, ComputeGraphPtr compute_graph, Graph2SubGraphInfoList &sub_graph_map);
+
+  // fingerprint and cut edge names of a partition to be optimized
+  using PartitionFingerprints =
+    std::map<SubGraphInfoPtr, std::pair<std::string, std::map<std::string, std::string>>>;
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief replace the partitions optimized in former builds with their cached copies
+  /// @param [in] session_id
+  /// @param [in] compute_graph: root graph being partitioned
+  /// @param [out] sub_graph_map: partitions which still need optimizing
+  /// @param [out] dirty_partitions: fingerprints of the partitions which still need optimizing
+  /// @return SUCCESS: success
+  ///         other: failed
+  ///
+  Status ReuseOptimizedSubgraph(uint64_t session_id, const ComputeGraphPtr &compute_graph,
+                                Graph2SubGraphInfoList &sub_graph_map, PartitionFingerprints &dirty_partitions);
+
+  void SaveOptimizedSubgraph(const PartitionFingerprints &dirty_partitions);
 
   void SetAttrForHcomBroadCastOp(ge::ComputeGraphPtr &compute_graph);
 
@@ -288,6 +339,12 @@ class GraphManager {
 
   Status LoadGraph(const GeRootModelPtr &ge_root_model, const GraphNodePtr &graph_node);
 
+  GraphRunReplicaPtr CreateRunReplica();
+
+  static uint32_t GetGraphReplicaNum();
+
+  Status UnloadRunReplicas(const GraphNodePtr &graph_node);
+
   bool IsGraphNeedBuild(const GraphNodePtr &graph_node);
 
   Status LoadFromCache(const GraphNodePtr &graph_node, const ModelCacheHelperPtr &cache_helper, GeModelPtr &ge_model);
@@ -353,6 +410,7 @@ class GraphManager {
   GraphPrepare graph_preparer_;
   GraphOptimize graph_optimize_;
   GraphPartitioner graph_partitioner_;
+  OptimizedPartitionCache optimized_partition_cache_;
   GraphBuilder graph_builder_;
   GraphLoader graph_loader_;
   GraphExecutor graph_executor_;
@@ -361,6 +419,9 @@ class GraphManager {
   VarAccelerateCtrl var_acc_ctrl_;
 
   std::mutex run_mutex_;
+
+  std::mutex io_binding_mutex_;
+  std::map<GraphId, GraphIoBinding> io_bindings_;
 };
 }  // namespace ge
 
@@ -16,6 +16,7 @@
 
 #include "graph/manager/graph_manager_utils.h"
 
+#include <algorithm>
 #include <set>
 #include <utility>
 
@@ -42,7 +43,8 @@ GraphNode::GraphNode(GraphId graph_id)
       load_flag_(false),
       async_(false),
       ge_model_(nullptr),
-      sem_(1) {
+      sem_(1),
+      pinned_run_num_(0) {
   graph_run_async_listener_ = MakeShared<RunAsyncListener>();
   if (graph_run_async_listener_ == nullptr) {
     GELOGE(MEMALLOC_FAILED, "Make shared failed");
@@ -58,6 +60,62 @@ void GraphNode::Unlock() {
   sem_.Pop(unused);
 }
 
+void GraphNode::AddRunReplica(const GraphRunReplicaPtr &replica) {
+  std::lock_guard<std::mutex> lock(replica_mutex_);
+  run_replicas_.emplace_back(replica);
+  idle_run_replicas_.emplace_back(replica);
+  replica_cond_.notify_one();
+}
+
+std::vector<GraphRunReplicaPtr> GraphNode::GetRunReplicas() const {
+  std::lock_guard<std::mutex> lock(replica_mutex_);
+  return run_replicas_;
+}
+
+void GraphNode::ClearRunReplicas() {
+  std::lock_guard<std::mutex> lock(replica_mutex_);
+  run_replicas_.clear();
+  idle_run_replicas_.clear();
+  replica_cond_.notify_all();
+}
+
+GraphRunReplicaPtr GraphNode::AcquireRunReplica() {
+  std::unique_lock<std::mutex> lock(replica_mutex_);
+  replica_cond_.wait(lock, [this]() { return run_replicas_.empty() || !idle_run_replicas_.empty(); });
+  if (idle_run_replicas_.empty()) {
+    return nullptr;
+  }
+  GraphRunReplicaPtr replica = idle_run_replicas_.back();
+  idle_run_replicas_.pop_back();
+  return replica;
+}
+
+void GraphNode::ReleaseRunReplica(const GraphRunReplicaPtr &replica) {
+  std::lock_guard<std::mutex> lock(replica_mutex_);
+  // the replica may be unloaded while running
+  if (std::find(run_replicas_.begin(), run_replicas_.end(), replica) != run_replicas_.end()) {
+    idle_run_replicas_.emplace_back(replica);
+    replica_cond_.notify_one();
+  }
+}
+
+void GraphNode::PinForRun() {
+  std::lock_guard<std::mutex> lock(replica_mutex_);
+  ++pinned_run_num_;
+}
+
+void GraphNode::UnpinForRun() {
+  std::lock_guard<std::mutex> lock(replica_mutex_);
+  if (pinned_run_num_ > 0) {
+    --pinned_run_num_;
+  }
+}
+
+bool GraphNode::IsExecuting() const {
+  std::lock_guard<std::mutex> lock(replica_mutex_);
+  return (pinned_run_num_ > 0) || (idle_run_replicas_.size() != run_replicas_.size());
+}
+
 SubGraphInfo::SubGraphInfo() : subgraph_ptr_(nullptr), ge_model_ptr_(nullptr), malloc_flag_(false) {}
 
 SubGraphInfo::~SubGraphInfo() {
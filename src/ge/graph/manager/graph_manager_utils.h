@@ -136,6 +136,10 @@ class RunAsyncListener : public ge::ModelListener {
   BlockingQueue<uint8_t> sem_;
 };
 
+class GraphExecutor;
+struct GraphRunReplica;
+using GraphRunReplicaPtr = std::shared_ptr<GraphRunReplica>;
+
 // single graph node info
 class GraphNode {
  public:
@@ -172,6 +176,31 @@ class GraphNode {
   void Lock();
   void Unlock();
 
+  ///
+  /// @ingroup ge_graph
+  /// @brief executor replicas of the loaded graph, a synchronous run holds one of them exclusively
+  ///
+  void AddRunReplica(const GraphRunReplicaPtr &replica);
+  std::vector<GraphRunReplicaPtr> GetRunReplicas() const;
+  void ClearRunReplicas();
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief wait until one of the replicas is idle and take it
+  /// @return nullptr if the graph has no replica
+  ///
+  GraphRunReplicaPtr AcquireRunReplica();
+  void ReleaseRunReplica(const GraphRunReplicaPtr &replica);
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief pin the loaded model for a synchronous run, the graph is executing and must not be unloaded
+  ///        until the run unpins it
+  ///
+  void PinForRun();
+  void UnpinForRun();
+  bool IsExecuting() const;
+
   // run graph asynchronous listener
   std::shared_ptr<RunAsyncListener> graph_run_async_listener_;
 
@@ -189,6 +218,12 @@ class GraphNode {
   GeModelPtr ge_model_;
   GeRootModelPtr ge_root_model_;
   BlockingQueue<uint8_t> sem_;
+
+  mutable std::mutex replica_mutex_;
+  std::condition_variable replica_cond_;
+  std::vector<GraphRunReplicaPtr> run_replicas_;
+  std::vector<GraphRunReplicaPtr> idle_run_replicas_;
+  uint32_t pinned_run_num_;
 };
 
 using GraphNodePtr = std::shared_ptr<GraphNode>;
@@ -221,6 +256,26 @@ class GraphModelListener : public ge::ModelListener {
   std::condition_variable &condition_;
 };
 
+// one loaded copy of a graph model, with its own executor and listener for synchronous run
+struct GraphRunReplica {
+  uint32_t model_id = INVALID_MODEL_ID;
+  std::mutex sync_run_mutex;
+  std::condition_variable condition;
+  std::shared_ptr<GraphModelListener> listener;
+  std::shared_ptr<GraphExecutor> executor;
+};
+
+// user buffers bound to the inputs and outputs of a graph, runs with the binding read and write them in place
+struct GraphIoBinding {
+  std::vector<DataBuffer> inputs;
+  // length of output buffer is its capacity, the real size is given by the output desc of each run
+  std::vector<DataBuffer> outputs;
+  // descs of inputs, required by dynamic shape graphs only
+  std::vector<GeTensorDesc> input_desc;
+  // buffers are device memory, otherwise host memory, which is better to be page locked by rtMallocHost
+  bool is_device_memory = false;
+};
+
 struct GraphManagerOptions {
   int32_t stream_num;
   int32_t perf_level;
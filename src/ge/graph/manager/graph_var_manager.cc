@@ -16,6 +16,7 @@
 
 #include "graph/manager/graph_var_manager.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "common/l2_cache_optimize.h"
@@ -34,45 +35,169 @@ using std::string;
 using std::vector;
 
 namespace ge {
-VarResource::VarResource(uint64_t session_id) : session_id_(session_id) {}
+namespace {
+const size_t kMinPublishedVarIds = 64;
+}  // namespace
+
+VarResource::VarResource(uint64_t session_id)
+    : session_id_(session_id),
+      published_var_ids_(std::make_shared<const std::unordered_map<std::string, VarId>>()) {
+  for (auto &chunk : var_chunks_) {
+    chunk.store(nullptr, std::memory_order_relaxed);
+  }
+}
 
 VarResource::~VarResource() {
   var_offset_set_.clear();
-  var_addr_mgr_map_.clear();
-  cur_var_tensor_desc_map_.clear();
+  for (auto &chunk : var_chunks_) {
+    delete[] chunk.load(std::memory_order_relaxed);
+  }
   var_broad_cast_info_.clear();
 }
 
+VarId VarResource::GetVarId(const std::string &var_name) {
+  auto published_var_ids = std::atomic_load(&published_var_ids_);
+  auto iter = published_var_ids->find(var_name);
+  if (iter != published_var_ids->end()) {
+    return iter->second;
+  }
+
+  std::lock_guard<std::mutex> lk(var_ids_mutex_);
+  auto recent_iter = recent_var_ids_.find(var_name);
+  if (recent_iter != recent_var_ids_.end()) {
+    return recent_iter->second;
+  }
+  // recent ids may have been merged after the first lookup
+  published_var_ids = std::atomic_load(&published_var_ids_);
+  iter = published_var_ids->find(var_name);
+  return iter == published_var_ids->end() ? kInvalidVarId : iter->second;
+}
+
+VarId VarResource::GetOrCreateVarId(const std::string &var_name) {
+  VarId var_id = GetVarId(var_name);
+  if (var_id != kInvalidVarId) {
+    return var_id;
+  }
+
+  var_id = var_num_.load(std::memory_order_relaxed);
+  size_t chunk_index = var_id / kVarChunkSize;
+  if (chunk_index >= kMaxVarChunks) {
+    GELOGE(INTERNAL_ERROR, "Too many variables in session %lu, var = %s", session_id_, var_name.c_str());
+    return kInvalidVarId;
+  }
+  VarRecord *chunk = var_chunks_[chunk_index].load(std::memory_order_relaxed);
+  if (chunk == nullptr) {
+    chunk = new (std::nothrow) VarRecord[kVarChunkSize];
+    if (chunk == nullptr) {
+      GELOGE(MEMALLOC_FAILED, "Alloc var records failed, var = %s", var_name.c_str());
+      return kInvalidVarId;
+    }
+    var_chunks_[chunk_index].store(chunk, std::memory_order_release);
+  }
+  chunk[var_id % kVarChunkSize].var_name = var_name;
+  var_num_.store(var_id + 1, std::memory_order_release);
+
+  std::lock_guard<std::mutex> lk(var_ids_mutex_);
+  recent_var_ids_.emplace(var_name, var_id);
+  auto published_var_ids = std::atomic_load(&published_var_ids_);
+  if (recent_var_ids_.size() >= std::max(kMinPublishedVarIds, published_var_ids->size())) {
+    auto merged_var_ids = std::make_shared<std::unordered_map<std::string, VarId>>(*published_var_ids);
+    merged_var_ids->insert(recent_var_ids_.begin(), recent_var_ids_.end());
+    std::atomic_store(&published_var_ids_, std::shared_ptr<const std::unordered_map<std::string, VarId>>(
+                                             std::move(merged_var_ids)));
+    recent_var_ids_.clear();
+  }
+  return var_id;
+}
+
+VarResource::VarRecord &VarResource::GetVarRecord(VarId var_id) const {
+  return var_chunks_[var_id / kVarChunkSize].load(std::memory_order_acquire)[var_id % kVarChunkSize];
+}
+
+std::shared_ptr<const VarState> VarResource::LoadVarState(VarId var_id) const {
+  if (var_id >= var_num_.load(std::memory_order_acquire)) {
+    return nullptr;
+  }
+  return std::atomic_load(&GetVarRecord(var_id).state);
+}
+
+void VarResource::StoreVarState(VarId var_id, std::shared_ptr<const VarState> state) {
+  std::atomic_store(&GetVarRecord(var_id).state, std::move(state));
+}
+
+const VarAddrMgr *VarResource::FindAddrMgr(const VarState &state, const ge::GeTensorDesc &tensor_desc) {
+  for (const auto &addr_mgr : state.addr_mgrs) {
+    if ((addr_mgr.tensor_desc.GetFormat() == tensor_desc.GetFormat()) &&
+        (addr_mgr.tensor_desc.GetDataType() == tensor_desc.GetDataType())) {
+      return &addr_mgr;
+    }
+  }
+  return nullptr;
+}
+
 ge::Status VarResource::GetVarAddr(const std::string &var_name, const ge::GeTensorDesc &tensor_desc, uint8_t **dev_ptr,
                                    rtMemType_t &memory_type) {
+  return GetVarAddr(GetVarId(var_name), tensor_desc, dev_ptr, memory_type);
+}
+
+ge::Status VarResource::GetVarAddr(VarId var_id, const ge::GeTensorDesc &tensor_desc, uint8_t **dev_ptr,
+                                   rtMemType_t &memory_type) {
   if (dev_ptr == nullptr) {
     GELOGE(FAILED, "[GetVarAddr] dev_ptr is null!");
     return FAILED;
   }
-  std::string var_key = VarKey(var_name, tensor_desc);
-  GELOGD("VarResource::GetVarAddr , var_key = %s", var_key.c_str());
 
-  auto iter = var_addr_mgr_map_.find(var_key);
-  if (iter == var_addr_mgr_map_.end()) {
-    GELOGE(FAILED, "VarResource::GetVarAddr failed, var_key %s", var_key.c_str());
+  auto state = LoadVarState(var_id);
+  const VarAddrMgr *addr_mgr = (state == nullptr) ? nullptr : FindAddrMgr(*state, tensor_desc);
+  if (addr_mgr == nullptr) {
+    GELOGE(FAILED, "VarResource::GetVarAddr failed, var_id %u, format %d, data type %d", var_id,
+           static_cast<int32_t>(tensor_desc.GetFormat()), static_cast<int32_t>(tensor_desc.GetDataType()));
     return FAILED;
   }
 
-  *dev_ptr = iter->second.address;
-  memory_type = iter->second.memory_type;
+  *dev_ptr = addr_mgr->address;
+  memory_type = addr_mgr->memory_type;
 
   return SUCCESS;
 }
 
 void VarResource::GetAllVarAddrMgr(std::unordered_map<std::string, VarAddrMgr> &var_addr_mgr_map) {
-  var_addr_mgr_map = var_addr_mgr_map_;
+  var_addr_mgr_map.clear();
+  VarId var_num = var_num_.load(std::memory_order_acquire);
+  for (VarId var_id = 0; var_id < var_num; ++var_id) {
+    auto state = LoadVarState(var_id);
+    if (state == nullptr) {
+      continue;
+    }
+    const std::string &var_name = GetVarRecord(var_id).var_name;
+    for (const auto &addr_mgr : state->addr_mgrs) {
+      var_addr_mgr_map[VarKey(var_name, addr_mgr.tensor_desc)] = addr_mgr;
+    }
+  }
+}
+
+std::unordered_map<std::string, ge::GeTensorDesc> VarResource::GetAllVarDesc() const {
+  std::unordered_map<std::string, ge::GeTensorDesc> var_descs;
+  VarId var_num = var_num_.load(std::memory_order_acquire);
+  for (VarId var_id = 0; var_id < var_num; ++var_id) {
+    auto state = LoadVarState(var_id);
+    if ((state != nullptr) && state->has_cur_desc) {
+      var_descs[GetVarRecord(var_id).var_name] = state->cur_desc;
+    }
+  }
+  return var_descs;
 }
 
 void VarResource::SetVarAddr(const std::string &var_name, const ge::GeTensorDesc &tensor_desc, uint8_t *dev_ptr,
                              rtMemType_t memory_type) {
-  std::string var_key = VarKey(var_name, tensor_desc);
-  GELOGI("VarResource::SetVarAddr , var_key = %s, mem_type:%u", var_key.c_str(), memory_type);
-  if (var_addr_mgr_map_.count(var_key) == 0) {
+  GELOGI("VarResource::SetVarAddr , var_name = %s, mem_type:%u", var_name.c_str(), memory_type);
+  VarId var_id = GetOrCreateVarId(var_name);
+  if (var_id == kInvalidVarId) {
+    return;
+  }
+  auto old_state = LoadVarState(var_id);
+  auto state = (old_state == nullptr) ? std::make_shared<VarState>() : std::make_shared<VarState>(*old_state);
+  if (FindAddrMgr(*state, tensor_desc) == nullptr) {
     GELOGI("SetVarAddr node_name %s, tensor_desc type %s, format %s", var_name.c_str(),
            TypeUtils::DataTypeToSerialString(tensor_desc.GetDataType()).c_str(),
            TypeUtils::FormatToSerialString(tensor_desc.GetFormat()).c_str());
@@ -80,17 +205,23 @@ void VarResource::SetVarAddr(const std::string &var_name, const ge::GeTensorDesc
     VarAddrMgr var_addr_mgr;
     var_addr_mgr.address = dev_ptr;
     var_addr_mgr.tensor_desc = tensor_desc;
-    var_addr_mgr_map_[var_key] = var_addr_mgr;
+    state->addr_mgrs.emplace_back(var_addr_mgr);
   }
 
-  cur_var_tensor_desc_map_[var_name] = tensor_desc;
+  state->has_cur_desc = true;
+  state->cur_desc = tensor_desc;
+  StoreVarState(var_id, std::move(state));
 }
 
 ge::Status VarResource::SaveVarAddr(const std::string &var_name, const ge::GeTensorDesc &tensor_desc, uint8_t *address,
                                     rtMemType_t memory_type) {
-  std::string var_key = VarKey(var_name, tensor_desc);
-  GELOGD("VarResource::SaveVarAddr, var_key = %s", var_key.c_str());
-  if (var_addr_mgr_map_.count(var_key) == 0) {
+  GELOGD("VarResource::SaveVarAddr, var_name = %s", var_name.c_str());
+  VarId var_id = GetOrCreateVarId(var_name);
+  if (var_id == kInvalidVarId) {
+    return FAILED;
+  }
+  auto old_state = LoadVarState(var_id);
+  if ((old_state == nullptr) || (FindAddrMgr(*old_state, tensor_desc) == nullptr)) {
     uint64_t logic_address = VarManager::Instance(session_id_)->GetVarMemLogicBase() +
                              reinterpret_cast<uint64_t>(reinterpret_cast<std::uintptr_t>(address));
     GELOGI("SaveVarAddr node_name %s, tensor_desc format %s, type %s.", var_name.c_str(),
@@ -101,24 +232,29 @@ ge::Status VarResource::SaveVarAddr(const std::string &var_name, const ge::GeTen
     var_addr_mgr.offset = reinterpret_cast<uint64_t>(reinterpret_cast<std::uintptr_t>(address));
     var_addr_mgr.tensor_desc = tensor_desc;
     var_addr_mgr.memory_type = memory_type;
-    var_addr_mgr_map_[var_key] = var_addr_mgr;
+    auto state = (old_state == nullptr) ? std::make_shared<VarState>() : std::make_shared<VarState>(*old_state);
+    state->addr_mgrs.emplace_back(var_addr_mgr);
+    StoreVarState(var_id, std::move(state));
     var_offset_set_.insert(logic_address);
 
     return SUCCESS;
   }
 
-  GELOGE(FAILED, "VarResource::SaveVarAddr, var_key %s save addr conflict", var_key.c_str());
+  GELOGE(FAILED, "VarResource::SaveVarAddr, var_key %s save addr conflict", VarKey(var_name, tensor_desc).c_str());
   return FAILED;
 }
 
 bool VarResource::IsVarExist(const std::string &var_name, const ge::GeTensorDesc &tensor_desc) {
-  std::string var_key = VarKey(var_name, tensor_desc);
-  return var_addr_mgr_map_.count(var_key) != 0;
+  auto state = LoadVarState(GetVarId(var_name));
+  return (state != nullptr) && (FindAddrMgr(*state, tensor_desc) != nullptr);
 }
 
-bool VarResource::IsVarExist(const std::string &var_name) { return cur_var_tensor_desc_map_.count(var_name) != 0; }
+bool VarResource::IsVarExist(const std::string &var_name) {
+  auto state = LoadVarState(GetVarId(var_name));
+  return (state != nullptr) && state->has_cur_desc;
+}
 
-std::string VarResource::VarKey(const std::string &var_name, const ge::GeTensorDesc &tensor_desc) {
+std::string VarResource::VarKey(const std::string &var_name, const ge::GeTensorDesc &tensor_desc) const {
   std::string var_key(var_name);
   var_key.append(std::to_string(static_cast<int32_t>(tensor_desc.GetFormat())))
     .append("_")
@@ -127,15 +263,18 @@ std::string VarResource::VarKey(const std::string &var_name, const ge::GeTensorD
 }
 
 ge::Status VarResource::GetCurVarDesc(const std::string &var_name, ge::GeTensorDesc &tensor_desc) {
-  if (cur_var_tensor_desc_map_.count(var_name) == 0) {
+  auto state = LoadVarState(GetVarId(var_name));
+  if ((state == nullptr) || !state->has_cur_desc) {
     return FAILED;
   }
-  tensor_desc = cur_var_tensor_desc_map_[var_name];
+  tensor_desc = state->cur_desc;
   return SUCCESS;
 }
 
 ge::Status VarResource::RenewCurVarDesc(const std::string &var_name, const ge::OpDescPtr &op_desc) {
-  if (cur_var_tensor_desc_map_.count(var_name) == 0) {
+  VarId var_id = GetVarId(var_name);
+  auto old_state = LoadVarState(var_id);
+  if ((old_state == nullptr) || !old_state->has_cur_desc) {
     GELOGI("There is no this node[%s] in var tensor_desc map. so no need renew!", var_name.c_str());
     return SUCCESS;
   }
@@ -145,27 +284,34 @@ ge::Status VarResource::RenewCurVarDesc(const std::string &var_name, const ge::O
     return FAILED;
   }
 
-  ge::GeTensorDesc curr_desc;
-  ge::Status ret = GetCurVarDesc(var_name, curr_desc);
-  if (ret != SUCCESS) {
-    GELOGE(FAILED, "[RenewCurVarDesc] Get var desc fail!");
-    return FAILED;
-  }
-  std::string key = VarKey(var_name, curr_desc);
+  auto state = std::make_shared<VarState>(*old_state);
+  ge::GeTensorDesc curr_desc = state->cur_desc;
+  // compares with curr_desc at the time of call, which is renewed between the two lookups below
+  auto same_key = [&curr_desc](const VarAddrMgr &addr_mgr) {
+    return (addr_mgr.tensor_desc.GetFormat() == curr_desc.GetFormat()) &&
+           (addr_mgr.tensor_desc.GetDataType() == curr_desc.GetDataType());
+  };
+  auto iter = std::find_if(state->addr_mgrs.begin(), state->addr_mgrs.end(), same_key);
   curr_desc.SetOriginFormat((op_desc->GetOutputDesc(0)).GetOriginFormat());
   curr_desc.SetFormat((op_desc->GetOutputDesc(0)).GetFormat());
-  cur_var_tensor_desc_map_[var_name] = curr_desc;
-  auto iter = var_addr_mgr_map_.find(key);
-  if (iter == var_addr_mgr_map_.end()) {
-    GELOGE(FAILED, "[RenewCurVarDesc] can't find ele with key [%s]", key.c_str());
+  state->cur_desc = curr_desc;
+  if (iter == state->addr_mgrs.end()) {
+    StoreVarState(var_id, std::move(state));
+    GELOGE(FAILED, "[RenewCurVarDesc] can't find addr of var [%s]", var_name.c_str());
     return FAILED;
   }
-  auto val = iter->second;
+  auto val = *iter;
   val.tensor_desc.SetOriginFormat((op_desc->GetOutputDesc(0)).GetOriginFormat());
   val.tensor_desc.SetFormat((op_desc->GetOutputDesc(0)).GetFormat());
-  var_addr_mgr_map_.erase(iter);
-  key = VarKey(var_name, curr_desc);
-  var_addr_mgr_map_[key] = val;
+  (void)state->addr_mgrs.erase(iter);
+  // replaces the addr kept for the new format, if any
+  auto renewed = std::find_if(state->addr_mgrs.begin(), state->addr_mgrs.end(), same_key);
+  if (renewed != state->addr_mgrs.end()) {
+    *renewed = val;
+  } else {
+    state->addr_mgrs.emplace_back(val);
+  }
+  StoreVarState(var_id, std::move(state));
 
   return SUCCESS;
 }
@@ -343,11 +489,14 @@ ge::Status VarManager::Init(const uint32_t &version, const uint64_t &session_id,
   device_id_ = device_id;
   session_id_ = session_id;
   job_id_ = job_id;
-  var_resource_ = std::unique_ptr<VarResource>(new (std::nothrow) VarResource(session_id_));
-  if (var_resource_ == nullptr) {
+  std::unique_ptr<VarResource> var_resource(new (std::nothrow) VarResource(session_id_));
+  if (var_resource == nullptr) {
     GELOGW("VarManager has not been init.");
     return ge::INTERNAL_ERROR;
   }
+  // lookups without lock may still read the resource replaced, so it is kept until the manager is deleted
+  var_resource_.store(var_resource.get(), std::memory_order_release);
+  var_resources_.emplace_back(std::move(var_resource));
   return SUCCESS;
 }
 
@@ -373,11 +522,12 @@ ge::Status VarManager::SetVarAddr(const std::string &var_name, const ge::GeTenso
          ge::TypeUtils::FormatToSerialString(tensor_desc.GetFormat()).c_str());
 
   std::lock_guard<std::recursive_mutex> lock(mutex_);
-  if (var_resource_ == nullptr) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
     GELOGW("VarManager has not been init.");
     return ge::INTERNAL_ERROR;
   }
-  var_resource_->SetVarAddr(var_name, tensor_desc, dev_ptr, memory_type);
+  var_resource->SetVarAddr(var_name, tensor_desc, dev_ptr, memory_type);
   return ge::SUCCESS;
 }
 
@@ -388,26 +538,27 @@ ge::Status VarManager::SaveVarAddr(const std::string &var_name, const ge::GeTens
          ge::TypeUtils::FormatToSerialString(tensor_desc.GetFormat()).c_str());
 
   std::lock_guard<std::recursive_mutex> lock(mutex_);
-  if (var_resource_ == nullptr) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
     GELOGW("VarManager has not been init.");
     return ge::INTERNAL_ERROR;
   }
-  var_resource_->SaveVarAddr(var_name, tensor_desc, address, memory_type);
+  var_resource->SaveVarAddr(var_name, tensor_desc, address, memory_type);
   return ge::SUCCESS;
 }
 
 ge::Status VarManager::GetVarAddr(const std::string &var_name, const ge::GeTensorDesc &tensor_desc, uint8_t **dev_ptr,
                                   rtMemType_t &memory_type) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
   GELOGD("VarManager::GetVarAddr var_name = %s, data_type = %s, data_format = %s", var_name.c_str(),
          ge::TypeUtils::DataTypeToSerialString(tensor_desc.GetDataType()).c_str(),
          ge::TypeUtils::FormatToSerialString(tensor_desc.GetFormat()).c_str());
 
-  if (var_resource_ == nullptr) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
     GELOGW("VarManager has not been init.");
     return ge::INTERNAL_ERROR;
   }
-  auto ret = var_resource_->GetVarAddr(var_name, tensor_desc, dev_ptr, memory_type);
+  auto ret = var_resource->GetVarAddr(var_name, tensor_desc, dev_ptr, memory_type);
   if (ret != SUCCESS) {
     GELOGW("GetVarAddr fail.");
     return ge::INTERNAL_ERROR;
@@ -416,13 +567,41 @@ ge::Status VarManager::GetVarAddr(const std::string &var_name, const ge::GeTenso
 }
 
 ge::Status VarManager::GetVarAddr(const std::string &var_name, const ge::GeTensorDesc &tensor_desc, uint8_t **dev_ptr) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
   rtMemType_t memory_type = RT_MEMORY_HBM;
   return GetVarAddr(var_name, tensor_desc, dev_ptr, memory_type);
 }
 
+VarId VarManager::GetVarId(const std::string &var_name) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
+    GELOGW("VarManager has not been init.");
+    return kInvalidVarId;
+  }
+  return var_resource->GetVarId(var_name);
+}
+
+ge::Status VarManager::GetVarAddr(VarId var_id, const ge::GeTensorDesc &tensor_desc, uint8_t **dev_ptr,
+                                  rtMemType_t &memory_type) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
+    GELOGW("VarManager has not been init.");
+    return ge::INTERNAL_ERROR;
+  }
+  auto ret = var_resource->GetVarAddr(var_id, tensor_desc, dev_ptr, memory_type);
+  if (ret != SUCCESS) {
+    GELOGW("GetVarAddr fail.");
+    return ge::INTERNAL_ERROR;
+  }
+  return SUCCESS;
+}
+
 void VarManager::GetAllVarAddrMgr(std::unordered_map<std::string, VarAddrMgr> &var_addr_mgr_map) {
-  var_resource_->GetAllVarAddrMgr(var_addr_mgr_map);
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
+    GELOGW("VarManager has not been init.");
+    return;
+  }
+  var_resource->GetAllVarAddrMgr(var_addr_mgr_map);
 }
 
 int64_t VarManager::GetVarMemSize(rtMemType_t memory_type) {
@@ -504,19 +683,20 @@ ge::Status VarManager::AssignVarMem(const std::string &var_name, const ge::GeTen
     GELOGE(ge::INTERNAL_ERROR, "AssignVarMem by offset failed.");
     return ge::INTERNAL_ERROR;
   }
-  if (var_resource_ == nullptr) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
     GELOGW("VarManager has not been init.");
     return ge::INTERNAL_ERROR;
   }
 
-  result = var_resource_->SaveVarAddr(
+  result = var_resource->SaveVarAddr(
     var_name, tensor_desc, reinterpret_cast<uint8_t *>(reinterpret_cast<uintptr_t>(mem_offset)), memory_type);
   if (result != SUCCESS) {
     GELOGE(ge::INTERNAL_ERROR, "AssignVarMem by offset failed.");
     return ge::INTERNAL_ERROR;
   }
 
-  result = var_resource_->GetVarAddr(
+  result = var_resource->GetVarAddr(
     var_name, tensor_desc, reinterpret_cast<uint8_t **>(reinterpret_cast<uintptr_t>(&mem_offset)), memory_type);
   if (result != SUCCESS) {
     GELOGE(ge::INTERNAL_ERROR, "GetVarAddr by offset failed.");
@@ -524,10 +704,10 @@ ge::Status VarManager::AssignVarMem(const std::string &var_name, const ge::GeTen
   }
 
   ge::GeTensorDesc cur_tensor_desc;
-  result = var_resource_->GetCurVarDesc(var_name, cur_tensor_desc);
+  result = var_resource->GetCurVarDesc(var_name, cur_tensor_desc);
   if (result != SUCCESS) {
-    var_resource_->SetVarAddr(var_name, tensor_desc,
-                              reinterpret_cast<uint8_t *>(reinterpret_cast<uintptr_t>(mem_offset)), memory_type);
+    var_resource->SetVarAddr(var_name, tensor_desc,
+                             reinterpret_cast<uint8_t *>(reinterpret_cast<uintptr_t>(mem_offset)), memory_type);
     return SUCCESS;
   }
 
@@ -541,54 +721,55 @@ ge::Status VarManager::AssignVarMem(const std::string &var_name, const ge::GeTen
            ge::TypeUtils::DataTypeToSerialString(cur_tensor_desc.GetDataType()).c_str(),
            ge::TypeUtils::FormatToSerialString(cur_tensor_desc.GetFormat()).c_str(),
            cur_tensor_desc.GetShape().GetDims().size());
-    var_resource_->SetVarAddr(var_name, tensor_desc,
-                              reinterpret_cast<uint8_t *>(reinterpret_cast<uintptr_t>(mem_offset)), memory_type);
+    var_resource->SetVarAddr(var_name, tensor_desc,
+                             reinterpret_cast<uint8_t *>(reinterpret_cast<uintptr_t>(mem_offset)), memory_type);
   }
 
   return SUCCESS;
 }
 
 bool VarManager::IsVarExist(const std::string &var_name, const ge::GeTensorDesc &tensor_desc) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
   GELOGD("VarManager::IsVarExist var_name = %s, data_type = %s, data_format = %s", var_name.c_str(),
          ge::TypeUtils::FormatToSerialString(tensor_desc.GetFormat()).c_str(),
          ge::TypeUtils::DataTypeToSerialString(tensor_desc.GetDataType()).c_str());
 
-  if (var_resource_ == nullptr) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
     GELOGW("VarManager has not been init.");
     return false;
   }
-  return var_resource_->IsVarExist(var_name, tensor_desc);
+  return var_resource->IsVarExist(var_name, tensor_desc);
 }
 
 bool VarManager::IsVarExist(const std::string &var_name) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
-  if (var_resource_ == nullptr) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
     GELOGW("VarManager has not been init.");
     return false;
   }
-  return var_resource_->IsVarExist(var_name);
+  return var_resource->IsVarExist(var_name);
 }
 
 ge::Status VarManager::SyncVarData(uint32_t graph_id, const std::string &var_name, ge::ConstOpDescPtr var_op_desc,
                                    uint8_t *base_ptr) {
   std::lock_guard<std::recursive_mutex> lock(mutex_);
-  if (var_resource_ == nullptr) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
     GELOGW("VarManager has not been init.");
     return ge::INTERNAL_ERROR;
   }
-  return var_resource_->SyncVarData(graph_id, var_name, std::move(var_op_desc), base_ptr);
+  return var_resource->SyncVarData(graph_id, var_name, std::move(var_op_desc), base_ptr);
 }
 
 ge::Status VarManager::GetCurVarDesc(const std::string &var_name, ge::GeTensorDesc &tensor_desc) {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
   GELOGI("VarManager::GetCurVarDesc var_name = %s.", var_name.c_str());
 
-  if (var_resource_ == nullptr) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
     GELOGW("VarManager has not been init.");
     return ge::INTERNAL_ERROR;
   }
-  return var_resource_->GetCurVarDesc(var_name, tensor_desc);
+  return var_resource->GetCurVarDesc(var_name, tensor_desc);
 }
 
 ge::Status VarManager::SaveBroadCastInfo(uint32_t graph_id, const VarBroadCastInfo &broad_cast_info) {
@@ -600,52 +781,57 @@ ge::Status VarManager::SaveBroadCastInfo(uint32_t graph_id, const VarBroadCastIn
     broad_cast_info.var_name.c_str(), broad_cast_info.broadcast_name.c_str(), broad_cast_info.idx,
     broad_cast_info.input_offset, broad_cast_info.input_size, broad_cast_info.output_offset,
     broad_cast_info.output_size);
-  if (var_resource_ == nullptr) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
     GELOGW("VarManager has not been init.");
     return ge::INTERNAL_ERROR;
   }
-  var_resource_->SaveBroadCastInfo(graph_id, broad_cast_info);
+  var_resource->SaveBroadCastInfo(graph_id, broad_cast_info);
   return SUCCESS;
 }
 
 ge::Status VarManager::GetBroadCastInfo(uint32_t graph_id, const string &var_name, VarBroadCastInfo &broad_cast_info) {
   std::lock_guard<std::recursive_mutex> lock(mutex_);
 
-  if (var_resource_ == nullptr) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
     GELOGW("VarManager has not been init.");
     return ge::INTERNAL_ERROR;
   }
-  return var_resource_->GetBroadCastInfo(graph_id, var_name, broad_cast_info);
+  return var_resource->GetBroadCastInfo(graph_id, var_name, broad_cast_info);
 }
 
 ge::Status VarManager::RenewCurVarDesc(const std::string &var_name, ge::OpDescPtr op_desc) {
   std::lock_guard<std::recursive_mutex> lock(mutex_);
   GELOGD("VarManager::RenewCurVarDesc var_name = %s.", var_name.c_str());
 
-  if (var_resource_ == nullptr) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
     GELOGE(ge::INTERNAL_ERROR, "VarManager has not been init.");
     return ge::INTERNAL_ERROR;
   }
-  return var_resource_->RenewCurVarDesc(var_name, std::move(op_desc));
+  return var_resource->RenewCurVarDesc(var_name, std::move(op_desc));
 }
 
 ge::Status VarManager::SyncBroadCastData2Var(uint32_t graph_id, const std::string &var_name,
                                              ge::ConstOpDescPtr var_op_desc, uint8_t *base_ptr) {
   std::lock_guard<std::recursive_mutex> lock(mutex_);
-  if (var_resource_ == nullptr) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
     GELOGW("VarManager has not been init.");
     return ge::INTERNAL_ERROR;
   }
-  return var_resource_->SyncBroadCastData2Var(graph_id, var_name, std::move(var_op_desc), base_ptr);
+  return var_resource->SyncBroadCastData2Var(graph_id, var_name, std::move(var_op_desc), base_ptr);
 }
 
 bool VarManager::IsVarAddr(const int64_t &offset) {
   std::lock_guard<std::recursive_mutex> lock(mutex_);
-  if (var_resource_ == nullptr) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
     GELOGW("VarManager has not been init.");
     return false;
   }
-  return var_resource_->IsVarAddr(offset);
+  return var_resource->IsVarAddr(offset);
 }
 
 ge::Status VarManager::MallocVarMemory(size_t memory_size) {
@@ -697,38 +883,42 @@ ge::Status VarManager::FreeVarMemory() {
 
 ge::Status VarManager::SetTransRoad(const std::string &var_name, const VarTransRoad &trans_road) {
   std::lock_guard<std::recursive_mutex> lock(mutex_);
-  if (var_resource_ == nullptr) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
     GELOGW("VarManager has not been init.");
     return ge::INTERNAL_ERROR;
   }
-  return var_resource_->SetTransRoad(var_name, trans_road);
+  return var_resource->SetTransRoad(var_name, trans_road);
 }
 
 VarTransRoad *VarManager::GetTransRoad(const std::string &var_name) {
   std::lock_guard<std::recursive_mutex> lock(mutex_);
-  if (var_resource_ == nullptr) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
     GELOGW("VarManager has not been init.");
     return nullptr;
   }
-  return var_resource_->GetTransRoad(var_name);
+  return var_resource->GetTransRoad(var_name);
 }
 
 Status VarManager::SetChangedGraphId(const std::string &var_name, uint32_t graph_id) {
   std::lock_guard<std::recursive_mutex> lock(mutex_);
-  if (var_resource_ == nullptr) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
     GELOGW("VarManager has not been init.");
     return INTERNAL_ERROR;
   }
-  return var_resource_->SetChangedGraphId(var_name, graph_id);
+  return var_resource->SetChangedGraphId(var_name, graph_id);
 }
 
 Status VarManager::GetChangedGraphId(const std::string &var_name, uint32_t &graph_id) {
   std::lock_guard<std::recursive_mutex> lock(mutex_);
-  if (var_resource_ == nullptr) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
     GELOGW("VarManager has not been init.");
     return INTERNAL_ERROR;
   }
-  return var_resource_->GetChangedGraphId(var_name, graph_id);
+  return var_resource->GetChangedGraphId(var_name, graph_id);
 }
 
 Status VarManager::SetMemoryMallocSize(const map<string, string> &options) {
@@ -821,54 +1011,70 @@ Status VarManager::ParseMemoryMallocSize(string &memory_size, size_t &result) {
 
 void VarManager::RemoveChangedGraphId(const std::string &var_name) {
   std::lock_guard<std::recursive_mutex> lock(mutex_);
-  if (var_resource_ == nullptr) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
     GELOGW("VarManager has not been init.");
     return;
   }
-  var_resource_->RemoveChangedGraphId(var_name);
+  var_resource->RemoveChangedGraphId(var_name);
 }
 
 Status VarManager::SetAllocatedGraphId(const std::string &var_name, uint32_t graph_id) {
   std::lock_guard<std::recursive_mutex> lock(mutex_);
-  if (var_resource_ == nullptr) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
     GELOGW("VarManager has not been init.");
     return INTERNAL_ERROR;
   }
-  return var_resource_->SetAllocatedGraphId(var_name, graph_id);
+  return var_resource->SetAllocatedGraphId(var_name, graph_id);
 }
 
 Status VarManager::GetAllocatedGraphId(const std::string &var_name, uint32_t &graph_id) {
   std::lock_guard<std::recursive_mutex> lock(mutex_);
-  if (var_resource_ == nullptr) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
     GELOGW("VarManager has not been init.");
     return INTERNAL_ERROR;
   }
-  return var_resource_->GetAllocatedGraphId(var_name, graph_id);
+  return var_resource->GetAllocatedGraphId(var_name, graph_id);
 }
 
 void VarManager::RemoveAllocatedGraphId(const std::string &var_name) {
   std::lock_guard<std::recursive_mutex> lock(mutex_);
-  if (var_resource_ == nullptr) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
     GELOGW("VarManager has not been init.");
     return;
   }
-  var_resource_->RemoveAllocatedGraphId(var_name);
+  var_resource->RemoveAllocatedGraphId(var_name);
+}
+
+Status VarManager::GetAllCurVarDesc(std::unordered_map<std::string, GeTensorDesc> &var_descs) {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
+    GELOGW("VarManager has not been inited.");
+    return INTERNAL_ERROR;
+  }
+  var_descs = var_resource->GetAllVarDesc();
+  return SUCCESS;
 }
 
 Status VarManager::GetAllVariables(std::map<std::string, GeTensorDesc> &all_variables) {
   std::lock_guard<std::recursive_mutex> lock(mutex_);
-  if (var_resource_ == nullptr) {
+  VarResource *var_resource = GetVarResource();
+  if (var_resource == nullptr) {
     GELOGW("VarManager has not been inited.");
     return INTERNAL_ERROR;
   }
-  auto new_variable_desc = var_resource_->GetAllVarDesc();
+  auto new_variable_desc = var_resource->GetAllVarDesc();
   if (new_variable_desc.size() == 0) {
     GELOGW("VarManager don't have variables.");
     return INTERNAL_ERROR;
   }
 
   for (auto iter = new_variable_desc.begin(); iter != new_variable_desc.end(); ++iter) {
-    auto trans_road = var_resource_->GetTransRoad(iter->first);
+    auto trans_road = var_resource->GetTransRoad(iter->first);
     if (trans_road == nullptr || trans_road->empty()) {
       GELOGI("The variable %s does not have any trans road", iter->first.c_str());
       all_variables[iter->first] = iter->second;
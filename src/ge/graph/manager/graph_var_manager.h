@@ -20,6 +20,7 @@
 #include <atomic>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -93,6 +94,18 @@ struct TransNodeInfo {
 
 using VarTransRoad = std::vector<TransNodeInfo>;
 
+// dense id of a variable name in its session, resolve it once and look the variable up by it
+using VarId = uint32_t;
+const VarId kInvalidVarId = 0xFFFFFFFFU;
+
+// state of a variable, never modified once published, so that it can be read without lock
+struct VarState {
+  bool has_cur_desc = false;
+  GeTensorDesc cur_desc;
+  // one for each format and data type the variable is assigned in
+  std::vector<VarAddrMgr> addr_mgrs;
+};
+
 class VarResource {
  public:
   explicit VarResource(uint64_t session_id_);
@@ -101,6 +114,12 @@ class VarResource {
   ge::Status GetVarAddr(const std::string &var_name, const ge::GeTensorDesc &tensor_desc, uint8_t **dev_ptr,
                         rtMemType_t &memory_type);
 
+  ge::Status GetVarAddr(VarId var_id, const ge::GeTensorDesc &tensor_desc, uint8_t **dev_ptr,
+                        rtMemType_t &memory_type);
+
+  // lookups by name or id are lock free, the other methods are guarded by VarManager
+  VarId GetVarId(const std::string &var_name);
+
   void GetAllVarAddrMgr(std::unordered_map<std::string, VarAddrMgr> &var_addr_mgr_map);
 
   void SetVarAddr(const std::string &var_name, const ge::GeTensorDesc &tensor_desc, uint8_t *dev_ptr,
@@ -157,15 +176,36 @@ class VarResource {
 
   bool IsVarAddr(const int64_t &offset);
 
-  std::unordered_map<std::string, ge::GeTensorDesc> GetAllVarDesc() const { return cur_var_tensor_desc_map_; }
+  std::unordered_map<std::string, ge::GeTensorDesc> GetAllVarDesc() const;
 
  private:
-  std::string VarKey(const std::string &var_name, const ge::GeTensorDesc &tensor_desc);
+  struct VarRecord {
+    std::string var_name;
+    std::shared_ptr<const VarState> state;
+  };
+
+  static const size_t kVarChunkSize = 1024;
+  static const size_t kMaxVarChunks = 4096;
+
+  std::string VarKey(const std::string &var_name, const ge::GeTensorDesc &tensor_desc) const;
+  VarId GetOrCreateVarId(const std::string &var_name);
+  VarRecord &GetVarRecord(VarId var_id) const;
+  std::shared_ptr<const VarState> LoadVarState(VarId var_id) const;
+  void StoreVarState(VarId var_id, std::shared_ptr<const VarState> state);
+  static const VarAddrMgr *FindAddrMgr(const VarState &state, const ge::GeTensorDesc &tensor_desc);
 
   uint64_t session_id_;
   std::unordered_set<uint64_t> var_offset_set_;
-  std::unordered_map<std::string, VarAddrMgr> var_addr_mgr_map_;
-  std::unordered_map<std::string, ge::GeTensorDesc> cur_var_tensor_desc_map_;
+
+  // records are allocated by chunk and never moved, a record is visible once var_num_ covers it
+  std::atomic<VarRecord *> var_chunks_[kMaxVarChunks];
+  std::atomic<VarId> var_num_{0};
+  // names interned lately are merged into the published map once they are as many as it has,
+  // so that lookups of settled variables never lock while interning stays amortized linear
+  std::shared_ptr<const std::unordered_map<std::string, VarId>> published_var_ids_;
+  std::unordered_map<std::string, VarId> recent_var_ids_;
+  std::mutex var_ids_mutex_;
+
   std::unordered_map<std::string, std::vector<TransNodeInfo>> var_to_trans_road_;
   std::unordered_map<std::string, uint32_t> var_names_to_changed_graph_id_;
   std::unordered_map<std::string, uint32_t> var_names_to_allocated_graph_id_;
@@ -214,6 +254,16 @@ class FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY VarManager {
 
   ge::Status GetVarAddr(const std::string &var_name, const ge::GeTensorDesc &tensor_desc, uint8_t **dev_ptr);
 
+  ///
+  /// @ingroup ge_graph
+  /// @brief resolve the id of variable once, for callers looking it up repeatedly
+  /// @return kInvalidVarId if the variable is not known yet
+  ///
+  VarId GetVarId(const std::string &var_name);
+
+  ge::Status GetVarAddr(VarId var_id, const ge::GeTensorDesc &tensor_desc, uint8_t **dev_ptr,
+                        rtMemType_t &memory_type);
+
   ge::Status SyncVarData(uint32_t graph_id, const std::string &var_name, ge::ConstOpDescPtr var_op_desc,
                          uint8_t *base_ptr);
 
@@ -280,6 +330,9 @@ class FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY VarManager {
 
   Status GetAllVariables(std::map<std::string, GeTensorDesc> &all_variables);
 
+  // current desc of each variable, which is the layout of its memory
+  Status GetAllCurVarDesc(std::unordered_map<std::string, GeTensorDesc> &var_descs);
+
  private:
   uint32_t version_;
   uint64_t session_id_;
@@ -289,10 +342,16 @@ class FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY VarManager {
   size_t var_mem_max_size_;
   size_t var_mem_logic_base_;
   size_t use_max_mem_size_;
-  std::unique_ptr<ge::VarResource> var_resource_;
+  // published by Init, lookups of variable addr and desc read it without lock
+  std::atomic<ge::VarResource *> var_resource_{nullptr};
+  // every resource published, an old one may still be read after Init replaced it
+  std::vector<std::unique_ptr<ge::VarResource>> var_resources_;
   map<rtMemType_t, MemResource *> mem_resource_map_;
+  // lookups of variable addr and desc do not take it
   mutable std::recursive_mutex mutex_;
 
+  ge::VarResource *GetVarResource() const { return var_resource_.load(std::memory_order_acquire); }
+
   Status ParseMemoryMallocSize(std::string &memory_size, size_t &my_size);
 };
 
@@ -26,7 +26,12 @@
 #include "graph/types.h"
 #include "graph/utils/type_utils.h"
 #include "common/thread_pool.h"
+#include "runtime/event.h"
 #include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
 
 namespace ge {
 namespace {
@@ -84,67 +89,230 @@ int64_t CalcVarSizeInBytes(const GeTensorDesc &desc) {
   return var_size;
 }
 
-Status CopyVarToDevice(const NodePtr &var, const formats::TransResult &trans_result, void *var_addr) {
-  GELOGD("Copy var %s from host to device, size %zu", var->GetName().c_str(), trans_result.length);
-  auto ret = rtMemcpy(var_addr, trans_result.length, reinterpret_cast<void *>(trans_result.data.get()),
-                      trans_result.length, RT_MEMCPY_HOST_TO_DEVICE);
-  if (ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED, "Failed to copy memory to device, size %zu", trans_result.length);
-    return RT_FAILED;
+// cached pinned host memory of a transfer pipeline
+const size_t kMaxStagingSize = 512UL * 1024UL * 1024UL;
+// a cached buffer is reused only if it is at most this times of the requested size
+const size_t kMaxStagingReuseRatio = 2;
+// device to host copies are issued in chunks of it, so that the copy of a huge variable does not hold the stream
+const uint64_t kMaxCopyChunkSize = 64UL * 1024UL * 1024UL;
+const uint32_t kCopyVarThreadNum = 4;
+
+///
+/// pinned host buffers reused by the variables going through a pipeline. Acquiring blocks while the buffers in use
+/// reach kMaxStagingSize, which bounds how far device to host copies run ahead of the transforms.
+///
+class StagingBufferPool {
+ public:
+  StagingBufferPool() = default;
+  ~StagingBufferPool() {
+    for (auto &buffer_and_size : buffer_sizes_) {
+      GE_CHK_RT(rtFreeHost(buffer_and_size.first));
+    }
   }
-  return SUCCESS;
-}
 
-Status CopyVarFromDevice(uint64_t session_id, const NodePtr &var, std::unique_ptr<uint8_t[]> &var_data,
-                         const GeTensorDesc &input_desc) {
-  uint8_t *var_logic = nullptr;
-  GE_CHECK_NOTNULL(var);
-  auto ret = VarManager::Instance(session_id)->GetVarAddr(var->GetName(), input_desc, &var_logic);
-  if (ret != SUCCESS) {
-    GELOGE(INTERNAL_ERROR,
-           "Failed to copy var %s from device, can not find it"
-           " from var manager %u",
-           var->GetName().c_str(), ret);
-    return INTERNAL_ERROR;
+  StagingBufferPool(const StagingBufferPool &) = delete;
+  StagingBufferPool &operator=(const StagingBufferPool &) = delete;
+
+  uint8_t *Acquire(size_t size) {
+    std::unique_lock<std::mutex> lk(mu_);
+    cond_.wait(lk, [this, size]() { return (in_use_size_ == 0) || (in_use_size_ + size <= kMaxStagingSize); });
+    auto it = free_buffers_.lower_bound(size);
+    if ((it != free_buffers_.end()) && (it->first / kMaxStagingReuseRatio <= size)) {
+      uint8_t *buffer = it->second;
+      in_use_size_ += it->first;
+      (void)free_buffers_.erase(it);
+      return buffer;
+    }
+
+    // drop cached buffers which do not fit, largest first, to stay in the limit
+    while (!free_buffers_.empty() && (cached_size_ + size > kMaxStagingSize)) {
+      auto largest = std::prev(free_buffers_.end());
+      GE_CHK_RT(rtFreeHost(largest->second));
+      cached_size_ -= largest->first;
+      (void)buffer_sizes_.erase(largest->second);
+      (void)free_buffers_.erase(largest);
+    }
+    uint8_t *buffer = nullptr;
+    auto rt_ret = rtMallocHost(reinterpret_cast<void **>(&buffer), size);
+    if (rt_ret != RT_ERROR_NONE) {
+      GELOGE(RT_FAILED, "Failed to malloc staging buffer, size %zu, rt-error-code %d", size, rt_ret);
+      return nullptr;
+    }
+    buffer_sizes_[buffer] = size;
+    cached_size_ += size;
+    in_use_size_ += size;
+    return buffer;
   }
 
-  uint8_t *var_addr = VarManager::Instance(session_id)->GetVarMemoryAddr(var_logic, RT_MEMORY_HBM);
-  if (var_addr == nullptr) {
-    GELOGE(INTERNAL_ERROR,
-           "Failed to copy var %s from device, cant not get "
-           "var addr from logic addr %p",
-           var->GetName().c_str(), var_logic);
-    return INTERNAL_ERROR;
+  void Release(uint8_t *buffer) {
+    std::lock_guard<std::mutex> lk(mu_);
+    auto it = buffer_sizes_.find(buffer);
+    if (it == buffer_sizes_.end()) {
+      return;
+    }
+    in_use_size_ -= it->second;
+    (void)free_buffers_.emplace(it->second, buffer);
+    cond_.notify_all();
   }
 
-  int64_t var_size_bytes = CalcVarSizeInBytes(input_desc);
-  if (var_size_bytes <= 0) {
-    return INTERNAL_ERROR;
+ private:
+  std::mutex mu_;
+  std::condition_variable cond_;
+  std::multimap<size_t, uint8_t *> free_buffers_;
+  std::map<uint8_t *, size_t> buffer_sizes_;
+  size_t cached_size_ = 0;
+  size_t in_use_size_ = 0;
+};
+
+// a variable to move through the pipeline, addrs are device memory
+struct VarTransferJob {
+  std::string var_name;
+  uint8_t *src_addr = nullptr;
+  int64_t src_size = 0;
+  uint8_t *dst_addr = nullptr;
+  // transforms data on host, if not set, the data is copied from src to dst on device as it is
+  std::function<Status(uint8_t *, formats::TransResult &)> trans_on_host;
+};
+
+///
+/// moves variables through three overlapping stages: device to host copy, which the calling thread issues
+/// asynchronously into staging buffers in order, transform on host and host to device copy, which run on workers as
+/// soon as the copy of their variable is done. Jobs without a host transform are copied on device only.
+///
+class VarTransferPipeline {
+ public:
+  VarTransferPipeline(rtContext_t context, uint32_t thread_num) : context_(context), thread_num_(thread_num) {}
+
+  ~VarTransferPipeline() {
+    if (stream_ != nullptr) {
+      GE_CHK_RT(rtStreamDestroy(stream_));
+    }
   }
 
-  std::unique_ptr<uint8_t[]> var_host(new (std::nothrow) uint8_t[var_size_bytes]);
-  if (var_host == nullptr) {
-    GELOGE(OUT_OF_MEMORY, "Failed to malloc rt-host memory, size %ld", var_size_bytes);
-    return OUT_OF_MEMORY;
+  VarTransferPipeline(const VarTransferPipeline &) = delete;
+  VarTransferPipeline &operator=(const VarTransferPipeline &) = delete;
+
+  Status Run(const std::vector<VarTransferJob> &jobs) {
+    if (jobs.empty()) {
+      return SUCCESS;
+    }
+    GE_CHK_RT_RET(rtStreamCreate(&stream_, 0));
+    ThreadPool executor(thread_num_);
+    std::vector<std::future<Status>> futures;
+    Status ret = SUCCESS;
+    for (const auto &job : jobs) {
+      if (!job.trans_on_host) {
+        GELOGD("Copy var %s on device, size %ld", job.var_name.c_str(), job.src_size);
+        ret = CopyInChunks(job.dst_addr, job.src_addr, job.src_size, RT_MEMCPY_DEVICE_TO_DEVICE);
+      } else {
+        ret = IssueToHost(executor, job, futures);
+      }
+      if (ret != SUCCESS) {
+        GELOGE(ret, "Failed to issue transfer of var %s", job.var_name.c_str());
+        break;
+      }
+    }
+
+    // transforms in flight read staging buffers, wait for them even on failure
+    for (auto &future : futures) {
+      Status trans_ret = future.get();
+      if ((trans_ret != SUCCESS) && (ret == SUCCESS)) {
+        ret = trans_ret;
+      }
+    }
+    GE_CHK_RT_RET(rtStreamSynchronize(stream_));
+    return ret;
   }
 
-  ret = rtMemcpy(reinterpret_cast<void *>(var_host.get()), var_size_bytes, reinterpret_cast<void *>(var_addr),
-                 var_size_bytes, RT_MEMCPY_DEVICE_TO_HOST);
-  if (ret != RT_ERROR_NONE) {
-    GELOGE(RT_FAILED,
-           "Failed to copy var memory from device, var %s, size %ld,"
-           " rt-error-code %u",
-           var->GetName().c_str(), var_size_bytes, ret);
-    return RT_FAILED;
+ private:
+  Status CopyInChunks(uint8_t *dst, const uint8_t *src, int64_t size, rtMemcpyKind_t kind) {
+    uint64_t offset = 0;
+    uint64_t total_size = static_cast<uint64_t>(size);
+    while (offset < total_size) {
+      uint64_t chunk_size = std::min(total_size - offset, kMaxCopyChunkSize);
+      GE_CHK_RT_RET(rtMemcpyAsync(dst + offset, chunk_size, src + offset, chunk_size, kind, stream_));
+      offset += chunk_size;
+    }
+    return SUCCESS;
   }
 
-  GELOGD("Copy var %s from device to host, size %ld", var->GetName().c_str(), var_size_bytes);
-  var_data.swap(var_host);
+  Status IssueToHost(ThreadPool &executor, const VarTransferJob &job, std::vector<std::future<Status>> &futures) {
+    uint8_t *staging = staging_buffers_.Acquire(static_cast<size_t>(job.src_size));
+    GE_CHECK_NOTNULL(staging);
+    rtEvent_t copied = nullptr;
+    Status ret = SUCCESS;
+    auto rt_ret = rtEventCreate(&copied);
+    if (rt_ret == RT_ERROR_NONE) {
+      ret = CopyInChunks(staging, job.src_addr, job.src_size, RT_MEMCPY_DEVICE_TO_HOST);
+      rt_ret = (ret == SUCCESS) ? rtEventRecord(copied, stream_) : RT_ERROR_NONE;
+    }
+    if ((rt_ret != RT_ERROR_NONE) || (ret != SUCCESS)) {
+      GELOGE(RT_FAILED, "Failed to copy var %s from device, size %ld, rt-error-code %d", job.var_name.c_str(),
+             job.src_size, rt_ret);
+      // the copy may have been issued partly
+      (void)rtStreamSynchronize(stream_);
+      if (copied != nullptr) {
+        (void)rtEventDestroy(copied);
+      }
+      staging_buffers_.Release(staging);
+      return RT_FAILED;
+    }
 
-  GELOGI("var_logic:%p, var_addr:%p", var_logic, var_addr);
+    auto future = executor.commit(
+      [this, staging, copied](const VarTransferJob &job) -> Status {
+        auto ret = TransAndCopyToDevice(job, staging, copied);
+        (void)rtEventDestroy(copied);
+        staging_buffers_.Release(staging);
+        return ret;
+      },
+      job);
+    if (!future.valid()) {
+      GELOGE(FAILED, "Future is invalid");
+      (void)rtEventSynchronize(copied);
+      (void)rtEventDestroy(copied);
+      staging_buffers_.Release(staging);
+      return FAILED;
+    }
+    futures.emplace_back(std::move(future));
+    return SUCCESS;
+  }
 
-  return SUCCESS;
-}
+  Status TransAndCopyToDevice(const VarTransferJob &job, uint8_t *staging, rtEvent_t copied) {
+    rtError_t rt_ret = rtCtxSetCurrent(context_);
+    if (rt_ret != RT_ERROR_NONE) {
+      GELOGE(RT_FAILED, "Failed to set context, error_code is: 0x%X.", rt_ret);
+      // the staging buffer is released after return, it must not be written any more
+      (void)rtEventSynchronize(copied);
+      return RT_ERROR_TO_GE_STATUS(rt_ret);
+    }
+    GE_CHK_RT_RET(rtEventSynchronize(copied));
+    GELOGD("Copy var %s from device to host, size %ld", job.var_name.c_str(), job.src_size);
+
+    formats::TransResult trans_result{};
+    auto ret = job.trans_on_host(staging, trans_result);
+    if (ret != SUCCESS) {
+      GELOGE(ret, "Failed to trans var %s on host, error code %u", job.var_name.c_str(), ret);
+      return ret;
+    }
+
+    GELOGD("Copy var %s from host to device, size %zu", job.var_name.c_str(), trans_result.length);
+    if (trans_result.length == 0) {
+      return SUCCESS;
+    }
+    rt_ret = rtMemcpy(job.dst_addr, trans_result.length, reinterpret_cast<void *>(trans_result.data.get()),
+                      trans_result.length, RT_MEMCPY_HOST_TO_DEVICE);
+    if (rt_ret != RT_ERROR_NONE) {
+      GELOGE(RT_FAILED, "Failed to copy var %s to device, size %zu", job.var_name.c_str(), trans_result.length);
+      return RT_FAILED;
+    }
+    return SUCCESS;
+  }
+
+  rtContext_t context_;
+  uint32_t thread_num_;
+  rtStream_t stream_ = nullptr;
+  StagingBufferPool staging_buffers_;
+};
 
 Status TransVarOnHost(uint8_t *var_data, const VarTransRoad &trans_road, formats::TransResult &result) {
   formats::TransResult result_last_time{};
@@ -244,7 +412,8 @@ Status ReAssignVarAddr(uint64_t session_id, const std::string &var_name, const G
   return SUCCESS;
 }
 
-Status TransVarData(const NodePtr &var, const VarTransRoad &trans_road, uint64_t session_id) {
+Status BuildTransVarJob(const NodePtr &var, const VarTransRoad &trans_road, uint64_t session_id,
+                       std::vector<VarTransferJob> &jobs) {
   // do not need to do anything if only all reshape/reformat node on the trans_road
   GE_CHECK_NOTNULL(var);
   bool need_trans = false;
@@ -258,44 +427,41 @@ Status TransVarData(const NodePtr &var, const VarTransRoad &trans_road, uint64_t
     return SUCCESS;
   }
 
-  // Sync var data from device
-  std::unique_ptr<uint8_t[]> var_data;
   if (trans_road.empty()) {
     GELOGE(INTERNAL_ERROR, "Failed to get trans_road, trans_road is empty.");
     return INTERNAL_ERROR;
   }
   const GeTensorDesc &input_desc = trans_road.begin()->input;
-  auto ret = CopyVarFromDevice(session_id, var, var_data, input_desc);
-  if (ret != SUCCESS) {
-    return ret;
+  VarTransferJob job;
+  job.var_name = var->GetName();
+  job.src_size = CalcVarSizeInBytes(input_desc);
+  if (job.src_size <= 0) {
+    GELOGE(INTERNAL_ERROR, "Failed to calc var data size from var %s", job.var_name.c_str());
+    return INTERNAL_ERROR;
   }
-
-  formats::TransResult trans_result{};
-  ret = TransVarOnHost(var_data.get(), trans_road, trans_result);
+  void *var_device = nullptr;
+  auto ret = ReAssignVarAddr(session_id, job.var_name, input_desc, &var_device);
   if (ret != SUCCESS) {
-    GELOGE(ret, "Failed to trans var data on host, error code %u", ret);
     return ret;
   }
-
-  void *var_device = nullptr;
+  job.src_addr = reinterpret_cast<uint8_t *>(var_device);
 
   /// It is a temporary solution to use the last GeTensorDesc to assign variable memory because the variable manager
   /// depends on TensorDesc and it is difficult to be modified. The correct solution is to assign memory based on the
   /// size of the converted variable. To complete the final solution, the dependency of the variable manager on
   /// TensorDesc needs to be removed. This change is large and needs to be performed step by step.
-  ret = ReAssignVarAddr(session_id, var->GetName(), trans_road.rbegin()->output, &var_device);
-  if (ret != SUCCESS) {
-    GELOGE(ret, "Failed to re-assign memory on device, size %zu", trans_result.length);
-    return ret;
-  }
-
-  // sync new data to device
-  ret = CopyVarToDevice(var, trans_result, var_device);
+  ret = ReAssignVarAddr(session_id, job.var_name, trans_road.rbegin()->output, &var_device);
   if (ret != SUCCESS) {
-    GELOGE(ret, "Failed to send var data to device");
+    GELOGE(ret, "Failed to re-assign memory on device of var %s", job.var_name.c_str());
     return ret;
   }
-
+  job.dst_addr = reinterpret_cast<uint8_t *>(var_device);
+  // the road is owned by var manager and lives as long as the session
+  const VarTransRoad *road = &trans_road;
+  job.trans_on_host = [road](uint8_t *var_data, formats::TransResult &result) -> Status {
+    return TransVarOnHost(var_data, *road, result);
+  };
+  jobs.emplace_back(std::move(job));
   return SUCCESS;
 }
 
@@ -318,8 +484,8 @@ Status TransTensor(uint8_t *var_data, const NodePtr &var_src, const NodePtr &var
   return SUCCESS;
 }
 
-Status CopyTensorFromSrcVarNode(const NodePtr &var_src, const NodePtr &var_dst, uint64_t session_id,
-                                uint32_t device_id) {
+Status BuildCopyVarJob(const NodePtr &var_src, const NodePtr &var_dst, uint64_t session_id,
+                      std::vector<VarTransferJob> &jobs) {
   /// after FE fusion pass, input num of applymomentum op was changed, 0th input is var_fp32, 6th input is
   /// var_fp16(new).
   /// unlink edges between var_fp32 and "dst_node" (need fp16) of var_fp32, add edge between var_fp16 and dst_node.
@@ -342,23 +508,30 @@ Status CopyTensorFromSrcVarNode(const NodePtr &var_src, const NodePtr &var_dst,
   GELOGI("dst_node %s, src_format %s, src_shape %s, src_type %s", var_dst->GetName().c_str(),
          TypeUtils::FormatToSerialString(data_format).c_str(), formats::ShapeToString(data_shape).c_str(),
          TypeUtils::DataTypeToSerialString(data_type).c_str());
-  // Sync var data from device
-  std::unique_ptr<uint8_t[]> var_src_data;
-  RtContextSwitchGuard switch_context(RT_CTX_NORMAL_MODE, device_id);
-  // copy from src_node
-  auto ret = CopyVarFromDevice(session_id, var_src, var_src_data, output_desc);
-  GE_IF_BOOL_EXEC(ret != SUCCESS, GELOGE(FAILED, "Copy Var From Device failed"); return ret);
-  // trans dtype
-  formats::TransResult trans_result{};
-  ret = TransTensor(var_src_data.get(), var_src, var_dst, trans_result);
-  GE_IF_BOOL_EXEC(ret != SUCCESS, GELOGE(INTERNAL_ERROR, "trans var data on host failed"); return ret);
-  // reset src value.
+
+  VarTransferJob job;
+  job.var_name = var_dst->GetName();
+  job.src_size = CalcVarSizeInBytes(output_desc);
+  GE_IF_BOOL_EXEC(job.src_size <= 0, GELOGE(INTERNAL_ERROR, "Failed to calc var data size from var %s",
+                                            var_src->GetName().c_str());
+                  return INTERNAL_ERROR);
   void *var_device = nullptr;
+  auto ret = ReAssignVarAddr(session_id, var_src->GetName(), output_desc, &var_device);
+  GE_IF_BOOL_EXEC(ret != SUCCESS, GELOGE(INTERNAL_ERROR, "get src var addr failed"); return ret);
+  job.src_addr = reinterpret_cast<uint8_t *>(var_device);
   ret = ReAssignVarAddr(session_id, var_dst->GetName(), dst_tensor_desc, &var_device);
   GE_IF_BOOL_EXEC(ret != SUCCESS, GELOGE(INTERNAL_ERROR, "assign mem failed"); return ret);
-  // copy to device
-  ret = CopyVarToDevice(var_dst, trans_result, var_device);
-  GE_IF_BOOL_EXEC(ret != SUCCESS, GELOGE(ret, "Failed to send var data to device"); return ret);
+  job.dst_addr = reinterpret_cast<uint8_t *>(var_device);
+
+  // the same layout is copied on device, there is no device kernel for the other transforms
+  bool same_layout = (src_data_type == data_type) && (src_format == data_format) &&
+                     (src_shape.GetDims() == data_shape.GetDims());
+  if (!same_layout) {
+    job.trans_on_host = [var_src, var_dst](uint8_t *var_data, formats::TransResult &result) -> Status {
+      return TransTensor(var_data, var_src, var_dst, result);
+    };
+  }
+  jobs.emplace_back(std::move(job));
   return SUCCESS;
 }
 }  // namespace
@@ -428,8 +601,14 @@ Status TransVarDataUtils::SyncTensorToDevice(const string &var_name, const uint8
 
 Status TransVarDataUtils::TransAllVarData(const vector<NodePtr> &variable_nodes, uint64_t session_id,
                                           rtContext_t context, uint32_t graph_id, uint32_t thread_num) {
-  ThreadPool executor(thread_num);
-  std::vector<std::future<Status>> vector_future;
+  rtError_t rt_ret = rtCtxSetCurrent(context);
+  if (rt_ret != RT_ERROR_NONE) {
+    GELOGE(RT_FAILED, "Failed to set context, error_code is: 0x%X.", rt_ret);
+    return RT_ERROR_TO_GE_STATUS(rt_ret);
+  }
+
+  std::vector<VarTransferJob> jobs;
+  std::vector<std::string> changed_var_names;
   for (auto &node : variable_nodes) {
     if (node == nullptr) {
       continue;
@@ -439,57 +618,42 @@ Status TransVarDataUtils::TransAllVarData(const vector<NodePtr> &variable_nodes,
       continue;
     }
 
-    std::future<Status> f = executor.commit(
-      [](const ge::NodePtr &node, uint64_t session_id, rtContext_t ctx, uint32_t graph_id) -> Status {
-        rtError_t rt_ret = rtCtxSetCurrent(ctx);
-        if (rt_ret != RT_ERROR_NONE) {
-          GELOGE(RT_FAILED, "Failed to set context, error_code is: 0x%X.", rt_ret);
-          return RT_ERROR_TO_GE_STATUS(rt_ret);
-        }
-        uint32_t allocated_graph_id = 0;
-        Status ret = VarManager::Instance(session_id)->GetAllocatedGraphId(node->GetName(), allocated_graph_id);
-        if (ret != SUCCESS) {
-          GELOGE(INTERNAL_ERROR, "var has not been allocated, node:%s, graph_id:%u.", node->GetName().c_str(),
-                 graph_id);
-          return INTERNAL_ERROR;
-        }
-        uint32_t changed_graph_id = 0;
-        ret = VarManager::Instance(session_id)->GetChangedGraphId(node->GetName(), changed_graph_id);
-        bool call_trans_var =
-          (ret == SUCCESS && changed_graph_id == graph_id && changed_graph_id != allocated_graph_id);
-        if (call_trans_var) {
-          GELOGI("VarManager::GetChangedGraphId() success, node:%s, graph_id:%u.", node->GetName().c_str(), graph_id);
-          VarTransRoad *trans_road = VarManager::Instance(session_id)->GetTransRoad(node->GetName());
-          if (trans_road == nullptr) {
-            GELOGI("The variable %s does not have any trans road", node->GetName().c_str());
-            return SUCCESS;
-          }
-          ret = TransVarData(node, *trans_road, session_id);
-          if (ret != SUCCESS) {
-            GELOGE(INTERNAL_ERROR, "TransVarData failed, node:%s, graph_id:%u.", node->GetName().c_str(), graph_id);
-            return INTERNAL_ERROR;
-          }
-          VarManager::Instance(session_id)->RemoveChangedGraphId(node->GetName());
-        }
-        return SUCCESS;
-      },
-      node, session_id, context, graph_id);
-    if (!f.valid()) {
-      GELOGE(FAILED, "Future is invalid");
-      return FAILED;
+    uint32_t allocated_graph_id = 0;
+    Status ret = VarManager::Instance(session_id)->GetAllocatedGraphId(node->GetName(), allocated_graph_id);
+    if (ret != SUCCESS) {
+      GELOGE(INTERNAL_ERROR, "var has not been allocated, node:%s, graph_id:%u.", node->GetName().c_str(), graph_id);
+      return INTERNAL_ERROR;
     }
-    vector_future.push_back(std::move(f));
-  }
-
-  Status ret_status;
-  for (size_t i = 0; i < vector_future.size(); ++i) {
-    ret_status = vector_future[i].get();
-    if (ret_status != SUCCESS) {
-      GELOGE(ret_status, "TransAllVarData:: trans %zu vardata failed", i);
-      return ret_status;
+    uint32_t changed_graph_id = 0;
+    ret = VarManager::Instance(session_id)->GetChangedGraphId(node->GetName(), changed_graph_id);
+    bool call_trans_var = (ret == SUCCESS && changed_graph_id == graph_id && changed_graph_id != allocated_graph_id);
+    if (!call_trans_var) {
+      continue;
     }
+    GELOGI("VarManager::GetChangedGraphId() success, node:%s, graph_id:%u.", node->GetName().c_str(), graph_id);
+    VarTransRoad *trans_road = VarManager::Instance(session_id)->GetTransRoad(node->GetName());
+    if (trans_road == nullptr) {
+      GELOGI("The variable %s does not have any trans road", node->GetName().c_str());
+      continue;
+    }
+    ret = BuildTransVarJob(node, *trans_road, session_id, jobs);
+    if (ret != SUCCESS) {
+      GELOGE(INTERNAL_ERROR, "TransVarData failed, node:%s, graph_id:%u.", node->GetName().c_str(), graph_id);
+      return INTERNAL_ERROR;
+    }
+    changed_var_names.emplace_back(node->GetName());
   }
 
+  VarTransferPipeline pipeline(context, thread_num);
+  auto ret = pipeline.Run(jobs);
+  if (ret != SUCCESS) {
+    GELOGE(ret, "TransAllVarData:: trans %zu vardata of graph %u failed", jobs.size(), graph_id);
+    return ret;
+  }
+  for (const auto &var_name : changed_var_names) {
+    VarManager::Instance(session_id)->RemoveChangedGraphId(var_name);
+  }
+  GELOGI("TransAllVarData:: trans %zu vardata of graph %u success", jobs.size(), graph_id);
   return SUCCESS;
 }
 
@@ -500,6 +664,9 @@ Status TransVarDataUtils::CopyVarData(const ComputeGraphPtr &compute_graph, uint
     return FAILED;
   }
 
+  RtContextSwitchGuard switch_context(RT_CTX_NORMAL_MODE, device_id);
+  std::vector<VarTransferJob> jobs;
+  std::vector<NodePtr> copied_nodes;
   string cp_from_node;
   bool copy_value = false;
   for (auto &node : compute_graph->GetAllNodes()) {
@@ -513,13 +680,25 @@ Status TransVarDataUtils::CopyVarData(const ComputeGraphPtr &compute_graph, uint
         GE_CHECK_NOTNULL(src_node);
         GELOGI("current_var_node__: [%s] copy_from_var_node__: [%s].", node->GetName().c_str(),
                src_node->GetName().c_str());
-        auto ret = CopyTensorFromSrcVarNode(src_node, node, session_id, device_id);
+        auto ret = BuildCopyVarJob(src_node, node, session_id, jobs);
         GE_IF_BOOL_EXEC(ret != SUCCESS, GELOGE(FAILED, "copy tensor failed!"); return FAILED);
-        // only copy once
-        (void)ge::AttrUtils::SetBool(node->GetOpDesc(), "_copy_value", true);  // no need to check value
+        copied_nodes.emplace_back(node);
       }
     }
   }
+  if (jobs.empty()) {
+    return SUCCESS;
+  }
+
+  rtContext_t context = nullptr;
+  GE_CHK_RT_RET(rtCtxGetCurrent(&context));
+  VarTransferPipeline pipeline(context, kCopyVarThreadNum);
+  auto ret = pipeline.Run(jobs);
+  GE_IF_BOOL_EXEC(ret != SUCCESS, GELOGE(FAILED, "copy tensor failed!"); return FAILED);
+  for (const auto &node : copied_nodes) {
+    // only copy once
+    (void)ge::AttrUtils::SetBool(node->GetOpDesc(), "_copy_value", true);  // no need to check value
+  }
   return SUCCESS;
 }
 }  // namespace ge
@@ -0,0 +1,453 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "graph/manager/var_checkpoint_engine.h"
+
+#include <fcntl.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <unordered_map>
+
+#include "framework/common/debug/ge_log.h"
+#include "framework/common/debug/log.h"
+#include "graph/common/op_signature.h"
+#include "graph/manager/graph_var_manager.h"
+#include "graph/utils/tensor_utils.h"
+#include "mmpa/mmpa_api.h"
+#include "securec.h"
+
+namespace ge {
+namespace {
+const char kCheckpointMagic[] = "GEVARCKP";
+const uint32_t kCheckpointVersion = 1;
+// data of each variable starts at page boundary, so that it can be mapped
+const uint64_t kCheckpointAlign = 4096;
+// variables closer than it on device are snapshotted by one copy
+const uint64_t kMaxMergeGap = 64 * 1024;
+// mmWrite takes a 32 bits length
+const uint64_t kMaxWriteSize = 64 * 1024 * 1024;
+
+// where the data of a variable is
+enum VarLocation : uint32_t {
+  kInThisFile = 0,
+  kInBaseFile = 1,
+};
+
+struct CheckpointHeader {
+  char magic[sizeof(uint64_t)];
+  uint32_t version;
+  uint32_t var_num;
+  uint64_t index_offset;
+  uint64_t index_size;
+};
+
+uint64_t AlignCheckpointOffset(uint64_t offset) {
+  return (offset + kCheckpointAlign - 1) / kCheckpointAlign * kCheckpointAlign;
+}
+
+class IndexReader {
+ public:
+  explicit IndexReader(const std::string &index) : index_(index) {}
+
+  template <typename T>
+  bool ReadValue(T &value) {
+    if (index_.size() - pos_ < sizeof(T)) {
+      return false;
+    }
+    (void)memcpy_s(&value, sizeof(T), index_.data() + pos_, sizeof(T));
+    pos_ += sizeof(T);
+    return true;
+  }
+
+  bool ReadString(std::string &value) {
+    size_t size = 0;
+    if (!ReadValue(size) || (index_.size() - pos_ < size)) {
+      return false;
+    }
+    value = index_.substr(pos_, size);
+    pos_ += size;
+    return true;
+  }
+
+ private:
+  const std::string &index_;
+  size_t pos_ = 0;
+};
+
+Status WriteFully(int32_t fd, const uint8_t *data, uint64_t size) {
+  while (size > 0) {
+    uint32_t write_size = static_cast<uint32_t>(std::min(size, kMaxWriteSize));
+    auto write_count = mmWrite(fd, const_cast<uint8_t *>(data), write_size);
+    if (write_count != static_cast<mmSsize_t>(write_size)) {
+      GELOGE(FAILED, "Write checkpoint failed, size = %u, ret = %ld, %s", write_size, static_cast<int64_t>(write_count),
+             strerror(errno));
+      return FAILED;
+    }
+    data += write_size;
+    size -= write_size;
+  }
+  return SUCCESS;
+}
+
+Status WritePadding(int32_t fd, uint64_t &offset) {
+  static const uint8_t kZeros[kCheckpointAlign] = {0};
+  uint64_t aligned_offset = AlignCheckpointOffset(offset);
+  GE_CHK_STATUS_RET_NOLOG(WriteFully(fd, kZeros, aligned_offset - offset));
+  offset = aligned_offset;
+  return SUCCESS;
+}
+
+// reads the var from one file, base_path is set to the file holding its data if it is not in this one
+Status ReadVarInFile(const std::string &file_path, const std::string &var_name, GeTensorDesc &tensor_desc,
+                     std::vector<uint8_t> &data, std::string &base_path) {
+  std::ifstream ifs(file_path, std::ios::binary);
+  CheckpointHeader header = {};
+  if (!ifs.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+      (memcmp(header.magic, kCheckpointMagic, sizeof(header.magic)) != 0) || (header.version != kCheckpointVersion)) {
+    GELOGE(FAILED, "%s is not a checkpoint file.", file_path.c_str());
+    return FAILED;
+  }
+  std::string index(header.index_size, '\0');
+  if (!ifs.seekg(header.index_offset) || !ifs.read(&index[0], header.index_size)) {
+    GELOGE(FAILED, "Read index of checkpoint %s failed.", file_path.c_str());
+    return FAILED;
+  }
+
+  IndexReader reader(index);
+  std::string index_base_path;
+  GE_CHK_BOOL_RET_STATUS(reader.ReadString(index_base_path), FAILED, "Parse index of checkpoint %s failed.",
+                         file_path.c_str());
+  for (uint32_t i = 0; i < header.var_num; ++i) {
+    std::string name;
+    int32_t data_type = 0;
+    int32_t format = 0;
+    size_t dim_num = 0;
+    bool parsed = reader.ReadString(name) && reader.ReadValue(data_type) && reader.ReadValue(format) &&
+                  reader.ReadValue(dim_num);
+    std::vector<int64_t> dims(parsed ? dim_num : 0);
+    for (size_t j = 0; parsed && (j < dim_num); ++j) {
+      parsed = reader.ReadValue(dims[j]);
+    }
+    uint32_t location = kInThisFile;
+    uint64_t data_offset = 0;
+    uint64_t data_size = 0;
+    parsed = parsed && reader.ReadValue(location) && reader.ReadValue(data_offset) && reader.ReadValue(data_size);
+    GE_CHK_BOOL_RET_STATUS(parsed, FAILED, "Parse index of checkpoint %s failed.", file_path.c_str());
+    if (name != var_name) {
+      continue;
+    }
+
+    if (location == kInBaseFile) {
+      GE_CHK_BOOL_RET_STATUS(!index_base_path.empty(), FAILED, "Var %s of checkpoint %s has no base file.",
+                             var_name.c_str(), file_path.c_str());
+      base_path = index_base_path;
+      return SUCCESS;
+    }
+    base_path.clear();
+    tensor_desc = GeTensorDesc(GeShape(dims), static_cast<Format>(format), static_cast<DataType>(data_type));
+    data.resize(data_size);
+    if ((data_size > 0) && (!ifs.seekg(data_offset) || !ifs.read(reinterpret_cast<char *>(data.data()), data_size))) {
+      GELOGE(FAILED, "Read var %s from checkpoint %s failed.", var_name.c_str(), file_path.c_str());
+      return FAILED;
+    }
+    return SUCCESS;
+  }
+  GELOGE(FAILED, "Var %s is not in checkpoint %s.", var_name.c_str(), file_path.c_str());
+  return FAILED;
+}
+}  // namespace
+
+VarCheckpointEngine::VarCheckpointEngine(uint64_t session_id) : session_id_(session_id) {}
+
+VarCheckpointEngine::~VarCheckpointEngine() {
+  (void)Wait();
+  jobs_.Stop();
+  if (write_thread_.joinable()) {
+    write_thread_.join();
+  }
+  for (auto &buffer : buffers_) {
+    if (buffer.addr != nullptr) {
+      GE_CHK_RT(rtFreeHost(buffer.addr));
+    }
+  }
+  if (stream_ != nullptr) {
+    GE_CHK_RT(rtStreamDestroy(stream_));
+  }
+}
+
+Status VarCheckpointEngine::CollectVars(std::vector<VarCheckpointItem> &vars) const {
+  auto var_manager = VarManager::Instance(session_id_);
+  GE_CHECK_NOTNULL(var_manager);
+  std::unordered_map<std::string, GeTensorDesc> var_descs;
+  GE_CHK_STATUS_RET(var_manager->GetAllCurVarDesc(var_descs), "Get variables of session %lu failed.", session_id_);
+  for (const auto &name_and_desc : var_descs) {
+    VarCheckpointItem var;
+    var.var_name = name_and_desc.first;
+    var.tensor_desc = name_and_desc.second;
+    uint8_t *logic_addr = nullptr;
+    rtMemType_t memory_type = RT_MEMORY_HBM;
+    GE_CHK_STATUS_RET(var_manager->GetVarAddr(var.var_name, var.tensor_desc, &logic_addr, memory_type),
+                      "Get addr of var %s failed.", var.var_name.c_str());
+    if (memory_type != RT_MEMORY_HBM) {
+      GELOGW("Var %s is not in HBM, memory type = %u, skip it.", var.var_name.c_str(), memory_type);
+      continue;
+    }
+    var.addr = var_manager->GetVarMemoryAddr(logic_addr, memory_type);
+    GE_CHECK_NOTNULL(var.addr);
+    int64_t size = 0;
+    GE_CHK_STATUS_RET(TensorUtils::GetSize(var.tensor_desc, size), "Get size of var %s failed.", var.var_name.c_str());
+    var.size = static_cast<uint64_t>(size);
+    vars.emplace_back(std::move(var));
+  }
+  return SUCCESS;
+}
+
+Status VarCheckpointEngine::Save(const std::string &file_path, bool incremental) {
+  std::vector<VarCheckpointItem> vars;
+  GE_CHK_STATUS_RET_NOLOG(CollectVars(vars));
+  return Save(file_path, vars, incremental);
+}
+
+Status VarCheckpointEngine::EnsureBuffer(HostBuffer &buffer, size_t size) {
+  if (buffer.size >= size) {
+    return SUCCESS;
+  }
+  if (buffer.addr != nullptr) {
+    GE_CHK_RT(rtFreeHost(buffer.addr));
+    buffer.addr = nullptr;
+    buffer.size = 0;
+  }
+  GE_CHK_RT_RET(rtMallocHost(reinterpret_cast<void **>(&buffer.addr), size));
+  // so that bytes never copied, such as gaps between variables, do not vary between snapshots
+  (void)memset_s(buffer.addr, size, 0, size);
+  buffer.size = size;
+  return SUCCESS;
+}
+
+Status VarCheckpointEngine::Snapshot(const std::vector<VarCheckpointItem> &vars, HostBuffer &buffer,
+                                     std::vector<SnapshotVar> &snapshot) {
+  std::vector<const VarCheckpointItem *> sorted_vars;
+  for (const auto &var : vars) {
+    GE_CHECK_NOTNULL(var.addr);
+    sorted_vars.emplace_back(&var);
+  }
+  std::sort(sorted_vars.begin(), sorted_vars.end(),
+            [](const VarCheckpointItem *lhs, const VarCheckpointItem *rhs) { return lhs->addr < rhs->addr; });
+
+  // merge variables close to each other into ranges, one copy for each range
+  struct CopyRange {
+    const uint8_t *addr;
+    uint64_t size;
+    size_t host_offset;
+  };
+  std::vector<CopyRange> ranges;
+  size_t host_size = 0;
+  for (auto var : sorted_vars) {
+    if (!ranges.empty() && (var->addr <= ranges.back().addr + ranges.back().size + kMaxMergeGap)) {
+      auto &range = ranges.back();
+      uint64_t var_offset = static_cast<uint64_t>(var->addr - range.addr);
+      uint64_t range_size = std::max(range.size, var_offset + var->size);
+      host_size += range_size - range.size;
+      range.size = range_size;
+      snapshot.emplace_back(SnapshotVar{var->var_name, var->tensor_desc, range.host_offset + var_offset, var->size});
+      continue;
+    }
+    ranges.emplace_back(CopyRange{var->addr, var->size, host_size});
+    snapshot.emplace_back(SnapshotVar{var->var_name, var->tensor_desc, host_size, var->size});
+    host_size += var->size;
+  }
+
+  GE_CHK_STATUS_RET(EnsureBuffer(buffer, host_size), "Malloc snapshot buffer failed, size = %zu.", host_size);
+  if (stream_ == nullptr) {
+    GE_CHK_RT_RET(rtStreamCreate(&stream_, 0));
+  }
+  for (const auto &range : ranges) {
+    if (range.size == 0) {
+      continue;
+    }
+    GE_CHK_RT_RET(rtMemcpyAsync(buffer.addr + range.host_offset, range.size, range.addr, range.size,
+                                RT_MEMCPY_DEVICE_TO_HOST, stream_));
+  }
+  GE_CHK_RT_RET(rtStreamSynchronize(stream_));
+  GELOGI("Snapshot %zu variables by %zu copies, size = %zu.", snapshot.size(), ranges.size(), host_size);
+  return SUCCESS;
+}
+
+Status VarCheckpointEngine::Save(const std::string &file_path, const std::vector<VarCheckpointItem> &vars,
+                                 bool incremental) {
+  std::lock_guard<std::mutex> save_lock(save_mutex_);
+  auto &buffer = buffers_[next_buffer_];
+  {
+    // the buffer is in use by the checkpoint before last one, wait for it to be written
+    std::unique_lock<std::mutex> lk(mu_);
+    cond_.wait(lk, [&buffer]() { return !buffer.busy; });
+  }
+
+  SaveJob job;
+  job.file_path = file_path;
+  job.incremental = incremental;
+  job.buffer_index = next_buffer_;
+  GE_CHK_STATUS_RET(Snapshot(vars, buffer, job.vars), "Snapshot variables for %s failed.", file_path.c_str());
+
+  if (!write_thread_.joinable()) {
+    write_thread_ = std::thread(&VarCheckpointEngine::WriteThread, this);
+  }
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    buffer.busy = true;
+    ++pending_jobs_;
+  }
+  if (!jobs_.Push(std::move(job))) {
+    std::lock_guard<std::mutex> lk(mu_);
+    buffer.busy = false;
+    --pending_jobs_;
+    GELOGE(INTERNAL_ERROR, "Push checkpoint job of %s failed.", file_path.c_str());
+    return INTERNAL_ERROR;
+  }
+  next_buffer_ = 1 - next_buffer_;
+  return SUCCESS;
+}
+
+Status VarCheckpointEngine::Wait() {
+  std::unique_lock<std::mutex> lk(mu_);
+  cond_.wait(lk, [this]() { return pending_jobs_ == 0; });
+  auto ret = write_status_;
+  write_status_ = SUCCESS;
+  return ret;
+}
+
+void VarCheckpointEngine::WriteThread() {
+  SaveJob job;
+  while (jobs_.Pop(job)) {
+    auto ret = WriteCheckpoint(job);
+    std::lock_guard<std::mutex> lk(mu_);
+    buffers_[job.buffer_index].busy = false;
+    --pending_jobs_;
+    if ((ret != SUCCESS) && (write_status_ == SUCCESS)) {
+      write_status_ = ret;
+    }
+    cond_.notify_all();
+  }
+}
+
+Status VarCheckpointEngine::WriteCheckpoint(const SaveJob &job) {
+  const uint8_t *host_base = buffers_[job.buffer_index].addr;
+  // a file of the chain is replaced by this one, the index would refer to itself, take a full checkpoint
+  bool in_chain = chain_file_paths_.count(job.file_path) > 0;
+  if (job.incremental && in_chain) {
+    GELOGW("Checkpoint %s replaces a file it would refer to, all variables are written.", job.file_path.c_str());
+  }
+  bool has_base = job.incremental && !last_file_path_.empty() && !in_chain;
+  std::string index;
+  OpSignature::AppendString(index, has_base ? last_file_path_ : std::string());
+
+  std::map<std::string, std::string> digests;
+  std::vector<const SnapshotVar *> vars_to_write;
+  uint64_t offset = AlignCheckpointOffset(sizeof(CheckpointHeader));
+  for (const auto &var : job.vars) {
+    std::string digest;
+    OpSignature::AppendDigest(digest, host_base + var.host_offset, var.size);
+    auto it = last_digests_.find(var.var_name);
+    bool unchanged = has_base && (it != last_digests_.end()) && (it->second == digest);
+    digests.emplace(var.var_name, std::move(digest));
+
+    OpSignature::AppendString(index, var.var_name);
+    OpSignature::AppendValue(index, static_cast<int32_t>(var.tensor_desc.GetDataType()));
+    OpSignature::AppendValue(index, static_cast<int32_t>(var.tensor_desc.GetFormat()));
+    const auto &dims = var.tensor_desc.GetShape().GetDims();
+    OpSignature::AppendValue(index, dims.size());
+    for (auto dim : dims) {
+      OpSignature::AppendValue(index, dim);
+    }
+    OpSignature::AppendValue(index, static_cast<uint32_t>(unchanged ? kInBaseFile : kInThisFile));
+    OpSignature::AppendValue(index, unchanged ? 0UL : offset);
+    OpSignature::AppendValue(index, var.size);
+    if (!unchanged) {
+      vars_to_write.emplace_back(&var);
+      offset = AlignCheckpointOffset(offset + var.size);
+    }
+  }
+
+  CheckpointHeader header = {};
+  (void)memcpy_s(header.magic, sizeof(header.magic), kCheckpointMagic, sizeof(header.magic));
+  header.version = kCheckpointVersion;
+  header.var_num = static_cast<uint32_t>(job.vars.size());
+  header.index_offset = offset;
+  header.index_size = index.size();
+
+  // written to a temp file first, so that the file is either complete or absent
+  std::string tmp_path = job.file_path + ".tmp";
+  int32_t fd = mmOpen2(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+  if (fd < 0) {
+    GELOGE(FAILED, "Open checkpoint file %s failed, ret = %d, %s", tmp_path.c_str(), fd, strerror(errno));
+    return FAILED;
+  }
+  uint64_t write_offset = sizeof(CheckpointHeader);
+  Status ret = WriteFully(fd, reinterpret_cast<const uint8_t *>(&header), sizeof(header));
+  for (size_t i = 0; (ret == SUCCESS) && (i < vars_to_write.size()); ++i) {
+    ret = WritePadding(fd, write_offset);
+    if (ret == SUCCESS) {
+      ret = WriteFully(fd, host_base + vars_to_write[i]->host_offset, vars_to_write[i]->size);
+      write_offset += vars_to_write[i]->size;
+    }
+  }
+  if (ret == SUCCESS) {
+    ret = WritePadding(fd, write_offset);
+  }
+  if (ret == SUCCESS) {
+    ret = WriteFully(fd, reinterpret_cast<const uint8_t *>(index.data()), index.size());
+  }
+  if (mmClose(fd) != EN_OK) {
+    ret = FAILED;
+  }
+  if ((ret != SUCCESS) || (std::rename(tmp_path.c_str(), job.file_path.c_str()) != 0)) {
+    GELOGE(FAILED, "Write checkpoint file %s failed.", job.file_path.c_str());
+    (void)std::remove(tmp_path.c_str());
+    return FAILED;
+  }
+
+  if (!has_base) {
+    chain_file_paths_.clear();
+  }
+  (void)chain_file_paths_.insert(job.file_path);
+  last_file_path_ = job.file_path;
+  last_digests_ = std::move(digests);
+  GELOGI("Checkpoint %s written, %zu of %zu variables, size = %lu.", job.file_path.c_str(), vars_to_write.size(),
+         job.vars.size(), header.index_offset + header.index_size);
+  return SUCCESS;
+}
+
+Status VarCheckpointEngine::ReadVar(const std::string &file_path, const std::string &var_name,
+                                    GeTensorDesc &tensor_desc, std::vector<uint8_t> &data) {
+  std::set<std::string> visited_paths;
+  std::string path = file_path;
+  while (!path.empty()) {
+    // a file overwritten by a checkpoint referring to it makes a cycle, which never reaches the data
+    if (!visited_paths.insert(path).second) {
+      GELOGE(FAILED, "Checkpoint %s refers to itself through its base files, var %s can not be read.",
+             file_path.c_str(), var_name.c_str());
+      return FAILED;
+    }
+    std::string base_path;
+    GE_CHK_STATUS_RET_NOLOG(ReadVarInFile(path, var_name, tensor_desc, data, base_path));
+    path = base_path;
+  }
+  return SUCCESS;
+}
+}  // namespace ge
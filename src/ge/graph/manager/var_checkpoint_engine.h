@@ -0,0 +1,134 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef GE_GRAPH_MANAGER_VAR_CHECKPOINT_ENGINE_H_
+#define GE_GRAPH_MANAGER_VAR_CHECKPOINT_ENGINE_H_
+
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/blocking_queue.h"
+#include "framework/common/ge_inner_error_codes.h"
+#include "graph/ge_tensor.h"
+#include "runtime/rt.h"
+
+namespace ge {
+struct VarCheckpointItem {
+  std::string var_name;
+  GeTensorDesc tensor_desc;
+  // device mem
+  const uint8_t *addr = nullptr;
+  uint64_t size = 0;
+};
+
+///
+/// @ingroup ge_graph
+/// @brief Saves variables of a session to checkpoint files without holding up training. Variable memory is copied
+///        into one of two page locked host buffers, then the file is written by a background thread, so the next
+///        step can run once the copy is done, and the next checkpoint can be taken while the last one is written.
+///        File layout: a header, data of each variable aligned to page size so that it can be mapped, then the index.
+///        Data is saved in the format the variable has on device, which is given by its desc in the index.
+///        An incremental checkpoint only holds the variables changed since the last checkpoint, the index refers
+///        the others to the last checkpoint file. Replacing a file the last checkpoint refers to takes a full one.
+///
+class VarCheckpointEngine {
+ public:
+  explicit VarCheckpointEngine(uint64_t session_id);
+  ~VarCheckpointEngine();
+
+  VarCheckpointEngine(const VarCheckpointEngine &) = delete;
+  VarCheckpointEngine &operator=(const VarCheckpointEngine &) = delete;
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief snapshot all variables of the session, and write them to file in background
+  /// @param [in] file_path: checkpoint file
+  /// @param [in] incremental: only write variables changed since the last checkpoint
+  /// @return Status result of the snapshot, graphs updating the variables must not be running during it
+  ///
+  Status Save(const std::string &file_path, bool incremental);
+
+  Status Save(const std::string &file_path, const std::vector<VarCheckpointItem> &vars, bool incremental);
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief wait for checkpoints in writing
+  /// @return Status the first failure of writing since last wait
+  ///
+  Status Wait();
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief read a variable from checkpoint file, following the files it refers to
+  ///
+  static Status ReadVar(const std::string &file_path, const std::string &var_name, GeTensorDesc &tensor_desc,
+                        std::vector<uint8_t> &data);
+
+ private:
+  struct SnapshotVar {
+    std::string var_name;
+    GeTensorDesc tensor_desc;
+    size_t host_offset;
+    uint64_t size;
+  };
+
+  struct SaveJob {
+    std::string file_path;
+    bool incremental = false;
+    size_t buffer_index = 0;
+    std::vector<SnapshotVar> vars;
+  };
+
+  struct HostBuffer {
+    uint8_t *addr = nullptr;
+    size_t size = 0;
+    bool busy = false;
+  };
+
+  Status CollectVars(std::vector<VarCheckpointItem> &vars) const;
+  Status EnsureBuffer(HostBuffer &buffer, size_t size);
+  Status Snapshot(const std::vector<VarCheckpointItem> &vars, HostBuffer &buffer, std::vector<SnapshotVar> &snapshot);
+  void WriteThread();
+  Status WriteCheckpoint(const SaveJob &job);
+
+  uint64_t session_id_;
+  rtStream_t stream_ = nullptr;
+  std::mutex save_mutex_;
+  HostBuffer buffers_[2];
+  size_t next_buffer_ = 0;
+
+  std::mutex mu_;
+  std::condition_variable cond_;
+  size_t pending_jobs_ = 0;
+  Status write_status_ = SUCCESS;
+  BlockingQueue<SaveJob> jobs_;
+  std::thread write_thread_;
+
+  // used by write thread only
+  std::string last_file_path_;
+  // the last checkpoint file and the files it refers to
+  std::set<std::string> chain_file_paths_;
+  std::map<std::string, std::string> last_digests_;
+};
+}  // namespace ge
+
+#endif  // GE_GRAPH_MANAGER_VAR_CHECKPOINT_ENGINE_H_
@@ -23,7 +23,10 @@
 #include <mutex>
 
 #include "common/op/ge_op_utils.h"
+#include "common/thread_pool.h"
 #include "common/util/error_manager/error_manager.h"
+#include "framework/common/util.h"
+#include "graph/ge_local_context.h"
 #include "graph/utils/graph_utils.h"
 #include "graph/utils/op_desc_utils.h"
 #include "init/gelib.h"
@@ -33,7 +36,8 @@
 namespace ge {
 namespace {
 std::mutex check_support_cost_mutex;
-}
+const int64_t kPlaceParallelMinBlock = 64;
+}  // namespace
 Status EnginePlacer::Check() const {
   if (compute_graph_ == nullptr) {
     GELOGE(GE_GRAPH_NULL_INPUT, "compute_graph_ is null.");
@@ -47,6 +51,32 @@ Status EnginePlacer::Check() const {
   return SUCCESS;
 }
 
+Status EnginePlacer::PlaceNode(const NodePtr &node_ptr, std::string &engine_name) {
+  GE_CHECK_NOTNULL(node_ptr);
+  auto op_desc = node_ptr->GetOpDesc();
+  GE_CHECK_NOTNULL(op_desc);
+  std::string kernel_name;
+  // Check if this node has assigned engine
+  bool has_engine_attr = AttrUtils::GetStr(op_desc, ATTR_NAME_ENGINE_NAME_FOR_LX, engine_name) && !engine_name.empty();
+  bool has_kernel_attr =
+    AttrUtils::GetStr(op_desc, ATTR_NAME_KKERNEL_LIB_NAME_FOR_LX, kernel_name) && !kernel_name.empty();
+  bool use_exist_engine_name = !op_desc->GetOpKernelLibName().empty() || (has_kernel_attr && has_engine_attr);
+  if (use_exist_engine_name) {
+    if (op_desc->GetOpEngineName().empty()) {
+      GELOGI("Op %s set engine_name %s engine_name %s from attrs", op_desc->GetName().c_str(), engine_name.c_str(),
+             kernel_name.c_str());
+      op_desc->SetOpEngineName(engine_name);
+      op_desc->SetOpKernelLibName(kernel_name);
+    }
+    engine_name = op_desc->GetOpEngineName();
+    return SUCCESS;
+  }
+
+  // Call placer cost model to get the "best" engine for this node
+  engine_name = ge::GELib::GetInstance()->DNNEngineManagerObj().GetDNNEngineName(node_ptr);
+  return engine_name.empty() ? FAILED : SUCCESS;
+}
+
 Status EnginePlacer::Run() {
   std::lock_guard<std::mutex> lock(check_support_cost_mutex);
 
@@ -54,51 +84,52 @@ Status EnginePlacer::Run() {
   if (Check() != SUCCESS) {
     return FAILED;
   }
-  bool is_check_support_success = true;
+  uint64_t start_time = GetCurrentTimestap();
+  auto &engine_manager = ge::GELib::GetInstance()->DNNEngineManagerObj();
+  engine_manager.InitPerformanceStaistic();
+
+  // Nodes are placed independently, the options of this thread are passed to the workers
+  auto nodes = compute_graph_->GetDirectNode();
+  std::vector<std::string> engine_names(nodes.size());
+  std::vector<uint8_t> place_success(nodes.size(), 0);
+  GEThreadLocalContext context = GetThreadLocalContext();
+  (void)ThreadPool::ParallelFor(static_cast<int64_t>(nodes.size()), kPlaceParallelMinBlock,
+                                [&](int64_t begin, int64_t end) -> Status {
+                                  GetThreadLocalContext() = context;
+                                  for (int64_t i = begin; i < end; ++i) {
+                                    place_success[i] = (PlaceNode(nodes.at(i), engine_names[i]) == SUCCESS);
+                                  }
+                                  return SUCCESS;
+                                });
+
   // Assign engine for each node in the graph
-  ge::GELib::GetInstance()->DNNEngineManagerObj().InitPerformanceStaistic();
-  for (const auto &node_ptr : compute_graph_->GetDirectNode()) {
-    GE_CHECK_NOTNULL(node_ptr);
-    auto op_desc = node_ptr->GetOpDesc();
-    GE_CHECK_NOTNULL(op_desc);
-    std::string engine_name;
-    std::string kernel_name;
-    // Check if this node has assigned engine
-    bool has_engine_attr =
-      AttrUtils::GetStr(op_desc, ATTR_NAME_ENGINE_NAME_FOR_LX, engine_name) && !engine_name.empty();
-    bool has_kernel_attr =
-      AttrUtils::GetStr(op_desc, ATTR_NAME_KKERNEL_LIB_NAME_FOR_LX, kernel_name) && !kernel_name.empty();
-    bool use_exist_engine_name = !op_desc->GetOpKernelLibName().empty() || (has_kernel_attr && has_engine_attr);
-    if (use_exist_engine_name) {
-      if (op_desc->GetOpEngineName().empty()) {
-        GELOGI("Op %s set engine_name %s engine_name %s from attrs", op_desc->GetName().c_str(), engine_name.c_str(),
-               kernel_name.c_str());
-        op_desc->SetOpEngineName(engine_name);
-        op_desc->SetOpKernelLibName(kernel_name);
-      }
-      engine_name = op_desc->GetOpEngineName();
-    } else {
-      // Call placer cost model to get the "best" engine for this node
-      engine_name = ge::GELib::GetInstance()->DNNEngineManagerObj().GetDNNEngineName(node_ptr);
-      // If can't get op's engine name, keep check support finish and return failed
-      if (engine_name.empty()) {
-        is_check_support_success = false;
-        ErrorManager::GetInstance().ATCReportErrMessage("E13003", {"opname", "optype"},
-                                                        {op_desc->GetName(), op_desc->GetType()});
-        GELOGE(GE_CLI_GE_NOT_INITIALIZED, "Can not find engine of op type %s",
-               node_ptr->GetOpDesc()->GetType().c_str());
-        continue;
-      }
+  bool is_check_support_success = true;
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    // If can't get op's engine name, keep check support finish and return failed
+    if (place_success[i] == 0) {
+      is_check_support_success = false;
+      GE_CHECK_NOTNULL(nodes.at(i));
+      auto op_desc = nodes.at(i)->GetOpDesc();
+      GE_CHECK_NOTNULL(op_desc);
+      ErrorManager::GetInstance().ATCReportErrMessage("E13003", {"opname", "optype"},
+                                                      {op_desc->GetName(), op_desc->GetType()});
+      GELOGE(GE_CLI_GE_NOT_INITIALIZED, "Can not find engine of op type %s", op_desc->GetType().c_str());
+      continue;
     }
-    if (AssignEngineAndLog(node_ptr, engine_name) != SUCCESS) {
+    if (AssignEngineAndLog(nodes.at(i), engine_names[i]) != SUCCESS) {
       GELOGE(GE_GRAPH_ASSIGN_ENGINE_FAILED, "[GraphPartitioner]: AssignEngineAndLog FAILED");
       return FAILED;
     }
   }
 
-  for (auto &it : ge::GELib::GetInstance()->DNNEngineManagerObj().GetCheckSupportCost()) {
+  for (auto &it : engine_manager.GetCheckSupportCost()) {
     GEEVENT("The time cost of %s::CheckSupported is [%lu] micro second.", it.first.c_str(), it.second);
   }
+  uint64_t hit_count = 0;
+  uint64_t miss_count = 0;
+  engine_manager.GetPlacementCacheStatistic(hit_count, miss_count);
+  GEEVENT("The time cost of placing %zu nodes of graph %s is [%lu] micro second, placement cache hit %lu, miss %lu.",
+          nodes.size(), compute_graph_->GetName().c_str(), GetCurrentTimestap() - start_time, hit_count, miss_count);
   GELOGI("Engine placer ends.");
   return is_check_support_success ? SUCCESS : FAILED;
 }
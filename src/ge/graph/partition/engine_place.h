@@ -45,6 +45,7 @@ class EnginePlacer {
   void SetComputeGraph(const ComputeGraphPtr &compute_graph) { compute_graph_ = compute_graph; }
 
  private:
+  Status PlaceNode(const NodePtr &node_ptr, std::string &engine_name);
   Status AssignEngineAndLog(ConstNodePtr node_ptr, const std::string &engine_name);
   Status Check() const;
 
@@ -15,6 +15,7 @@
  */
 
 #include "graph/partition/graph_partition.h"
+#include <google/protobuf/text_format.h>
 #include <algorithm>
 #include <memory>
 #include <string>
@@ -26,11 +27,14 @@
 #include "graph/debug/ge_attr_define.h"
 #include "graph/manager/graph_manager_utils.h"
 #include "graph/common/ge_call_wrapper.h"
+#include "graph/common/op_signature.h"
+#include "graph/detail/model_serialize_imp.h"
 #include "graph/utils/graph_utils.h"
 #include "graph/utils/op_desc_utils.h"
 #include "graph/utils/type_utils.h"
 #include "init/gelib.h"
 #include "opskernel_manager/ops_kernel_manager.h"
+#include "proto/ge_ir.pb.h"
 
 namespace {
 const char *const kEngineDefaultData = "ENGINE_DEFAULT_DATA";
@@ -39,6 +43,11 @@ const char *const kPlaceHolderType = "PlaceHolder";
 const int kOneGraph = 1;  // only one graph
 const int kRankOne = 1;   // order of graph list is 0,1,2,3..., 1 means second order
 const int kRankZero = 0;  // order of graph list is 0,1,2,3..., 0 means first order
+// attrs of placeholder and end nodes which change with the order of partitions
+const char *const kPeerIndex = "peerIndex";
+const char *const kPeerNodeName = "_peerNodeName";
+const char *const kParentId = "parentId";
+const char *const kParentNode = "parentNode";
 }  // namespace
 namespace ge {
 Status ge::GraphPartitioner::CheckIfEnd2PldEmpty(ge::ComputeGraphPtr &output_merged_compute_graph) {
@@ -1037,4 +1046,266 @@ void ge::GraphPartitioner::AddEndPldInformationToSubGraphInfo(ge::SubGraphInfoPt
 }
 
 const Graph2SubGraphInfoList &ge::GraphPartitioner::GetSubGraphMap() { return graph_2_subgraph_list_; }
+
+Status ge::GraphPartitioner::GetCutEdgeName(const GraphPartitionInfo &graph_info, const NodePtr &node,
+                                            std::string &cut_edge_name) const {
+  NodePtr end_node = node;
+  NodePtr pld_node = node;
+  if (node->GetType() == kEndType) {
+    auto iter = graph_info.end_2_pld_.find(node);
+    GE_IF_BOOL_EXEC(iter == graph_info.end_2_pld_.end(),
+                    GELOGE(FAILED, "Placeholder of end %s not found.", node->GetName().c_str());
+                    return FAILED;)
+    pld_node = iter->second;
+  } else {
+    auto iter = graph_info.pld_2_end_.find(node);
+    GE_IF_BOOL_EXEC(iter == graph_info.pld_2_end_.end(),
+                    GELOGE(FAILED, "End of placeholder %s not found.", node->GetName().c_str());
+                    return FAILED;)
+    end_node = iter->second;
+  }
+  GE_CHECK_NOTNULL(end_node);
+  GE_CHECK_NOTNULL(pld_node);
+
+  // the producer of the cut edge feeds the end node, and the placeholder node feeds the consumer
+  std::string src_name;
+  auto end_in_anchor = end_node->GetInDataAnchor(0);
+  if ((end_in_anchor != nullptr) && (end_in_anchor->GetPeerOutAnchor() != nullptr)) {
+    auto src_anchor = end_in_anchor->GetPeerOutAnchor();
+    src_name = src_anchor->GetOwnerNode()->GetName() + ":" + std::to_string(src_anchor->GetIdx());
+  } else if (!end_node->GetInControlNodes().empty()) {
+    src_name = end_node->GetInControlNodes().at(0)->GetName() + ":-1";
+  }
+  std::string dst_name;
+  auto pld_out_anchor = pld_node->GetOutDataAnchor(0);
+  if ((pld_out_anchor != nullptr) && !pld_out_anchor->GetPeerInDataAnchors().empty()) {
+    auto dst_anchor = pld_out_anchor->GetPeerInDataAnchors().at(0);
+    dst_name = dst_anchor->GetOwnerNode()->GetName() + ":" + std::to_string(dst_anchor->GetIdx());
+  } else if (!pld_node->GetOutControlNodes().empty()) {
+    dst_name = pld_node->GetOutControlNodes().at(0)->GetName() + ":-1";
+  }
+  cut_edge_name = src_name + "->" + dst_name;
+  return SUCCESS;
+}
+
+Status ge::GraphPartitioner::GetPartitionFingerprint(const ComputeGraphPtr &original_compute_graph,
+                                                     const SubGraphInfoPtr &sub_graph_info,
+                                                     const std::string &build_context, std::string &fingerprint,
+                                                     std::map<std::string, std::string> &cut_edge_names) {
+  GE_CHECK_NOTNULL(sub_graph_info);
+  const ComputeGraphPtr &sub_graph = sub_graph_info->GetSubGraph();
+  GE_CHECK_NOTNULL(sub_graph);
+  auto info_iter = graph_2_graph_partition_info_.find(original_compute_graph);
+  GE_IF_BOOL_EXEC(info_iter == graph_2_graph_partition_info_.end(),
+                  GELOGE(FAILED, "Partition info of %s not found.", sub_graph->GetName().c_str());
+                  return FAILED;)
+
+  std::unordered_map<NodePtr, std::string> stable_names;
+  for (const auto &node : sub_graph->GetDirectNode()) {
+    std::string stable_name = node->GetName();
+    if ((node->GetType() == kEndType) || (node->GetType() == kPlaceHolderType)) {
+      std::string cut_edge_name;
+      GE_CHK_STATUS_RET(GetCutEdgeName(info_iter->second, node, cut_edge_name), "Get cut edge of %s failed.",
+                        node->GetName().c_str());
+      cut_edge_names[node->GetName()] = cut_edge_name;
+      stable_name = node->GetType() + "(" + cut_edge_name + ")";
+    }
+    stable_names[node] = stable_name;
+  }
+
+  // nodes are ordered by their stable names, edges refer to their peers by stable names too
+  std::map<std::string, std::string> node_texts;
+  ModelSerializeImp model_serialize_imp;
+  for (const auto &node : sub_graph->GetDirectNode()) {
+    proto::OpDef op_def;
+    if (!model_serialize_imp.SerializeOpDesc(node->GetOpDesc(), &op_def)) {
+      GELOGW("Serialize node %s failed.", node->GetName().c_str());
+      return INTERNAL_ERROR;
+    }
+    op_def.set_name(stable_names[node]);
+    op_def.set_id(0);
+    op_def.clear_input();
+    op_def.clear_src_name();
+    op_def.clear_src_index();
+    op_def.clear_dst_name();
+    op_def.clear_dst_index();
+    auto attr = op_def.mutable_attr();
+    attr->erase(kPeerIndex);
+    attr->erase(kPeerNodeName);
+    attr->erase(kParentId);
+    // weights are keyed by their digest, the cache compares them with the cached partition on a hit
+    std::string weights_text;
+    if (attr->erase(ATTR_NAME_WEIGHTS) > 0) {
+      for (const auto &weight : OpDescUtils::GetWeights(node)) {
+        const Buffer &data = weight->GetData();
+        weights_text += "\nweights ";
+        OpSignature::AppendDigest(weights_text, data.data(), data.size());
+      }
+    }
+    std::string node_text;
+    if (!google::protobuf::TextFormat::PrintToString(op_def, &node_text)) {
+      GELOGW("Print node %s to string failed.", node->GetName().c_str());
+      return INTERNAL_ERROR;
+    }
+    node_text += weights_text;
+    for (const auto &in_anchor : node->GetAllInDataAnchors()) {
+      auto peer_anchor = in_anchor->GetPeerOutAnchor();
+      node_text += "\ninput " + std::to_string(in_anchor->GetIdx()) + " " +
+                   ((peer_anchor == nullptr) ? std::string()
+                                             : stable_names[peer_anchor->GetOwnerNode()] + ":" +
+                                                 std::to_string(peer_anchor->GetIdx()));
+    }
+    std::set<std::string> control_inputs;
+    for (const auto &in_node : node->GetInControlNodes()) {
+      control_inputs.insert(stable_names[in_node]);
+    }
+    for (const auto &control_input : control_inputs) {
+      node_text += "\ncontrol input " + control_input;
+    }
+    node_texts[stable_names[node]] = node_text;
+  }
+
+  std::string graph_text = build_context + "\n" + sub_graph_info->GetEngineName() + "\n" +
+                           sub_graph_info->GetStreamLabel();
+  for (const auto &node_text : node_texts) {
+    graph_text += "\n" + node_text.second;
+  }
+  fingerprint.swap(graph_text);
+  return SUCCESS;
+}
+
+Status ge::GraphPartitioner::ReplacePartition(const ComputeGraphPtr &original_compute_graph,
+                                              const SubGraphInfoPtr &sub_graph_info,
+                                              const ComputeGraphPtr &optimized_graph,
+                                              const std::map<std::string, std::string> &cut_edge_names) {
+  GE_CHECK_NOTNULL(sub_graph_info);
+  GE_CHECK_NOTNULL(optimized_graph);
+  const ComputeGraphPtr sub_graph = sub_graph_info->GetSubGraph();
+  GE_CHECK_NOTNULL(sub_graph);
+  auto info_iter = graph_2_graph_partition_info_.find(original_compute_graph);
+  GE_IF_BOOL_EXEC(info_iter == graph_2_graph_partition_info_.end(),
+                  GELOGE(FAILED, "Partition info of %s not found.", sub_graph->GetName().c_str());
+                  return FAILED;)
+  GraphPartitionInfo &graph_info = info_iter->second;
+
+  // match every node the merging goes through before changing anything
+  std::map<std::string, NodePtr> cut_edge_to_node;
+  for (const auto &node : sub_graph->GetDirectNode()) {
+    if ((node->GetType() == kEndType) || (node->GetType() == kPlaceHolderType)) {
+      std::string cut_edge_name;
+      GE_CHK_STATUS_RET(GetCutEdgeName(graph_info, node, cut_edge_name), "Get cut edge of %s failed.",
+                        node->GetName().c_str());
+      cut_edge_to_node[cut_edge_name] = node;
+    }
+  }
+  NodetoNodeMap replaced_nodes;
+  std::map<std::string, NodePtr> optimized_nodes;
+  for (const auto &node : optimized_graph->GetDirectNode()) {
+    optimized_nodes[node->GetName()] = node;
+    if ((node->GetType() != kEndType) && (node->GetType() != kPlaceHolderType)) {
+      continue;
+    }
+    auto name_iter = cut_edge_names.find(node->GetName());
+    auto node_iter = (name_iter == cut_edge_names.end()) ? cut_edge_to_node.end()
+                                                         : cut_edge_to_node.find(name_iter->second);
+    if ((node_iter == cut_edge_to_node.end()) || (node_iter->second->GetType() != node->GetType())) {
+      GELOGW("Cut edge of %s in %s does not match the partition.", node->GetName().c_str(),
+             optimized_graph->GetName().c_str());
+      return FAILED;
+    }
+    replaced_nodes[node_iter->second] = node;
+  }
+  if (replaced_nodes.size() != cut_edge_to_node.size()) {
+    GELOGW("Cut edges of %s do not match the partition.", optimized_graph->GetName().c_str());
+    return FAILED;
+  }
+  // function nodes are looked up when their subgraphs are merged
+  for (const auto &node_pair : graph_info.corresponding_node_in_partitions_) {
+    const NodePtr &node = node_pair.second;
+    if ((node == nullptr) || (node->GetOwnerComputeGraph() != sub_graph) ||
+        node->GetOpDesc()->GetSubgraphInstanceNames().empty()) {
+      continue;
+    }
+    auto node_iter = optimized_nodes.find(node->GetName());
+    if (node_iter == optimized_nodes.end()) {
+      GELOGW("Function node %s not found in %s.", node->GetName().c_str(), optimized_graph->GetName().c_str());
+      return FAILED;
+    }
+    replaced_nodes[node] = node_iter->second;
+  }
+
+  // placeholder and end nodes of the copy take the identity of the current ones
+  for (const auto &node_pair : replaced_nodes) {
+    const OpDescPtr &op_desc = node_pair.first->GetOpDesc();
+    const OpDescPtr &new_op_desc = node_pair.second->GetOpDesc();
+    if ((op_desc->GetType() != kEndType) && (op_desc->GetType() != kPlaceHolderType)) {
+      continue;
+    }
+    new_op_desc->SetName(op_desc->GetName());
+    for (const auto &attr_name : {kPeerIndex, kPeerNodeName, kParentId}) {
+      GeAttrValue attr_value;
+      if (op_desc->GetAttr(attr_name, attr_value) == GRAPH_SUCCESS) {
+        (void)new_op_desc->SetAttr(attr_name, attr_value);
+      }
+    }
+    (void)new_op_desc->SetExtAttr(kParentNode, op_desc->TryGetExtAttr(kParentNode, NodePtr()));
+  }
+  auto replace_node = [&replaced_nodes](const NodePtr &node) {
+    auto iter = replaced_nodes.find(node);
+    return (iter == replaced_nodes.end()) ? node : iter->second;
+  };
+  NodetoNodeMap end_2_pld;
+  for (const auto &node_pair : graph_info.end_2_pld_) {
+    end_2_pld[replace_node(node_pair.first)] = replace_node(node_pair.second);
+  }
+  graph_info.end_2_pld_.swap(end_2_pld);
+  NodetoNodeMap pld_2_end;
+  for (const auto &node_pair : graph_info.pld_2_end_) {
+    pld_2_end[replace_node(node_pair.first)] = replace_node(node_pair.second);
+  }
+  graph_info.pld_2_end_.swap(pld_2_end);
+  for (auto &index_and_end : graph_info.index_2_end_) {
+    index_and_end.second = replace_node(index_and_end.second);
+  }
+  for (auto &node_pair : graph_info.corresponding_node_in_partitions_) {
+    node_pair.second = replace_node(node_pair.second);
+  }
+
+  optimized_graph->SetName(sub_graph->GetName());
+  std::string session_graph_id;
+  if (AttrUtils::GetStr(*sub_graph, ATTR_NAME_SESSION_GRAPH_ID, session_graph_id)) {
+    (void)AttrUtils::SetStr(*optimized_graph, ATTR_NAME_SESSION_GRAPH_ID, session_graph_id);
+  }
+  auto partition_iter = graph_info.partitions_.find(sub_graph);
+  if (partition_iter != graph_info.partitions_.end()) {
+    graph_info.partitions_[optimized_graph] = partition_iter->second;
+    graph_info.partitions_.erase(sub_graph);
+  }
+  auto rank_iter = graph_info.partitions_2_rank_.find(sub_graph);
+  if (rank_iter != graph_info.partitions_2_rank_.end()) {
+    size_t rank = rank_iter->second;
+    graph_info.partitions_2_rank_.erase(rank_iter);
+    graph_info.partitions_2_rank_[optimized_graph] = rank;
+  }
+  for (auto &partition : graph_info.rank_2_partitions_) {
+    if (partition == sub_graph) {
+      partition = optimized_graph;
+    }
+  }
+  for (auto &cluster_and_partition : graph_info.cluster_2_partition_) {
+    if (cluster_and_partition.second == sub_graph) {
+      cluster_and_partition.second = optimized_graph;
+    }
+  }
+  sub_graph_info->SetSubGraph(optimized_graph);
+
+  // the peers of the replaced nodes are in the other partitions of the graph
+  graph_info_ = graph_info;
+  for (auto &graph_sub_graph_info : graph_2_subgraph_list_[original_compute_graph]) {
+    AddEndPldInformationToSubGraphInfo(graph_sub_graph_info);
+  }
+  GELOGI("Partition %s is replaced by an optimized copy with %zu nodes.", sub_graph->GetName().c_str(),
+         optimized_graph->GetDirectNodesSize());
+  return SUCCESS;
+}
 }  // namespace ge
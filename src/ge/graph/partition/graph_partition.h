@@ -70,6 +70,20 @@ class GraphPartitioner {
   // Return all subgraphs
   const Graph2SubGraphInfoList &GetSubGraphMap();
 
+  /// Fingerprint of a partition before optimizing, the canonical text of its nodes and edges with a digest of its
+  /// weights. It does not depend on the order of partitions: placeholder and end nodes are named by the edge of the
+  /// original graph they cut, cut_edge_names gives that name by node name. build_context is what else the optimizing
+  /// depends on, such as the engine options.
+  Status GetPartitionFingerprint(const ComputeGraphPtr &original_compute_graph, const SubGraphInfoPtr &sub_graph_info,
+                                 const std::string &build_context, std::string &fingerprint,
+                                 std::map<std::string, std::string> &cut_edge_names);
+
+  /// Replace the partition of sub_graph_info with an optimized copy of a partition of the same fingerprint, whose
+  /// placeholder and end nodes take the place of the current ones when merging. Nothing changes on failure.
+  Status ReplacePartition(const ComputeGraphPtr &original_compute_graph, const SubGraphInfoPtr &sub_graph_info,
+                          const ComputeGraphPtr &optimized_graph,
+                          const std::map<std::string, std::string> &cut_edge_names);
+
  private:
   Status MergeSubGraph(ge::ComputeGraphPtr &output_merged_compute_graph,
                        const ge::ComputeGraphPtr &original_compute_graph);
@@ -171,6 +185,7 @@ class GraphPartitioner {
     GraphPartitionInfo() : num_of_pld_end_(0), input_size_(0), output_size_(0), mode_(kPartitioning) {}
     ~GraphPartitionInfo() = default;
   };
+  Status GetCutEdgeName(const GraphPartitionInfo &graph_info, const NodePtr &node, std::string &cut_edge_name) const;
   std::unordered_map<ComputeGraphPtr, GraphPartitionInfo> graph_2_graph_partition_info_;
   Graph2SubGraphInfoList graph_2_subgraph_list_;
   Graph2InputNodesSubGraphInfo graph_2_input_subgraph_;
@@ -0,0 +1,134 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "graph/partition/optimized_partition_cache.h"
+
+#include <cstring>
+#include <vector>
+
+#include "framework/common/debug/ge_log.h"
+#include "framework/common/debug/log.h"
+#include "graph/debug/ge_attr_define.h"
+#include "graph/utils/graph_utils.h"
+#include "graph/utils/op_desc_utils.h"
+
+namespace ge {
+ComputeGraphPtr OptimizedPartitionCache::CopyGraph(const ComputeGraphPtr &graph) {
+  std::vector<NodePtr> input_nodes;
+  std::vector<NodePtr> output_nodes;
+  ComputeGraphPtr new_graph = GraphUtils::CloneGraph(graph, "", input_nodes, output_nodes);
+  if (new_graph != nullptr) {
+    new_graph->SetGraphUnknownFlag(graph->GetGraphUnknownFlag());
+  }
+  return new_graph;
+}
+
+bool OptimizedPartitionCache::IsSameWeights(const ComputeGraphPtr &partition, const ComputeGraphPtr &cached_graph) {
+  if (partition == nullptr) {
+    return false;
+  }
+  std::unordered_map<std::string, NodePtr> cached_nodes;
+  for (const auto &node : partition->GetDirectNode()) {
+    if (!node->GetOpDesc()->HasAttr(ATTR_NAME_WEIGHTS)) {
+      continue;
+    }
+    if (cached_nodes.empty()) {
+      for (const auto &cached_node : cached_graph->GetDirectNode()) {
+        cached_nodes[cached_node->GetName()] = cached_node;
+      }
+    }
+    // a const node folded or fused by the optimizing leaves only the digest in the fingerprint to match
+    auto iter = cached_nodes.find(node->GetName());
+    if (iter == cached_nodes.end()) {
+      continue;
+    }
+    auto weights = OpDescUtils::GetWeights(node);
+    auto cached_weights = OpDescUtils::GetWeights(iter->second);
+    if (weights.size() != cached_weights.size()) {
+      return false;
+    }
+    for (size_t i = 0; i < weights.size(); ++i) {
+      const Buffer &data = weights[i]->GetData();
+      const Buffer &cached_data = cached_weights[i]->GetData();
+      if ((data.size() != cached_data.size()) ||
+          ((data.size() > 0) && (memcmp(data.data(), cached_data.data(), data.size()) != 0))) {
+        GELOGD("Weights of node %s differ from the cached partition.", node->GetName().c_str());
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool OptimizedPartitionCache::Find(const std::string &fingerprint, const ComputeGraphPtr &partition,
+                                   ComputeGraphPtr &graph, std::map<std::string, std::string> &cut_edge_names) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = partitions_.find(fingerprint);
+  if (iter == partitions_.end()) {
+    return false;
+  }
+  // weights rewritten by the optimizing miss as well, the partition is optimized again
+  if (!IsSameWeights(partition, iter->second.graph)) {
+    return false;
+  }
+  graph = CopyGraph(iter->second.graph);
+  if (graph == nullptr) {
+    GELOGW("Copy cached partition %s failed.", iter->second.graph->GetName().c_str());
+    return false;
+  }
+  cut_edge_names = iter->second.cut_edge_names;
+  iter->second.last_used = ++use_count_;
+  return true;
+}
+
+Status OptimizedPartitionCache::Save(const std::string &fingerprint, const ComputeGraphPtr &graph,
+                                     const std::map<std::string, std::string> &cut_edge_names) {
+  GE_CHECK_NOTNULL(graph);
+  // the partition is merged into the model after it is saved, so keep a copy
+  ComputeGraphPtr graph_copy = CopyGraph(graph);
+  if (graph_copy == nullptr) {
+    GELOGE(INTERNAL_ERROR, "Copy partition %s failed.", graph->GetName().c_str());
+    return INTERNAL_ERROR;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  CachedPartition &partition = partitions_[fingerprint];
+  partition.graph = graph_copy;
+  partition.cut_edge_names = cut_edge_names;
+  partition.last_used = ++use_count_;
+  while (partitions_.size() > capacity_) {
+    auto lru_iter = partitions_.begin();
+    for (auto iter = partitions_.begin(); iter != partitions_.end(); ++iter) {
+      if (iter->second.last_used < lru_iter->second.last_used) {
+        lru_iter = iter;
+      }
+    }
+    GELOGD("Drop cached partition %s.", lru_iter->second.graph->GetName().c_str());
+    partitions_.erase(lru_iter);
+  }
+  return SUCCESS;
+}
+
+void OptimizedPartitionCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  partitions_.clear();
+}
+
+size_t OptimizedPartitionCache::Size() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return partitions_.size();
+}
+}  // namespace ge
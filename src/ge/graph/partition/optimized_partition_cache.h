@@ -0,0 +1,92 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GE_GRAPH_PARTITION_OPTIMIZED_PARTITION_CACHE_H_
+#define GE_GRAPH_PARTITION_OPTIMIZED_PARTITION_CACHE_H_
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "common/ge_inner_error_codes.h"
+#include "graph/compute_graph.h"
+
+namespace ge {
+///
+/// @ingroup graph/partition
+/// @brief Partitions optimized by their engines, keyed by the fingerprint of the partition before optimizing.
+///        A partition of a rebuilt graph with the same fingerprint takes a copy of the optimized one instead of
+///        being optimized and compiled again. The least recently used partitions are dropped beyond the capacity.
+///        The fingerprint is the canonical text of the partition with a digest of its weights, so the cache keeps
+///        no second copy of the weights. A hit compares the fingerprint whole and confirms the weights of the
+///        partition against the ones the cached partition still holds.
+///
+class OptimizedPartitionCache {
+ public:
+  explicit OptimizedPartitionCache(size_t capacity) : capacity_(capacity) {}
+  ~OptimizedPartitionCache() = default;
+
+  OptimizedPartitionCache(const OptimizedPartitionCache &) = delete;
+  OptimizedPartitionCache &operator=(const OptimizedPartitionCache &) = delete;
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief get a copy of the optimized partition
+  /// @param [in] fingerprint: fingerprint of the partition before optimizing
+  /// @param [in] partition: the partition before optimizing, whose weights confirm the hit
+  /// @param [out] graph: copy of the optimized partition
+  /// @param [out] cut_edge_names: cut edge name of each placeholder and end node in graph, by node name
+  /// @return true if found
+  ///
+  bool Find(const std::string &fingerprint, const ComputeGraphPtr &partition, ComputeGraphPtr &graph,
+            std::map<std::string, std::string> &cut_edge_names);
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief save a copy of the optimized partition
+  /// @param [in] fingerprint: fingerprint of the partition before optimizing
+  /// @param [in] graph: optimized partition
+  /// @param [in] cut_edge_names: cut edge name of each placeholder and end node in graph, by node name
+  /// @return SUCCESS: success
+  ///         other: failed
+  ///
+  Status Save(const std::string &fingerprint, const ComputeGraphPtr &graph,
+              const std::map<std::string, std::string> &cut_edge_names);
+
+  void Clear();
+
+  size_t Size();
+
+ private:
+  struct CachedPartition {
+    ComputeGraphPtr graph;
+    std::map<std::string, std::string> cut_edge_names;
+    uint64_t last_used = 0;
+  };
+
+  static ComputeGraphPtr CopyGraph(const ComputeGraphPtr &graph);
+
+  static bool IsSameWeights(const ComputeGraphPtr &partition, const ComputeGraphPtr &cached_graph);
+
+  const size_t capacity_;
+  uint64_t use_count_ = 0;
+  std::mutex mutex_;
+  std::unordered_map<std::string, CachedPartition> partitions_;
+};
+}  // namespace ge
+
+#endif  // GE_GRAPH_PARTITION_OPTIMIZED_PARTITION_CACHE_H_
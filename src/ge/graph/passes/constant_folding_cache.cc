@@ -0,0 +1,116 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "graph/passes/constant_folding_cache.h"
+
+#include "common/ge/ge_util.h"
+#include "framework/common/debug/ge_log.h"
+#include "graph/common/op_signature.h"
+
+namespace ge {
+namespace {
+const size_t kMaxSessionCacheSize = 256 * 1024 * 1024;
+}  // namespace
+
+ConstantFoldingCache &ConstantFoldingCache::Instance() {
+  static ConstantFoldingCache instance;
+  return instance;
+}
+
+bool ConstantFoldingCache::GenerateKey(const OpDescPtr &op_desc, const std::vector<ConstGeTensorPtr> &inputs,
+                                       std::string &key) {
+  if (!OpSignature::Generate(op_desc, key)) {
+    GELOGD("Node %s can not be keyed, skip the folding cache.", op_desc == nullptr ? "" : op_desc->GetName().c_str());
+    return false;
+  }
+
+  OpSignature::AppendValue(key, inputs.size());
+  for (const auto &input : inputs) {
+    if (input == nullptr) {
+      return false;
+    }
+    OpSignature::AppendTensor(key, *input);
+  }
+  return true;
+}
+
+bool ConstantFoldingCache::Find(uint64_t session_id, const std::string &key, std::vector<GeTensorPtr> &outputs) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto session_iter = session_caches_.find(session_id);
+  if (session_iter == session_caches_.end()) {
+    return false;
+  }
+  auto &session_cache = session_iter->second;
+  auto iter = session_cache.entries.find(key);
+  if (iter == session_cache.entries.end()) {
+    return false;
+  }
+
+  // the outputs become weights of new const nodes, which may be modified later, hand out copies
+  std::vector<GeTensorPtr> cloned_outputs;
+  for (const auto &output : iter->second.outputs) {
+    GeTensorPtr cloned_output = MakeShared<GeTensor>(output.Clone());
+    if (cloned_output == nullptr) {
+      GELOGW("Failed to copy the output of folding cache entry.");
+      return false;
+    }
+    cloned_outputs.emplace_back(cloned_output);
+  }
+  session_cache.lru.splice(session_cache.lru.begin(), session_cache.lru, iter->second.lru_iter);
+  outputs.swap(cloned_outputs);
+  return true;
+}
+
+void ConstantFoldingCache::Add(uint64_t session_id, const std::string &key, const std::vector<GeTensorPtr> &outputs) {
+  size_t size = key.size();
+  for (const auto &output : outputs) {
+    if (output == nullptr) {
+      return;
+    }
+    size += output->GetData().size();
+  }
+  if (size > kMaxSessionCacheSize) {
+    GELOGD("Folding result size %zu exceeds the cache size, skip caching it.", size);
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto &session_cache = session_caches_[session_id];
+  if (session_cache.entries.count(key) > 0) {
+    return;
+  }
+  session_cache.lru.push_front(key);
+  auto &entry = session_cache.entries[key];
+  for (const auto &output : outputs) {
+    entry.outputs.emplace_back(output->Clone());
+  }
+  entry.size = size;
+  entry.lru_iter = session_cache.lru.begin();
+  session_cache.total_size += size;
+
+  while (session_cache.total_size > kMaxSessionCacheSize && !session_cache.lru.empty()) {
+    auto evict_iter = session_cache.entries.find(session_cache.lru.back());
+    session_cache.total_size -= evict_iter->second.size;
+    session_cache.entries.erase(evict_iter);
+    session_cache.lru.pop_back();
+  }
+}
+
+void ConstantFoldingCache::RemoveSession(uint64_t session_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  (void)session_caches_.erase(session_id);
+}
+}  // namespace ge
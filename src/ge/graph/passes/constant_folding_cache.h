@@ -0,0 +1,98 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GE_GRAPH_PASSES_CONSTANT_FOLDING_CACHE_H_
+#define GE_GRAPH_PASSES_CONSTANT_FOLDING_CACHE_H_
+
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "graph/ge_attr_value.h"
+#include "graph/ge_tensor.h"
+#include "graph/op_desc.h"
+
+namespace ge {
+///
+/// @ingroup ge_graph
+/// @brief Session scoped cache of constant folding results. An entry is keyed by the content of the folded node:
+///        op type, op attrs, tensor descs and a digest of every input tensor, so identical constant expressions in
+///        multi-batch clones, loop bodies or a re-prepared graph are computed only once per session. The inputs are
+///        not kept, the size and the 128 bits digest of every input in the key confirm a hit.
+///
+class ConstantFoldingCache {
+ public:
+  static ConstantFoldingCache &Instance();
+
+  ConstantFoldingCache(const ConstantFoldingCache &) = delete;
+  ConstantFoldingCache &operator=(const ConstantFoldingCache &) = delete;
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief generate the content key of a node computed with inputs
+  /// @param [in] op_desc op desc of the node to fold
+  /// @param [in] inputs input tensors of the node
+  /// @param [out] key content key
+  /// @return false if the node carries attrs which can not be keyed, and should not be cached
+  ///
+  static bool GenerateKey(const OpDescPtr &op_desc, const std::vector<ConstGeTensorPtr> &inputs, std::string &key);
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief find the folding result of key in session
+  /// @param [out] outputs copies of the cached outputs, owned by the caller
+  /// @return true if found
+  ///
+  bool Find(uint64_t session_id, const std::string &key, std::vector<GeTensorPtr> &outputs);
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief add the folding result of key to session, the least recently used entries are evicted when the
+  ///        session exceeds its memory budget. Copies of the outputs are kept.
+  ///
+  void Add(uint64_t session_id, const std::string &key, const std::vector<GeTensorPtr> &outputs);
+
+  ///
+  /// @ingroup ge_graph
+  /// @brief release all folding results of session
+  ///
+  void RemoveSession(uint64_t session_id);
+
+ private:
+  struct CacheEntry {
+    std::vector<GeTensor> outputs;
+    size_t size = 0;
+    std::list<std::string>::iterator lru_iter;
+  };
+
+  struct SessionCache {
+    std::unordered_map<std::string, CacheEntry> entries;
+    std::list<std::string> lru;  // most recently used at front
+    size_t total_size = 0;
+  };
+
+  ConstantFoldingCache() = default;
+  ~ConstantFoldingCache() = default;
+
+  std::mutex mutex_;
+  std::map<uint64_t, SessionCache> session_caches_;
+};
+}  // namespace ge
+
+#endif  // GE_GRAPH_PASSES_CONSTANT_FOLDING_CACHE_H_
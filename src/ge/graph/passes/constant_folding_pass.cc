@@ -16,12 +16,16 @@
 
 #include "graph/passes/constant_folding_pass.h"
 
+#include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "common/debug/log.h"
 #include "common/types.h"
 #include "framework/common/debug/ge_log.h"
+#include "graph/ge_context.h"
 #include "graph/operator_factory.h"
+#include "graph/passes/constant_folding_cache.h"
 #include "graph/utils/attr_utils.h"
 #include "graph/utils/node_utils.h"
 #include "graph/utils/op_desc_utils.h"
@@ -62,6 +66,47 @@ Status ConstantFoldingPass::Run(ge::NodePtr &node) {
 
   auto inputs = OpDescUtils::GetInputData(input_nodes);
   vector<GeTensorPtr> outputs;
+  auto ret = ComputeNode(node, inputs, outputs);
+  if (ret == NOT_CHANGED) {
+    return SUCCESS;
+  }
+  if (ret != SUCCESS) {
+    return ret;
+  }
+
+  // Evaluate the whole constant region downstream in memory, instead of materializing a const node for every
+  // intermediate result and waiting for the re-pass to reach the consumers
+  std::vector<NodePtr> region = {node};
+  std::map<NodePtr, std::vector<GeTensorPtr>> nodes_to_outputs = {{node, outputs}};
+  ExpandConstantRegion(region, nodes_to_outputs);
+  if (region.size() > 1) {
+    GELOGI("Node %s type %s, fold %zu nodes as a constant region.", node->GetName().c_str(), node->GetType().c_str(),
+           region.size());
+  }
+  return Folding(region, nodes_to_outputs);
+}
+
+Status ConstantFoldingPass::ComputeNode(NodePtr &node, const std::vector<ConstGeTensorPtr> &inputs,
+                                        std::vector<GeTensorPtr> &outputs) {
+  uint64_t session_id = GetContext().SessionId();
+  std::string key;
+  bool cacheable = ConstantFoldingCache::GenerateKey(node->GetOpDesc(), inputs, key);
+  if (cacheable && ConstantFoldingCache::Instance().Find(session_id, key, outputs)) {
+    GELOGD("Node %s type %s, reuse the result in constant folding cache.", node->GetName().c_str(),
+           node->GetType().c_str());
+    return SUCCESS;
+  }
+
+  auto ret = RunKernel(node, inputs, outputs);
+  if (ret == SUCCESS && cacheable) {
+    ConstantFoldingCache::Instance().Add(session_id, key, outputs);
+  }
+  return ret;
+}
+
+Status ConstantFoldingPass::RunKernel(NodePtr &node, const std::vector<ConstGeTensorPtr> &inputs,
+                                      std::vector<GeTensorPtr> &outputs) {
+  OpDescPtr node_desc = node->GetOpDesc();
   // Statistic of ge constant folding kernel
   uint64_t start_time = GetCurrentTimestap();
   auto ret = RunOpKernel(node, inputs, outputs);
@@ -70,7 +115,7 @@ Status ConstantFoldingPass::Run(ge::NodePtr &node) {
     if (op_kernel == nullptr) {
       GELOGD("No op kernel for node %s type %s, skip the constant folding", node->GetName().c_str(),
              node->GetType().c_str());
-      return SUCCESS;
+      return NOT_CHANGED;
     }
 
     // Statistic of op and fe constant folding kernel
@@ -89,7 +134,7 @@ Status ConstantFoldingPass::Run(ge::NodePtr &node) {
       if (ret == NOT_CHANGED) {
         GELOGD("Node %s type %s, compute terminates and exits the constant folding.", node->GetName().c_str(),
                node->GetType().c_str());
-        return SUCCESS;
+        return NOT_CHANGED;
       }
       GELOGE(INTERNAL_ERROR, "Calculate for node %s failed in constant folding", node->GetName().c_str());
       return ret;
@@ -114,7 +159,75 @@ Status ConstantFoldingPass::Run(ge::NodePtr &node) {
            node->GetName().c_str());
     return INTERNAL_ERROR;
   }
+  return SUCCESS;
+}
+
+bool ConstantFoldingPass::GetRegionInputs(const NodePtr &node,
+                                          const std::map<NodePtr, std::vector<GeTensorPtr>> &nodes_to_outputs,
+                                          std::vector<ConstGeTensorPtr> &inputs) {
+  auto node_desc = node->GetOpDesc();
+  if (node_desc == nullptr) {
+    return false;
+  }
+  for (const auto &in_anchor : node->GetAllInDataAnchors()) {
+    auto peer_out_anchor = in_anchor->GetPeerOutAnchor();
+    if (peer_out_anchor == nullptr) {
+      continue;
+    }
+    auto in_node = peer_out_anchor->GetOwnerNode();
+    if (in_node == nullptr) {
+      return false;
+    }
+    auto iter = nodes_to_outputs.find(in_node);
+    if (iter != nodes_to_outputs.end()) {
+      auto index = static_cast<size_t>(peer_out_anchor->GetIdx());
+      if (index >= iter->second.size() || iter->second[index] == nullptr) {
+        return false;
+      }
+      inputs.emplace_back(iter->second[index]);
+    } else if ((in_node->GetType() == CONSTANT) || (in_node->GetType() == CONSTANTOP)) {
+      auto weights = OpDescUtils::MutableWeights(in_node);
+      if (weights.empty() || weights[0] == nullptr) {
+        return false;
+      }
+      inputs.emplace_back(weights[0]);
+    } else {
+      return false;
+    }
+  }
+  return !inputs.empty() && inputs.size() == node_desc->GetInputsSize();
+}
 
-  return Folding(node, outputs);
+void ConstantFoldingPass::ExpandConstantRegion(std::vector<NodePtr> &region,
+                                               std::map<NodePtr, std::vector<GeTensorPtr>> &nodes_to_outputs) {
+  std::unordered_set<NodePtr> rejected_nodes;
+  // The region grows while walking it, so nodes are appended in topological order
+  for (size_t i = 0; i < region.size(); ++i) {
+    for (auto &out_node : region[i]->GetOutDataNodes()) {
+      if ((nodes_to_outputs.count(out_node) > 0) || (rejected_nodes.count(out_node) > 0)) {
+        continue;
+      }
+      if (folding_pass::IsNoNeedConstantFolding(out_node) ||
+          !out_node->GetOpDesc()->GetSubgraphInstanceNames().empty()) {
+        rejected_nodes.insert(out_node);
+        continue;
+      }
+      std::vector<ConstGeTensorPtr> inputs;
+      if (!GetRegionInputs(out_node, nodes_to_outputs, inputs)) {
+        // Other inputs may come from nodes joining the region later, it will be checked again then
+        continue;
+      }
+      std::vector<GeTensorPtr> outputs;
+      if (ComputeNode(out_node, inputs, outputs) != SUCCESS) {
+        // Left to the node by node folding, which reports the failure if there is any
+        rejected_nodes.insert(out_node);
+        continue;
+      }
+      GELOGD("Node %s type %s joins the constant region of node %s.", out_node->GetName().c_str(),
+             out_node->GetType().c_str(), region[0]->GetName().c_str());
+      region.emplace_back(out_node);
+      nodes_to_outputs[out_node] = std::move(outputs);
+    }
+  }
 }
 }  // namespace ge
@@ -18,6 +18,7 @@
 #define GE_GRAPH_PASSES_CONSTANT_FOLDING_PASS_H_
 
 #include <map>
+#include <string>
 #include <vector>
 
 #include "graph/passes/folding_pass.h"
@@ -30,6 +31,12 @@ class ConstantFoldingPass : public FoldingPass {
   const std::unordered_map<std::string, std::pair<std::uint64_t, uint64_t>> &GetOpConstantFoldingPerfStatistic() const;
 
  private:
+  Status ComputeNode(NodePtr &node, const std::vector<ConstGeTensorPtr> &inputs, std::vector<GeTensorPtr> &outputs);
+  Status RunKernel(NodePtr &node, const std::vector<ConstGeTensorPtr> &inputs, std::vector<GeTensorPtr> &outputs);
+  bool GetRegionInputs(const NodePtr &node, const std::map<NodePtr, std::vector<GeTensorPtr>> &nodes_to_outputs,
+                       std::vector<ConstGeTensorPtr> &inputs);
+  void ExpandConstantRegion(std::vector<NodePtr> &region, std::map<NodePtr, std::vector<GeTensorPtr>> &nodes_to_outputs);
+
   std::unordered_map<std::string, std::pair<std::uint64_t, uint64_t>> statistic_of_op_constant_folding_;
   std::unordered_map<std::string, std::pair<std::uint64_t, uint64_t>> statistic_of_ge_constant_folding_;
 };
@@ -16,6 +16,7 @@
 
 #include "graph/passes/folding_pass.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -139,7 +140,65 @@ Status FoldingPass::Folding(NodePtr &node, vector<GeTensorPtr> &outputs) {
            node->GetType().c_str());
     return INTERNAL_ERROR;
   }
-  for (auto iter = in_data_nodes_set.begin(); iter != in_data_nodes_set.end(); ++iter) {
+  return RemoveUselessInDataNodes(in_data_nodes_set);
+}
+
+Status FoldingPass::Folding(std::vector<NodePtr> &nodes,
+                            std::map<NodePtr, std::vector<GeTensorPtr>> &nodes_to_outputs) {
+  if (nodes.size() == 1) {
+    return Folding(nodes[0], nodes_to_outputs[nodes[0]]);
+  }
+  std::unordered_set<NodePtr> region(nodes.begin(), nodes.end());
+  for (auto &node : nodes) {
+    GE_CHECK_NOTNULL(node);
+    GELOGD("begin folding node:%s in constant region", node->GetName().c_str());
+    // Edges inside the region disappear together with the region, only the consumers outside need consts
+    auto indexes_to_anchors = GetIndexAndPeerInDataAnchors(node);
+    for (auto iter = indexes_to_anchors.begin(); iter != indexes_to_anchors.end();) {
+      auto &anchors = iter->second;
+      anchors.erase(std::remove_if(anchors.begin(), anchors.end(),
+                                   [&region](const InDataAnchorPtr &anchor) {
+                                     return region.count(anchor->GetOwnerNode()) > 0;
+                                   }),
+                    anchors.end());
+      if (anchors.empty()) {
+        iter = indexes_to_anchors.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+
+    auto ret = DealWithInNodes(node);
+    if (ret != SUCCESS) {
+      return ret;
+    }
+    if (AddConstNode(node, indexes_to_anchors, nodes_to_outputs[node]) != SUCCESS) {
+      return INTERNAL_ERROR;
+    }
+  }
+
+  std::unordered_set<NodePtr> in_data_nodes_set;
+  for (auto &node : nodes) {
+    for (auto &in_data_node : node->GetInDataNodes()) {
+      if (region.count(in_data_node) == 0) {
+        in_data_nodes_set.insert(in_data_node);
+      }
+    }
+  }
+  // Delete from the sinks of the region, so that the control dependencies are relinked transitively onto the consts
+  for (auto iter = nodes.rbegin(); iter != nodes.rend(); ++iter) {
+    auto node = *iter;
+    if (IsolateAndDeleteNode(node, {}) != SUCCESS) {
+      GELOGE(INTERNAL_ERROR, "Failed to isolate and delete node %s, type %s.", node->GetName().c_str(),
+             node->GetType().c_str());
+      return INTERNAL_ERROR;
+    }
+  }
+  return RemoveUselessInDataNodes(in_data_nodes_set);
+}
+
+Status FoldingPass::RemoveUselessInDataNodes(const std::unordered_set<NodePtr> &in_data_nodes) {
+  for (auto iter = in_data_nodes.begin(); iter != in_data_nodes.end(); ++iter) {
     auto pre_node = *iter;
     if (pre_node->GetOutDataNodesSize() == 0) {
       if ((pre_node->GetType() == DATA) || (pre_node->GetType() == ENTER)) {
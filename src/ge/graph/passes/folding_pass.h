@@ -19,6 +19,7 @@
 
 #include <map>
 #include <memory>
+#include <unordered_set>
 #include <vector>
 
 #include "graph/passes/base_pass.h"
@@ -38,11 +39,19 @@ class FoldingPass : public BaseNodePass {
 
  protected:
   Status Folding(NodePtr &node, vector<GeTensorPtr> &outputs);
+  ///
+  /// Fold a connected constant region in one step. Only the outputs consumed outside of the region are
+  /// materialized as const nodes, then all the nodes of the region are removed.
+  /// @param nodes nodes of the region in topological order
+  /// @param nodes_to_outputs computed outputs of every node in the region
+  ///
+  Status Folding(std::vector<NodePtr> &nodes, std::map<NodePtr, std::vector<GeTensorPtr>> &nodes_to_outputs);
 
  private:
   Status AddConstNode(NodePtr &node, IndexsToAnchors indexes_to_anchors, std::vector<GeTensorPtr> &v_weight);
   Status DealWithInNodes(NodePtr &node);
   Status RemoveNodeKeepingCtrlEdges(NodePtr &node);
+  Status RemoveUselessInDataNodes(const std::unordered_set<NodePtr> &in_data_nodes);
   Status ConnectNodeToInAnchor(InDataAnchorPtr &in_anchor, NodePtr &node, int node_index);
 };
 }  // namespace ge
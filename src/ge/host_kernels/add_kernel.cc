@@ -92,14 +92,10 @@ Status AddKernel::BCastAdd(const OpDescPtr &op_desc_ptr, const std::vector<Const
     return ret;
   }
 
-  std::vector<int64_t> x_indexes;
-  std::vector<int64_t> y_indexes;
-  bcast.BCastIndexes(x_indexes, y_indexes);
-
   auto x1_data = reinterpret_cast<const InT *>(input[kAddFirstInput]->GetData().data());
   auto x2_data = reinterpret_cast<const InT *>(input[kAddSecondInput]->GetData().data());
 
-  size_t data_num = x_indexes.size();
+  size_t data_num = static_cast<size_t>(bcast.GetOutputElementNum());
   std::unique_ptr<InT[]> buf(new (std::nothrow) InT[data_num]());
   if (buf == nullptr) {
     GELOGE(MEMALLOC_FAILED, "New sizeof(T) * data_num(%zu) memory failed", static_cast<size_t>(sizeof(InT) * data_num));
@@ -107,14 +103,16 @@ Status AddKernel::BCastAdd(const OpDescPtr &op_desc_ptr, const std::vector<Const
   }
 
   DataType data_type = input[kAddFirstInput]->GetTensorDesc().GetDataType();
-  for (size_t i = 0; i < data_num; i++) {
-    auto x_index = *(x1_data + x_indexes[i]);
-    auto y_index = *(x2_data + y_indexes[i]);
-    if (OverflowCheck<InT>(x_index, y_index, data_type) != SUCCESS) {
-      GELOGE(PARAM_INVALID, "Result of add is overflow.");
+  ret = bcast.BCastElementwise(x1_data, x2_data, buf.get(), [this, data_type](InT x, InT y, InT &out) -> Status {
+    if (OverflowCheck<InT>(x, y, data_type) != SUCCESS) {
       return PARAM_INVALID;
     }
-    *(buf.get() + i) = x_index + y_index;
+    out = x + y;
+    return SUCCESS;
+  });
+  if (ret != SUCCESS) {
+    GELOGE(PARAM_INVALID, "Result of add is overflow.");
+    return PARAM_INVALID;
   }
 
   GeTensorPtr output_ptr = MakeShared<GeTensor>(op_desc_ptr->GetOutputDesc(kAddFirstOutput));
@@ -16,13 +16,16 @@
 
 #include "host_kernels/concat_v2_kernel.h"
 
+#include <algorithm>
 #include <memory>
 #include <set>
+#include <utility>
 
 #include "common/debug/log.h"
 #include "common/fp16_t.h"
 #include "common/ge_inner_error_codes.h"
 #include "common/op/ge_op_utils.h"
+#include "common/thread_pool.h"
 #include "framework/common/debug/ge_log.h"
 #include "host_kernels/kernel_utils.h"
 #include "graph/utils/type_utils.h"
@@ -33,25 +36,44 @@ namespace {
 const size_t kConcatV2InputNum = 3;
 const int kSupportEmptyTensorRank = 1;
 const std::set<DataType> concatv2_supported_type = {DT_INT32, DT_FLOAT};
+const int64_t kConcatV2ParallelMinBlock = 65536;
 
 template <typename T>
 void GetOutputData(std::vector<T> &y_data, int64_t loop, size_t &input_size,
                    const std::vector<ConstGeTensorPtr> &input) {
-  for (int64_t i = 0; i < loop; i++) {
-    for (size_t k = 0; k < input_size; k++) {
-      GeShape datak_shape = input.at(k)->GetTensorDesc().GetShape();
-      auto buffer = input.at(k)->GetData();
-      const T *datak = reinterpret_cast<const T *>(buffer.data());
-      if (datak == nullptr || buffer.size() == 0) {
-        GELOGW("input[%zu] is with no data", k);
-        continue;
-      }
-      int64_t gapk = datak_shape.GetShapeSize() / loop;  // [2,3] is 6/loop
-      for (int64_t j = 0; j < gapk; j++) {
-        y_data.push_back(datak[j + gapk * i]);
-      }
+  // Resolve every input block once, then each of the `loop` output rows is the concatenation of one
+  // contiguous gap from every input, so rows can be filled independently.
+  if (loop <= 0) {
+    return;
+  }
+  std::vector<std::pair<const T *, int64_t>> blocks;
+  int64_t row_size = 0;
+  for (size_t k = 0; k < input_size; k++) {
+    GeShape datak_shape = input.at(k)->GetTensorDesc().GetShape();
+    auto buffer = input.at(k)->GetData();
+    const T *datak = reinterpret_cast<const T *>(buffer.data());
+    if (datak == nullptr || buffer.size() == 0) {
+      GELOGW("input[%zu] is with no data", k);
+      continue;
     }
+    int64_t gapk = datak_shape.GetShapeSize() / loop;  // [2,3] is 6/loop
+    blocks.emplace_back(datak, gapk);
+    row_size += gapk;
   }
+
+  y_data.resize(static_cast<size_t>(loop * row_size));
+  T *y = y_data.data();
+  int64_t min_rows = std::max(kConcatV2ParallelMinBlock / std::max(row_size, static_cast<int64_t>(1)),
+                              static_cast<int64_t>(1));
+  (void)ThreadPool::ParallelFor(loop, min_rows, [&blocks, y, row_size](int64_t begin, int64_t end) -> Status {
+    for (int64_t i = begin; i < end; i++) {
+      T *dst = y + i * row_size;
+      for (const auto &block : blocks) {
+        dst = std::copy_n(block.first + block.second * i, block.second, dst);
+      }
+    }
+    return SUCCESS;
+  });
 }
 
 #define SET_OUTPUT(DTYPE, TYPE)                                                                                  \
@@ -76,38 +76,43 @@ Status OverflowCheck(T const &x, T const &y, DataType &type) {
   return SUCCESS;
 }
 
-#define DEFINE_FUNC_WITH_STATUS_BY_TYPE(TYPE)                                         \
-  std::function<TYPE(TYPE const &, TYPE const &, DataType &, Status &)> func_##TYPE = \
-    [](TYPE const &a, TYPE const &b, DataType &type, Status &ret) -> TYPE {           \
-    ret = OverflowCheck(a, b, type);                                                  \
-    if (ret != SUCCESS) {                                                             \
-      GELOGE(PARAM_INVALID, "Result of mul is overflow.");                            \
-      return static_cast<TYPE>(0);                                                    \
-    }                                                                                 \
-    return static_cast<TYPE>(a) * static_cast<TYPE>(b);                               \
-  };
-
-#define SET_BCAST_COMPUTE_CASE(DTYPE, TYPE)                              \
-  case DTYPE:                                                            \
-    ret = bcast.BCastComputeCheck(input, y_data_##TYPE##_, func_##TYPE); \
+template <typename T>
+Status BCastMulCompute(BCast &bcast, const std::vector<ConstGeTensorPtr> &input, std::vector<T> &y_data) {
+  Status ret = bcast.GenerateBcastInfo(BCast::TransShapeToDimVec(input[0]->GetTensorDesc()),
+                                       BCast::TransShapeToDimVec(input[1]->GetTensorDesc()));
+  if (ret != SUCCESS) {
+    GELOGE(ret, "Mul broadcasting failed.");
+    return ret;
+  }
+
+  DataType data_type = input[0]->GetTensorDesc().GetDataType();
+  auto x1_data = reinterpret_cast<const T *>(input[0]->GetData().data());
+  auto x2_data = reinterpret_cast<const T *>(input[1]->GetData().data());
+  y_data.resize(static_cast<size_t>(bcast.GetOutputElementNum()));
+  ret = bcast.BCastElementwise(x1_data, x2_data, y_data.data(), [data_type](T x, T y, T &out) -> Status {
+    DataType type = data_type;
+    if (OverflowCheck<T>(x, y, type) != SUCCESS) {
+      return PARAM_INVALID;
+    }
+    out = static_cast<T>(x) * static_cast<T>(y);
+    return SUCCESS;
+  });
+  if (ret != SUCCESS) {
+    GELOGE(PARAM_INVALID, "Result of mul is overflow.");
+    return ret;
+  }
+  return SUCCESS;
+}
+
+#define SET_BCAST_COMPUTE_CASE(DTYPE, TYPE)                      \
+  case DTYPE:                                                    \
+    ret = BCastMulCompute<TYPE>(bcast, input, y_data_##TYPE##_); \
     break;
 
 #define SET_OUTPUT(DTYPE, TYPE)                                                                                        \
   case DTYPE:                                                                                                          \
     (void)output_ptr->SetData(reinterpret_cast<uint8_t *>(y_data_##TYPE##_.data()), y_data_##TYPE##_.size() * length); \
     break;
-// [no need to check result]
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(int8_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(int16_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(int32_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(int64_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(uint8_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(uint16_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(uint32_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(uint64_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(fp16_t)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(float)
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(double)
 }  // namespace
 
 Status MulKernel::Compute(const OpDescPtr op_desc_ptr, const std::vector<ConstGeTensorPtr> &input,
@@ -16,11 +16,13 @@
 
 #include "host_kernels/reduce_prod_kernel.h"
 
+#include <algorithm>
 #include <memory>
 #include <set>
 
 #include "common/math/math_util.h"
 #include "common/op/ge_op_utils.h"
+#include "common/thread_pool.h"
 #include "common/types.h"
 #include "framework/common/debug/ge_log.h"
 #include "framework/common/ge_inner_error_codes.h"
@@ -36,6 +38,7 @@ const size_t kReduceProdMaxAxisRank = 1;
 const size_t kReduceProdInputOnlyData = 1;
 const size_t kReduceProdInputSize = 2;
 const std::set<DataType> kReduceProdSupportedType = {DT_INT32};
+const int64_t kReduceProdParallelMinBlock = 32768;
 }  // namespace
 
 Status ReduceProdKernel::ReduceProdCheck(const ge::OpDescPtr &op_desc_ptr,
@@ -126,22 +129,38 @@ Status ReduceProdKernel::DataCal(const std::vector<ge::ConstGeTensorPtr> &input,
       return INTERNAL_ERROR;
     }
 
-    int32_t tmp_x = 1;
-    int32_t tmp_y = 1;
-    for (int64_t i = 0; i < head_dim_; ++i) {
-      for (int64_t j = 0; j < end_dim_; ++j) {
-        // all index for input_data is less than size of input_data
-        tmp_x = input_data[static_cast<size_t>(i * end_dim_ * axis_dim_ + j)];
-        for (int64_t k = 1; k < axis_dim_; ++k) {
-          tmp_y = input_data[static_cast<size_t>(i * end_dim_ * axis_dim_ + j + k * end_dim_)];
-          if (ge::CheckInt32MulOverflow(tmp_x, tmp_y) != SUCCESS) {
-            GELOGW("Product is overflow. multiplier 1: %d. multiplier 2: %d.", tmp_x, tmp_y);
-            return INTERNAL_ERROR;
+    // Rows of the output are independent, so split them across the host pool. Within a row the axis is
+    // walked outermost and end_dim_ innermost, which keeps every access contiguous while preserving the
+    // multiplication order of each output element.
+    int64_t end_dim = end_dim_;
+    int64_t axis_dim = axis_dim_;
+    int32_t *out_data = buf.get();
+    int64_t min_rows = std::max(kReduceProdParallelMinBlock / std::max(end_dim * axis_dim, static_cast<int64_t>(1)),
+                                static_cast<int64_t>(1));
+    Status ret = ThreadPool::ParallelFor(
+      head_dim_, min_rows, [input_data, out_data, end_dim, axis_dim](int64_t begin, int64_t end) -> Status {
+        for (int64_t i = begin; i < end; ++i) {
+          // all index for input_data is less than size of input_data
+          const int32_t *in_row = input_data + static_cast<size_t>(i * end_dim * axis_dim);
+          int32_t *out_row = out_data + static_cast<size_t>(i * end_dim);
+          for (int64_t j = 0; j < end_dim; ++j) {
+            out_row[j] = in_row[j];
+          }
+          for (int64_t k = 1; k < axis_dim; ++k) {
+            const int32_t *in_slice = in_row + static_cast<size_t>(k * end_dim);
+            for (int64_t j = 0; j < end_dim; ++j) {
+              if (ge::CheckInt32MulOverflow(out_row[j], in_slice[j]) != SUCCESS) {
+                GELOGW("Product is overflow. multiplier 1: %d. multiplier 2: %d.", out_row[j], in_slice[j]);
+                return INTERNAL_ERROR;
+              }
+              out_row[j] *= in_slice[j];
+            }
           }
-          tmp_x *= tmp_y;
         }
-        buf[static_cast<size_t>(i * end_dim_ + j)] = tmp_x;
-      }
+        return SUCCESS;
+      });
+    if (ret != SUCCESS) {
+      return ret;
     }
 
     GE_IF_BOOL_EXEC(output_ptr->SetData(reinterpret_cast<uint8_t *>(buf.get()),
@@ -28,11 +28,13 @@
 #include "host_kernels/kernel_utils.h"
 #include "inc/kernel_factory.h"
 #include "common/math/math_util.h"
+#include "common/thread_pool.h"
 
 namespace ge {
 namespace {
 const size_t kRsqrtInputSize = 1;
 const size_t kRsqrtInputIndex0 = 0;
+const int64_t kRsqrtParallelMinBlock = 16384;
 
 template <typename T>
 Status ZeroCheck(T x, const DataType &data_type) {
@@ -51,6 +53,24 @@ Status ZeroCheck(T x, const DataType &data_type) {
   }
   return SUCCESS;
 }
+inline fp16_t RsqrtValue(fp16_t x) {
+  double val = static_cast<double>(x);
+  double drSqrt = 1.0 / std::sqrt(val);
+  fp16_t result;
+  result = drSqrt;
+  return result;
+}
+
+inline float RsqrtValue(float x) {
+  float denominator = std::sqrt(x);
+  return static_cast<float>(1 / denominator);
+}
+
+inline double RsqrtValue(double x) {
+  double denominator = std::sqrt(x);
+  return static_cast<double>(1 / denominator);
+}
+
 #define SET_RSQRT_CASE(DTYPE, TYPE)                               \
   case (DTYPE):                                                   \
     ret = RsqrtKernel::RsqrtCompute<TYPE>(input_ptr, output_ptr); \
@@ -70,33 +90,25 @@ Status RsqrtKernel::RsqrtCompute(ConstGeTensorPtr &input_tensor_ptr, GeTensorPtr
       GELOGW("New buf failed");
       return NOT_CHANGED;
     }
-    auto ptr = const_cast<T *>(reinterpret_cast<const T *>(input_tensor_ptr->GetData().data()));
-    for (size_t i = 0; i < data_count; i++) {
-      if (ZeroCheck(*(ptr + i), data_type) != SUCCESS) {
-        GELOGW("Rsqrt: The input data can not less than or equal to zero, rsqrt folding failed.");
-        return NOT_CHANGED;
-      }
-      switch (data_type) {
-        case DT_FLOAT16: {
-          double val = static_cast<double>(*(reinterpret_cast<const fp16_t *>(input_tensor_ptr->GetData().data()) + i));
-          double drSqrt = 1.0 / std::sqrt(val);
-          buf[i] = drSqrt;
-          break;
-        }
-        case DT_FLOAT: {
-          float denominator = std::sqrt(*(reinterpret_cast<const float *>(input_tensor_ptr->GetData().data()) + i));
-          buf[i] = static_cast<float>(1 / denominator);
-          break;
-        }
-        case DT_DOUBLE: {
-          double denominator = std::sqrt(*(reinterpret_cast<const double *>(input_tensor_ptr->GetData().data()) + i));
-          buf[i] = static_cast<double>(1 / denominator);
-          break;
-        }
-        default:
-          GELOGW("Input data type must be FP16, FP32 and DOUBLE.");
-          return NOT_CHANGED;
-      }
+    if ((data_type != DT_FLOAT16) && (data_type != DT_FLOAT) && (data_type != DT_DOUBLE)) {
+      GELOGW("Input data type must be FP16, FP32 and DOUBLE.");
+      return NOT_CHANGED;
+    }
+    const T *ptr = reinterpret_cast<const T *>(input_tensor_ptr->GetData().data());
+    T *out = buf.get();
+    Status ret = ThreadPool::ParallelFor(static_cast<int64_t>(data_count), kRsqrtParallelMinBlock,
+                                         [ptr, out, data_type](int64_t begin, int64_t end) -> Status {
+                                           for (int64_t i = begin; i < end; ++i) {
+                                             if (ZeroCheck(ptr[i], data_type) != SUCCESS) {
+                                               return NOT_CHANGED;
+                                             }
+                                             out[i] = RsqrtValue(ptr[i]);
+                                           }
+                                           return SUCCESS;
+                                         });
+    if (ret != SUCCESS) {
+      GELOGW("Rsqrt: The input data can not less than or equal to zero, rsqrt folding failed.");
+      return NOT_CHANGED;
     }
     GE_IF_BOOL_EXEC(output_tensor_ptr->SetData(reinterpret_cast<uint8_t *>(buf.get()), data_size) != GRAPH_SUCCESS,
                     GELOGW("Set data failed");
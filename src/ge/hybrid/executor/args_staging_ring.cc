@@ -0,0 +1,106 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hybrid/executor/args_staging_ring.h"
+#include <algorithm>
+#include "framework/common/debug/ge_log.h"
+#include "framework/common/debug/log.h"
+#include "securec.h"
+
+namespace ge {
+namespace hybrid {
+namespace {
+const size_t kInitCapacity = 1024 * 1024;
+const size_t kMaxCapacity = 64 * 1024 * 1024;
+}  // namespace
+
+ArgsStagingRing::~ArgsStagingRing() {
+  (void)WaitIssuedCopies();
+  FreeBuffer();
+}
+
+Status ArgsStagingRing::WaitIssuedCopies() {
+  if (!has_issued_copies_) {
+    return SUCCESS;
+  }
+  // an execution failed before synchronizing leaves its copies on the stream
+  GE_CHK_RT_RET(rtStreamSynchronize(stream_));
+  has_issued_copies_ = false;
+  return SUCCESS;
+}
+
+void ArgsStagingRing::FreeBuffer() {
+  if (host_base_ != nullptr) {
+    GE_CHK_RT(rtFreeHost(host_base_));
+    host_base_ = nullptr;
+  }
+  capacity_ = 0;
+}
+
+Status ArgsStagingRing::Reset() {
+  std::lock_guard<std::mutex> lk(mu_);
+  GE_CHK_STATUS_RET(WaitIssuedCopies(), "Wait for copies of staged args failed.");
+  used_size_ = 0;
+  pending_copies_.clear();
+  if (host_base_ != nullptr && (!overflowed_ || capacity_ >= kMaxCapacity)) {
+    return SUCCESS;
+  }
+
+  size_t capacity = (host_base_ == nullptr) ? kInitCapacity : std::min(capacity_ * 2, kMaxCapacity);
+  FreeBuffer();
+  overflowed_ = false;
+  GE_CHK_RT_RET(rtMallocHost(reinterpret_cast<void **>(&host_base_), capacity));
+  capacity_ = capacity;
+  GELOGD("Args staging buffer allocated, size = %zu", capacity_);
+  return SUCCESS;
+}
+
+bool ArgsStagingRing::Stage(void *dst, const void *data, size_t size) {
+  std::lock_guard<std::mutex> lk(mu_);
+  if (host_base_ == nullptr || size > capacity_ - used_size_) {
+    overflowed_ = true;
+    return false;
+  }
+  if (memcpy_s(host_base_ + used_size_, capacity_ - used_size_, data, size) != EOK) {
+    return false;
+  }
+
+  auto dst_addr = static_cast<uint8_t *>(dst);
+  if (!pending_copies_.empty()) {
+    auto &last = pending_copies_.back();
+    if ((last.dst + last.size == dst_addr) && (last.offset + last.size == used_size_)) {
+      last.size += size;
+      used_size_ += size;
+      return true;
+    }
+  }
+  pending_copies_.emplace_back(PendingCopy{dst_addr, used_size_, size});
+  used_size_ += size;
+  return true;
+}
+
+Status ArgsStagingRing::Flush() {
+  std::lock_guard<std::mutex> lk(mu_);
+  for (const auto &copy : pending_copies_) {
+    GE_CHK_RT_RET(
+      rtMemcpyAsync(copy.dst, copy.size, host_base_ + copy.offset, copy.size, RT_MEMCPY_HOST_TO_DEVICE, stream_));
+    has_issued_copies_ = true;
+  }
+  pending_copies_.clear();
+  return SUCCESS;
+}
+}  // namespace hybrid
+}  // namespace ge
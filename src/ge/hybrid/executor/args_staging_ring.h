@@ -0,0 +1,84 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GE_HYBRID_EXECUTOR_ARGS_STAGING_RING_H_
+#define GE_HYBRID_EXECUTOR_ARGS_STAGING_RING_H_
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "ge/ge_api_error_codes.h"
+#include "runtime/rt.h"
+
+namespace ge {
+namespace hybrid {
+/**
+ * Page locked host buffer for the args which tasks update on device before each launch. The args are written to the
+ * buffer and copied to device by async copies on the execution stream, so the copies are ordered before the launches
+ * without blocking the host. Copies to adjacent device addresses are merged into one.
+ * The buffer is only reused or freed after the stream is synchronized, so that copies issued by a failed execution
+ * never read it after that. If an execution runs out of it, the rest is copied synchronously and the buffer grows for
+ * the next execution.
+ */
+class ArgsStagingRing {
+ public:
+  explicit ArgsStagingRing(rtStream_t stream) : stream_(stream) {}
+  ~ArgsStagingRing();
+
+  ArgsStagingRing(const ArgsStagingRing &) = delete;
+  ArgsStagingRing &operator=(const ArgsStagingRing &) = delete;
+
+  /**
+   * Reclaim the buffer, the stream is synchronized first if copies were issued since last reset.
+   */
+  Status Reset();
+
+  /**
+   * Stage a copy of data to device address dst, it is issued by the next Flush.
+   * @return false if the buffer is used up, data should be copied by the caller then
+   */
+  bool Stage(void *dst, const void *data, size_t size);
+
+  /**
+   * Issue the staged copies on the stream.
+   */
+  Status Flush();
+
+ private:
+  struct PendingCopy {
+    uint8_t *dst;
+    size_t offset;
+    size_t size;
+  };
+
+  Status WaitIssuedCopies();
+  void FreeBuffer();
+
+  rtStream_t stream_;
+  std::mutex mu_;
+  uint8_t *host_base_ = nullptr;
+  size_t capacity_ = 0;
+  size_t used_size_ = 0;
+  bool overflowed_ = false;
+  // copies issued on the stream may still read the buffer
+  bool has_issued_copies_ = false;
+  std::vector<PendingCopy> pending_copies_;
+};
+}  // namespace hybrid
+}  // namespace ge
+
+#endif  // GE_HYBRID_EXECUTOR_ARGS_STAGING_RING_H_
@@ -24,6 +24,7 @@
 #include "framework/common/debug/ge_log.h"
 #include "hybrid/common/npu_memory_allocator.h"
 #include "hybrid/common/tensor_value.h"
+#include "hybrid/executor/args_staging_ring.h"
 #include "hybrid/executor/hybrid_profiler.h"
 #include "hybrid/executor/node_done_manager.h"
 #include "hybrid/executor/node_state.h"
@@ -42,6 +43,7 @@ struct GraphExecutionContext {
   rtContext_t rt_context = nullptr;
   rtContext_t rt_gen_context = nullptr;
   std::unique_ptr<CallbackManager> callback_manager;
+  std::unique_ptr<ArgsStagingRing> args_staging_ring;
   NpuMemoryAllocator *allocator = nullptr;
   mutable std::unique_ptr<HybridProfiler> profiler;
   DumpProperties dump_properties;
@@ -49,6 +51,8 @@ struct GraphExecutionContext {
   bool dump_enabled = false;
   long profiling_level = 0;
   long iteration = 0;
+  // stream syncs by tasks in the middle of an execution
+  mutable std::atomic<uint32_t> stream_sync_count{0};
   Status status = SUCCESS;
   mutable std::mutex mu;
 };
@@ -24,6 +24,7 @@ namespace ge {
 namespace hybrid {
 namespace {
 int kDataOutputIndex = 0;
+const size_t kMaxDataBatchSize = 16;
 }
 HybridModelAsyncExecutor::HybridModelAsyncExecutor(HybridModel *model) : model_(model), run_flag_(false) {}
 
@@ -99,13 +100,25 @@ Status HybridModelAsyncExecutor::RunInternal() {
   // DeviceReset before thread run finished!
   GE_MAKE_GUARD(not_used_var, [&] { GE_CHK_RT(rtDeviceReset(device_id)); });
 
+  // data queued while the model is running are taken in one go, without waking up for each of them
+  std::vector<std::shared_ptr<InputDataWrapper>> data_wrappers;
+  size_t next_data_pos = 0;
   while (run_flag_) {
-    std::shared_ptr<InputDataWrapper> data_wrapper;
-    Status ret = data_inputer_->Pop(data_wrapper);
-    if (data_wrapper == nullptr || ret != SUCCESS) {
+    Status ret = SUCCESS;
+    if (next_data_pos >= data_wrappers.size()) {
+      data_wrappers.clear();
+      next_data_pos = 0;
+      ret = data_inputer_->PopBatch(data_wrappers, kMaxDataBatchSize);
+    }
+    if (ret != SUCCESS || next_data_pos >= data_wrappers.size()) {
       GELOGI("data_wrapper is null!, ret = %u", ret);
       continue;
     }
+    std::shared_ptr<InputDataWrapper> data_wrapper = std::move(data_wrappers[next_data_pos++]);
+    if (data_wrapper == nullptr) {
+      GELOGI("data_wrapper is null!");
+      continue;
+    }
 
     GELOGI("Getting the input data, model_id:%u", model_id_);
     GE_IF_BOOL_EXEC(!run_flag_, break);
@@ -249,6 +262,31 @@ Status HybridModelAsyncExecutor::OnComputeDone(uint32_t data_index, uint32_t res
   return result_code;
 }
 
+Status HybridModelAsyncExecutor::CalcOutputSize(size_t index, const GeTensorDesc &tensor_desc,
+                                                const TensorValue &output_tensor, int64_t &output_size) {
+  GE_CHK_GRAPH_STATUS_RET(TensorUtils::CalcTensorMemSize(tensor_desc.GetShape(), tensor_desc.GetFormat(),
+                                                         tensor_desc.GetDataType(), output_size),
+                          "Failed to calc tensor size for output[%zu]. shape = [%s], type = %s, format = %s", index,
+                          tensor_desc.GetShape().ToString().c_str(),
+                          TypeUtils::DataTypeToSerialString(tensor_desc.GetDataType()).c_str(),
+                          TypeUtils::FormatToSerialString(tensor_desc.GetFormat()).c_str());
+
+  GELOGD("Got tensor size for output[%zu] successfully. shape = [%s], type = %s, format = %s, size = %ld", index,
+         tensor_desc.GetShape().ToString().c_str(),
+         TypeUtils::DataTypeToSerialString(tensor_desc.GetDataType()).c_str(),
+         TypeUtils::FormatToSerialString(tensor_desc.GetFormat()).c_str(), output_size);
+
+  GE_CHECK_GE(output_size, 0);
+  GE_CHECK_LE(output_size, UINT32_MAX);
+  if (output_tensor.GetSize() < static_cast<size_t>(output_size)) {
+    GELOGE(INTERNAL_ERROR, "output[%zu] tensor size(%zu) is not enough for output shape [%s]", index,
+           output_tensor.GetSize(), tensor_desc.GetShape().ToString().c_str());
+    return INTERNAL_ERROR;
+  }
+
+  return SUCCESS;
+}
+
 Status HybridModelAsyncExecutor::CopyOutputs(HybridModelExecutor::ExecuteArgs &args, OutputData *output_data,
                                              std::vector<ge::OutputTensorInfo> &outputs) {
   // copy output data from op to designated position
@@ -267,25 +305,7 @@ Status HybridModelAsyncExecutor::CopyOutputs(HybridModelExecutor::ExecuteArgs &a
     auto &tensor_desc = output_tensor_desc_list.at(i);
     GE_CHECK_NOTNULL(tensor_desc);
     int64_t output_size = -1;
-    GE_CHK_GRAPH_STATUS_RET(TensorUtils::CalcTensorMemSize(tensor_desc->GetShape(), tensor_desc->GetFormat(),
-                                                           tensor_desc->GetDataType(), output_size),
-                            "Failed to calc tensor size for output[%zu]. shape = [%s], type = %s, format = %s", i,
-                            tensor_desc->GetShape().ToString().c_str(),
-                            TypeUtils::DataTypeToSerialString(tensor_desc->GetDataType()).c_str(),
-                            TypeUtils::FormatToSerialString(tensor_desc->GetFormat()).c_str());
-
-    GELOGD("Got tensor size for output[%zu] successfully. shape = [%s], type = %s, format = %s, size = %ld", i,
-           tensor_desc->GetShape().ToString().c_str(),
-           TypeUtils::DataTypeToSerialString(tensor_desc->GetDataType()).c_str(),
-           TypeUtils::FormatToSerialString(tensor_desc->GetFormat()).c_str(), output_size);
-
-    GE_CHECK_GE(output_size, 0);
-    GE_CHECK_LE(output_size, UINT32_MAX);
-    if (output_tensor.GetSize() < static_cast<size_t>(output_size)) {
-      GELOGE(INTERNAL_ERROR, "output[%zu] tensor size(%zu) is not enough for output shape [%s]", i,
-             output_tensor.GetSize(), tensor_desc->GetShape().ToString().c_str());
-      return INTERNAL_ERROR;
-    }
+    GE_CHK_STATUS_RET_NOLOG(CalcOutputSize(i, *tensor_desc, output_tensor, output_size));
 
     ge::OutputTensorInfo output;
     output.data_type = static_cast<uint32_t>(tensor_desc->GetDataType());
@@ -358,5 +378,65 @@ Status HybridModelAsyncExecutor::Execute(const vector<GeTensor> &inputs, vector<
 
   return SUCCESS;
 }
+
+Status HybridModelAsyncExecutor::Execute(const std::vector<DataBuffer> &inputs,
+                                         const std::vector<GeTensorDesc> &input_desc, std::vector<DataBuffer> &outputs,
+                                         std::vector<GeTensorDesc> &output_desc, bool is_device_memory) {
+  GELOGD("Start to execute model with bound buffers, device memory = %d.", is_device_memory);
+  if ((inputs.size() != input_tensors_.size()) || (input_desc.size() != input_tensors_.size())) {
+    GELOGE(PARAM_INVALID, "Input number mismatch. model requires %zu, but buffers = %zu, descs = %zu",
+           input_tensors_.size(), inputs.size(), input_desc.size());
+    return PARAM_INVALID;
+  }
+
+  HybridModelExecutor::ExecuteArgs args;
+  args.inputs.resize(input_tensors_.size());
+  args.input_desc.resize(input_tensors_.size());
+  if (is_device_memory) {
+    // device buffers are fed to the nodes as input tensors
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      args.inputs[i] = TensorValue(inputs[i].data, inputs[i].length);
+    }
+  } else {
+    InputData input_data;
+    input_data.blobs = inputs;
+    GE_CHK_STATUS_RET(CopyInputData(input_data), "Failed to copy input data to model");
+    for (auto &it : input_tensors_) {
+      args.inputs[it.first] = it.second;
+    }
+  }
+  for (size_t i = 0; i < input_desc.size(); ++i) {
+    args.input_desc[i] = MakeShared<GeTensorDesc>(input_desc[i]);
+  }
+
+  GE_CHK_STATUS_RET(executor_->Execute(args), "Failed to execute model.");
+
+  if ((args.outputs.size() != outputs.size()) || (args.output_desc.size() != outputs.size())) {
+    GELOGE(PARAM_INVALID, "Output number mismatch. model outputs = %zu, descs = %zu, but buffers = %zu",
+           args.outputs.size(), args.output_desc.size(), outputs.size());
+    return PARAM_INVALID;
+  }
+
+  rtMemcpyKind_t kind = is_device_memory ? RT_MEMCPY_DEVICE_TO_DEVICE : RT_MEMCPY_DEVICE_TO_HOST;
+  output_desc.clear();
+  for (size_t i = 0; i < outputs.size(); ++i) {
+    auto &tensor_desc = args.output_desc[i];
+    GE_CHECK_NOTNULL(tensor_desc);
+    int64_t output_size = -1;
+    GE_CHK_STATUS_RET_NOLOG(CalcOutputSize(i, *tensor_desc, args.outputs[i], output_size));
+    if (outputs[i].length < static_cast<uint64_t>(output_size)) {
+      GELOGE(PARAM_INVALID, "Buffer of output[%zu] is too small, buffer size = %lu, output size = %ld, shape = [%s]",
+             i, outputs[i].length, output_size, tensor_desc->GetShape().ToString().c_str());
+      return PARAM_INVALID;
+    }
+    if (output_size > 0) {
+      GE_CHK_RT_RET(rtMemcpy(outputs[i].data, outputs[i].length, args.outputs[i].GetData(), output_size, kind));
+    }
+    output_desc.emplace_back(*tensor_desc);
+  }
+
+  GELOGD("Done executing model with bound buffers. output count = %zu", output_desc.size());
+  return SUCCESS;
+}
 }  // namespace hybrid
 }  // namespace ge
@@ -37,6 +37,20 @@ class HybridModelAsyncExecutor {
 
   Status Execute(const vector<GeTensor> &inputs, vector<GeTensor> &outputs);
 
+  ///
+  /// @ingroup ge
+  /// @brief execute with buffers bound by user, device inputs are taken by nodes in place, host inputs are copied
+  ///        to device once, and outputs are copied into the bound buffers directly
+  /// @param [in] inputs input buffers
+  /// @param [in] input_desc descs of inputs
+  /// @param [in] outputs output buffers
+  /// @param [out] output_desc real descs of outputs
+  /// @param [in] is_device_memory buffers are device memory or host memory
+  /// @return Status
+  ///
+  Status Execute(const std::vector<DataBuffer> &inputs, const std::vector<GeTensorDesc> &input_desc,
+                 std::vector<DataBuffer> &outputs, std::vector<GeTensorDesc> &output_desc, bool is_device_memory);
+
   Status Start(const std::shared_ptr<ModelListener> &listener);
 
   void SetDeviceId(uint32_t device_id);
@@ -60,6 +74,9 @@ class HybridModelAsyncExecutor {
   Status CopyOutputs(HybridModelExecutor::ExecuteArgs &args, OutputData *output_data,
                      std::vector<ge::OutputTensorInfo> &outputs);
 
+  static Status CalcOutputSize(size_t index, const GeTensorDesc &tensor_desc, const TensorValue &output_tensor,
+                               int64_t &output_size);
+
   Status OnComputeDone(uint32_t data_index, uint32_t result_code, std::vector<ge::OutputTensorInfo> &outputs);
 
   Status PreRun(InputData &current_data);
@@ -15,6 +15,7 @@
  */
 
 #include "hybrid_model_executor.h"
+#include "ge/ge_api_types.h"
 #include "graph/ge_context.h"
 #include "graph/runtime_inference_context.h"
 
@@ -23,6 +24,15 @@ namespace hybrid {
 namespace {
 const int kIntBase = 10;
 const char *const kEnvProfilingLevel = "HYBRID_PROFILING_LEVEL";
+const size_t kDefaultShapePlanCapacity = 8;
+
+long GetIntOption(const std::string &key, long default_value) {
+  std::string value;
+  if ((::ge::GetContext().GetOption(key, value) != GRAPH_SUCCESS) || value.empty()) {
+    return default_value;
+  }
+  return std::strtol(value.c_str(), nullptr, kIntBase);
+}
 }  // namespace
 HybridModelExecutor::HybridModelExecutor(HybridModel *model, uint32_t device_id, rtStream_t stream)
     : model_(model), device_id_(device_id), stream_(stream) {}
@@ -36,6 +46,9 @@ HybridModelExecutor::~HybridModelExecutor() {
 Status HybridModelExecutor::Init() {
   GELOGD("Start to init HybridGraphEngine.");
   GE_CHK_STATUS_RET_NOLOG(InitExecutionContext());
+  root_graph_executor_.reset(new (std::nothrow) SubgraphExecutor(model_->GetRootGraphItem(), &context_));
+  GE_CHECK_NOTNULL(root_graph_executor_);
+  GE_CHK_STATUS_RET_NOLOG(InitShapePlanCache());
   GELOGD("HybridGraphEngine initialized successfully.");
   return SUCCESS;
 }
@@ -45,12 +58,23 @@ Status HybridModelExecutor::Execute(HybridModelExecutor::ExecuteArgs &args) {
   auto root_graph_item = model_->GetRootGraphItem();
   GE_CHECK_NOTNULL(root_graph_item);
 
-  SubgraphExecutor executor(model_->GetRootGraphItem(), &context_);
-  auto ret = ExecuteGraphInternal(executor, args);
+  GE_CHECK_NOTNULL(root_graph_executor_);
+  bool is_recording_plan = false;
+  ShapePlan *shape_plan = nullptr;
+  // shapes of the inputs are the signature of a plan
+  if ((shape_plan_cache_ != nullptr) && (args.input_desc.size() == args.inputs.size())) {
+    shape_plan = shape_plan_cache_->Acquire(args.input_desc, is_recording_plan);
+  }
+  root_graph_executor_->SetShapePlan(shape_plan, is_recording_plan);
+  auto ret = ExecuteGraphInternal(*root_graph_executor_, args);
+  root_graph_executor_->SetShapePlan(nullptr, false);
+  if (shape_plan != nullptr) {
+    shape_plan_cache_->Release(shape_plan, is_recording_plan, ret);
+  }
   Cleanup();
   RECORD_MODEL_EXECUTION_EVENT(&context_, "[Cleanup] End");
   GE_CHK_STATUS_RET(ret, "Failed to execute model");
-  GELOGD("Model executed successfully.");
+  GELOGD("Model executed successfully, stream synced %u times by tasks.", context_.stream_sync_count.load());
 
   if (context_.profiler != nullptr) {
     context_.profiler->Dump(std::cout);
@@ -98,6 +122,8 @@ Status HybridModelExecutor::InitExecutionContext() {
   GE_CHECK_NOTNULL(context_.allocator);
   context_.callback_manager = std::unique_ptr<CallbackManager>(new (std::nothrow) CallbackManager(stream_));
   GE_CHECK_NOTNULL(context_.callback_manager);
+  context_.args_staging_ring = std::unique_ptr<ArgsStagingRing>(new (std::nothrow) ArgsStagingRing(stream_));
+  GE_CHECK_NOTNULL(context_.args_staging_ring);
   context_.dump_properties = PropertiesManager::Instance().GetDumpProperties(context_.session_id);
   const char *profiling_level = std::getenv(kEnvProfilingLevel);
   if (profiling_level != nullptr) {
@@ -115,8 +141,36 @@ Status HybridModelExecutor::InitExecutionContext() {
   return SUCCESS;
 }
 
+Status HybridModelExecutor::InitShapePlanCache() {
+  long threshold = GetIntOption(OPTION_EXEC_SHAPE_PLAN_THRESHOLD, 0);
+  long capacity = GetIntOption(OPTION_EXEC_SHAPE_PLAN_CAPACITY, kDefaultShapePlanCapacity);
+  if (threshold <= 0) {
+    return SUCCESS;
+  }
+  if ((threshold > UINT32_MAX) || (capacity <= 0)) {
+    GELOGE(PARAM_INVALID, "Invalid shape plan options, threshold = %ld, capacity = %ld.", threshold, capacity);
+    return PARAM_INVALID;
+  }
+
+  auto root_graph_item = model_->GetRootGraphItem();
+  GE_CHECK_NOTNULL(root_graph_item);
+  if (!ShapePlanCache::IsSupported(*root_graph_item)) {
+    GELOGI("[%s] Shape plans are not supported by the model.", root_graph_item->GetName().c_str());
+    return SUCCESS;
+  }
+  shape_plan_cache_.reset(new (std::nothrow) ShapePlanCache(root_graph_item, static_cast<uint32_t>(threshold),
+                                                            static_cast<size_t>(capacity)));
+  GE_CHECK_NOTNULL(shape_plan_cache_);
+  GELOGI("[%s] Shape plans enabled, threshold = %ld, capacity = %ld.", root_graph_item->GetName().c_str(), threshold,
+         capacity);
+  return SUCCESS;
+}
+
 Status HybridModelExecutor::ResetExecutionContext(GraphExecutionContext &context) {
   GE_CHK_STATUS_RET_NOLOG(context.callback_manager->Init());
+  // copies staged by last execution are waited for, even if it failed before synchronizing the stream
+  GE_CHK_STATUS_RET_NOLOG(context.args_staging_ring->Reset());
+  context.stream_sync_count = 0;
   string ctx_id = std::to_string(context.session_id);
   RuntimeInferenceContext::DestroyContext(ctx_id);
   GE_CHK_GRAPH_STATUS_RET(RuntimeInferenceContext::CreateContext(ctx_id), "Failed to Destroy RuntimeInferenceContext");
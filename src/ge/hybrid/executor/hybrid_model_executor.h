@@ -20,6 +20,7 @@
 #include "graph/load/new_model_manager/data_inputer.h"
 #include "hybrid/executor/hybrid_execution_context.h"
 #include "hybrid/executor/rt_callback_manager.h"
+#include "hybrid/executor/shape_plan_cache.h"
 #include "hybrid/executor/subgraph_executor.h"
 
 namespace ge {
@@ -41,18 +42,25 @@ class HybridModelExecutor {
 
   const GraphExecutionContext *GetContext() const { return &context_; }
 
+  const ShapePlanCache *GetShapePlanCache() const { return shape_plan_cache_.get(); }
+
   Status Execute(ExecuteArgs &args);
 
  private:
   Status ExecuteGraphInternal(SubgraphExecutor &executor, ExecuteArgs &args);
   Status Cleanup();
   Status InitExecutionContext();
+  Status InitShapePlanCache();
   static Status ResetExecutionContext(GraphExecutionContext &context);
 
   HybridModel *model_;
   uint32_t device_id_;
   rtStream_t stream_;
   GraphExecutionContext context_;
+  // reused by every execution, so that per node states are allocated once
+  std::unique_ptr<SubgraphExecutor> root_graph_executor_;
+  // null if shape plans are disabled or not supported by the model
+  std::unique_ptr<ShapePlanCache> shape_plan_cache_;
 };
 }  // namespace hybrid
 }  // namespace ge
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+
 #include "hybrid/executor/node_done_manager.h"
 #include <chrono>
 #include "framework/common/debug/ge_log.h"
@@ -22,84 +23,90 @@ namespace ge {
 namespace hybrid {
 namespace {
 constexpr int kDefaultWaitTimeoutInSec = 60 * 10;
+constexpr int kSpinCount = 64;
+}  // namespace
+void NodeDoneManager::Init(size_t node_num) {
+  done_flags_.reset(new (std::nothrow) std::atomic<bool>[node_num]);
+  node_num_ = (done_flags_ == nullptr) ? 0 : node_num;
+  Reset();
 }
-bool NodeDoneManager::Cond::Await() {
-  std::unique_lock<std::mutex> lk(cond_mu_);
-  if (!cv_.wait_for(lk, std::chrono::seconds(kDefaultWaitTimeoutInSec),
-                    [&]() { return is_released_ || is_cancelled_; })) {
-    GELOGE(INTERNAL_ERROR, "Wait timed out.");
-    return false;
-  }
 
-  return is_released_;
-}
-
-void NodeDoneManager::Cond::Release() {
-  std::unique_lock<std::mutex> lk(cond_mu_);
-  is_released_ = true;
-  cv_.notify_all();
+std::atomic<bool> *NodeDoneManager::GetFlag(int node_index) const {
+  if ((node_index < 0) || (static_cast<size_t>(node_index) >= node_num_)) {
+    GELOGE(INTERNAL_ERROR, "Node index %d out of range, node num = %zu.", node_index, node_num_);
+    return nullptr;
+  }
+  return &done_flags_[node_index];
 }
 
-void NodeDoneManager::Cond::Cancel() {
-  std::unique_lock<std::mutex> lk(cond_mu_);
-  is_cancelled_ = true;
+void NodeDoneManager::Destroy() {
+  GELOGD("Start to destroy NodeDoneManager.");
+  destroyed_.store(true);
+  std::lock_guard<std::mutex> lk(mu_);
   cv_.notify_all();
+  GELOGD("Done destroying NodeDoneManager successfully.");
 }
 
-bool NodeDoneManager::Cond::IsRelease() {
-  std::unique_lock<std::mutex> lk(cond_mu_);
-  return is_released_;
-}
-
-NodeDoneManager::Cond *NodeDoneManager::GetSubject(const NodePtr &node) {
-  std::lock_guard<std::mutex> lk(mu_);
-  if (destroyed_) {
-    GELOGD("Already destroyed.");
-    return nullptr;
-  }
-
-  auto it = subjects_.find(node);
-  if (it == subjects_.end()) {
-    return &subjects_[node];
+void NodeDoneManager::Reset() {
+  for (size_t i = 0; i < node_num_; ++i) {
+    done_flags_[i].store(false, std::memory_order_relaxed);
   }
-
-  return &it->second;
+  destroyed_.store(false);
 }
 
-void NodeDoneManager::Destroy() {
-  GELOGD("Start to reset NodeDoneManager.");
-  std::lock_guard<std::mutex> lk(mu_);
-  GELOGD("Cond size = %zu.", subjects_.size());
-  for (auto &sub : subjects_) {
-    if (!sub.second.IsRelease()) {
-      sub.second.Cancel();
-      GELOGD("[%s] Node canceled.", sub.first->GetName().c_str());
-    }
+void NodeDoneManager::NodeDone(int node_index) {
+  auto flag = GetFlag(node_index);
+  if (flag == nullptr) {
+    return;
   }
+  flag->store(true, std::memory_order_release);
+  GELOGD("Node %d released.", node_index);
 
-  subjects_.clear();
-  destroyed_ = true;
-  GELOGD("Done resetting NodeDoneManager successfully.");
-}
-
-void NodeDoneManager::NodeDone(const NodePtr &node) {
-  auto sub = GetSubject(node);
-  if (sub != nullptr) {
-    sub->Release();
-    GELOGD("[%s] Node released.", node->GetName().c_str());
+  // pairs with the fence in Await, either the parked waiter is seen here or the flag is seen by the waiter
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (num_waiters_.load(std::memory_order_relaxed) > 0) {
+    std::lock_guard<std::mutex> lk(mu_);
+    cv_.notify_all();
   }
 }
 
-bool NodeDoneManager::Await(const NodePtr &node) {
-  auto sub = GetSubject(node);
-  if (sub == nullptr) {
+bool NodeDoneManager::Await(int node_index) {
+  auto flag = GetFlag(node_index);
+  if (flag == nullptr) {
     return false;
   }
+  for (int i = 0; i < kSpinCount; ++i) {
+    if (destroyed_.load()) {
+      GELOGD("Already destroyed.");
+      return false;
+    }
+    if (flag->load(std::memory_order_acquire)) {
+      return true;
+    }
+  }
 
-  GELOGD("[%s] Await start. is_released = %s", node->GetName().c_str(), sub->IsRelease() ? "true" : "false");
-  bool ret = sub->Await();
-  GELOGD("[%s] Await ended. is_released = %s", node->GetName().c_str(), sub->IsRelease() ? "true" : "false");
-  return ret;
+  GELOGD("Node %d await start.", node_index);
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(kDefaultWaitTimeoutInSec);
+  std::unique_lock<std::mutex> lk(mu_);
+  num_waiters_.fetch_add(1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  bool is_done = false;
+  while (!destroyed_.load()) {
+    if (flag->load(std::memory_order_acquire)) {
+      is_done = true;
+      break;
+    }
+    if (cv_.wait_until(lk, deadline) == std::cv_status::timeout) {
+      is_done = flag->load(std::memory_order_acquire) && !destroyed_.load();
+      if (!is_done) {
+        GELOGE(INTERNAL_ERROR, "Wait timed out.");
+      }
+      break;
+    }
+  }
+  num_waiters_.fetch_sub(1, std::memory_order_relaxed);
+  GELOGD("Node %d await ended. is_done = %s", node_index, is_done ? "true" : "false");
+  return is_done;
 }
 }  // namespace hybrid
 }  // namespace ge
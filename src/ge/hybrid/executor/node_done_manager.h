@@ -14,44 +14,48 @@
  * limitations under the License.
  */
 
+
 #ifndef GE_HYBRID_EXECUTOR_NODE_DONE_COND_MANAGER_H_
 #define GE_HYBRID_EXECUTOR_NODE_DONE_COND_MANAGER_H_
 
+#include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
-#include <unordered_map>
-#include "graph/node.h"
 
 namespace ge {
 namespace hybrid {
+// Completion table of the nodes in a graph, indexed by NodeItem::index_in_graph.
+// Each node has an atomic done flag, so NodeDone and Await of a done node are lock free. Waiters park on a shared
+// condition variable, which is only touched by NodeDone when some waiter is parked.
 class NodeDoneManager {
  public:
-  void NodeDone(const NodePtr &node);
+  NodeDoneManager() = default;
+  ~NodeDoneManager() = default;
+
+  // size the table for node_num nodes, all of them are not done
+  void Init(size_t node_num);
+
+  void NodeDone(int node_index);
 
-  bool Await(const NodePtr &node);
+  // wait until the node is done, return false if the table is destroyed or wait timed out
+  bool Await(int node_index);
 
+  // wake up all waiters, Await returns false until Reset
   void Destroy();
 
+  // reset all nodes to not done without reallocation
+  void Reset();
+
  private:
-  class Cond {
-   public:
-    bool IsRelease();
-    void Release();
-    void Cancel();
-    bool Await();
-
-   private:
-    std::mutex cond_mu_;
-    std::condition_variable cv_;
-    bool is_released_ = false;
-    bool is_cancelled_ = false;
-  };
-
-  Cond *GetSubject(const NodePtr &node);
+  std::atomic<bool> *GetFlag(int node_index) const;
+
+  std::unique_ptr<std::atomic<bool>[]> done_flags_;
+  size_t node_num_ = 0;
+  std::atomic<bool> destroyed_{false};
+  std::atomic<uint32_t> num_waiters_{0};
   std::mutex mu_;
-  std::unordered_map<NodePtr, Cond> subjects_;
-  bool destroyed_ = false;
+  std::condition_variable cv_;
 };
 }  // namespace hybrid
 }  // namespace ge
@@ -114,8 +114,14 @@ Status ShapeInferenceState::AwaitShapesReady(const GraphExecutionContext &contex
   return SUCCESS;
 }
 
-ShapeFuture::ShapeFuture(NodePtr src_node, uint32_t src_index, SubgraphContext *subgraph_context)
-    : src_node_(std::move(src_node)), src_index_(src_index), subgraph_context_(subgraph_context) {}
+void ShapeInferenceState::Reset() {
+  std::lock_guard<std::mutex> lk(mu_);
+  shape_futures.clear();
+  num_pending_shapes_ = node_item.num_inputs - node_item.num_static_input_shapes;
+}
+
+ShapeFuture::ShapeFuture(const NodeItem *src_node, uint32_t src_index, SubgraphContext *subgraph_context)
+    : src_node_(src_node), src_index_(src_index), subgraph_context_(subgraph_context) {}
 
 NodeState::NodeState(const NodeItem &node_item, SubgraphContext *subgraph_context)
     : node_item_(&node_item), shape_inference_state_(node_item), subgraph_context_(subgraph_context) {
@@ -125,22 +131,43 @@ NodeState::NodeState(const NodeItem &node_item, SubgraphContext *subgraph_contex
 Status NodeState::AwaitInputTensors(GraphExecutionContext &context) const {
   for (auto &src_node : node_item_->dependents_for_execution) {
     GELOGI("[%s] Start to wait for data dependent node: [%s]", node_item_->NodeName().c_str(),
-           src_node->GetName().c_str());
+           src_node->NodeName().c_str());
     RECORD_EXECUTION_EVENT(&context, node_item_->NodeName().c_str(), "[AwaitNodeDone] [%s] Start",
-                           src_node->GetName().c_str());
-    if (!subgraph_context_->Await(src_node)) {
-      GELOGE(INTERNAL_ERROR, "[%s] Await node [%s] failed.", GetName().c_str(), src_node->GetName().c_str());
+                           src_node->NodeName().c_str());
+    if (!subgraph_context_->Await(*src_node)) {
+      GELOGE(INTERNAL_ERROR, "[%s] Await node [%s] failed.", GetName().c_str(), src_node->NodeName().c_str());
       return INTERNAL_ERROR;
     }
 
     RECORD_EXECUTION_EVENT(&context, node_item_->NodeName().c_str(), "[AwaitNodeDone] [%s] End",
-                           src_node->GetName().c_str());
-    GELOGI("[%s] Done waiting node.", src_node->GetName().c_str());
+                           src_node->NodeName().c_str());
+    GELOGI("[%s] Done waiting node.", src_node->NodeName().c_str());
   }
 
   return SUCCESS;
 }
 
+TaskContext *NodeState::GetOrCreateTaskContext(GraphExecutionContext *execution_context) {
+  if (task_context_ == nullptr) {
+    task_context_ = TaskContext::Create(*node_item_, execution_context, subgraph_context_);
+  } else {
+    task_context_->Reset();
+  }
+  return task_context_.get();
+}
+
+void NodeState::Reset() {
+  shape_inference_state_.Reset();
+  frozen_tiling_ = nullptr;
+  prepare_future_ = std::future<Status>();
+}
+
+void NodeState::AwaitPrepareDone() {
+  if (prepare_future_.valid()) {
+    prepare_future_.wait();
+  }
+}
+
 Status NodeState::WaitForPrepareDone() {
   if (prepare_future_.valid()) {
     GELOGD("[%s] Start to wait for prepare future.", GetName().c_str());
@@ -151,15 +178,15 @@ Status NodeState::WaitForPrepareDone() {
 }
 
 Status ShapeFuture::Get(GeShape &ori_shape, GeShape &shape) {
-  GELOGI("Start to wait node: %s for getting shape", src_node_->GetName().c_str());
-  if (!subgraph_context_->Await(src_node_)) {
+  GELOGI("Start to wait node: %s for getting shape", src_node_->NodeName().c_str());
+  if (!subgraph_context_->Await(*src_node_)) {
     GELOGE(INTERNAL_ERROR, "cancelled");
     return INTERNAL_ERROR;
   }
 
-  shape = src_node_->GetOpDesc()->MutableOutputDesc(src_index_)->MutableShape();
-  ori_shape = src_node_->GetOpDesc()->MutableOutputDesc(src_index_)->GetOriginShape();
-  GELOGI("Get shape from %s:%u. shape = [%s]", src_node_->GetName().c_str(), src_index_, shape.ToString().c_str());
+  shape = src_node_->op_desc->MutableOutputDesc(src_index_)->MutableShape();
+  ori_shape = src_node_->op_desc->MutableOutputDesc(src_index_)->GetOriginShape();
+  GELOGI("Get shape from %s:%u. shape = [%s]", src_node_->NodeName().c_str(), src_index_, shape.ToString().c_str());
   return SUCCESS;
 }
 }  // namespace hybrid
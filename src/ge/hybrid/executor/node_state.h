@@ -22,6 +22,7 @@
 #include <mutex>
 #include "external/ge/ge_api_error_codes.h"
 #include "hybrid/model/node_item.h"
+#include "hybrid/node_executor/task_context.h"
 #include "node_done_manager.h"
 
 namespace ge {
@@ -29,15 +30,16 @@ namespace hybrid {
 class NodeTask;
 class GraphExecutionContext;
 class SubgraphContext;
+class TilingSnapshot;
 
 class ShapeFuture {
  public:
-  ShapeFuture(NodePtr src_node, uint32_t src_index, SubgraphContext *subgraph_context);
+  ShapeFuture(const NodeItem *src_node, uint32_t src_index, SubgraphContext *subgraph_context);
   ~ShapeFuture() = default;
   Status Get(GeShape &ori_shape, GeShape &shape);
 
  private:
-  NodePtr src_node_;
+  const NodeItem *src_node_;
   uint32_t src_index_;
   SubgraphContext *subgraph_context_;
 };
@@ -51,6 +53,8 @@ struct ShapeInferenceState {
 
   Status AwaitShapesReady(const GraphExecutionContext &context);
 
+  void Reset();
+
   const NodeItem &node_item;
 
  private:
@@ -80,19 +84,35 @@ struct NodeState {
 
   void SetKernelTask(const shared_ptr<NodeTask> &kernel_task) { kernel_task_ = kernel_task; }
 
+  const TilingSnapshot *GetFrozenTiling() const { return frozen_tiling_; }
+
+  void SetFrozenTiling(const TilingSnapshot *frozen_tiling) { frozen_tiling_ = frozen_tiling; }
+
   Status WaitForPrepareDone();
 
   void SetPrepareFuture(std::future<Status> &&prepare_future) { this->prepare_future_ = std::move(prepare_future); }
 
+  // wait for the prepare task to finish without taking its status
+  void AwaitPrepareDone();
+
   Status AwaitInputTensors(GraphExecutionContext &context) const;
 
+  // task context is created on first execution of the node and reset in place by the following ones
+  TaskContext *GetOrCreateTaskContext(GraphExecutionContext *execution_context);
+
+  // reset state of last execution, keep allocated objects for reuse
+  void Reset();
+
  private:
   const NodeItem *node_item_ = nullptr;
   std::shared_ptr<NodeTask> kernel_task_ = nullptr;
+  // set when the shapes of the node are restored from a shape plan
+  const TilingSnapshot *frozen_tiling_ = nullptr;
   std::future<Status> prepare_future_;
   OpDescPtr op_desc_;
   ShapeInferenceState shape_inference_state_;
   SubgraphContext *subgraph_context_;
+  std::unique_ptr<TaskContext> task_context_;
   std::mutex mu_;
 };
 
@@ -0,0 +1,261 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hybrid/executor/shape_plan_cache.h"
+#include "framework/common/debug/log.h"
+#include "graph/utils/tensor_utils.h"
+
+namespace ge {
+namespace hybrid {
+namespace {
+// signatures seen less than threshold times are forgotten when there are more than this
+constexpr size_t kMaxCountedSignatures = 1024;
+}  // namespace
+
+ShapePlan::ShapePlan(const GraphItem &graph_item) : graph_item_(graph_item), nodes_(graph_item.GetAllNodes().size()) {}
+
+void ShapePlan::FreezeTensorDesc(const GeTensorDesc &tensor_desc, FrozenTensorDesc &frozen_desc) {
+  frozen_desc.shape = tensor_desc.GetShape();
+  frozen_desc.origin_shape = tensor_desc.GetOriginShape();
+  (void)TensorUtils::GetSize(tensor_desc, frozen_desc.size);
+}
+
+void ShapePlan::RestoreTensorDesc(const FrozenTensorDesc &frozen_desc, GeTensorDesc &tensor_desc) {
+  tensor_desc.SetShape(frozen_desc.shape);
+  tensor_desc.SetOriginShape(frozen_desc.origin_shape);
+  TensorUtils::SetSize(tensor_desc, frozen_desc.size);
+}
+
+Status ShapePlan::Freeze(const NodeState &node_state, TaskContext *task_context) {
+  const NodeItem &node_item = *node_state.GetNodeItem();
+  if (!node_item.is_dynamic) {
+    return SUCCESS;
+  }
+  if ((node_item.index_in_graph < 0) || (static_cast<size_t>(node_item.index_in_graph) >= nodes_.size())) {
+    GELOGE(INTERNAL_ERROR, "[%s] Invalid index in graph: %d", node_item.NodeName().c_str(), node_item.index_in_graph);
+    return INTERNAL_ERROR;
+  }
+
+  std::unique_ptr<FrozenNode> frozen_node(new (std::nothrow) FrozenNode());
+  GE_CHECK_NOTNULL(frozen_node);
+  const OpDesc *op_desc = node_item.op_desc;
+  frozen_node->input_desc.resize(op_desc->GetAllInputsSize());
+  for (size_t i = 0; i < frozen_node->input_desc.size(); ++i) {
+    auto input_desc = op_desc->GetInputDescPtr(static_cast<uint32_t>(i));
+    if (input_desc != nullptr) {
+      FreezeTensorDesc(*input_desc, frozen_node->input_desc[i]);
+    }
+  }
+  frozen_node->output_desc.resize(op_desc->GetOutputsSize());
+  for (size_t i = 0; i < frozen_node->output_desc.size(); ++i) {
+    auto output_desc = op_desc->GetOutputDescPtr(static_cast<uint32_t>(i));
+    GE_CHECK_NOTNULL(output_desc);
+    FreezeTensorDesc(*output_desc, frozen_node->output_desc[i]);
+  }
+  frozen_node->workspace_bytes = op_desc->GetWorkspaceBytes();
+
+  if (task_context != nullptr) {
+    frozen_node->kernel_task = node_state.GetKernelTask();
+    GE_CHECK_NOTNULL(frozen_node->kernel_task);
+    // the caller reports the failure and gives up the plan
+    GE_CHK_STATUS_RET_NOLOG(frozen_node->kernel_task->SaveTilingData(*task_context, frozen_node->tiling));
+  }
+
+  nodes_[node_item.index_in_graph] = std::move(frozen_node);
+  GELOGD("[%s] Node frozen into shape plan of graph [%s].", node_item.NodeName().c_str(),
+         graph_item_.GetName().c_str());
+  return SUCCESS;
+}
+
+Status ShapePlan::Restore(NodeState &node_state) const {
+  const NodeItem &node_item = *node_state.GetNodeItem();
+  if (!node_item.is_dynamic) {
+    return SUCCESS;
+  }
+  if ((node_item.index_in_graph < 0) || (static_cast<size_t>(node_item.index_in_graph) >= nodes_.size()) ||
+      (nodes_[node_item.index_in_graph] == nullptr)) {
+    GELOGE(INTERNAL_ERROR, "[%s] Node is not frozen in shape plan.", node_item.NodeName().c_str());
+    return INTERNAL_ERROR;
+  }
+
+  const FrozenNode &frozen_node = *nodes_[node_item.index_in_graph];
+  OpDesc *op_desc = node_item.op_desc;
+  for (size_t i = 0; i < frozen_node.input_desc.size(); ++i) {
+    auto input_desc = op_desc->MutableInputDesc(static_cast<uint32_t>(i));
+    if (input_desc != nullptr) {
+      RestoreTensorDesc(frozen_node.input_desc[i], *input_desc);
+    }
+  }
+  for (size_t i = 0; i < frozen_node.output_desc.size(); ++i) {
+    auto output_desc = op_desc->MutableOutputDesc(static_cast<uint32_t>(i));
+    GE_CHECK_NOTNULL(output_desc);
+    RestoreTensorDesc(frozen_node.output_desc[i], *output_desc);
+  }
+  op_desc->SetWorkspaceBytes(frozen_node.workspace_bytes);
+
+  if (frozen_node.kernel_task != nullptr) {
+    node_state.SetKernelTask(frozen_node.kernel_task);
+  }
+  node_state.SetFrozenTiling(frozen_node.tiling.get());
+  return SUCCESS;
+}
+
+bool ShapePlan::IsComplete() const {
+  if (is_abandoned_) {
+    return false;
+  }
+  for (const auto &node_item : graph_item_.GetAllNodes()) {
+    if (node_item->is_dynamic && (nodes_[node_item->index_in_graph] == nullptr)) {
+      GELOGD("[%s] Node is not frozen in shape plan.", node_item->NodeName().c_str());
+      return false;
+    }
+  }
+  return true;
+}
+
+ShapePlanCache::ShapePlanCache(const GraphItem *graph_item, uint32_t threshold, size_t capacity)
+    : graph_item_(graph_item), threshold_(threshold), capacity_(capacity) {}
+
+ShapePlanCache::~ShapePlanCache() { LogStats(); }
+
+bool ShapePlanCache::IsSupported(const GraphItem &graph_item) {
+  if (!graph_item.IsDynamic()) {
+    return false;
+  }
+  // shapes depending on tensor values or computed by the kernels differ with the same input shapes
+  for (const auto &node_item : graph_item.GetAllNodes()) {
+    if (!node_item->is_dynamic) {
+      continue;
+    }
+    if (node_item->IsControlOp() || (node_item->node_type == PARTITIONEDCALL) ||
+        (node_item->shape_inference_type == DEPEND_SHAPE_RANGE) ||
+        (node_item->shape_inference_type == DEPEND_COMPUTE) || !node_item->dependents_for_shape_inference.empty()) {
+      GELOGI("[%s] Shape plan is not supported by graph [%s] for node of type [%s].", node_item->NodeName().c_str(),
+             graph_item.GetName().c_str(), node_item->NodeType().c_str());
+      return false;
+    }
+  }
+  return true;
+}
+
+Status ShapePlanCache::GetSignature(const std::vector<ConstGeTensorDescPtr> &input_desc, ShapeSignature &signature) {
+  for (const auto &tensor_desc : input_desc) {
+    GE_CHECK_NOTNULL(tensor_desc);
+    for (const GeShape &shape : {tensor_desc->GetShape(), tensor_desc->GetOriginShape()}) {
+      const auto &dims = shape.GetDims();
+      signature.emplace_back(static_cast<int64_t>(dims.size()));
+      signature.insert(signature.end(), dims.begin(), dims.end());
+    }
+  }
+  return SUCCESS;
+}
+
+ShapePlan *ShapePlanCache::Acquire(const std::vector<ConstGeTensorDescPtr> &input_desc, bool &is_recording) {
+  is_recording = false;
+  ShapeSignature signature;
+  if (GetSignature(input_desc, signature) != SUCCESS) {
+    return nullptr;
+  }
+
+  ++lookup_count_;
+  auto iter = plans_.find(signature);
+  if (iter != plans_.end()) {
+    PlanEntry &entry = iter->second;
+    entry.last_used = lookup_count_;
+    if (entry.is_frozen) {
+      ++entry.hit_count;
+      ++hit_count_;
+      return entry.plan.get();
+    }
+    // last recording failed, record again
+    is_recording = true;
+    return entry.plan.get();
+  }
+
+  if (signature_counts_.size() >= kMaxCountedSignatures) {
+    signature_counts_.clear();
+  }
+  auto count_iter = signature_counts_.find(signature);
+  uint32_t count = (count_iter == signature_counts_.end()) ? 1 : count_iter->second + 1;
+  if (count < threshold_) {
+    signature_counts_[signature] = count;
+    return nullptr;
+  }
+  if (count_iter != signature_counts_.end()) {
+    signature_counts_.erase(count_iter);
+  }
+
+  std::unique_ptr<ShapePlan> plan(new (std::nothrow) ShapePlan(*graph_item_));
+  if (plan == nullptr) {
+    GELOGW("[%s] Failed to create shape plan.", graph_item_->GetName().c_str());
+    return nullptr;
+  }
+  EvictPlans();
+  PlanEntry &entry = plans_[signature];
+  entry.plan = std::move(plan);
+  entry.last_used = lookup_count_;
+  is_recording = true;
+  GELOGI("[%s] Start to record shape plan, plan count = %zu.", graph_item_->GetName().c_str(), plans_.size());
+  return entry.plan.get();
+}
+
+void ShapePlanCache::Release(ShapePlan *plan, bool is_recording, Status status) {
+  if ((plan == nullptr) || !is_recording) {
+    return;
+  }
+  for (auto iter = plans_.begin(); iter != plans_.end(); ++iter) {
+    if (iter->second.plan.get() != plan) {
+      continue;
+    }
+    if ((status == SUCCESS) && plan->IsComplete()) {
+      iter->second.is_frozen = true;
+      ++recorded_count_;
+      GELOGI("[%s] Shape plan recorded, plan count = %zu.", graph_item_->GetName().c_str(), plans_.size());
+    } else {
+      GELOGW("[%s] Failed to record shape plan, status = %u.", graph_item_->GetName().c_str(), status);
+      plans_.erase(iter);
+    }
+    return;
+  }
+}
+
+void ShapePlanCache::EvictPlans() {
+  while (!plans_.empty() && (plans_.size() >= capacity_)) {
+    auto lru_iter = plans_.begin();
+    for (auto iter = plans_.begin(); iter != plans_.end(); ++iter) {
+      if (iter->second.last_used < lru_iter->second.last_used) {
+        lru_iter = iter;
+      }
+    }
+    GELOGD("[%s] Evict shape plan with %lu hits.", graph_item_->GetName().c_str(), lru_iter->second.hit_count);
+    plans_.erase(lru_iter);
+    ++evicted_count_;
+  }
+}
+
+void ShapePlanCache::LogStats() const {
+  double hit_rate = (lookup_count_ == 0) ? 0.0 : static_cast<double>(hit_count_) / lookup_count_;
+  GELOGI("[%s] Shape plan stats: lookups = %lu, hits = %lu, hit rate = %.3f, recorded = %lu, evicted = %lu, "
+         "plans = %zu.", graph_item_->GetName().c_str(), lookup_count_, hit_count_, hit_rate, recorded_count_,
+         evicted_count_, plans_.size());
+  for (const auto &signature_and_entry : plans_) {
+    const PlanEntry &entry = signature_and_entry.second;
+    GELOGI("[%s] Shape plan of %zu signature dims: frozen = %d, hits = %lu.", graph_item_->GetName().c_str(),
+           signature_and_entry.first.size(), static_cast<int>(entry.is_frozen), entry.hit_count);
+  }
+}
+}  // namespace hybrid
+}  // namespace ge
@@ -0,0 +1,126 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GE_HYBRID_EXECUTOR_SHAPE_PLAN_CACHE_H_
+#define GE_HYBRID_EXECUTOR_SHAPE_PLAN_CACHE_H_
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <vector>
+#include "external/ge/ge_api_error_codes.h"
+#include "hybrid/executor/node_state.h"
+#include "hybrid/model/graph_item.h"
+#include "hybrid/node_executor/node_executor.h"
+
+namespace ge {
+namespace hybrid {
+// dims of all input shapes of an execution, each shape is led by its dim num
+using ShapeSignature = std::vector<int64_t>;
+
+// Shapes, sizes, kernel tasks and tiling data of the dynamic nodes of a graph, frozen from an execution with one
+// shape signature. An execution with the same signature restores them instead of inferring shapes, calculating running
+// params, compiling tasks and calculating tiling data again.
+class ShapePlan {
+ public:
+  explicit ShapePlan(const GraphItem &graph_item);
+  ~ShapePlan() = default;
+
+  // freeze the node after its task is prepared, task_context is null for the node which has no task
+  Status Freeze(const NodeState &node_state, TaskContext *task_context);
+
+  // restore the frozen node, nothing is done for a static node
+  Status Restore(NodeState &node_state) const;
+
+  // all dynamic nodes are frozen
+  bool IsComplete() const;
+
+  // give up the recording, the plan is never complete then. Nodes are frozen by the prepare and launch threads
+  void Abandon() { is_abandoned_ = true; }
+  bool IsAbandoned() const { return is_abandoned_; }
+
+ private:
+  struct FrozenTensorDesc {
+    GeShape shape;
+    GeShape origin_shape;
+    int64_t size = 0;
+  };
+
+  struct FrozenNode {
+    std::vector<FrozenTensorDesc> input_desc;
+    std::vector<FrozenTensorDesc> output_desc;
+    std::vector<int64_t> workspace_bytes;
+    std::shared_ptr<NodeTask> kernel_task;
+    std::unique_ptr<TilingSnapshot> tiling;
+  };
+
+  static void FreezeTensorDesc(const GeTensorDesc &tensor_desc, FrozenTensorDesc &frozen_desc);
+  static void RestoreTensorDesc(const FrozenTensorDesc &frozen_desc, GeTensorDesc &tensor_desc);
+
+  const GraphItem &graph_item_;
+  // indexed by NodeItem::index_in_graph, null for the node which is not frozen
+  std::vector<std::unique_ptr<FrozenNode>> nodes_;
+  std::atomic<bool> is_abandoned_{false};
+};
+
+// Frozen shape plans of the root graph of a hybrid model. A plan is recorded by the execution which sees its shape
+// signature for the threshold-th time, and the least recently used plans are dropped beyond the capacity.
+// It is used by the executor of the model only, so no lock is taken.
+class ShapePlanCache {
+ public:
+  ShapePlanCache(const GraphItem *graph_item, uint32_t threshold, size_t capacity);
+  ~ShapePlanCache();
+
+  // whether shape plans are able to replace shape inference of the graph
+  static bool IsSupported(const GraphItem &graph_item);
+
+  // get the plan of input shapes, is_recording is set if the plan is to be recorded by this execution
+  ShapePlan *Acquire(const std::vector<ConstGeTensorDescPtr> &input_desc, bool &is_recording);
+
+  // release the plan after the execution, a recording plan is kept only if it is recorded by a successful execution
+  void Release(ShapePlan *plan, bool is_recording, Status status);
+
+  uint64_t GetLookupCount() const { return lookup_count_; }
+  uint64_t GetHitCount() const { return hit_count_; }
+  size_t GetPlanCount() const { return plans_.size(); }
+
+  void LogStats() const;
+
+ private:
+  struct PlanEntry {
+    std::unique_ptr<ShapePlan> plan;
+    bool is_frozen = false;
+    uint64_t last_used = 0;
+    uint64_t hit_count = 0;
+  };
+
+  static Status GetSignature(const std::vector<ConstGeTensorDescPtr> &input_desc, ShapeSignature &signature);
+  void EvictPlans();
+
+  const GraphItem *graph_item_;
+  const uint32_t threshold_;
+  const size_t capacity_;
+  std::map<ShapeSignature, PlanEntry> plans_;
+  // execution count of the signatures which have no plan yet
+  std::map<ShapeSignature, uint32_t> signature_counts_;
+  uint64_t lookup_count_ = 0;
+  uint64_t hit_count_ = 0;
+  uint64_t recorded_count_ = 0;
+  uint64_t evicted_count_ = 0;
+};
+}  // namespace hybrid
+}  // namespace ge
+#endif  // GE_HYBRID_EXECUTOR_SHAPE_PLAN_CACHE_H_
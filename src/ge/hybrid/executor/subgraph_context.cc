@@ -28,6 +28,7 @@ Status SubgraphContext::Init() {
          graph_item_->TotalInputs(), graph_item_->TotalOutputs());
   all_inputs_.resize(static_cast<unsigned long>(graph_item_->TotalInputs()));
   all_outputs_.resize(static_cast<unsigned long>(graph_item_->TotalOutputs()));
+  node_done_manager_.Init(graph_item_->GetAllNodes().size());
 
   return SUCCESS;
 }
@@ -42,6 +43,21 @@ NodeStatePtr SubgraphContext::GetOrCreateNodeState(const NodeItem *node_item) {
   return node_state;
 }
 
+void SubgraphContext::Reset() {
+  AwaitPrepareDone();
+  std::lock_guard<std::mutex> lk(mu_);
+  for (auto &tensor : all_inputs_) {
+    tensor = TensorValue();
+  }
+  for (auto &tensor : all_outputs_) {
+    tensor = TensorValue();
+  }
+  for (auto &node_state : node_states_) {
+    node_state.second->Reset();
+  }
+  node_done_manager_.Reset();
+}
+
 Status SubgraphContext::SetInput(int index, const TensorValue &tensor) {
   if (static_cast<size_t>(index) >= all_inputs_.size()) {
     GELOGE(INTERNAL_ERROR, "output index output range. all input num = %zu, input index = %d", all_inputs_.size(),
@@ -100,13 +116,27 @@ Status SubgraphContext::GetOutputs(std::vector<TensorValue> &outputs) {
   return SUCCESS;
 }
 
-bool SubgraphContext::Await(const NodePtr &node) { return node_done_manager_.Await(node); }
+bool SubgraphContext::Await(const NodeItem &node_item) { return node_done_manager_.Await(node_item.index_in_graph); }
 
 void SubgraphContext::OnError(Status error) {
   GELOGE(error, "[%s] Error occurred while executing graph.", graph_item_->GetName().c_str());
   node_done_manager_.Destroy();
 }
 
-void SubgraphContext::NodeDone(const NodePtr &node) { node_done_manager_.NodeDone(node); }
+void SubgraphContext::AwaitPrepareDone() {
+  // prepare tasks create node states of their successors, wait for them out of the lock
+  std::vector<NodeStatePtr> node_states;
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    for (auto &node_state : node_states_) {
+      node_states.emplace_back(node_state.second);
+    }
+  }
+  for (auto &node_state : node_states) {
+    node_state->AwaitPrepareDone();
+  }
+}
+
+void SubgraphContext::NodeDone(const NodeItem &node_item) { node_done_manager_.NodeDone(node_item.index_in_graph); }
 }  // namespace hybrid
 }  // namespace ge
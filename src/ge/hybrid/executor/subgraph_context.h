@@ -35,16 +35,22 @@ class SubgraphContext {
   Status Init();
   NodeStatePtr GetOrCreateNodeState(const NodeItem *node_item);
 
+  // wait for the prepare tasks of last execution, then clear its tensors and node states for reuse by the next one
+  void Reset();
+
   void OnError(Status error);
 
+  // wait for the prepare tasks still running on the pool, e.g. after an execution failed
+  void AwaitPrepareDone();
+
   Status SetInput(const NodeItem &node_item, int input_index, const TensorValue &tensor);
   Status SetOutput(const NodeItem &node_item, int output_index, const TensorValue &tensor);
   Status SetInput(int index, const TensorValue &tensor);
   Status GetInput(int index, TensorValue &tensor);
   Status GetOutputs(std::vector<TensorValue> &outputs);
 
-  bool Await(const NodePtr &node);
-  void NodeDone(const NodePtr &node);
+  bool Await(const NodeItem &node_item);
+  void NodeDone(const NodeItem &node_item);
 
  private:
   friend class TaskContext;
@@ -29,21 +29,33 @@ constexpr int kDataInputIndex = 0;
 SubgraphExecutor::SubgraphExecutor(const GraphItem *graph_item, GraphExecutionContext *context, bool force_infer_shape)
     : graph_item_(graph_item),
       context_(context),
-      force_infer_shape_(force_infer_shape),
-      pre_run_pool_(kDefaultThreadNum) {}
+      force_infer_shape_(force_infer_shape) {
+  // known shape subgraph launches its only node directly, no shape inference runs ahead of it
+  if (graph_item_->IsDynamic()) {
+    pre_run_pool_.reset(new (std::nothrow) ThreadPool(kDefaultThreadNum));
+  }
+}
 
 SubgraphExecutor::~SubgraphExecutor() { GELOGD("[%s] SubgraphExecutor destroyed.", graph_item_->GetName().c_str()); }
 
 Status SubgraphExecutor::Init(const std::vector<TensorValue> &inputs,
                               const std::vector<ConstGeTensorDescPtr> &input_desc) {
-  subgraph_context_.reset(new (std::nothrow) SubgraphContext(graph_item_));
-  GE_CHECK_NOTNULL(subgraph_context_);
-  GE_CHK_STATUS_RET(subgraph_context_->Init(), "[%s] Failed to init subgraph context.", graph_item_->GetName().c_str());
-
-  shape_inference_engine_.reset(new (std::nothrow) ShapeInferenceEngine(context_, subgraph_context_.get()));
-  GE_CHECK_NOTNULL(shape_inference_engine_);
+  if (subgraph_context_ == nullptr) {
+    subgraph_context_.reset(new (std::nothrow) SubgraphContext(graph_item_));
+    GE_CHECK_NOTNULL(subgraph_context_);
+    GE_CHK_STATUS_RET(subgraph_context_->Init(), "[%s] Failed to init subgraph context.",
+                      graph_item_->GetName().c_str());
+  } else {
+    // executed before, reuse the context and node states of last execution
+    subgraph_context_->Reset();
+  }
 
   if (graph_item_->IsDynamic()) {
+    GE_CHECK_NOTNULL(pre_run_pool_);
+    if (shape_inference_engine_ == nullptr) {
+      shape_inference_engine_.reset(new (std::nothrow) ShapeInferenceEngine(context_, subgraph_context_.get()));
+      GE_CHECK_NOTNULL(shape_inference_engine_);
+    }
     GE_CHK_STATUS_RET(InitInputsForUnknownShape(inputs, input_desc), "[%s] Failed to set inputs.",
                       graph_item_->GetName().c_str());
   } else {
@@ -142,12 +154,13 @@ Status SubgraphExecutor::ExecuteAsyncForKnownShape(const std::vector<TensorValue
   GE_CHECK_NOTNULL(node_state);
   node_state->SetKernelTask(node_item->kernel_task);
 
-  known_shape_task_context_ = TaskContext::Create(*node_item, context_, subgraph_context_.get());
-  GE_CHECK_NOTNULL(known_shape_task_context_);
+  auto task_context = node_state->GetOrCreateTaskContext(context_);
+  GE_CHECK_NOTNULL(task_context);
 
-  GE_CHK_STATUS_RET(ExecutionEngine::ExecuteAsync(*node_state, known_shape_task_context_, *context_),
+  // outputs are the ones of subgraph, hold them until next execution
+  GE_CHK_STATUS_RET(ExecutionEngine::ExecuteAsync(*node_state, *task_context, *context_, false),
                     "[%s] Failed to execute node [%s] for known subgraph.", graph_item_->GetName().c_str(),
-                    known_shape_task_context_->GetNodeName());
+                    task_context->GetNodeName());
 
   GELOGD("[%s] Done execute non-dynamic subgraph successfully.", graph_item_->GetName().c_str());
   return SUCCESS;
@@ -189,17 +202,26 @@ Status SubgraphExecutor::PrepareNodes() {
     GE_CHECK_NOTNULL(node_state);
     auto p_node_state = node_state.get();
 
+    bool is_restoring_plan = (shape_plan_ != nullptr) && !is_recording_plan_;
     if (node_item.node_type == NETOUTPUT) {
       // Wait for all inputs become valid
       // after PrepareNodes returned. all output tensors and shapes are valid
-      GE_CHK_STATUS_RET_NOLOG(p_node_state->GetShapeInferenceState().AwaitShapesReady(*context_));
+      if (is_restoring_plan) {
+        GE_CHK_STATUS_RET_NOLOG(shape_plan_->Restore(*p_node_state));
+      } else {
+        GE_CHK_STATUS_RET_NOLOG(p_node_state->GetShapeInferenceState().AwaitShapesReady(*context_));
+        FreezeNode(*p_node_state, nullptr);
+      }
       GE_CHK_STATUS_RET_NOLOG(p_node_state->AwaitInputTensors(*context_));
       continue;
     }
 
     // only do shape inference and compilation for nodes with dynamic shapes.
-    if (node_item.is_dynamic) {
-      auto prepare_future = pre_run_pool_.commit([this, p_node_state]() -> Status {
+    if (node_item.is_dynamic && is_restoring_plan) {
+      GE_CHK_STATUS_RET(shape_plan_->Restore(*p_node_state), "[%s] Failed to restore shape plan.",
+                        node_item.NodeName().c_str());
+    } else if (node_item.is_dynamic) {
+      auto prepare_future = pre_run_pool_->commit([this, p_node_state]() -> Status {
         GE_CHK_STATUS_RET_NOLOG(InferShape(shape_inference_engine_.get(), *p_node_state));
         return PrepareForExecution(context_, *p_node_state);
       });
@@ -271,12 +293,13 @@ Status SubgraphExecutor::LaunchTasks() {
     GE_CHK_STATUS_RET_NOLOG(node_state->WaitForPrepareDone());
 
     GELOGD("[%s] Start to execute.", node_state->GetName().c_str());
-    auto task_context = TaskContext::Create(*node_state->GetNodeItem(), context_, subgraph_context_.get());
+    auto task_context = node_state->GetOrCreateTaskContext(context_);
     GE_CHECK_NOTNULL(task_context);
     task_context->SetForceInferShape(force_infer_shape_);
-    auto shared_task_context = std::shared_ptr<TaskContext>(task_context.release());
-    GE_CHK_STATUS_RET(ExecutionEngine::ExecuteAsync(*node_state, shared_task_context, *context_),
+    task_context->SetFrozenTiling(node_state->GetFrozenTiling());
+    GE_CHK_STATUS_RET(ExecutionEngine::ExecuteAsync(*node_state, *task_context, *context_),
                       "[%s] Execute node failed.", node_state->GetName().c_str());
+    FreezeNode(*node_state, task_context);
 
     GELOGD("[%s] Done executing node successfully.", node_state->GetName().c_str());
   }
@@ -284,6 +307,9 @@ Status SubgraphExecutor::LaunchTasks() {
 
 Status SubgraphExecutor::ScheduleTasks() {
   GELOGD("[%s] Start to schedule prepare workers.", graph_item_->GetName().c_str());
+  // queue is stopped if last execution failed
+  ready_queue_.Clear();
+  ready_queue_.Restart();
   auto prepare_future = std::async([&]() -> Status {
     auto ret = PrepareNodes();
     ready_queue_.Push(nullptr);
@@ -298,6 +324,9 @@ Status SubgraphExecutor::ScheduleTasks() {
     context_->SetErrorCode(ret);
     ready_queue_.Stop();
     prepare_future.wait();
+    // the node states and the shape inference engine are used by the prepare tasks, which quit once the nodes
+    // done manager is destroyed
+    subgraph_context_->AwaitPrepareDone();
     return ret;
   }
 
@@ -307,6 +336,24 @@ Status SubgraphExecutor::ScheduleTasks() {
   return SUCCESS;
 }
 
+void SubgraphExecutor::FreezeNode(const NodeState &node_state, TaskContext *task_context) {
+  if (!is_recording_plan_ || shape_plan_->IsAbandoned()) {
+    return;
+  }
+  // the plan only saves work of later executions, this one goes on without it
+  auto ret = shape_plan_->Freeze(node_state, task_context);
+  if (ret != SUCCESS) {
+    GELOGW("[%s] Failed to freeze node into shape plan, ret = %u, recording of the plan is abandoned.",
+           node_state.GetName().c_str(), ret);
+    shape_plan_->Abandon();
+  }
+}
+
+void SubgraphExecutor::SetShapePlan(ShapePlan *shape_plan, bool is_recording) {
+  shape_plan_ = shape_plan;
+  is_recording_plan_ = (shape_plan != nullptr) && is_recording;
+}
+
 Status SubgraphExecutor::GetOutputs(vector<TensorValue> &outputs) { return subgraph_context_->GetOutputs(outputs); }
 
 Status SubgraphExecutor::GetOutputs(vector<TensorValue> &outputs, std::vector<ConstGeTensorDescPtr> &output_desc) {
@@ -24,6 +24,7 @@
 #include "hybrid/executor/subgraph_context.h"
 #include "hybrid/executor/node_state.h"
 #include "hybrid/executor/hybrid_execution_context.h"
+#include "hybrid/executor/shape_plan_cache.h"
 #include "hybrid/executor/worker/shape_inference_engine.h"
 #include "hybrid/model/graph_item.h"
 #include "hybrid/node_executor/task_context.h"
@@ -74,6 +75,13 @@ class SubgraphExecutor {
    */
   Status GetOutputs(std::vector<TensorValue> &outputs, std::vector<ConstGeTensorDescPtr> &output_desc);
 
+  /**
+   * Set shape plan of the following executions
+   * @param shape_plan      plan restored instead of shape inference, or recorded if is_recording, null if no plan
+   * @param is_recording    whether the plan is recorded by the executions
+   */
+  void SetShapePlan(ShapePlan *shape_plan, bool is_recording);
+
  private:
   static Status PrepareForExecution(GraphExecutionContext *ctx, NodeState &node_state);
   static Status InferShape(ShapeInferenceEngine *shape_inference_engine, NodeState &node_state);
@@ -86,15 +94,18 @@ class SubgraphExecutor {
   Status PrepareNodes();
   Status LaunchTasks();
   Status SetOutputsToParentNode(TaskContext &task_context);
+  void FreezeNode(const NodeState &node_state, TaskContext *task_context);
 
   const GraphItem *graph_item_;
   GraphExecutionContext *context_;
   std::unique_ptr<SubgraphContext> subgraph_context_;
   bool force_infer_shape_;
-  ThreadPool pre_run_pool_;
+  // created for dynamic subgraph only
+  std::unique_ptr<ThreadPool> pre_run_pool_;
   BlockingQueue<NodeState *> ready_queue_;
   std::unique_ptr<ShapeInferenceEngine> shape_inference_engine_;
-  std::shared_ptr<TaskContext> known_shape_task_context_;
+  ShapePlan *shape_plan_ = nullptr;
+  bool is_recording_plan_ = false;
 };
 }  // namespace hybrid
 }  // namespace ge
@@ -27,6 +27,7 @@ namespace ge {
 namespace hybrid {
 namespace {
 constexpr int64_t kMaxPadding = 63;
+constexpr int kTaskContextUsers = 2;
 
 Status LogInputs(const NodeItem &node_item, const TaskContext &task_context) {
   for (auto i = 0; i < task_context.NumInputs(); ++i) {
@@ -56,7 +57,7 @@ Status LogOutputs(const NodeItem &node_item, const TaskContext &task_context) {
 }  // namespace
 class NodeDoneCallback {
  public:
-  NodeDoneCallback(GraphExecutionContext *graph_context, std::shared_ptr<TaskContext> task_context);
+  NodeDoneCallback(GraphExecutionContext *graph_context, TaskContext *task_context);
   ~NodeDoneCallback() = default;
   Status OnNodeDone();
 
@@ -64,12 +65,11 @@ class NodeDoneCallback {
   Status PrepareConstInputs(const NodeItem &node_item);
   Status DumpDynamicNode();
   GraphExecutionContext *graph_context_;
-  std::shared_ptr<TaskContext> context_;
-  DumpOp dump_op_;
+  TaskContext *context_;
 };
 
-NodeDoneCallback::NodeDoneCallback(GraphExecutionContext *graph_context, std::shared_ptr<TaskContext> task_context)
-    : graph_context_(graph_context), context_(std::move(task_context)) {}
+NodeDoneCallback::NodeDoneCallback(GraphExecutionContext *graph_context, TaskContext *task_context)
+    : graph_context_(graph_context), context_(task_context) {}
 
 Status NodeDoneCallback::PrepareConstInputs(const NodeItem &node_item) {
   for (auto output_idx : node_item.to_const_output_id_list) {
@@ -128,6 +128,8 @@ Status NodeDoneCallback::DumpDynamicNode() {
   auto stream = context_->GetStream();
   vector<uintptr_t> input_addrs;
   vector<uintptr_t> output_addrs;
+  // dump op is synchronized before return
+  DumpOp dump_op;
   for (int i = 0; i < context_->NumInputs(); i++) {
     auto tensor_value = context_->GetInput(i);
     GE_CHK_BOOL_RET_STATUS(tensor_value != nullptr, PARAM_INVALID, "Tensor value is nullptr");
@@ -141,14 +143,14 @@ Status NodeDoneCallback::DumpDynamicNode() {
     output_addrs.emplace_back(output_addr);
   }
 
-  dump_op_.SetDumpInfo(context_->GetDumpProperties(), op_desc, input_addrs, output_addrs, stream);
+  dump_op.SetDumpInfo(context_->GetDumpProperties(), op_desc, input_addrs, output_addrs, stream);
 
   GE_CHECK_NOTNULL(graph_context_);
   const HybridModel *model = graph_context_->model;
   GE_CHECK_NOTNULL(model);
   std::string dynamic_model_name = model->GetModelName();
   uint32_t model_id = model->GetModelId();
-  dump_op_.SetDynamicModelInfo(dynamic_model_name, model_id);
+  dump_op.SetDynamicModelInfo(dynamic_model_name, model_id);
 
   void *global_step = nullptr;
   TensorValue *varible_global_step = context_->GetVariable(NODE_NAME_GLOBAL_STEP);
@@ -167,9 +169,9 @@ Status NodeDoneCallback::DumpDynamicNode() {
   if (varible_loop_cond != nullptr) {
     loop_cond = const_cast<void *>(varible_loop_cond->GetData());
   }
-  dump_op_.SetLoopAddr(global_step, loop_per_iter, loop_cond);
+  dump_op.SetLoopAddr(global_step, loop_per_iter, loop_cond);
 
-  GE_CHK_STATUS_RET(dump_op_.LaunchDumpOp(), "Failed to launch dump op in hybird model");
+  GE_CHK_STATUS_RET(dump_op.LaunchDumpOp(), "Failed to launch dump op in hybird model");
 
   auto rt_ret = rtStreamSynchronize(stream);
   if (rt_ret != RT_ERROR_NONE) {
@@ -219,22 +221,43 @@ Status NodeDoneCallback::OnNodeDone() {
   return SUCCESS;
 }
 
-Status ExecutionEngine::ExecuteAsync(NodeState &node_state, const std::shared_ptr<TaskContext> &task_context,
-                                     GraphExecutionContext &execution_context) {
-  GELOGI("[%s] Node is ready for execution", task_context->GetNodeName());
-  RECORD_EXECUTION_EVENT(&execution_context, task_context->GetNodeName(), "Start");
-  auto cb = std::shared_ptr<NodeDoneCallback>(new (std::nothrow) NodeDoneCallback(&execution_context, task_context));
-  GE_CHECK_NOTNULL(cb);
-  auto callback = [&, cb]() {
-    auto ret = cb->OnNodeDone();
+Status ExecutionEngine::ExecuteAsync(NodeState &node_state, TaskContext &task_context,
+                                     GraphExecutionContext &execution_context, bool release_on_done) {
+  GELOGI("[%s] Node is ready for execution", task_context.GetNodeName());
+  RECORD_EXECUTION_EVENT(&execution_context, task_context.GetNodeName(), "Start");
+  // the callback and this thread both use the outputs, whichever finishes last releases them
+  if (release_on_done) {
+    task_context.SetRefCount(kTaskContextUsers);
+  }
+  // captures two words only, so that std::function keeps it without heap allocation
+  TaskContext *p_task_context = &task_context;
+  auto callback = [p_task_context, release_on_done]() {
+    auto graph_context = const_cast<GraphExecutionContext *>(p_task_context->GetExecutionContext());
+    NodeDoneCallback cb(graph_context, p_task_context);
+    auto ret = cb.OnNodeDone();
     if (ret != SUCCESS) {
-      task_context->OnError(ret);
+      p_task_context->OnError(ret);
+    }
+    if (release_on_done) {
+      p_task_context->Unref();
     }
   };
 
-  GE_CHK_STATUS_RET_NOLOG(DoExecuteAsync(node_state, *task_context, execution_context, callback));
-  GE_CHK_STATUS_RET_NOLOG(PropagateOutputs(*node_state.GetNodeItem(), *task_context, execution_context));
-  return SUCCESS;
+  auto ret = DoExecuteAsync(node_state, task_context, execution_context, callback);
+  if (ret != SUCCESS) {
+    // the callback is never invoked once the launch failed, drop its reference together with the one of this thread
+    if (release_on_done) {
+      task_context.Unref();
+      task_context.Unref();
+    }
+    return ret;
+  }
+
+  ret = PropagateOutputs(*node_state.GetNodeItem(), task_context, execution_context);
+  if (release_on_done) {
+    task_context.Unref();
+  }
+  return ret;
 }
 
 Status ExecutionEngine::DoExecuteAsync(NodeState &node_state, TaskContext &task_context, GraphExecutionContext &context,
@@ -24,8 +24,13 @@ namespace ge {
 namespace hybrid {
 class ExecutionEngine {
  public:
-  static Status ExecuteAsync(NodeState &node_state, const std::shared_ptr<TaskContext> &task_context,
-                             GraphExecutionContext &execution_context);
+  /**
+   * Launch the node, task_context is owned by node_state and must outlive the callback of the node
+   * @param release_on_done   release outputs and workspaces of task_context once the node is done, otherwise they
+   *                          are held until task_context is reset
+   */
+  static Status ExecuteAsync(NodeState &node_state, TaskContext &task_context, GraphExecutionContext &execution_context,
+                             bool release_on_done = true);
 
  private:
   static Status ValidateInputTensors(const NodeState &node_state, const TaskContext &task_context);
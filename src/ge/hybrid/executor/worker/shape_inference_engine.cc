@@ -82,17 +82,18 @@ Status ShapeInferenceEngine::InferShape(NodeState &node_state) {
 Status ShapeInferenceEngine::AwaitDependentNodes(NodeState &node_state) {
   auto &node_item = *node_state.GetNodeItem();
   for (auto &src_node : node_item.dependents_for_shape_inference) {
-    GELOGI("[%s] Start to wait for data dependent node: %s", node_item.NodeName().c_str(), src_node->GetName().c_str());
+    GELOGI("[%s] Start to wait for data dependent node: %s", node_item.NodeName().c_str(),
+           src_node->NodeName().c_str());
     RECORD_SHAPE_INFERENCE_EVENT(execution_context_, node_item.NodeName().c_str(), "[AwaitNodeDone] [%s] Start",
-                                 src_node->GetName().c_str());
-    if (!subgraph_context_->Await(src_node)) {
-      GELOGE(INTERNAL_ERROR, "[%s] Await node failed.", src_node->GetName().c_str());
+                                 src_node->NodeName().c_str());
+    if (!subgraph_context_->Await(*src_node)) {
+      GELOGE(INTERNAL_ERROR, "[%s] Await node failed.", src_node->NodeName().c_str());
       return INTERNAL_ERROR;
     }
 
     RECORD_SHAPE_INFERENCE_EVENT(execution_context_, node_item.NodeName().c_str(), "[AwaitNodeDone] [%s] End",
-                                 src_node->GetName().c_str());
-    GELOGI("[%s] Done waiting node.", src_node->GetName().c_str());
+                                 src_node->NodeName().c_str());
+    GELOGI("[%s] Done waiting node.", src_node->NodeName().c_str());
   }
 
   return SUCCESS;
@@ -127,7 +128,7 @@ Status ShapeInferenceEngine::PropagateOutputShapes(const NodeItem &node_item) {
 
       // in case type 3 and 4, shape will be valid after computing is done
       if (shape_is_future) {
-        ShapeFuture future(node_item.node, i, subgraph_context_);
+        ShapeFuture future(&node_item, i, subgraph_context_);
         dst_node_state->GetShapeInferenceState().UpdateInputShapeFuture(dst_input_index_and_node.first,
                                                                         std::move(future));
       } else {
@@ -39,6 +39,11 @@ class HybridDavinciModel::Impl {
     return executor_.Execute(inputs, outputs);
   }
 
+  Status Execute(const std::vector<DataBuffer> &inputs, const std::vector<GeTensorDesc> &input_desc,
+                 std::vector<DataBuffer> &outputs, std::vector<GeTensorDesc> &output_desc, bool is_device_memory) {
+    return executor_.Execute(inputs, input_desc, outputs, output_desc, is_device_memory);
+  }
+
   Status ModelRunStart() { return executor_.Start(listener_); }
 
   Status ModelRunStop() { return executor_.Stop(); }
@@ -87,6 +92,13 @@ Status HybridDavinciModel::Execute(const vector<GeTensor> &inputs, vector<GeTens
   return impl_->Execute(inputs, outputs);
 }
 
+Status HybridDavinciModel::Execute(const std::vector<DataBuffer> &inputs, const std::vector<GeTensorDesc> &input_desc,
+                                   std::vector<DataBuffer> &outputs, std::vector<GeTensorDesc> &output_desc,
+                                   bool is_device_memory) {
+  GE_CHECK_NOTNULL(impl_);
+  return impl_->Execute(inputs, input_desc, outputs, output_desc, is_device_memory);
+}
+
 Status HybridDavinciModel::ModelRunStart() {
   GE_CHECK_NOTNULL(impl_);
   return impl_->ModelRunStart();
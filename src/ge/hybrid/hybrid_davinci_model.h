@@ -39,6 +39,9 @@ class HybridDavinciModel {
 
   Status Execute(const vector<GeTensor> &inputs, vector<GeTensor> &outputs);
 
+  Status Execute(const std::vector<DataBuffer> &inputs, const std::vector<GeTensorDesc> &input_desc,
+                 std::vector<DataBuffer> &outputs, std::vector<GeTensorDesc> &output_desc, bool is_device_memory);
+
   Status ModelRunStart();
 
   Status ModelRunStop();
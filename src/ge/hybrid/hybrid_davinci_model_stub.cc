@@ -28,6 +28,12 @@ Status HybridDavinciModel::Init() { return UNSUPPORTED; }
 
 Status HybridDavinciModel::Execute(const vector<GeTensor> &inputs, vector<GeTensor> &outputs) { return UNSUPPORTED; }
 
+Status HybridDavinciModel::Execute(const std::vector<DataBuffer> &inputs, const std::vector<GeTensorDesc> &input_desc,
+                                   std::vector<DataBuffer> &outputs, std::vector<GeTensorDesc> &output_desc,
+                                   bool is_device_memory) {
+  return UNSUPPORTED;
+}
+
 Status HybridDavinciModel::ModelRunStart() { return UNSUPPORTED; }
 
 Status HybridDavinciModel::ModelRunStop() { return UNSUPPORTED; }
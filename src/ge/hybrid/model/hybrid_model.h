@@ -20,6 +20,7 @@
 #include <vector>
 #include <queue>
 #include <memory>
+#include <unordered_map>
 #include "framework/common/ge_inner_error_codes.h"
 #include "graph/load/new_model_manager/data_inputer.h"
 #include "graph/load/new_model_manager/task_info/task_info.h"
@@ -80,7 +81,7 @@ class HybridModel {
   std::map<uint32_t, NodeItem *> input_nodes_;
   std::map<std::string, NodePtr> constant_op_nodes_;
   std::map<std::string, NodePtr> variable_nodes_;
-  std::map<std::string, std::unique_ptr<TensorValue>> variable_tensors_;
+  std::unordered_map<std::string, std::unique_ptr<TensorValue>> variable_tensors_;
   std::map<NodePtr, std::vector<domi::TaskDef>> task_defs_;
   std::map<NodePtr, GeModelPtr> known_shape_sub_models_;
 
@@ -77,6 +77,7 @@ Status HybridModelBuilder::Build() {
   GE_CHK_STATUS_RET(InitWeights(), "[%s] Failed to init weights", GetGraphName());
   GE_CHK_STATUS_RET(InitConstantOps(), "[%s] Failed to init constant op", GetGraphName());
   GE_CHK_STATUS_RET(InitVariableTensors(), "[%s] Failed to init variables", GetGraphName());
+  GE_CHK_STATUS_RET(ResolveRefOutputTensors(), "[%s] Failed to resolve ref outputs", GetGraphName());
   GE_CHK_STATUS_RET(LoadTasks(), "[%s] Failed to load tasks", GetGraphName());
   GELOGI("[%s] Done building hybrid model successfully.", GetGraphName());
   return SUCCESS;
@@ -199,7 +200,7 @@ Status HybridModelBuilder::ParseDependentInputNodes(NodeItem &node_item, const s
              node_item.NodeName().c_str(), src_node_item->NodeName().c_str());
 
       src_node_item->has_observer = true;
-      node_item.dependents_for_execution.emplace_back(src_node);
+      node_item.dependents_for_execution.emplace_back(src_node_item);
     }
 
     if (src_node_item->shape_inference_type == DEPEND_SHAPE_RANGE) {
@@ -221,7 +222,7 @@ Status HybridModelBuilder::ParseDependentInputNodes(NodeItem &node_item, const s
     auto src_node_item = MutableNodeItem(src_node);
     GE_CHECK_NOTNULL(src_node_item);
     src_node_item->has_observer = true;
-    node_item.dependents_for_execution.emplace_back(src_node);
+    node_item.dependents_for_execution.emplace_back(src_node_item);
     GELOGD("[%s] Dependent added from %s for control op's cond/branch", node_item.NodeName().c_str(),
            src_node_item->NodeName().c_str());
   }
@@ -250,7 +251,9 @@ Status HybridModelBuilder::ParseDependentInputNodes(NodeItem &node_item, const s
   }
 
   for (const auto &dep_node : dependent_input_nodes) {
-    node_item.dependents_for_shape_inference.emplace_back(dep_node);
+    auto dep_node_item = MutableNodeItem(dep_node);
+    GE_CHECK_NOTNULL(dep_node_item);
+    node_item.dependents_for_shape_inference.emplace_back(dep_node_item);
   }
 
   return SUCCESS;
@@ -720,6 +723,26 @@ Status HybridModelBuilder::InitVariableTensors() {
   return SUCCESS;
 }
 
+Status HybridModelBuilder::ResolveRefOutputTensors() {
+  // variable tensors are looked up by name once here, instead of every time the outputs are allocated
+  for (auto &it : hybrid_model_.node_items_) {
+    auto &node_item = it.second;
+    if (node_item->ref_outputs.empty()) {
+      continue;
+    }
+    node_item->ref_output_tensors.resize(node_item->num_outputs, nullptr);
+    for (auto &ref_output : node_item->ref_outputs) {
+      if ((ref_output.first < 0) || (ref_output.first >= node_item->num_outputs)) {
+        GELOGE(INTERNAL_ERROR, "[%s] Ref output index %d out of range [0, %d)", node_item->NodeName().c_str(),
+               ref_output.first, node_item->num_outputs);
+        return INTERNAL_ERROR;
+      }
+      node_item->ref_output_tensors[ref_output.first] = hybrid_model_.GetVariable(ref_output.second->GetName());
+    }
+  }
+  return SUCCESS;
+}
+
 Status HybridModelBuilder::InitWeights() {
   // Train do not have weight. (only got ConstOp)
   return SUCCESS;
@@ -1152,6 +1175,7 @@ Status HybridModelBuilder::LoadKnownShapedSubgraph(ComputeGraph &graph, NodeItem
   node_item->input_start = 0;
   node_item->output_start = 0;
   node_item->outputs.resize(node_item->num_outputs);
+  node_item->index_in_graph = static_cast<int>(graph_item->node_items_.size());
   graph_item->node_items_.emplace_back(node_item);
   graph_item->output_node_ = node_item;
   graph_item->total_inputs_ = node_item->num_inputs;
@@ -1200,6 +1224,7 @@ Status HybridModelBuilder::LoadDynamicSubgraph(ComputeGraph &graph, bool is_root
       GE_CHK_STATUS_RET_NOLOG(BuildOutputMapping(*graph_item, *node_item, is_root_graph));
     }
 
+    node_item->index_in_graph = static_cast<int>(graph_item->node_items_.size());
     graph_item->node_items_.emplace_back(node_item);
     // parse var outputs
     GE_CHK_STATUS_RET_NOLOG(ParseVarOutputs(*node_item));
@@ -70,6 +70,7 @@ class HybridModelBuilder {
   Status AssignUninitializedConstantOps();
   Status InitConstantOps();
   Status InitVariableTensors();
+  Status ResolveRefOutputTensors();
   Status LoadDynamicSubgraph(ComputeGraph &graph, bool is_root_graph);
   Status ParseVarOutputs(NodeItem &node_item);
   Status LoadKnownShapedSubgraph(ComputeGraph &graph, NodeItem *parent_node_item);
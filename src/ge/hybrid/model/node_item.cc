@@ -160,7 +160,7 @@ std::string NodeItem::DebugString() const {
   ss << ", num_outputs = " << num_outputs;
   ss << ", dependent_nodes = [";
   for (const auto &dep_node : dependents_for_shape_inference) {
-    ss << dep_node->GetName() << ", ";
+    ss << dep_node->NodeName() << ", ";
   }
   ss << "]";
   int index = 0;
@@ -56,6 +56,8 @@ struct NodeItem {
   NodePtr node;
   OpDesc *op_desc;
   int node_id;
+  // index in the graph item which the node belongs to, indexing per graph execution states
+  int index_in_graph = -1;
   int num_inputs;
   int num_outputs;
 
@@ -66,8 +68,8 @@ struct NodeItem {
   UnknowShapeOpType shape_inference_type = DEPEND_IN_SHAPE;
   std::string node_name;
   std::string node_type;
-  std::vector<ge::NodePtr> dependents_for_shape_inference;
-  std::vector<ge::NodePtr> dependents_for_execution;
+  std::vector<const NodeItem *> dependents_for_shape_inference;
+  std::vector<const NodeItem *> dependents_for_execution;
   std::set<int> to_const_output_id_list;
 
   vector<NodeItem *> inputs;
@@ -78,6 +80,8 @@ struct NodeItem {
   std::unique_ptr<FusedSubgraph> fused_subgraph;
   const NodeExecutor *node_executor = nullptr;
   std::map<int, ge::NodePtr> ref_outputs;
+  // tensors of the ref outputs indexed by output, resolved once variables are initialized
+  std::vector<TensorValue *> ref_output_tensors;
   std::map<int, int> reuse_inputs;
 
   std::vector<bool> is_input_shape_static;
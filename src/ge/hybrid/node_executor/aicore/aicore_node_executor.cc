@@ -23,6 +23,13 @@
 namespace ge {
 namespace hybrid {
 REGISTER_NODE_EXECUTOR_BUILDER(NodeExecutorManager::ExecutorType::AICORE, AiCoreNodeExecutor);
+namespace {
+// frozen tiling of each op task of the node task
+class AiCoreTilingSnapshot : public TilingSnapshot {
+ public:
+  std::vector<FrozenTilingInfo> tiling_infos;
+};
+}  // namespace
 
 AiCoreNodeTask::AiCoreNodeTask(std::vector<std::unique_ptr<AiCoreOpTask>> &&tasks) : tasks_(std::move(tasks)) {}
 
@@ -196,6 +203,31 @@ Status AiCoreNodeTask::UpdateTilingData(TaskContext &context) {
   return SUCCESS;
 }
 
+Status AiCoreNodeTask::SaveTilingData(TaskContext &context, std::unique_ptr<TilingSnapshot> &snapshot) {
+  std::unique_ptr<AiCoreTilingSnapshot> aicore_snapshot(new (std::nothrow) AiCoreTilingSnapshot());
+  GE_CHECK_NOTNULL(aicore_snapshot);
+  aicore_snapshot->tiling_infos.resize(tasks_.size());
+  for (size_t i = 0; i < tasks_.size(); ++i) {
+    GE_CHK_STATUS_RET(tasks_[i]->FreezeTilingInfo(aicore_snapshot->tiling_infos[i]), "[%s] Failed to freeze tiling.",
+                      context.GetNodeName());
+  }
+  snapshot = std::move(aicore_snapshot);
+  return SUCCESS;
+}
+
+Status AiCoreNodeTask::RestoreTilingData(TaskContext &context, const TilingSnapshot &snapshot) {
+  const auto *aicore_snapshot = dynamic_cast<const AiCoreTilingSnapshot *>(&snapshot);
+  if ((aicore_snapshot == nullptr) || (aicore_snapshot->tiling_infos.size() != tasks_.size())) {
+    GELOGE(INTERNAL_ERROR, "[%s] Frozen tiling mismatches the tasks.", context.GetNodeName());
+    return INTERNAL_ERROR;
+  }
+  for (size_t i = 0; i < tasks_.size(); ++i) {
+    tasks_[i]->RestoreTilingInfo(aicore_snapshot->tiling_infos[i]);
+  }
+  GELOGD("[%s] Done restoring frozen tiling.", context.GetNodeName());
+  return SUCCESS;
+}
+
 bool AiCoreNodeTask::IsSupportDynamicShape() {
   for (size_t i = 0; i < tasks_.size(); ++i) {
     if (!tasks_[i]->IsDynamicShapeSupported()) {
@@ -49,6 +49,8 @@ class AiCoreNodeTask : public NodeTask {
   ~AiCoreNodeTask() override = default;
   bool IsSupportDynamicShape() override;
   Status UpdateTilingData(TaskContext &context) override;
+  Status SaveTilingData(TaskContext &context, std::unique_ptr<TilingSnapshot> &snapshot) override;
+  Status RestoreTilingData(TaskContext &context, const TilingSnapshot &snapshot) override;
 
   Status UpdateArgs(TaskContext &context) override;
   Status ExecuteAsync(TaskContext &context, std::function<void()> done_callback) override;
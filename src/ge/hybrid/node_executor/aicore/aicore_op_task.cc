@@ -138,11 +138,36 @@ Status AiCoreOpTask::UpdateTilingInfo(TaskContext &context) {
   GE_CHK_RT_RET(rtMemcpy(tiling_buffer_->GetData(), tiling_buffer_->GetSize(), tiling_data_.c_str(),
                          tiling_data_.size(), RT_MEMCPY_HOST_TO_DEVICE));
   RECORD_EXECUTION_EVENT(execution_context, context.GetNodeName(), "[CopyTilingInfo] End");
+  tiling_addr_ = tiling_buffer_->GetData();
 
   GELOGD("[%s] Done updating tiling info for task: [%s]", node->GetName().c_str(), stub_name_.c_str());
   return SUCCESS;
 }
 
+Status AiCoreOpTask::FreezeTilingInfo(FrozenTilingInfo &tiling_info) const {
+  tiling_info.block_dim = block_dim_;
+  if (tiling_buffer_ == nullptr) {
+    return SUCCESS;
+  }
+
+  GE_CHK_BOOL_RET_STATUS(!tiling_data_.empty(), INTERNAL_ERROR, "[%s] Tiling data is not updated.", stub_name_.c_str());
+  auto allocator = NpuMemoryAllocator::GetAllocator();
+  GE_CHECK_NOTNULL(allocator);
+  tiling_info.tiling_buffer = TensorBuffer::Create(allocator, tiling_data_.size());
+  GE_CHECK_NOTNULL(tiling_info.tiling_buffer);
+  GE_CHK_RT_RET(rtMemcpy(tiling_info.tiling_buffer->GetData(), tiling_info.tiling_buffer->GetSize(),
+                         tiling_data_.c_str(), tiling_data_.size(), RT_MEMCPY_HOST_TO_DEVICE));
+  GELOGD("[%s] Tiling info frozen, size = %zu, block_dim = %u", stub_name_.c_str(), tiling_data_.size(), block_dim_);
+  return SUCCESS;
+}
+
+void AiCoreOpTask::RestoreTilingInfo(const FrozenTilingInfo &tiling_info) {
+  block_dim_ = tiling_info.block_dim;
+  if (tiling_info.tiling_buffer != nullptr) {
+    tiling_addr_ = tiling_info.tiling_buffer->GetData();
+  }
+}
+
 Status AiCoreOpTask::CalcTilingInfo(const NodePtr &node, OpRunInfo &tiling_info) {
   GELOGD("[%s] Start to invoke OpParaCalculate.", node->GetName().c_str());
   GE_CHK_STATUS_RET(OpParaCalculate(*node, tiling_info), "Failed calc tiling data of node %s.",
@@ -183,7 +208,7 @@ Status AiCoreOpTask::UpdateArgs(TaskContext &task_context) {
   }
 
   if (tiling_buffer_ != nullptr) {
-    arg_base_[index++] = reinterpret_cast<uintptr_t>(tiling_buffer_->GetData());
+    arg_base_[index++] = reinterpret_cast<uintptr_t>(tiling_addr_);
   }
 
   if (task_context.IsTraceEnabled()) {
@@ -223,6 +248,7 @@ Status AiCoreOpTask::InitTilingInfo(const OpDesc &op_desc) {
   GE_CHECK_NOTNULL(allocator);
   tiling_buffer_ = TensorBuffer::Create(allocator, static_cast<size_t>(max_size));
   GE_CHECK_NOTNULL(tiling_buffer_);
+  tiling_addr_ = tiling_buffer_->GetData();
 
   GELOGD("[%s] Done allocating tiling buffer, size=%ld.", op_desc.GetName().c_str(), max_size);
   return SUCCESS;
@@ -309,7 +335,7 @@ Status AtomicAddrCleanOpTask::UpdateArgs(TaskContext &task_context) {
   }
 
   if (tiling_buffer_ != nullptr) {
-    arg_base_[index++] = reinterpret_cast<uintptr_t>(tiling_buffer_->GetData());
+    arg_base_[index++] = reinterpret_cast<uintptr_t>(tiling_addr_);
   } else {
     GELOGD("[%s] Not a dynamic op", GetName().c_str());
   }
@@ -28,6 +28,12 @@
 
 namespace ge {
 namespace hybrid {
+// tiling of an op task for one set of shapes, kept in its own device buffer
+struct FrozenTilingInfo {
+  std::unique_ptr<TensorBuffer> tiling_buffer;
+  uint32_t block_dim = 1;
+};
+
 class AiCoreOpTask {
  public:
   AiCoreOpTask() = default;
@@ -44,6 +50,12 @@ class AiCoreOpTask {
 
   Status LaunchKernel(rtStream_t stream);
 
+  // copy tiling data updated by PrepareWithShape, tiling buffer is kept null if the task has no tiling data
+  Status FreezeTilingInfo(FrozenTilingInfo &tiling_info) const;
+
+  // use the frozen tiling data instead of updating tiling data for the frozen shapes
+  void RestoreTilingInfo(const FrozenTilingInfo &tiling_info);
+
   const std::string &GetName() const;
 
  protected:
@@ -52,6 +64,8 @@ class AiCoreOpTask {
   virtual Status CalcTilingInfo(const NodePtr &node, optiling::OpRunInfo &tiling_info);
 
   std::unique_ptr<TensorBuffer> tiling_buffer_ = nullptr;
+  // device address of tiling data passed to the kernel, in tiling_buffer_ or in a frozen tiling buffer
+  void *tiling_addr_ = nullptr;
   std::string tiling_data_;
   uintptr_t *arg_base_ = nullptr;
   uint32_t max_arg_count_ = 0;
@@ -18,6 +18,7 @@
 #include "common/formats/formats.h"
 #include "aicpu/common/aicpu_task_struct.h"
 #include "graph/load/new_model_manager/model_manager.h"
+#include "graph/utils/type_utils.h"
 #include "hybrid/executor/hybrid_execution_context.h"
 #include "hybrid/model/hybrid_model.h"
 #include "init/gelib.h"
@@ -27,6 +28,13 @@ namespace hybrid {
 namespace {
 // mem need release
 constexpr uint64_t kReleaseFlag = 1;
+// release flag, data size, src and dst of mem copy task
+constexpr size_t kCopyInputNum = 4;
+// outputs larger than it are allocated after compute by their real size
+constexpr uint64_t kMaxBoundedOutputSize = 64 * 1024 * 1024;
+constexpr size_t kCopyTaskAlign = 8;
+
+size_t AlignCopyTaskSize(size_t size) { return (size + kCopyTaskAlign - 1) / kCopyTaskAlign * kCopyTaskAlign; }
 }  // namespace
 REGISTER_NODE_EXECUTOR_BUILDER(NodeExecutorManager::ExecutorType::AICPU_TF, AiCpuNodeExecutor);
 REGISTER_NODE_EXECUTOR_BUILDER(NodeExecutorManager::ExecutorType::AICPU_CUSTOM, AiCpuNodeExecutor);
@@ -39,7 +47,26 @@ Status AicpuNodeTaskBase::AllocTensorBuffer(size_t size, std::unique_ptr<TensorB
   return SUCCESS;
 }
 
-Status AicpuNodeTaskBase::InitExtInfo(const std::string &kernel_ext_info) {
+Status AicpuNodeTaskBase::CopyArgsToDevice(TaskContext &context, void *dst, const void *data, size_t size) {
+  // staged copies are issued on the stream before launch, the host does not wait for them
+  auto execution_context = context.GetExecutionContext();
+  if ((execution_context != nullptr) && (execution_context->args_staging_ring != nullptr) &&
+      execution_context->args_staging_ring->Stage(dst, data, size)) {
+    return SUCCESS;
+  }
+  GE_CHK_RT_RET(rtMemcpy(dst, size, data, size, RT_MEMCPY_HOST_TO_DEVICE));
+  return SUCCESS;
+}
+
+Status AicpuNodeTaskBase::FlushArgs(TaskContext &context) {
+  auto execution_context = context.GetExecutionContext();
+  if ((execution_context != nullptr) && (execution_context->args_staging_ring != nullptr)) {
+    GE_CHK_STATUS_RET(execution_context->args_staging_ring->Flush(), "Flush staged args failed.");
+  }
+  return SUCCESS;
+}
+
+Status AicpuNodeTaskBase::InitExtInfo(const std::string &kernel_ext_info, size_t io_addr_size) {
   if (node_item_->is_dynamic) {
     // dynamic node must have ext info
     GE_CHK_STATUS_RET(aicpu_ext_handle_.Parse(kernel_ext_info),
@@ -47,6 +74,11 @@ Status AicpuNodeTaskBase::InitExtInfo(const std::string &kernel_ext_info) {
                       kernel_ext_info.size());
   }
 
+  // alloc io addr and ext info buf, allow alloc size 0
+  GE_CHK_STATUS_RET(AllocTensorBuffer(io_addr_size + kernel_ext_info.size(), args_dev_buf_),
+                    "Node[%s] alloc args buf failed, io_addr_size=%zu, kernel_ext_info_size=%zu", node_name_.c_str(),
+                    io_addr_size, kernel_ext_info.size());
+
   // if no ext info no need copy to device.
   if (kernel_ext_info.empty()) {
     GELOGI("Node[%s] kernel_ext_info is empty, no need copy to device, is_dynamic=%s.", node_name_.c_str(),
@@ -54,9 +86,9 @@ Status AicpuNodeTaskBase::InitExtInfo(const std::string &kernel_ext_info) {
     return SUCCESS;
   }
 
-  // copy task args buf
-  GE_CHK_STATUS_RET(AllocTensorBuffer(kernel_ext_info.size(), ext_info_addr_dev_),
-                    "Node[%s] alloc kernel_ext_info buf failed, size=%zu", node_name_.c_str(), kernel_ext_info.size());
+  auto ext_info_addr = static_cast<uint8_t *>(args_dev_buf_->GetData()) + io_addr_size;
+  ext_info_addr_dev_ = TensorBuffer::Create(ext_info_addr, kernel_ext_info.size());
+  GE_CHECK_NOTNULL(ext_info_addr_dev_);
 
   // copy default ext info to device
   GE_CHK_RT_RET(rtMemcpy(ext_info_addr_dev_->GetData(), ext_info_addr_dev_->GetSize(), kernel_ext_info.data(),
@@ -115,7 +147,7 @@ Status AicpuNodeTaskBase::UpdateShapeToOutputDesc(const GeShape &shape_new, int3
   return SUCCESS;
 }
 
-Status AicpuNodeTaskBase::UpdateExtInfo() {
+Status AicpuNodeTaskBase::UpdateExtInfo(TaskContext &context) {
   GELOGI("Node[%s] update ext info begin, unknown_type=%d.", node_name_.c_str(), unknown_type_);
   if (node_item_->num_inputs == 0 && node_item_->num_outputs == 0) {
     GELOGI("Node[%s] has no input and output, no need update ext info.", node_name_.c_str());
@@ -140,8 +172,8 @@ Status AicpuNodeTaskBase::UpdateExtInfo() {
   }
 
   // copy input and output shapes to device
-  GE_CHK_RT_RET(rtMemcpy(ext_info_addr_dev_->GetData(), ext_info_addr_dev_->GetSize(), aicpu_ext_handle_.GetExtInfo(),
-                         aicpu_ext_handle_.GetExtInfoLen(), RT_MEMCPY_HOST_TO_DEVICE));
+  GE_CHK_STATUS_RET_NOLOG(CopyArgsToDevice(context, ext_info_addr_dev_->GetData(), aicpu_ext_handle_.GetExtInfo(),
+                                           aicpu_ext_handle_.GetExtInfoLen()));
 
   GELOGI("Node[%s] update ext info end.", node_name_.c_str());
   return SUCCESS;
@@ -158,8 +190,9 @@ Status AicpuNodeTaskBase::UpdateArgs(TaskContext &context) {
   GE_CHK_STATUS_RET(UpdateIoAddr(context), "Node[%s] update io addr failed.", node_name_.c_str());
   if (node_item_->is_dynamic) {
     // dynamic node need update ext info.
-    GE_CHK_STATUS_RET(UpdateExtInfo(), "Node[%s] update ext info failed.", node_name_.c_str());
+    GE_CHK_STATUS_RET(UpdateExtInfo(context), "Node[%s] update ext info failed.", node_name_.c_str());
   }
+  GE_CHK_STATUS_RET(FlushArgs(context), "Node[%s] copy args to device failed.", node_name_.c_str());
   GELOGI("Node[%s] update args end.", node_name_.c_str());
   return SUCCESS;
 }
@@ -211,16 +244,17 @@ Status AicpuTfNodeTask::InitForDependComputeTask() {
   // init for mem copy task
   // copy task need copy output_data and output_shape, max len is 2 * output_num
   const size_t copy_input_buf_len = node_item_->num_outputs * 2 * sizeof(uint64_t);
-  GE_CHK_STATUS_RET(AllocTensorBuffer(copy_input_buf_len, copy_input_release_flag_dev_),
-                    "Node[%s] alloc copy task input release_flag failed, size=%zu", node_name_.c_str(),
-                    copy_input_buf_len);
-  GE_CHK_STATUS_RET(AllocTensorBuffer(copy_input_buf_len, copy_input_data_size_dev_),
-                    "Node[%s] alloc copy task input data_size failed, size=%zu", node_name_.c_str(),
-                    copy_input_buf_len);
-  GE_CHK_STATUS_RET(AllocTensorBuffer(copy_input_buf_len, copy_input_src_dev_),
-                    "Node[%s] alloc copy task input src failed, size=%zu", node_name_.c_str(), copy_input_buf_len);
-  GE_CHK_STATUS_RET(AllocTensorBuffer(copy_input_buf_len, copy_input_dst_dev_),
-                    "Node[%s] alloc copy task input dst failed, size=%zu", node_name_.c_str(), copy_input_buf_len);
+  GE_CHK_STATUS_RET(AllocTensorBuffer(copy_input_buf_len * kCopyInputNum, copy_input_buf_dev_),
+                    "Node[%s] alloc copy task input buf failed, size=%zu", node_name_.c_str(),
+                    copy_input_buf_len * kCopyInputNum);
+  std::unique_ptr<TensorBuffer> *copy_inputs[kCopyInputNum] = {&copy_input_release_flag_dev_,
+                                                               &copy_input_data_size_dev_, &copy_input_src_dev_,
+                                                               &copy_input_dst_dev_};
+  auto copy_input_base = static_cast<uint8_t *>(copy_input_buf_dev_->GetData());
+  for (size_t i = 0; i < kCopyInputNum; ++i) {
+    *copy_inputs[i] = TensorBuffer::Create(copy_input_base + i * copy_input_buf_len, copy_input_buf_len);
+    GE_CHECK_NOTNULL(*copy_inputs[i]);
+  }
 
   // copy task args buf
   GE_CHK_STATUS_RET(AllocTensorBuffer(sizeof(STR_FWK_OP_KERNEL), copy_task_args_buf_),
@@ -242,9 +276,170 @@ Status AicpuTfNodeTask::InitForDependComputeTask() {
 
   GE_CHK_RT_RET(rtMemcpy(copy_ioaddr_dev_->GetData(), copy_io_addr_size, &copy_io_addr[0], copy_io_addr_size,
                          RT_MEMCPY_HOST_TO_DEVICE));
+  return InitForBoundedOutputs();
+}
+
+bool AicpuTfNodeTask::GetOutputBound(int output_index, uint64_t &data_bound, uint64_t &shape_bound) const {
+  auto output_desc = node_item_->op_desc->GetOutputDescPtr(output_index);
+  uint32_t type_size = 0;
+  if ((output_desc == nullptr) || !TypeUtils::GetDataTypeLength(output_desc->GetDataType(), type_size)) {
+    return false;
+  }
+
+  const auto &dims = output_desc->GetShape().GetDims();
+  std::vector<std::pair<int64_t, int64_t>> shape_range;
+  (void)output_desc->GetShapeRange(shape_range);
+  uint64_t bound = type_size;
+  for (size_t i = 0; i < dims.size(); ++i) {
+    if (dims[i] == UNKNOWN_DIM_NUM) {
+      return false;
+    }
+    // unknown dim is bounded by the max of its range, which is -1 if not limited
+    int64_t dim_max = (dims[i] >= 0) ? dims[i] : ((i < shape_range.size()) ? shape_range[i].second : -1);
+    if ((dim_max < 0) || ((dim_max > 0) && (bound > kMaxBoundedOutputSize / static_cast<uint64_t>(dim_max)))) {
+      return false;
+    }
+    // the copy reads the bound whatever the real size is, so an output which may be smaller than its bound would be
+    // read past its end. such an output is copied after compute by the size in its summary
+    if ((dims[i] < 0) && (shape_range[i].first != dim_max)) {
+      return false;
+    }
+    bound *= static_cast<uint64_t>(dim_max);
+  }
+  data_bound = bound;
+  shape_bound = dims.size() * sizeof(int64_t);
+  return true;
+}
+
+Status AicpuTfNodeTask::InitForBoundedOutputs() {
+  if (!node_item_->is_dynamic) {
+    return SUCCESS;
+  }
+  output_data_bounds_.resize(node_item_->num_outputs);
+  output_shape_bounds_.resize(node_item_->num_outputs);
+  // src ptr in result summary and bound of each copy, for data and shape of every output
+  std::vector<std::pair<uint64_t, uint64_t>> copy_fields;
+  for (auto i = 0; i < node_item_->num_outputs; ++i) {
+    if (!GetOutputBound(i, output_data_bounds_[i], output_shape_bounds_[i])) {
+      GELOGI("Node[%s] out[%d] has no upper bound, outputs are allocated after compute.", node_name_.c_str(), i);
+      return SUCCESS;
+    }
+    auto summary_addr = reinterpret_cast<uintptr_t>(output_summary_[i]->GetData());
+    copy_fields.emplace_back(summary_addr + offsetof(aicpu::FWKAdapter::ResultSummary, raw_data_ptr),
+                             output_data_bounds_[i]);
+    if (output_shape_bounds_[i] > 0) {
+      copy_fields.emplace_back(summary_addr + offsetof(aicpu::FWKAdapter::ResultSummary, shape_data_ptr),
+                               output_shape_bounds_[i]);
+    }
+  }
+
+  // the copy inputs are fields of result summaries, which are not adjacent, so each copy is a task of its own
+  STR_FWK_OP_KERNEL copy_task = {0};
+  std::string task_info;
+  if (GenMemCopyTask(1, copy_task, task_info) != SUCCESS) {
+    GELOGW("Node[%s] generate copy task failed, outputs are allocated after compute.", node_name_.c_str());
+    return SUCCESS;
+  }
+
+  const size_t copy_num = copy_fields.size();
+  // release flag, dst addr and data size of each copy, then the copy tasks
+  const size_t sizes_offset = sizeof(uint64_t) + copy_num * sizeof(uint64_t);
+  const size_t tasks_offset = sizes_offset + copy_num * sizeof(uint64_t);
+  const size_t args_offset = kCopyInputNum * sizeof(uint64_t);
+  const size_t workspace_offset = args_offset + AlignCopyTaskSize(sizeof(STR_FWK_OP_KERNEL));
+  const size_t task_size = workspace_offset + AlignCopyTaskSize(task_info.size());
+  std::vector<uint8_t> copy_buf(tasks_offset + copy_num * task_size, 0);
+  GE_CHK_STATUS_RET(AllocTensorBuffer(copy_buf.size(), bounded_copy_buf_dev_),
+                    "Node[%s] alloc bounded copy buf failed, size=%zu", node_name_.c_str(), copy_buf.size());
+  auto dev_base = static_cast<uint8_t *>(bounded_copy_buf_dev_->GetData());
+  *reinterpret_cast<uint64_t *>(copy_buf.data()) = kReleaseFlag;
+
+  for (size_t i = 0; i < copy_num; ++i) {
+    // the size reported in the summary is not known before the copy, copy the bound, which is the size of the
+    // output, and check the size in the callback, so that no buffer is accessed out of its end
+    auto size_offset = sizes_offset + i * sizeof(uint64_t);
+    *reinterpret_cast<uint64_t *>(copy_buf.data() + size_offset) = copy_fields[i].second;
+    auto task_base = copy_buf.data() + tasks_offset + i * task_size;
+    auto task_base_dev = dev_base + tasks_offset + i * task_size;
+    uint64_t copy_io_addr[kCopyInputNum] = {reinterpret_cast<uintptr_t>(dev_base),
+                                            reinterpret_cast<uintptr_t>(dev_base + size_offset), copy_fields[i].first,
+                                            reinterpret_cast<uintptr_t>(dev_base + (i + 1) * sizeof(uint64_t))};
+    STR_FWK_OP_KERNEL copy_args = copy_task;
+    copy_args.fwkKernelBase.fwk_kernel.inputOutputAddr = reinterpret_cast<uintptr_t>(task_base_dev);
+    copy_args.fwkKernelBase.fwk_kernel.workspaceBaseAddr =
+      reinterpret_cast<uintptr_t>(task_base_dev + workspace_offset);
+    copy_args.fwkKernelBase.fwk_kernel.extInfoAddr = 0;
+    copy_args.fwkKernelBase.fwk_kernel.extInfoLen = 0;
+    bool copy_ok = (memcpy_s(task_base, task_size, copy_io_addr, sizeof(copy_io_addr)) == EOK) &&
+                   (memcpy_s(task_base + args_offset, task_size - args_offset, &copy_args, sizeof(copy_args)) == EOK) &&
+                   (task_info.empty() || memcpy_s(task_base + workspace_offset, task_size - workspace_offset,
+                                                  task_info.data(), task_info.size()) == EOK);
+    GE_CHK_BOOL_RET_STATUS(copy_ok, INTERNAL_ERROR, "Node[%s] fill args of copy task %zu failed.", node_name_.c_str(),
+                           i);
+    bounded_copy_args_.emplace_back(task_base_dev + args_offset);
+  }
+  GE_CHK_RT_RET(rtMemcpy(dev_base, bounded_copy_buf_dev_->GetSize(), copy_buf.data(), copy_buf.size(),
+                         RT_MEMCPY_HOST_TO_DEVICE));
+  use_bounded_outputs_ = true;
+  GELOGI("Node[%s] outputs are bounded, %zu copy tasks are launched after compute.", node_name_.c_str(), copy_num);
   return SUCCESS;
 }
 
+Status AicpuTfNodeTask::PrepareBoundedOutputs(TaskContext &context) {
+  // dst addr of each copy, in the order of copy tasks
+  std::vector<uint64_t> dst_addrs;
+  dst_addrs.reserve(bounded_copy_args_.size());
+  bounded_out_shape_hbm_.clear();
+  bounded_out_shape_hbm_.resize(node_item_->num_outputs);
+  for (auto i = 0; i < node_item_->num_outputs; ++i) {
+    std::unique_ptr<TensorBuffer> tensor_buffer;
+    GE_CHK_STATUS_RET(AllocTensorBuffer(output_data_bounds_[i], tensor_buffer),
+                      "Node[%s] out[%d] alloc tensor buffer failed, bound=%lu", node_name_.c_str(), i,
+                      output_data_bounds_[i]);
+    dst_addrs.emplace_back(reinterpret_cast<uintptr_t>(tensor_buffer->GetData()));
+    auto status = context.SetOutput(i, TensorValue(std::shared_ptr<TensorBuffer>(tensor_buffer.release())));
+    GE_CHK_STATUS_RET(status, "Node[%s] set output %d failed.", node_name_.c_str(), i);
+
+    if (output_shape_bounds_[i] > 0) {
+      GE_CHK_STATUS_RET(AllocTensorBuffer(output_shape_bounds_[i], bounded_out_shape_hbm_[i]),
+                        "Node[%s] out[%d] alloc shape buffer failed, bound=%lu", node_name_.c_str(), i,
+                        output_shape_bounds_[i]);
+      dst_addrs.emplace_back(reinterpret_cast<uintptr_t>(bounded_out_shape_hbm_[i]->GetData()));
+    }
+  }
+
+  auto dst_addr_dev = static_cast<uint8_t *>(bounded_copy_buf_dev_->GetData()) + sizeof(uint64_t);
+  return CopyArgsToDevice(context, dst_addr_dev, dst_addrs.data(), sizeof(uint64_t) * dst_addrs.size());
+}
+
+Status AicpuTfNodeTask::LaunchBoundedCopyTasks(TaskContext &context) {
+  RECORD_EXECUTION_EVENT(context.GetExecutionContext(), node_name_.c_str(), "[LaunchBoundedCopy] Start");
+  for (auto copy_args : bounded_copy_args_) {
+    GE_CHK_RT_RET(rtKernelLaunchEx(copy_args, sizeof(STR_FWK_OP_KERNEL), RT_KERNEL_DEFAULT, context.GetStream()));
+  }
+  RECORD_EXECUTION_EVENT(context.GetExecutionContext(), node_name_.c_str(), "[LaunchBoundedCopy] End");
+  return SUCCESS;
+}
+
+Status AicpuTfNodeTask::UpdateShapeByBoundedOutputs(TaskContext &context) {
+  // the copy tasks are before the callback on stream, so outputs and shapes are ready now
+  for (auto i = 0; i < node_item_->num_outputs; ++i) {
+    auto &result_summary = output_summary_host_[i];
+    GE_CHK_RT_RET(rtMemcpy(&result_summary, sizeof(aicpu::FWKAdapter::ResultSummary), output_summary_[i]->GetData(),
+                           output_summary_[i]->GetSize(), RT_MEMCPY_DEVICE_TO_HOST));
+    if ((result_summary.raw_data_size != output_data_bounds_[i]) ||
+        (result_summary.shape_data_size != output_shape_bounds_[i])) {
+      // the output breaks its shape range and the copies do not match it. go back to allocating after compute
+      use_bounded_outputs_ = false;
+      GELOGE(INTERNAL_ERROR, "Node[%s] out[%d] raw data size=%lu, shape data size=%lu, differ from bound %lu and %lu.",
+             node_name_.c_str(), i, result_summary.raw_data_size, result_summary.shape_data_size,
+             output_data_bounds_[i], output_shape_bounds_[i]);
+      return INTERNAL_ERROR;
+    }
+  }
+  return UpdateShapeByHbmBuffer(context, bounded_out_shape_hbm_);
+}
+
 Status AicpuTfNodeTask::Init(const HybridModel &model) {
   GELOGI("Node[%s] init start.", node_name_.c_str());
 
@@ -260,19 +455,18 @@ Status AicpuTfNodeTask::Init(const HybridModel &model) {
   GE_CHK_RT_RET(rtMemcpy(kernel_workspace_->GetData(), kernel_workspace_size, kernel_ex_def.task_info().data(),
                          kernel_workspace_size, RT_MEMCPY_HOST_TO_DEVICE));
 
-  auto input_output_size = (node_item_->num_inputs + node_item_->num_outputs) * sizeof(uint64_t);
-  // alloc input output addr buf, allow alloc size 0
-  GE_CHK_STATUS_RET(AllocTensorBuffer(input_output_size, input_output_addr_),
-                    "Node[%s] alloc buffer for io addr failed, size=%zu.", node_name_.c_str(), input_output_size);
-
   auto &kernel_ext_info = kernel_ex_def.kernel_ext_info();
   auto kernel_ext_info_size = kernel_ex_def.kernel_ext_info_size();
   GE_CHK_BOOL_RET_STATUS(kernel_ext_info.size() == kernel_ext_info_size, FAILED,
                          "Node[%s] task def kernel_ext_info.size=%zu, but kernel_ext_info_size=%u.", node_name_.c_str(),
                          kernel_ext_info.size(), kernel_ext_info_size);
 
-  // init ext info
-  GE_CHK_STATUS_RET(InitExtInfo(kernel_ext_info), "Node[%s] init ext info failed.", node_name_.c_str());
+  // init ext info, and input output addr buf ahead of it
+  auto input_output_size = (node_item_->num_inputs + node_item_->num_outputs) * sizeof(uint64_t);
+  GE_CHK_STATUS_RET(InitExtInfo(kernel_ext_info, input_output_size), "Node[%s] init ext info failed.",
+                    node_name_.c_str());
+  input_output_addr_ = TensorBuffer::Create(args_dev_buf_->GetData(), input_output_size);
+  GE_CHECK_NOTNULL(input_output_addr_);
   GE_CHK_STATUS_RET(InitForDependComputeTask(), "Node[%s] init for depend compute task failed.", node_name_.c_str());
 
   // build fwk_op_kernel.
@@ -374,16 +568,17 @@ Status AicpuTfNodeTask::CopyDataToHbm(TaskContext &context,
   GE_CHK_STATUS_RET(AllocTensorBuffer(task_info.size(), kernel_workspace_buf),
                     "Node[%s] alloc copy task workspace buf failed, size=%zu.", node_name_.c_str(), task_info.size());
 
-  GE_CHK_RT_RET(rtMemcpy(kernel_workspace_buf->GetData(), task_info.size(), task_info.data(), task_info.size(),
-                         RT_MEMCPY_HOST_TO_DEVICE));
+  GE_CHK_STATUS_RET_NOLOG(
+    CopyArgsToDevice(context, kernel_workspace_buf->GetData(), task_info.data(), task_info.size()));
 
   aicpu_task.fwkKernelBase.fwk_kernel.inputOutputAddr = reinterpret_cast<uintptr_t>(copy_ioaddr_dev_->GetData());
   aicpu_task.fwkKernelBase.fwk_kernel.workspaceBaseAddr = reinterpret_cast<uintptr_t>(kernel_workspace_buf->GetData());
   aicpu_task.fwkKernelBase.fwk_kernel.extInfoAddr = 0;
   aicpu_task.fwkKernelBase.fwk_kernel.extInfoLen = 0;
 
-  GE_CHK_RT_RET(rtMemcpy(copy_task_args_buf_->GetData(), sizeof(STR_FWK_OP_KERNEL), &aicpu_task,
-                         sizeof(STR_FWK_OP_KERNEL), RT_MEMCPY_HOST_TO_DEVICE));
+  GE_CHK_STATUS_RET_NOLOG(
+    CopyArgsToDevice(context, copy_task_args_buf_->GetData(), &aicpu_task, sizeof(STR_FWK_OP_KERNEL)));
+  GE_CHK_STATUS_RET(FlushArgs(context), "Node[%s] copy args of copy task to device failed.", node_name_.c_str());
 
   RECORD_CALLBACK_EVENT(context.GetExecutionContext(), node_name_.c_str(), "[LaunchCopy] Start");
   GE_CHK_RT_RET(rtKernelLaunchEx(copy_task_args_buf_->GetData(), sizeof(STR_FWK_OP_KERNEL), RT_KERNEL_DEFAULT,
@@ -391,11 +586,14 @@ Status AicpuTfNodeTask::CopyDataToHbm(TaskContext &context,
   RECORD_CALLBACK_EVENT(context.GetExecutionContext(), node_name_.c_str(), "[LaunchCopy] End");
 
   GE_CHK_RT_RET(rtStreamSynchronize(context.GetStream()));
+  if (context.GetExecutionContext() != nullptr) {
+    context.GetExecutionContext()->stream_sync_count++;
+  }
   RECORD_CALLBACK_EVENT(context.GetExecutionContext(), node_name_.c_str(), "[SynchronizeCopy] End");
   return SUCCESS;
 }
 
-Status AicpuTfNodeTask::PrepareCopyInputs(const TaskContext &context,
+Status AicpuTfNodeTask::PrepareCopyInputs(TaskContext &context,
                                           const std::vector<std::unique_ptr<TensorBuffer>> &out_shape_hbm,
                                           uint64_t &copy_num) {
   std::vector<uint64_t> copy_input_release_flag;
@@ -433,18 +631,17 @@ Status AicpuTfNodeTask::PrepareCopyInputs(const TaskContext &context,
 
   GE_CHK_BOOL_RET_STATUS(copy_num > 0, INTERNAL_ERROR, "Node[%s] need copy num is 0", node_name_.c_str());
 
-  // copy task need copy output and output shape
-  const size_t copy_input_buf_len = copy_num * sizeof(uint64_t);
-
-  GE_CHK_RT_RET(rtMemcpy(copy_input_release_flag_dev_->GetData(), copy_input_release_flag_dev_->GetSize(),
-                         &copy_input_release_flag[0], copy_input_buf_len, RT_MEMCPY_HOST_TO_DEVICE));
-  GE_CHK_RT_RET(rtMemcpy(copy_input_data_size_dev_->GetData(), copy_input_data_size_dev_->GetSize(),
-                         &copy_input_data_size[0], copy_input_buf_len, RT_MEMCPY_HOST_TO_DEVICE));
-  GE_CHK_RT_RET(rtMemcpy(copy_input_src_dev_->GetData(), copy_input_src_dev_->GetSize(), &copy_input_src[0],
-                         copy_input_buf_len, RT_MEMCPY_HOST_TO_DEVICE));
-  GE_CHK_RT_RET(rtMemcpy(copy_input_dst_dev_->GetData(), copy_input_dst_dev_->GetSize(), &copy_input_dst[0],
-                         copy_input_buf_len, RT_MEMCPY_HOST_TO_DEVICE));
-  return SUCCESS;
+  // the four inputs are adjacent on device, copy them at once
+  const size_t max_copy_num = copy_input_release_flag_dev_->GetSize() / sizeof(uint64_t);
+  GE_CHK_BOOL_RET_STATUS(copy_num <= max_copy_num, INTERNAL_ERROR, "Node[%s] need copy num %lu is more than %zu",
+                         node_name_.c_str(), copy_num, max_copy_num);
+  std::vector<uint64_t> copy_inputs(max_copy_num * kCopyInputNum, 0);
+  (void)std::copy(copy_input_release_flag.begin(), copy_input_release_flag.end(), copy_inputs.begin());
+  (void)std::copy(copy_input_data_size.begin(), copy_input_data_size.end(), copy_inputs.begin() + max_copy_num);
+  (void)std::copy(copy_input_src.begin(), copy_input_src.end(), copy_inputs.begin() + max_copy_num * 2);
+  (void)std::copy(copy_input_dst.begin(), copy_input_dst.end(), copy_inputs.begin() + max_copy_num * 3);
+  return CopyArgsToDevice(context, copy_input_buf_dev_->GetData(), copy_inputs.data(),
+                          sizeof(uint64_t) * copy_inputs.size());
 }
 
 Status AicpuTfNodeTask::GenMemCopyTask(uint64_t copy_num, STR_FWK_OP_KERNEL &task, std::string &task_info) {
@@ -479,7 +676,7 @@ Status AicpuTfNodeTask::UpdateShapeByHbmBuffer(TaskContext &context,
       std::unique_ptr<int64_t[]> shape_addr(new (std::nothrow) int64_t[dim_num]());
       GE_CHECK_NOTNULL(shape_addr);
       GE_CHK_RT_RET(rtMemcpy(shape_addr.get(), result_summary.shape_data_size, shape_hbm->GetData(),
-                             shape_hbm->GetSize(), RT_MEMCPY_DEVICE_TO_HOST));
+                             result_summary.shape_data_size, RT_MEMCPY_DEVICE_TO_HOST));
       for (uint32_t dim_idx = 0; dim_idx < dim_num; ++dim_idx) {
         shape_dims.emplace_back(shape_addr[dim_idx]);
         GELOGD("Node[%s] [%d]th output dim[%u]=%ld.", node_name_.c_str(), i, dim_idx, shape_addr[dim_idx]);
@@ -493,6 +690,12 @@ Status AicpuTfNodeTask::UpdateShapeByHbmBuffer(TaskContext &context,
 
 Status AicpuTfNodeTask::UpdateShapeAndDataByResultSummary(TaskContext &context) {
   GELOGI("Node[%s] update shape and data by result summary begin.", node_name_.c_str());
+  if (use_bounded_outputs_) {
+    GE_CHK_STATUS_RET(UpdateShapeByBoundedOutputs(context), "Node[%s] update shape by bounded outputs failed.",
+                      node_name_.c_str());
+    GELOGI("Node[%s] update shape by bounded outputs end.", node_name_.c_str());
+    return SUCCESS;
+  }
 
   std::vector<std::unique_ptr<TensorBuffer>> out_shape_hbm;
   GE_CHK_STATUS_RET(ReadResultSummaryAndPrepareMemory(context, out_shape_hbm),
@@ -545,13 +748,17 @@ Status AicpuTfNodeTask::UpdateIoAddr(TaskContext &context) {
       void *summary_addr = output_summary_[j]->GetData();
       io_addrs.emplace_back(reinterpret_cast<uintptr_t>(summary_addr));
     }
+    if (use_bounded_outputs_) {
+      GE_CHK_STATUS_RET(PrepareBoundedOutputs(context), "Node[%s] prepare bounded outputs failed.",
+                        node_name_.c_str());
+    }
   }
 
   // if has input and output, need copy to ioaddr
   if (!io_addrs.empty()) {
     // copy input and output to device
-    GE_CHK_RT_RET(rtMemcpy(input_output_addr_->GetData(), input_output_addr_->GetSize(), &io_addrs[0],
-                           sizeof(uint64_t) * io_addrs.size(), RT_MEMCPY_HOST_TO_DEVICE));
+    GE_CHK_STATUS_RET_NOLOG(
+      CopyArgsToDevice(context, input_output_addr_->GetData(), &io_addrs[0], sizeof(uint64_t) * io_addrs.size()));
   }
   return SUCCESS;
 }
@@ -562,6 +769,9 @@ Status AicpuTfNodeTask::LaunchTask(TaskContext &context) {
   RECORD_EXECUTION_EVENT(context.GetExecutionContext(), node_name_.c_str(), "[AicpuTfNodertKernelLaunchEx] Start");
   GE_CHK_RT_RET(rtKernelLaunchEx(kernel_buf_->GetData(), kernel_buf_->GetSize(), flag, context.GetStream()));
   RECORD_EXECUTION_EVENT(context.GetExecutionContext(), node_name_.c_str(), "[AicpuTfNodertKernelLaunchEx] End");
+  if (node_item_->is_dynamic && (unknown_type_ == DEPEND_COMPUTE) && use_bounded_outputs_) {
+    GE_CHK_STATUS_RET_NOLOG(LaunchBoundedCopyTasks(context));
+  }
   GELOGI("Node[%s] launch end.", node_name_.c_str());
   return SUCCESS;
 }
@@ -632,7 +842,8 @@ Status AicpuNodeTask::Init(const HybridModel &model) {
                          "Node[%s] task def kernel_ext_info.size=%zu, but kernel_ext_info_size=%u.", node_name.c_str(),
                          kernel_ext_info.size(), kernel_ext_info_size);
 
-  GE_CHK_STATUS_RET(InitExtInfo(kernel_ext_info), "Node[%s] init ext info failed.", node_name.c_str());
+  // io addrs are in args, which is copied by launch
+  GE_CHK_STATUS_RET(InitExtInfo(kernel_ext_info, 0), "Node[%s] init ext info failed.", node_name.c_str());
 
   if (ext_info_addr_dev_ == nullptr) {
     aicpu_param_head->extInfoLength = 0;
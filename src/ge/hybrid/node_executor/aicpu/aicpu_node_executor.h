@@ -17,6 +17,7 @@
 #ifndef GE_HYBRID_KERNEL_AICPU_NODE_EXECUTOR_H_
 #define GE_HYBRID_KERNEL_AICPU_NODE_EXECUTOR_H_
 
+#include <atomic>
 #include "external/graph/types.h"
 #include "cce/aicpu_engine_struct.h"
 #include "hybrid/node_executor/node_executor.h"
@@ -44,9 +45,9 @@ class AicpuNodeTaskBase : public NodeTask {
   Status ExecuteAsync(TaskContext &context, std::function<void()> done_callback) override;
 
  protected:
-  virtual Status InitExtInfo(const std::string &kernel_ext_info);
+  virtual Status InitExtInfo(const std::string &kernel_ext_info, size_t io_addr_size);
 
-  virtual Status UpdateExtInfo();
+  virtual Status UpdateExtInfo(TaskContext &context);
 
   virtual Status UpdateOutputShapeFromExtInfo();
 
@@ -60,6 +61,10 @@ class AicpuNodeTaskBase : public NodeTask {
 
   static Status AllocTensorBuffer(size_t size, std::unique_ptr<TensorBuffer> &tensor_buffer);
 
+  static Status CopyArgsToDevice(TaskContext &context, void *dst, const void *data, size_t size);
+
+  static Status FlushArgs(TaskContext &context);
+
  protected:
   const NodeItem *node_item_;
   // just reference.
@@ -75,6 +80,9 @@ class AicpuNodeTaskBase : public NodeTask {
   // valid when node_item_->is_dynamic is true
   AicpuExtInfoHandler aicpu_ext_handle_;
 
+  // io addr followed by ext info, device mem, they are adjacent so updated by one copy
+  std::unique_ptr<TensorBuffer> args_dev_buf_;
+
   // ext info addr, device mem
   std::unique_ptr<TensorBuffer> ext_info_addr_dev_;
 };
@@ -97,6 +105,20 @@ class AicpuTfNodeTask : public AicpuNodeTaskBase {
  private:
   Status InitForDependComputeTask();
 
+  ///
+  /// init copy tasks of bounded outputs, which read the src from the result summary on device and copy the bound
+  /// of each output. the op goes to the sync path if some output may be smaller than its bound.
+  ///
+  Status InitForBoundedOutputs();
+
+  bool GetOutputBound(int output_index, uint64_t &data_bound, uint64_t &shape_bound) const;
+
+  Status PrepareBoundedOutputs(TaskContext &context);
+
+  Status LaunchBoundedCopyTasks(TaskContext &context);
+
+  Status UpdateShapeByBoundedOutputs(TaskContext &context);
+
   Status UpdateShapeAndDataByResultSummary(TaskContext &context);
 
   ///
@@ -111,7 +133,7 @@ class AicpuTfNodeTask : public AicpuNodeTaskBase {
 
   Status UpdateShapeByHbmBuffer(TaskContext &context, const std::vector<std::unique_ptr<TensorBuffer>> &out_shape_hbm);
 
-  Status PrepareCopyInputs(const TaskContext &context, const std::vector<std::unique_ptr<TensorBuffer>> &out_shape_hbm,
+  Status PrepareCopyInputs(TaskContext &context, const std::vector<std::unique_ptr<TensorBuffer>> &out_shape_hbm,
                            uint64_t &copy_num);
 
   static Status EnsureSessionCreated(uint64_t session_id);
@@ -135,10 +157,23 @@ class AicpuTfNodeTask : public AicpuNodeTaskBase {
 
   std::unique_ptr<TensorBuffer> copy_ioaddr_dev_;
 
+  // holds the four copy inputs below in turn
+  std::unique_ptr<TensorBuffer> copy_input_buf_dev_;
   std::unique_ptr<TensorBuffer> copy_input_release_flag_dev_;
   std::unique_ptr<TensorBuffer> copy_input_data_size_dev_;
   std::unique_ptr<TensorBuffer> copy_input_src_dev_;
   std::unique_ptr<TensorBuffer> copy_input_dst_dev_;
+
+  // DEPEND_COMPUTE op with fixed sizes of all outputs allocates them before launch, and launches the copy tasks
+  // right after itself, so no stream sync is needed in the middle of execution
+  std::atomic<bool> use_bounded_outputs_{false};
+  std::vector<uint64_t> output_data_bounds_;
+  std::vector<uint64_t> output_shape_bounds_;
+  // release flag, dst addr and bound of each copy, followed by io addr, args and workspace of each copy task,
+  // device mem
+  std::unique_ptr<TensorBuffer> bounded_copy_buf_dev_;
+  std::vector<void *> bounded_copy_args_;
+  std::vector<std::unique_ptr<TensorBuffer>> bounded_out_shape_hbm_;
 };
 
 class AicpuNodeTask : public AicpuNodeTaskBase {
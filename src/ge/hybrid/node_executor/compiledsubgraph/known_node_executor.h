@@ -35,9 +35,11 @@ class KnownNodeTask : public NodeTask {
   Status ExecuteAsync(TaskContext &context, std::function<void()> done_callback) override;
   Status Init(TaskContext &context) override;
 
+  // load the davinci model when the hybrid model is built, before the mem base is allocated by the first execution
+  Status InitDavinciModel();
+
  private:
   std::shared_ptr<DavinciModel> davinci_model_ = nullptr;
-  bool load_flag_ = false;
 };
 
 class KnownNodeExecutor : public NodeExecutor {
@@ -19,9 +19,25 @@
 #include "graph/passes/folding_pass.h"
 #include "hybrid/model/hybrid_model.h"
 #include "ge_local_engine/engine/host_cpu_engine.h"
+#include "graph/utils/tensor_adapter.h"
+#include "graph/utils/tensor_utils.h"
+#include "graph/utils/type_utils.h"
+#include "securec.h"
 
 namespace ge {
 namespace hybrid {
+namespace {
+// an output bound before the kernel runs, as net output, ref output or reuse of an input, gets the result copied
+bool IsOutputBound(const TaskContext &context, int index) {
+  const auto &node_item = context.GetNodeItem();
+  if ((node_item.ref_outputs.count(index) > 0) || (node_item.reuse_inputs.count(index) > 0)) {
+    return true;
+  }
+  auto tensor_value = context.GetOutput(index);
+  return (tensor_value != nullptr) && (tensor_value->GetData() != nullptr);
+}
+}  // namespace
+
 REGISTER_NODE_EXECUTOR_BUILDER(NodeExecutorManager::ExecutorType::HOST_CPU, HostCpuNodeExecutor);
 
 Status HostNodeTaskBase::UpdateArgs(TaskContext &) {
@@ -41,58 +57,175 @@ Status HostNodeTaskBase::ExecuteAsync(TaskContext &context, std::function<void()
   return SUCCESS;
 }
 
-Status CpuKernelNodeTask::Execute(TaskContext &context) {
+Status CpuKernelNodeTask::Init() {
   const auto &op_desc = node_->GetOpDesc();
   GE_CHECK_NOTNULL(op_desc);
+  GE_CHK_STATUS_RET(HostCpuEngine::FindOpKernel(node_, op_kernel_), "node:%s type:%s, find op kernel failed.",
+                    node_->GetName().c_str(), node_->GetType().c_str());
+  GE_CHECK_NOTNULL(op_kernel_);
+
+  for (size_t i = 0; i < op_desc->GetInputsSize(); ++i) {
+    auto tensor_name = op_desc->GetInputNameByIndex(i);
+    GE_RETURN_WITH_LOG_IF_TRUE(tensor_name.empty(), "Failed to get input name. node = %s, index = %zu",
+                               op_desc->GetName().c_str(), i);
+    input_names_.emplace_back(tensor_name);
+  }
+  for (size_t i = 0; i < op_desc->GetOutputsSize(); ++i) {
+    auto tensor_name = op_desc->GetOutputNameByIndex(i);
+    GE_RETURN_WITH_LOG_IF_TRUE(tensor_name.empty(), "Failed to get output name. node = %s, index = %zu",
+                               op_desc->GetName().c_str(), i);
+    output_names_.emplace_back(tensor_name);
+  }
+  return SUCCESS;
+}
 
-  std::vector<ConstGeTensorPtr> inputs;
+Status CpuKernelNodeTask::PrepareInputs(TaskContext &context, std::map<std::string, const Tensor> &named_inputs) const {
+  const auto &op_desc = node_->GetOpDesc();
+  if (static_cast<size_t>(context.NumInputs()) != input_names_.size()) {
+    GELOGE(PARAM_INVALID, "node:%s mismatching input sizes, op_desc has %zu input(s), but given %d",
+           context.GetNodeName(), input_names_.size(), context.NumInputs());
+    return PARAM_INVALID;
+  }
   for (int32_t i = 0; i < context.NumInputs(); ++i) {
-    const auto &input_desc = op_desc->GetInputDesc(i);
-    GE_CHECK_NOTNULL(context.GetInput(i));
-    auto in_tensor = MakeShared<GeTensor>(input_desc, reinterpret_cast<const uint8_t *>(context.GetInput(i)->GetData()),
-                                          context.GetInput(i)->GetSize());
-    GE_CHECK_NOTNULL(in_tensor);
-    in_tensor->MutableTensorDesc().SetDataType(input_desc.GetDataType());
-    in_tensor->MutableTensorDesc().SetShape(input_desc.GetShape());
-    inputs.emplace_back(in_tensor);
-    GELOGI("node:%s allocate input %zu, addr=%p, size=%lld", op_desc->GetName().c_str(), i,
-           reinterpret_cast<const uint8_t *>(in_tensor->GetData().data()), in_tensor->GetData().size());
+    auto tensor_value = context.GetInput(i);
+    GE_CHECK_NOTNULL(tensor_value);
+    // build the kernel tensor straight from the TensorValue buffer, no intermediate GeTensor
+    auto tensor_desc = TensorAdapter::GeTensorDesc2TensorDesc(op_desc->GetInputDesc(i));
+    named_inputs.emplace(input_names_[i], Tensor(tensor_desc, reinterpret_cast<const uint8_t *>(tensor_value->GetData()),
+                                                 tensor_value->GetSize()));
+    GELOGD("node:%s input %d, addr=%p, size=%zu", context.GetNodeName(), i, tensor_value->GetData(),
+           tensor_value->GetSize());
   }
+  return SUCCESS;
+}
 
-  std::vector<GeTensorPtr> outputs;
+Status CpuKernelNodeTask::AcquireOutputTensor(int index, const GeTensorDesc &output_desc, size_t size,
+                                              Tensor &tensor) const {
+  {
+    std::lock_guard<std::mutex> lock(output_tensor_pool_->mu);
+    auto &free_tensors = output_tensor_pool_->free_tensors[index];
+    if (!free_tensors.empty()) {
+      tensor = free_tensors.back();
+      free_tensors.pop_back();
+    }
+  }
+  (void)tensor.SetTensorDesc(TensorAdapter::GeTensorDesc2TensorDesc(output_desc));
+  // only a tensor of another size gets new memory, the shape of a dynamic output may change between iterations
+  if ((tensor.GetSize() != size) && (tensor.SetData(std::vector<uint8_t>(size)) != GRAPH_SUCCESS)) {
+    GELOGE(MEMALLOC_FAILED, "node:%s set data for output %d failed.", node_->GetName().c_str(), index);
+    return MEMALLOC_FAILED;
+  }
+  return SUCCESS;
+}
+
+void CpuKernelNodeTask::ReleaseOutputTensor(const std::weak_ptr<OutputTensorPool> &pool, int index,
+                                            const Tensor &tensor) {
+  // the task may be unloaded while a downstream node still holds the output
+  auto output_tensor_pool = pool.lock();
+  if (output_tensor_pool != nullptr) {
+    std::lock_guard<std::mutex> lock(output_tensor_pool->mu);
+    output_tensor_pool->free_tensors[index].emplace_back(tensor);
+  }
+}
+
+Status CpuKernelNodeTask::PrepareOutputs(TaskContext &context, std::map<std::string, Tensor> &named_outputs) const {
+  const auto &op_desc = node_->GetOpDesc();
   for (int32_t i = 0; i < context.NumOutputs(); ++i) {
     const auto &output_desc = op_desc->GetOutputDesc(i);
-    AllocationAttr attr;
-    attr.SetMemType(HOST_DDR);
-    if (context.AllocateOutput(i, output_desc, nullptr, &attr) != SUCCESS) {
-      GELOGE(FAILED, "node:%s Failed to allocate output %d", context.GetNodeName(), i);
-      return FAILED;
+    if (!HostCpuEngine::IsOutputDataTypeSupported(output_desc.GetDataType())) {
+      GELOGE(PARAM_INVALID, "node:%s data type %s of output %d not support.", context.GetNodeName(),
+             TypeUtils::DataTypeToSerialString(output_desc.GetDataType()).c_str(), i);
+      return PARAM_INVALID;
     }
-    auto tensor = context.GetOutput(i);
-    GE_CHECK_NOTNULL(tensor);
-    auto out_tensor =
-      MakeShared<GeTensor>(output_desc, reinterpret_cast<const uint8_t *>(tensor->GetData()), tensor->GetSize());
-    GE_CHECK_NOTNULL(out_tensor);
-    out_tensor->MutableTensorDesc().SetDataType(output_desc.GetDataType());
-    out_tensor->MutableTensorDesc().SetShape(output_desc.GetShape());
-    outputs.emplace_back(out_tensor);
-    GELOGI("node:%s allocate output %d, addr=%p, size=%zu", op_desc->GetName().c_str(), i,
-           reinterpret_cast<const uint8_t *>(out_tensor->GetData().data()), out_tensor->GetData().size());
+    int64_t size = 0;
+    (void)TensorUtils::GetSize(output_desc, size);
+    if (IsOutputBound(context, i)) {
+      AllocationAttr attr;
+      attr.SetMemType(HOST_DDR);
+      if (context.AllocateOutput(i, output_desc, nullptr, &attr) != SUCCESS) {
+        GELOGE(FAILED, "node:%s Failed to allocate output %d", context.GetNodeName(), i);
+        return FAILED;
+      }
+      auto tensor_value = context.GetOutput(i);
+      GE_CHECK_NOTNULL(tensor_value);
+      size = static_cast<int64_t>(tensor_value->GetSize());
+    }
+    if (size < 0) {
+      GELOGE(INTERNAL_ERROR, "node:%s invalid size %ld of output %d.", context.GetNodeName(), size, i);
+      return INTERNAL_ERROR;
+    }
+    Tensor tensor;
+    GE_CHK_STATUS_RET_NOLOG(AcquireOutputTensor(i, output_desc, static_cast<size_t>(size), tensor));
+    named_outputs.emplace(output_names_[i], tensor);
+    GELOGD("node:%s prepare output %d, addr=%p, size=%ld", context.GetNodeName(), i, tensor.GetData(), size);
+  }
+  return SUCCESS;
+}
+
+Status CpuKernelNodeTask::UpdateOutputs(TaskContext &context, std::map<std::string, Tensor> &named_outputs) const {
+  for (int32_t i = 0; i < context.NumOutputs(); ++i) {
+    auto iter = named_outputs.find(output_names_[i]);
+    if (iter == named_outputs.end()) {
+      GELOGE(INTERNAL_ERROR, "node:%s output %s not found.", context.GetNodeName(), output_names_[i].c_str());
+      return INTERNAL_ERROR;
+    }
+    Tensor &tensor = iter->second;
+    if (!IsOutputBound(context, i)) {
+      // the output views the buffer the kernel wrote, which goes back to the pool with the last view of it
+      auto buffer = TensorBuffer::Create(tensor.GetData(), tensor.GetSize());
+      GE_CHECK_NOTNULL(buffer);
+      std::weak_ptr<OutputTensorPool> pool = output_tensor_pool_;
+      std::shared_ptr<TensorBuffer> output_buffer(buffer.release(), [pool, i, tensor](TensorBuffer *tensor_buffer) {
+        delete tensor_buffer;
+        ReleaseOutputTensor(pool, i, tensor);
+      });
+      GE_CHK_STATUS_RET_NOLOG(context.SetOutput(i, TensorValue(output_buffer)));
+      continue;
+    }
+
+    auto tensor_value = context.MutableOutput(i);
+    GE_CHECK_NOTNULL(tensor_value);
+    if (tensor.GetSize() > tensor_value->GetSize()) {
+      GELOGE(INTERNAL_ERROR, "node:%s output %d size %zu exceeds allocated size %zu.", context.GetNodeName(), i,
+             tensor.GetSize(), tensor_value->GetSize());
+      return INTERNAL_ERROR;
+    }
+    if (tensor.GetSize() > 0) {
+      GE_CHK_BOOL_RET_STATUS(memcpy_s(tensor_value->MutableData(), tensor_value->GetSize(), tensor.GetData(),
+                                      tensor.GetSize()) == EOK,
+                             INTERNAL_ERROR, "node:%s copy output %d failed.", context.GetNodeName(), i);
+    }
+    ReleaseOutputTensor(output_tensor_pool_, i, tensor);
   }
+  return SUCCESS;
+}
 
-  return HostCpuEngine::GetInstance().Run(node_, inputs, outputs);
+Status CpuKernelNodeTask::Execute(TaskContext &context) {
+  const auto &op_desc = node_->GetOpDesc();
+  GE_CHECK_NOTNULL(op_desc);
+  GE_CHECK_NOTNULL(op_kernel_);
+
+  std::map<std::string, const Tensor> named_inputs;
+  std::map<std::string, Tensor> named_outputs;
+  GE_CHK_STATUS_RET_NOLOG(PrepareInputs(context, named_inputs));
+  GE_CHK_STATUS_RET_NOLOG(PrepareOutputs(context, named_outputs));
+  GE_CHK_STATUS_RET_NOLOG(HostCpuEngine::RunInternal(op_desc, *op_kernel_, named_inputs, named_outputs));
+  return UpdateOutputs(context, named_outputs);
 }
 
-Status HostCpuNodeTask::Execute(TaskContext &context) {
-  RunContext run_context;
-  auto host_kernel = hybrid::host_cpu::KernelFactory::Instance().CreateKernel(node_);
-  if (host_kernel == nullptr) {
+Status HostCpuNodeTask::Init() {
+  host_kernel_ = hybrid::host_cpu::KernelFactory::Instance().CreateKernel(node_);
+  if (host_kernel_ == nullptr) {
     GELOGE(UNSUPPORTED, "node %s type %s is not supported by host kernel.", node_->GetName().c_str(),
            node_->GetType().c_str());
     return UNSUPPORTED;
   }
+  return SUCCESS;
+}
 
-  Status compute_ret = host_kernel->Compute(context);
+Status HostCpuNodeTask::Execute(TaskContext &context) {
+  GE_CHECK_NOTNULL(host_kernel_);
+  Status compute_ret = host_kernel_->Compute(context);
   if (compute_ret != SUCCESS) {
     GELOGE(compute_ret, "node %s type %s compute failed or not imply.", node_->GetName().c_str(),
            node_->GetType().c_str());
@@ -115,12 +248,18 @@ Status HostCpuNodeExecutor::LoadTask(const HybridModel &model, const NodePtr &no
   const std::string &type = node->GetType();
   if (HostCpuEngine::GetInstance().CheckSupported(type)) {
     GELOGI("create CpuKernelNodeTask for node %s, type %s.", name.c_str(), type.c_str());
-    task = MakeShared<CpuKernelNodeTask>(node);
-    GE_CHECK_NOTNULL(task);
+    auto cpu_kernel_task = MakeShared<CpuKernelNodeTask>(node);
+    GE_CHECK_NOTNULL(cpu_kernel_task);
+    GE_CHK_STATUS_RET(cpu_kernel_task->Init(), "node %s type %s, init CpuKernelNodeTask failed.", name.c_str(),
+                      type.c_str());
+    task = std::move(cpu_kernel_task);
   } else if (hybrid::host_cpu::KernelFactory::Instance().CreateKernel(node) != nullptr) {
     GELOGI("create HostCpuNodeTask for node %s, type %s.", name.c_str(), type.c_str());
-    task = MakeShared<HostCpuNodeTask>(node);
-    GE_CHECK_NOTNULL(task);
+    auto host_cpu_task = MakeShared<HostCpuNodeTask>(node);
+    GE_CHECK_NOTNULL(host_cpu_task);
+    GE_CHK_STATUS_RET(host_cpu_task->Init(), "node %s type %s, init HostCpuNodeTask failed.", name.c_str(),
+                      type.c_str());
+    task = std::move(host_cpu_task);
   } else {
     GELOGE(UNSUPPORTED, "node %s type %s is not support in HostCpuNodeExecutor now.", name.c_str(), type.c_str());
     return UNSUPPORTED;
@@ -17,8 +17,15 @@
 #ifndef GE_HYBRID_KERNEL_HOST_CPU_NODE_EXECUTOR_H_
 #define GE_HYBRID_KERNEL_HOST_CPU_NODE_EXECUTOR_H_
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 #include "hybrid/node_executor/node_executor.h"
+#include "hybrid/node_executor/host_cpu/kernel/kernel.h"
 #include "inc/kernel.h"
+#include "inc/register/register.h"
 
 namespace ge {
 namespace hybrid {
@@ -41,8 +48,27 @@ class CpuKernelNodeTask : public HostNodeTaskBase {
   explicit CpuKernelNodeTask(const NodePtr &node) : HostNodeTaskBase(node) {}
   ~CpuKernelNodeTask() override = default;
 
+  Status Init();
+
  private:
   Status Execute(TaskContext &context) override;
+  Status PrepareInputs(TaskContext &context, std::map<std::string, const Tensor> &named_inputs) const;
+  Status PrepareOutputs(TaskContext &context, std::map<std::string, Tensor> &named_outputs) const;
+  Status UpdateOutputs(TaskContext &context, std::map<std::string, Tensor> &named_outputs) const;
+
+  // output tensors the kernel writes to, one is handed back once no TensorValue views its buffer any more
+  struct OutputTensorPool {
+    std::mutex mu;
+    std::map<int, std::vector<Tensor>> free_tensors;
+  };
+  Status AcquireOutputTensor(int index, const GeTensorDesc &output_desc, size_t size, Tensor &tensor) const;
+  static void ReleaseOutputTensor(const std::weak_ptr<OutputTensorPool> &pool, int index, const Tensor &tensor);
+
+  // resolved once at load time, reused by every iteration
+  std::unique_ptr<HostCpuOp> op_kernel_;
+  std::vector<std::string> input_names_;
+  std::vector<std::string> output_names_;
+  std::shared_ptr<OutputTensorPool> output_tensor_pool_ = std::make_shared<OutputTensorPool>();
 };
 
 class HostCpuNodeTask : public HostNodeTaskBase {
@@ -50,8 +76,13 @@ class HostCpuNodeTask : public HostNodeTaskBase {
   explicit HostCpuNodeTask(const NodePtr &node) : HostNodeTaskBase(node) {}
   ~HostCpuNodeTask() override = default;
 
+  Status Init();
+
  private:
   Status Execute(TaskContext &context) override;
+
+  // created once at load time, host kernels keep no state across executions
+  std::shared_ptr<host_cpu::Kernel> host_kernel_;
 };
 
 class HostCpuNodeExecutor : public NodeExecutor {
@@ -32,7 +32,12 @@ const char *const kEngineNameHostCpu = "DNN_VM_HOST_CPU_OP_STORE";
 }  // namespace
 Status NodeExecutor::PrepareTask(NodeTask &task, TaskContext &context) const {
   GE_CHK_STATUS_RET_NOLOG(context.AllocateOutputs());
-  GE_CHK_STATUS_RET_NOLOG(task.UpdateTilingData(context));  // update op_desc before alloc ws
+  // update op_desc before alloc ws
+  if (context.GetFrozenTiling() != nullptr) {
+    GE_CHK_STATUS_RET_NOLOG(task.RestoreTilingData(context, *context.GetFrozenTiling()));
+  } else {
+    GE_CHK_STATUS_RET_NOLOG(task.UpdateTilingData(context));
+  }
   GE_CHK_STATUS_RET_NOLOG(context.AllocateWorkspaces());
   GE_CHK_STATUS_RET_NOLOG(task.UpdateArgs(context));
   return SUCCESS;
@@ -27,6 +27,13 @@ const uint32_t MEMORY_ALIGN_RATIO = 2;
 const uint32_t MEMORY_ALIGN_SIZE = 32;
 namespace hybrid {
 class HybridModel;
+// Tiling data of a node task for one set of shapes
+class TilingSnapshot {
+ public:
+  TilingSnapshot() = default;
+  virtual ~TilingSnapshot() = default;
+};
+
 // Base class of Node Task
 class NodeTask {
  public:
@@ -40,6 +47,24 @@ class NodeTask {
    */
   virtual Status UpdateTilingData(TaskContext &context) { return SUCCESS; }
 
+  /**
+   * Save tiling data updated for current shapes
+   * @param context             instance of TaskContext
+   * @param snapshot            saved tiling data, kept null if the task has no tiling data
+   * @return SUCCESS on success, error code otherwise
+   */
+  virtual Status SaveTilingData(TaskContext &context, std::unique_ptr<TilingSnapshot> &snapshot) { return SUCCESS; }
+
+  /**
+   * Restore tiling data saved by SaveTilingData instead of updating it, the shapes should be the saved ones
+   * @param context             instance of TaskContext
+   * @param snapshot            saved tiling data
+   * @return SUCCESS on success, error code otherwise
+   */
+  virtual Status RestoreTilingData(TaskContext &context, const TilingSnapshot &snapshot) {
+    return UpdateTilingData(context);
+  }
+
   /**
    * Init
    * @param context             instance of TaskContext
@@ -30,9 +30,22 @@ TaskContext::TaskContext(GraphExecutionContext *execution_context, const NodeIte
 
 TaskContext::~TaskContext() {
   GELOGD("[%s] TaskContext destroyed.", node_item_->NodeName().c_str());
+  Release();
+}
+
+void TaskContext::Reset() {
+  Release();
+  force_infer_shape_ = false;
+  status_ = SUCCESS;
+  iteration_ = execution_context_->iteration;
+  ref_count_.store(0);
+}
+
+void TaskContext::Release() {
   for (auto ws_addr : workspaces_) {
     execution_context_->allocator->Deallocate(ws_addr);
   }
+  workspaces_.clear();
 
   // release output
   for (int i = 0; i < NumOutputs(); ++i) {
@@ -43,6 +56,15 @@ TaskContext::~TaskContext() {
   }
 }
 
+void TaskContext::SetRefCount(int ref_count) { ref_count_.store(ref_count); }
+
+void TaskContext::Unref() {
+  if (ref_count_.fetch_sub(1) == 1) {
+    GELOGD("[%s] Release resources of task context.", node_item_->NodeName().c_str());
+    Release();
+  }
+}
+
 std::unique_ptr<TaskContext> TaskContext::Create(const NodeItem &node_item, GraphExecutionContext *execution_context,
                                                  SubgraphContext *subgraph_context) {
   GELOGI("[%s] To create task context, input start = %d, num_inputs = %d, output start = %d, num_outputs = %d.",
@@ -196,7 +218,9 @@ Status TaskContext::AllocateOutput(int index, const GeTensorDesc &tensor_desc, T
     GELOGD("source node of %s:%d = %s, op_type = %s", node_item_->NodeName().c_str(), index,
            ref_node->GetName().c_str(), ref_node->GetType().c_str());
 
-    TensorValue *ref_tensor = execution_context_->model->GetVariable(ref_node->GetName());
+    TensorValue *ref_tensor = static_cast<size_t>(index) < node_item_->ref_output_tensors.size()
+                                ? node_item_->ref_output_tensors[index]
+                                : nullptr;
     GE_CHECK_NOTNULL(ref_tensor);
     outputs_start_[index] = *ref_tensor;
   } else {
@@ -363,7 +387,7 @@ bool TaskContext::IsForceInferShape() const { return force_infer_shape_; }
 
 void TaskContext::SetForceInferShape(bool force_infer_shape) { force_infer_shape_ = force_infer_shape; }
 
-void TaskContext::NodeDone() { subgraph_context_->NodeDone(node_item_->node); }
+void TaskContext::NodeDone() { subgraph_context_->NodeDone(*node_item_); }
 
 void TaskContext::OnError(Status error) {
   subgraph_context_->OnError(error);
@@ -17,6 +17,7 @@
 #ifndef GE_HYBRID_KERNEL_TASK_CONTEXT_H_
 #define GE_HYBRID_KERNEL_TASK_CONTEXT_H_
 
+#include <atomic>
 #include <map>
 #include <mutex>
 #include <vector>
@@ -31,6 +32,7 @@ namespace ge {
 namespace hybrid {
 class GraphExecutionContext;
 class SubgraphContext;
+class TilingSnapshot;
 
 class TaskContext {
  public:
@@ -39,6 +41,16 @@ class TaskContext {
 
   ~TaskContext();
 
+  // reset for next execution of the node, resources of the last execution are released if still held
+  void Reset();
+
+  // release workspaces and outputs of the execution
+  void Release();
+
+  // set number of parties which use the resources of the execution, the last one to call Unref releases them
+  void SetRefCount(int ref_count);
+  void Unref();
+
   int NumInputs() const;
   int NumOutputs() const;
   size_t NumWorkspaces() const;
@@ -91,6 +103,10 @@ class TaskContext {
 
   bool IsForceInferShape() const;
   void SetForceInferShape(bool force_infer_shape);
+
+  // tiling data restored by the task instead of updating it, null if tiling data is to be updated
+  const TilingSnapshot *GetFrozenTiling() const { return frozen_tiling_; }
+  void SetFrozenTiling(const TilingSnapshot *frozen_tiling) { frozen_tiling_ = frozen_tiling; }
   void *handle_ = nullptr;
 
  private:
@@ -101,6 +117,7 @@ class TaskContext {
 
   const NodeItem *node_item_ = nullptr;
   bool force_infer_shape_ = false;
+  const TilingSnapshot *frozen_tiling_ = nullptr;
   GraphExecutionContext *execution_context_;
   SubgraphContext *subgraph_context_;
   TensorValue *inputs_start_ = nullptr;
@@ -108,6 +125,7 @@ class TaskContext {
   Status status_ = SUCCESS;
   std::vector<void *> workspaces_;
   uint64_t iteration_ = 0;
+  std::atomic<int> ref_count_{0};
 };
 }  // namespace hybrid
 }  // namespace ge
@@ -97,7 +97,7 @@ Status GELib::InnerInitialize(const map<string, string> &options) {
   GELOGI("GE System initial.");
   GE_TIMESTAMP_START(SystemInitialize);
   Status initSystemStatus = SystemInitialize(options);
-  GE_TIMESTAMP_END(SystemInitialize, "InnerInitialize::SystemInitialize");
+  GE_TIMESTAMP_EVENT_END(SystemInitialize, "InnerInitialize::SystemInitialize");
   if (initSystemStatus != SUCCESS) {
     GELOGE(initSystemStatus);
     RollbackInit();
@@ -107,7 +107,7 @@ Status GELib::InnerInitialize(const map<string, string> &options) {
   GELOGI("engineManager initial.");
   GE_TIMESTAMP_START(EngineInitialize);
   Status initEmStatus = engineManager_.Initialize(options);
-  GE_TIMESTAMP_END(EngineInitialize, "InnerInitialize::EngineInitialize");
+  GE_TIMESTAMP_EVENT_END(EngineInitialize, "InnerInitialize::EngineInitialize");
   if (initEmStatus != SUCCESS) {
     GELOGE(initEmStatus);
     RollbackInit();
@@ -117,7 +117,7 @@ Status GELib::InnerInitialize(const map<string, string> &options) {
   GELOGI("opsManager initial.");
   GE_TIMESTAMP_START(OpsManagerInitialize);
   Status initOpsStatus = opsManager_.Initialize(options);
-  GE_TIMESTAMP_END(OpsManagerInitialize, "InnerInitialize::OpsManagerInitialize");
+  GE_TIMESTAMP_EVENT_END(OpsManagerInitialize, "InnerInitialize::OpsManagerInitialize");
   if (initOpsStatus != SUCCESS) {
     GELOGE(initOpsStatus);
     RollbackInit();
@@ -127,7 +127,7 @@ Status GELib::InnerInitialize(const map<string, string> &options) {
   GELOGI("sessionManager initial.");
   GE_TIMESTAMP_START(SessionManagerInitialize);
   Status initSmStatus = sessionManager_.Initialize(options);
-  GE_TIMESTAMP_END(SessionManagerInitialize, "InnerInitialize::SessionManagerInitialize");
+  GE_TIMESTAMP_EVENT_END(SessionManagerInitialize, "InnerInitialize::SessionManagerInitialize");
   if (initSmStatus != SUCCESS) {
     GELOGE(initSmStatus);
     RollbackInit();
@@ -136,8 +136,8 @@ Status GELib::InnerInitialize(const map<string, string> &options) {
 
   GELOGI("Start to initialize HostCpuEngine");
   GE_TIMESTAMP_START(HostCpuEngineInitialize);
-  Status initHostCpuEngineStatus = HostCpuEngine::GetInstance().Initialize();
-  GE_TIMESTAMP_END(HostCpuEngineInitialize, "InnerInitialize::HostCpuEngineInitialize");
+  Status initHostCpuEngineStatus = HostCpuEngine::GetInstance().Initialize(options);
+  GE_TIMESTAMP_EVENT_END(HostCpuEngineInitialize, "InnerInitialize::HostCpuEngineInitialize");
   if (initHostCpuEngineStatus != SUCCESS) {
     GELOGE(initHostCpuEngineStatus, "Failed to initialize HostCpuEngine");
     RollbackInit();
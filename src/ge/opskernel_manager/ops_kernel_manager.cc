@@ -18,6 +18,7 @@
 
 #include <dlfcn.h>
 #include <algorithm>
+#include <cstdlib>
 #include <iostream>
 #include <utility>
 
@@ -27,6 +28,7 @@
 #include "../init/gelib.h"
 #include "framework/common/debug/ge_log.h"
 #include "ge/ge_api.h"
+#include "graph/common/ge_call_wrapper.h"
 #include "proto/optimizer_priority.pb.h"
 
 namespace {
@@ -34,8 +36,18 @@ const char *const kInitialize = "Initialize";
 const char *const kGetOpsKernelInfoStores = "GetOpsKernelInfoStores";
 const char *const kGetGraphOptimizerObjs = "GetGraphOptimizerObjs";
 const char *const kFinalize = "Finalize";
+const char *const kOpsKernelInfoCacheFileName = "ops_kernel_info.cache";
+const char kOpsKernelInfoCacheSeparator = '\t';
+// op type, engine, opKernelLib, computeCost, flagPartial, flagAsync, isAtomic, opFileName, opFuncName
+const size_t kOpsKernelInfoCacheFieldNum = 9;
 
 std::mutex ops_kernel_info_mutex;
+
+// returned by the getters once the deferred initialization of plugins failed
+const std::map<std::string, std::vector<ge::OpInfo>> kEmptyOpsKernelInfo;
+const std::map<std::string, ge::OpsKernelInfoStorePtr> kEmptyOpsKernelInfoStores;
+const std::map<std::string, ge::GraphOptimizerPtr> kEmptyGraphOptimizers;
+const std::vector<std::pair<std::string, ge::GraphOptimizerPtr>> kEmptyGraphOptimizersByPriority;
 }  // namespace
 
 namespace ge {
@@ -78,51 +90,103 @@ Status OpsKernelManager::Initialize(const map<string, string> &options_const) {
   GetExternalEnginePath(extern_engine_path, options);
   GELOGI("OPTION_EXEC_EXTERN_PLUGIN_PATH=%s.", extern_engine_path.c_str());
 
+  iter = options.find(OPTION_EXEC_FAST_STARTUP);
+  lazy_init_ = (iter != options.end()) && (iter->second == "1");
+  plugin_manager_.SetFastLoad(lazy_init_);
+
   op_tiling_manager_.LoadSo();
 
+  GE_TIMESTAMP_START(LoadPlugins);
   ret = plugin_manager_.LoadSo(extern_engine_path, func_check_list);
-  if (ret == SUCCESS) {
-    initialize_ = options;
-    Status rst0 = plugin_manager_.InvokeAll<map<string, string> &, Status>(kInitialize, initialize_);
-    if (rst0 == FAILED) {
-      GELOGE(GE_OPS_GET_NO_VALID_SO);
-      return GE_OPS_GET_NO_VALID_SO;
-    }
-    Status rst1 =
-      plugin_manager_.InvokeAll<map<string, OpsKernelInfoStorePtr> &>(kGetOpsKernelInfoStores, ops_kernel_store_);
-    if (rst1 != SUCCESS) {
-      GELOGW("Initialize OpsKernelInfo failed.");
-    }
-    Status rst2 =
-      plugin_manager_.InvokeAll<map<string, GraphOptimizerPtr> &>(kGetGraphOptimizerObjs, graph_optimizers_);
-    if (rst2 != SUCCESS) {
-      GELOGW("Initialize GraphOptimizerObjs failed.");
-    }
+  GE_TIMESTAMP_EVENT_END(LoadPlugins, "OpsKernelManager::LoadPlugins");
+  if (ret != SUCCESS) {
+    GELOGE(ret, "Failed to find any valid so file.");
+    return ret;
+  }
 
-    ret = CheckPluginPtr();
-    if (ret != SUCCESS) {
-      return ret;
-    }
-    ret = InitOpKernelInfoStores(options);
+  initialize_ = options;
+  if (lazy_init_) {
+    InitOpsKernelInfoCache(options);
+    GELOGI("Initialization of ops kernel plugins is deferred until they are used.");
+  } else {
+    ret = InitializePlugins();
     if (ret != SUCCESS) {
       return ret;
     }
+  }
+  init_flag_ = true;
+  return SUCCESS;
+}
+
+Status OpsKernelManager::InitializePlugins() {
+  GE_TIMESTAMP_START(InitializePlugins);
+  Status rst0 = plugin_manager_.InvokeAll<map<string, string> &, Status>(kInitialize, initialize_);
+  if (rst0 == FAILED) {
+    GELOGE(GE_OPS_GET_NO_VALID_SO);
+    return GE_OPS_GET_NO_VALID_SO;
+  }
+  Status rst1 =
+    plugin_manager_.InvokeAll<map<string, OpsKernelInfoStorePtr> &>(kGetOpsKernelInfoStores, ops_kernel_store_);
+  if (rst1 != SUCCESS) {
+    GELOGW("Initialize OpsKernelInfo failed.");
+  }
+  Status rst2 =
+    plugin_manager_.InvokeAll<map<string, GraphOptimizerPtr> &>(kGetGraphOptimizerObjs, graph_optimizers_);
+  if (rst2 != SUCCESS) {
+    GELOGW("Initialize GraphOptimizerObjs failed.");
+  }
+
+  Status ret = CheckPluginPtr();
+  if (ret != SUCCESS) {
+    return ret;
+  }
+  ret = InitOpKernelInfoStores(initialize_);
+  if (ret != SUCCESS) {
+    return ret;
+  }
+  // the cached op infos are the ones the plugins give, and references to them may already be held
+  if (!ops_kernel_info_cached_) {
     InitOpsKernelInfo();
-    ret = InitGraphOptimzers(options);
-    if (ret != SUCCESS) {
-      return ret;
-    }
-    ret = InitGraphOptimizerPriority();
-    if ((ret != SUCCESS)) {
-      GELOGE(ret, "Init graph optimizer priority failed.");
-      return ret;
-    }
-    init_flag_ = true;
-    return SUCCESS;
-  } else {
-    GELOGE(ret, "Failed to find any valid so file.");
+  }
+  ret = InitGraphOptimzers(initialize_);
+  if (ret != SUCCESS) {
+    return ret;
+  }
+  ret = InitGraphOptimizerPriority();
+  if ((ret != SUCCESS)) {
+    GELOGE(ret, "Init graph optimizer priority failed.");
     return ret;
   }
+  GE_TIMESTAMP_EVENT_END(InitializePlugins, "OpsKernelManager::InitializePlugins");
+  return SUCCESS;
+}
+
+Status OpsKernelManager::EnsurePluginsInitialized() const {
+  if (!lazy_init_) {
+    return SUCCESS;
+  }
+  if (plugins_initialized_.load(std::memory_order_acquire)) {
+    return plugins_init_status_;
+  }
+  std::lock_guard<std::recursive_mutex> lock(plugin_init_mutex_);
+  if (plugins_initialized_.load(std::memory_order_relaxed)) {
+    return plugins_init_status_;
+  }
+  // plugins may query the manager while being initialized, they see the partial state as in eager initialization
+  if (plugins_initializing_) {
+    return SUCCESS;
+  }
+  plugins_initializing_ = true;
+  // the plugins are part of the manager's state which is only deferred, not changed, by lazy initialization
+  auto ret = const_cast<OpsKernelManager *>(this)->InitializePlugins();
+  plugins_initializing_ = false;
+  if (ret != SUCCESS) {
+    // not retried, the failure is returned as eager initialization would have returned it from Initialize
+    GELOGE(ret, "Deferred initialization of ops kernel plugins failed.");
+  }
+  plugins_init_status_ = ret;
+  plugins_initialized_.store(true, std::memory_order_release);
+  return ret;
 }
 
 void OpsKernelManager::GetExternalEnginePath(std::string &extern_engine_path, const std::map<string, string> &options) {
@@ -312,6 +376,13 @@ Status OpsKernelManager::Finalize() {
     GELOGW("Finalize is not allowed, initialize first is necessary.");
     return SUCCESS;
   }
+  std::lock_guard<std::recursive_mutex> lock(plugin_init_mutex_);
+  if (lazy_init_ && !plugins_initialized_.load(std::memory_order_relaxed)) {
+    GELOGI("Ops kernel plugins are never used, no need to finalize them.");
+    init_flag_ = false;
+    return SUCCESS;
+  }
+  SaveOpsKernelInfoCache();
   GELOGI("free ops kernel resource.");
   for (auto iter = ops_kernel_store_.begin(); iter != ops_kernel_store_.end(); ++iter) {
     GELOGI("OpsKernelStore finalize, name: %s.", (iter->first).c_str());
@@ -341,6 +412,19 @@ Status OpsKernelManager::Finalize() {
 }
 
 const vector<OpInfo> &OpsKernelManager::GetOpsKernelInfo(const string &op_type) {
+  // the cache holds all the op infos of the plugins, an op type not in it has none
+  if (ops_kernel_info_cached_) {
+    std::lock_guard<std::mutex> lock(ops_kernel_info_mutex);
+    auto find = ops_kernel_info_.find(op_type);
+    if (find != ops_kernel_info_.end()) {
+      return find->second;
+    }
+    GELOGW("Failed to get opsKernelInfo object by type: %s.", op_type.c_str());
+    return empty_op_info_;
+  }
+  if (EnsurePluginsInitialized() != SUCCESS) {
+    return empty_op_info_;
+  }
   std::lock_guard<std::mutex> lock(ops_kernel_info_mutex);
 
   auto find = ops_kernel_info_.find(op_type);
@@ -358,11 +442,17 @@ const vector<OpInfo> &OpsKernelManager::GetOpsKernelInfo(const string &op_type)
 }
 
 const map<string, vector<OpInfo>> &OpsKernelManager::GetAllOpsKernelInfo() const {
+  if (!ops_kernel_info_cached_ && (EnsurePluginsInitialized() != SUCCESS)) {
+    return kEmptyOpsKernelInfo;
+  }
   std::lock_guard<std::mutex> lock(ops_kernel_info_mutex);
   return ops_kernel_info_;
 }
 
 OpsKernelInfoStorePtr OpsKernelManager::GetOpsKernelInfoStore(const std::string &name) const {
+  if (EnsurePluginsInitialized() != SUCCESS) {
+    return nullptr;
+  }
   auto find = ops_kernel_store_.find(name);
   if (find != ops_kernel_store_.end()) {
     return find->second;
@@ -373,17 +463,31 @@ OpsKernelInfoStorePtr OpsKernelManager::GetOpsKernelInfoStore(const std::string
 }
 
 const map<string, OpsKernelInfoStorePtr> &OpsKernelManager::GetAllOpsKernelInfoStores() const {
+  if (EnsurePluginsInitialized() != SUCCESS) {
+    return kEmptyOpsKernelInfoStores;
+  }
   return ops_kernel_store_;
 }
 
-const map<string, GraphOptimizerPtr> &OpsKernelManager::GetAllGraphOptimizerObjs() const { return graph_optimizers_; }
+const map<string, GraphOptimizerPtr> &OpsKernelManager::GetAllGraphOptimizerObjs() const {
+  if (EnsurePluginsInitialized() != SUCCESS) {
+    return kEmptyGraphOptimizers;
+  }
+  return graph_optimizers_;
+}
 
 const vector<pair<string, GraphOptimizerPtr>> &OpsKernelManager::GetAllGraphOptimizerObjsByPriority() const {
+  if (EnsurePluginsInitialized() != SUCCESS) {
+    return kEmptyGraphOptimizersByPriority;
+  }
   return graph_optimizers_by_priority_;
 }
 
 void OpsKernelManager::GetGraphOptimizerByEngine(const std::string &engine_name,
                                                  vector<GraphOptimizerPtr> &graph_optimizer) {
+  if (EnsurePluginsInitialized() != SUCCESS) {
+    return;
+  }
   for (const auto &it : graph_optimizers_) {
     GraphOptimizerAttribute attrs;
     if (it.second->GetAttributes(attrs) != SUCCESS) {
@@ -439,6 +543,89 @@ Status OpsKernelManager::InitGraphOptimizerPriority() {
   return SUCCESS;
 }
 
+void OpsKernelManager::InitOpsKernelInfoCache(const map<string, string> &options) {
+  auto iter = options.find(OPTION_EXEC_STARTUP_CACHE_PATH);
+  if ((iter == options.end()) || iter->second.empty()) {
+    return;
+  }
+  std::shared_ptr<GELib> instance_ptr = ge::GELib::GetInstance();
+  if (instance_ptr == nullptr) {
+    GELOGW("GELib is not initialized, ops kernel info cache is not used.");
+    return;
+  }
+  // the op infos come from the ops kernel plugins, and are ordered by the compute cost of the engine plugins
+  vector<string> so_paths = plugin_manager_.GetSoPathList();
+  const auto &engine_so_paths = instance_ptr->DNNEngineManagerObj().GetEngineSoPaths();
+  so_paths.insert(so_paths.end(), engine_so_paths.begin(), engine_so_paths.end());
+  ops_kernel_info_fingerprint_ = PluginManager::GetFingerprint(so_paths);
+  for (const auto &option : options) {
+    ops_kernel_info_fingerprint_ += option.first + "=" + option.second + ";";
+  }
+  ops_kernel_info_cache_file_ = iter->second + "/" + kOpsKernelInfoCacheFileName;
+  LoadOpsKernelInfoCache();
+}
+
+void OpsKernelManager::LoadOpsKernelInfoCache() {
+  vector<string> lines;
+  PluginManager::LoadStartupCache(ops_kernel_info_cache_file_, ops_kernel_info_fingerprint_, lines);
+  map<string, vector<OpInfo>> ops_kernel_info;
+  for (const auto &line : lines) {
+    vector<string> fields;
+    size_t start = 0;
+    size_t pos = line.find(kOpsKernelInfoCacheSeparator);
+    while (pos != string::npos) {
+      fields.emplace_back(line.substr(start, pos - start));
+      start = pos + 1;
+      pos = line.find(kOpsKernelInfoCacheSeparator, start);
+    }
+    fields.emplace_back(line.substr(start));
+    if (fields.size() != kOpsKernelInfoCacheFieldNum) {
+      GELOGW("Invalid line in ops kernel info cache %s, the cache is not used.", ops_kernel_info_cache_file_.c_str());
+      return;
+    }
+    OpInfo op_info;
+    op_info.engine = fields[1];
+    op_info.opKernelLib = fields[2];
+    op_info.computeCost = static_cast<int>(std::strtol(fields[3].c_str(), nullptr, 10));
+    op_info.flagPartial = (fields[4] == "1");
+    op_info.flagAsync = (fields[5] == "1");
+    op_info.isAtomic = (fields[6] == "1");
+    op_info.opFileName = fields[7];
+    op_info.opFuncName = fields[8];
+    ops_kernel_info[fields[0]].emplace_back(op_info);
+  }
+  if (ops_kernel_info.empty()) {
+    return;
+  }
+  ops_kernel_info_.swap(ops_kernel_info);
+  ops_kernel_info_cached_ = true;
+  GELOGI("%zu op types are found in ops kernel info cache.", ops_kernel_info_.size());
+}
+
+void OpsKernelManager::SaveOpsKernelInfoCache() const {
+  if (ops_kernel_info_cache_file_.empty() || ops_kernel_info_cached_ || (plugins_init_status_ != SUCCESS)) {
+    return;
+  }
+  vector<string> lines;
+  {
+    std::lock_guard<std::mutex> lock(ops_kernel_info_mutex);
+    for (const auto &it : ops_kernel_info_) {
+      for (const auto &op_info : it.second) {
+        string line = it.first;
+        for (const auto &field : {op_info.engine, op_info.opKernelLib, std::to_string(op_info.computeCost),
+                                  string(op_info.flagPartial ? "1" : "0"), string(op_info.flagAsync ? "1" : "0"),
+                                  string(op_info.isAtomic ? "1" : "0"), op_info.opFileName, op_info.opFuncName}) {
+          line += kOpsKernelInfoCacheSeparator + field;
+        }
+        lines.emplace_back(line);
+      }
+    }
+  }
+  if (PluginManager::SaveStartupCache(ops_kernel_info_cache_file_, ops_kernel_info_fingerprint_, lines) == SUCCESS) {
+    GELOGI("Ops kernel info cache saved, %zu op types cached.", ops_kernel_info_.size());
+  }
+}
+
 Status OpsKernelManager::FinalizeOpsKernel() {
   GELOGI("ge invoke ops kernal finalize.");
   Status ret = plugin_manager_.InvokeAll<Status>(kFinalize);
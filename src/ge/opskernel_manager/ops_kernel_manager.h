@@ -17,6 +17,7 @@
 #ifndef GE_OPSKERNEL_MANAGER_OPS_KERNEL_MANAGER_H_
 #define GE_OPSKERNEL_MANAGER_OPS_KERNEL_MANAGER_H_
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
@@ -75,13 +76,21 @@ class OpsKernelManager {
   // get enablePluginFlag
   bool GetEnablePluginFlag() const;
 
+  // in fast startup mode initialize the plugins on their first use, the status of the initialization is kept and
+  // returned to every later caller, and the getters above return nothing once it failed
+  Status EnsurePluginsInitialized() const;
+
  private:
   OpsKernelManager();
   ~OpsKernelManager();
 
   // opsKernelManager initialize, load all opsKernelInfoStore and graph_optimizer
+  // in fast startup mode the plugins are only loaded here, and initialized on first use of any of them
   Status Initialize(const map<string, string> &options);
 
+  // initialize the loaded plugins, and collect their opsKernelInfoStores and graph_optimizers
+  Status InitializePlugins();
+
   // opsKernelManager finalize, unload all opsKernelInfoStore and graph_optimizer
   Status Finalize();
 
@@ -106,6 +115,14 @@ class OpsKernelManager {
   // Finalize other ops kernel resource
   Status FinalizeOpsKernel();
 
+  // in fast startup mode with a startup cache path, load the opsKernelInfo saved by an earlier process with the same
+  // plugins and options, the op infos are then served without initializing the plugins
+  void InitOpsKernelInfoCache(const map<string, string> &options);
+
+  void LoadOpsKernelInfoCache();
+
+  void SaveOpsKernelInfoCache() const;
+
   PluginManager plugin_manager_;
   OpTilingManager op_tiling_manager_;
   // opsKernelInfoStore
@@ -123,6 +140,18 @@ class OpsKernelManager {
 
   bool init_flag_;
 
+  // plugins are initialized lazily in fast startup mode
+  bool lazy_init_ = false;
+  mutable std::recursive_mutex plugin_init_mutex_;
+  mutable std::atomic<bool> plugins_initialized_{false};
+  mutable bool plugins_initializing_ = false;
+  mutable Status plugins_init_status_ = SUCCESS;
+
+  string ops_kernel_info_cache_file_;
+  string ops_kernel_info_fingerprint_;
+  // ops_kernel_info_ is loaded from the startup cache, and is kept when the plugins are initialized
+  bool ops_kernel_info_cached_ = false;
+
   bool enable_fe_flag_ = false;
 
   bool enable_aicpu_flag_ = false;
@@ -22,17 +22,37 @@
 #include "common/dump/dump_properties.h"
 #include "common/util.h"
 #include "framework/common/debug/ge_log.h"
+#include "graph/common/local_context.h"
 #include "graph/ge_context.h"
 #include "graph/ge_global_options.h"
 #include "graph/ge_local_context.h"
 #include "graph/load/new_model_manager/model_manager.h"
 #include "graph/manager/graph_var_manager.h"
+#include "graph/passes/constant_folding_cache.h"
 #include "graph/utils/tensor_adapter.h"
 #include "runtime/mem.h"
 
 namespace ge {
 namespace {
 const int32_t kDumpStatus = 0;
+std::mutex omg_context_mutex;
+
+///
+/// Output nodes designated by the user are consumed by the first run graph, as they were cleared after it.
+/// Each call works on its own copy, so concurrent calls never share the omg context.
+///
+void TakeOmgContext(OmgContext &context) {
+  std::lock_guard<std::mutex> lock(omg_context_mutex);
+  context = domi::GetContext();
+  domi::GetContext().out_nodes_map.clear();
+  domi::GetContext().user_out_nodes.clear();
+}
+
+class LocalOmgContextGuard {
+ public:
+  explicit LocalOmgContextGuard(OmgContext &context) { SetLocalOmgContext(context); }
+  ~LocalOmgContextGuard() { SetLocalOmgContext(domi::GetContext()); }
+};
 
 Status CheckReuseMemoryOption(const std::map<string, string> &options) {
   auto iter = options.find(OPTION_EXEC_DISABLE_REUSED_MEMORY);
@@ -50,7 +70,6 @@ Status CheckReuseMemoryOption(const std::map<string, string> &options) {
 }
 }  // namespace
 
-static std::mutex mutex_;  // BuildGraph and RunGraph use
 bool InnerSession::is_dump_server_inited_ = false;
 InnerSession::InnerSession(uint64_t session_id, const std::map<string, string> &options)
     : init_flag_(false), session_id_(session_id), options_(options), graph_manager_(domi::GetContext()) {}
@@ -121,7 +140,16 @@ Status InnerSession::Finalize() {
   }
 
   ModelManager::GetInstance()->DestroyAicpuSession(session_id_);
+  ConstantFoldingCache::Instance().RemoveSession(session_id_);
   init_flag_ = false;
+  {
+    // checkpoints in writing read snapshots in host memory only, but the engine holds a stream of the device
+    std::lock_guard<std::mutex> checkpoint_lock(checkpoint_mutex_);
+    if (checkpoint_engine_ != nullptr) {
+      GE_CHK_STATUS(checkpoint_engine_->Wait(), "[InnerSession:%lu] write var checkpoint failed.", session_id_);
+      checkpoint_engine_.reset();
+    }
+  }
   // release var memory
   GELOGI("VarManager free var memory.");
   (void)VarManager::Instance(session_id_)->FreeVarMemory();
@@ -137,6 +165,25 @@ Status InnerSession::GetVariable(const std::string &name, Tensor &val) {
   return graph_manager_.GetVariable(name, val);
 }
 
+Status InnerSession::SaveVarCheckpoint(const std::string &file_path, bool incremental) {
+  if (!init_flag_) {
+    GELOGE(GE_SESS_INIT_FAILED, "[InnerSession:%lu] initialize failed.", session_id_);
+    return GE_SESS_INIT_FAILED;
+  }
+  UpdateThreadContext(std::map<std::string, std::string>{});
+  std::lock_guard<std::mutex> lock(checkpoint_mutex_);
+  if (checkpoint_engine_ == nullptr) {
+    checkpoint_engine_.reset(new (std::nothrow) VarCheckpointEngine(session_id_));
+    GE_CHECK_NOTNULL(checkpoint_engine_);
+  }
+  return checkpoint_engine_->Save(file_path, incremental);
+}
+
+Status InnerSession::WaitVarCheckpoint() {
+  std::lock_guard<std::mutex> lock(checkpoint_mutex_);
+  return checkpoint_engine_ == nullptr ? SUCCESS : checkpoint_engine_->Wait();
+}
+
 Status InnerSession::AddGraph(uint32_t graph_id, const Graph &graph) {
   std::map<std::string, std::string> options;
   return AddGraph(graph_id, graph, options);
@@ -162,36 +209,84 @@ Status InnerSession::AddGraph(uint32_t graph_id, const Graph &graph,
 
 Status InnerSession::RunGraph(uint32_t graph_id, const std::vector<Tensor> &inputs, std::vector<Tensor> &outputs) {
   GELOGI("[InnerSession:%lu] run graph on session, graph_id=%u.", session_id_, graph_id);
-  if (mutex_.try_lock()) {
-    std::lock_guard<std::mutex> lock(mutex_, std::adopt_lock);
-    if (!init_flag_) {
-      GELOGE(GE_SESS_INIT_FAILED, "[InnerSession:%lu] initialize failed.", session_id_);
-      return GE_SESS_INIT_FAILED;
-    }
-    UpdateThreadContext(graph_id);
-    vector<GeTensor> geInputs;
-    for (auto &item : inputs) {
-      geInputs.push_back(TensorAdapter::AsGeTensor(item));
-    }
-    vector<GeTensor> geOutputs;
-    Status ret = graph_manager_.RunGraph(graph_id, geInputs, geOutputs, session_id_);
-    domi::GetContext().out_nodes_map.clear();
-    domi::GetContext().user_out_nodes.clear();
-    if (ret != SUCCESS) {
-      GELOGE(ret, "[InnerSession:%lu] run graph failed, graph_id=%u.", session_id_, graph_id);
-      return ret;
-    }
-    outputs.clear();
-    for (auto &item : geOutputs) {
-      outputs.push_back(TensorAdapter::AsTensor(item));
-    }
+  if (!init_flag_) {
+    GELOGE(GE_SESS_INIT_FAILED, "[InnerSession:%lu] initialize failed.", session_id_);
+    return GE_SESS_INIT_FAILED;
+  }
+  UpdateThreadContext(graph_id);
+  OmgContext omg_context;
+  TakeOmgContext(omg_context);
+  LocalOmgContextGuard omg_context_guard(omg_context);
+  vector<GeTensor> geInputs;
+  for (auto &item : inputs) {
+    geInputs.push_back(TensorAdapter::AsGeTensor(item));
+  }
+  vector<GeTensor> geOutputs;
+  Status ret = graph_manager_.RunGraph(graph_id, geInputs, geOutputs, session_id_);
+  if (ret != SUCCESS) {
+    GELOGE(ret, "[InnerSession:%lu] run graph failed, graph_id=%u.", session_id_, graph_id);
+    return ret;
+  }
+  outputs.clear();
+  for (auto &item : geOutputs) {
+    outputs.push_back(TensorAdapter::AsTensor(item));
+  }
 
-    GELOGI("[InnerSession:%lu] run graph success, graph_id=%u.", session_id_, graph_id);
-    return SUCCESS;
-  } else {
-    GELOGE(GE_SESS_ALREADY_RUNNING, "[InnerSession:%lu] run graph failed, graph_id=%u.", session_id_, graph_id);
-    return GE_SESS_ALREADY_RUNNING;
+  GELOGI("[InnerSession:%lu] run graph success, graph_id=%u.", session_id_, graph_id);
+  return SUCCESS;
+}
+
+Status InnerSession::RegisterIoBinding(uint32_t graph_id, const std::vector<InputTensorInfo> &inputs,
+                                       const std::vector<InputTensorInfo> &outputs, bool is_device_memory) {
+  if (!init_flag_) {
+    GELOGE(GE_SESS_INIT_FAILED, "[InnerSession:%lu] initialize failed.", session_id_);
+    return GE_SESS_INIT_FAILED;
+  }
+  GraphIoBinding io_binding;
+  io_binding.is_device_memory = is_device_memory;
+  for (const auto &input : inputs) {
+    GE_CHK_BOOL_RET_STATUS(input.length >= 0, PARAM_INVALID, "[InnerSession:%lu] input length %ld is invalid.",
+                           session_id_, input.length);
+    io_binding.inputs.emplace_back(input.data, static_cast<uint64_t>(input.length), false);
+    io_binding.input_desc.emplace_back(GeShape(input.dims), FORMAT_ND, static_cast<DataType>(input.data_type));
   }
+  for (const auto &output : outputs) {
+    GE_CHK_BOOL_RET_STATUS(output.length >= 0, PARAM_INVALID, "[InnerSession:%lu] output length %ld is invalid.",
+                           session_id_, output.length);
+    io_binding.outputs.emplace_back(output.data, static_cast<uint64_t>(output.length), false);
+  }
+  return graph_manager_.RegisterIoBinding(graph_id, io_binding);
+}
+
+Status InnerSession::UnregisterIoBinding(uint32_t graph_id) {
+  if (!init_flag_) {
+    GELOGE(GE_SESS_INIT_FAILED, "[InnerSession:%lu] initialize failed.", session_id_);
+    return GE_SESS_INIT_FAILED;
+  }
+  return graph_manager_.UnregisterIoBinding(graph_id);
+}
+
+Status InnerSession::RunGraphWithIoBinding(uint32_t graph_id, std::vector<TensorDesc> &output_desc) {
+  GELOGI("[InnerSession:%lu] run graph with io binding on session, graph_id=%u.", session_id_, graph_id);
+  if (!init_flag_) {
+    GELOGE(GE_SESS_INIT_FAILED, "[InnerSession:%lu] initialize failed.", session_id_);
+    return GE_SESS_INIT_FAILED;
+  }
+  UpdateThreadContext(graph_id);
+  OmgContext omg_context;
+  TakeOmgContext(omg_context);
+  LocalOmgContextGuard omg_context_guard(omg_context);
+  std::vector<GeTensorDesc> ge_output_desc;
+  Status ret = graph_manager_.RunGraphWithIoBinding(graph_id, ge_output_desc);
+  if (ret != SUCCESS) {
+    GELOGE(ret, "[InnerSession:%lu] run graph with io binding failed, graph_id=%u.", session_id_, graph_id);
+    return ret;
+  }
+  output_desc.clear();
+  for (const auto &desc : ge_output_desc) {
+    output_desc.push_back(TensorAdapter::GeTensorDesc2TensorDesc(desc));
+  }
+  return SUCCESS;
 }
 
 Status InnerSession::RemoveGraph(uint32_t graph_id) {
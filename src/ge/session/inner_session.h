@@ -17,12 +17,15 @@
 #ifndef GE_SESSION_INNER_SESSION_H_
 #define GE_SESSION_INNER_SESSION_H_
 
+#include <atomic>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 #include "framework/common/ge_types.h"
 #include "ge/ge_api_types.h"
 #include "graph/manager/graph_manager.h"
+#include "graph/manager/var_checkpoint_engine.h"
 
 namespace ge {
 class InnerSession {
@@ -45,6 +48,14 @@ class InnerSession {
 
   Status RunGraphAsync(uint32_t graph_id, const std::vector<InputTensorInfo> &inputs, RunAsyncCallback callback);
 
+  // bind user buffers to the graph, length of an output buffer is its capacity
+  Status RegisterIoBinding(uint32_t graph_id, const std::vector<InputTensorInfo> &inputs,
+                           const std::vector<InputTensorInfo> &outputs, bool is_device_memory);
+
+  Status UnregisterIoBinding(uint32_t graph_id);
+
+  Status RunGraphWithIoBinding(uint32_t graph_id, std::vector<TensorDesc> &output_desc);
+
   Status Finalize();
 
   Status GetAllVariables(std::map<std::string, GeTensorDesc> &all_variables);
@@ -56,6 +67,11 @@ class InnerSession {
 
   Status GetVariable(const std::string &name, Tensor &val);
 
+  // snapshot the variables and write them to file in background, graphs updating them must not be running
+  Status SaveVarCheckpoint(const std::string &file_path, bool incremental);
+
+  Status WaitVarCheckpoint();
+
   Status RegisterCallBackFunc(
     const std::string &key, const std::function<Status(uint32_t, const std::map<std::string, ge::Tensor> &)> &callback);
 
@@ -68,11 +84,13 @@ class InnerSession {
   Status RemoveDumpProperties();
 
  private:
-  bool init_flag_;
+  std::atomic<bool> init_flag_;
   uint64_t session_id_;
   std::map<string, string> options_;
   GraphManager graph_manager_;
   std::mutex resource_mutex_;  // AddGraph, RemoveGraph and Finalize use
+  std::mutex checkpoint_mutex_;
+  std::unique_ptr<VarCheckpointEngine> checkpoint_engine_;
   void UpdateThreadContext(const std::map<std::string, std::string> &options);
   void UpdateThreadContext(uint32_t graph_id);
   static bool is_dump_server_inited_;
@@ -283,6 +283,99 @@ Status SessionManager::RunGraphAsync(SessionId session_id, uint32_t graph_id,
   return innerSession->RunGraphAsync(graph_id, inputs, callback);
 }
 
+Status SessionManager::RegisterIoBinding(SessionId session_id, uint32_t graph_id,
+                                         const std::vector<InputTensorInfo> &inputs,
+                                         const std::vector<InputTensorInfo> &outputs, bool is_device_memory) {
+  if (!init_flag_) {
+    GELOGE(GE_SESSION_MANAGER_NOT_INIT);
+    return GE_SESSION_MANAGER_NOT_INIT;
+  }
+  SessionPtr innerSession = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::map<SessionId, SessionPtr>::iterator it = session_manager_map_.find(session_id);
+    if (it == session_manager_map_.end()) {
+      return GE_SESSION_NOT_EXIST;
+    } else {
+      innerSession = it->second;
+    }
+  }
+  return innerSession->RegisterIoBinding(graph_id, inputs, outputs, is_device_memory);
+}
+
+Status SessionManager::UnregisterIoBinding(SessionId session_id, uint32_t graph_id) {
+  if (!init_flag_) {
+    GELOGE(GE_SESSION_MANAGER_NOT_INIT);
+    return GE_SESSION_MANAGER_NOT_INIT;
+  }
+  SessionPtr innerSession = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::map<SessionId, SessionPtr>::iterator it = session_manager_map_.find(session_id);
+    if (it == session_manager_map_.end()) {
+      return GE_SESSION_NOT_EXIST;
+    } else {
+      innerSession = it->second;
+    }
+  }
+  return innerSession->UnregisterIoBinding(graph_id);
+}
+
+Status SessionManager::RunGraphWithIoBinding(SessionId session_id, uint32_t graph_id,
+                                             std::vector<TensorDesc> &output_desc) {
+  if (!init_flag_) {
+    GELOGE(GE_SESSION_MANAGER_NOT_INIT);
+    return GE_SESSION_MANAGER_NOT_INIT;
+  }
+  SessionPtr innerSession = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::map<SessionId, SessionPtr>::iterator it = session_manager_map_.find(session_id);
+    if (it == session_manager_map_.end()) {
+      return GE_SESSION_NOT_EXIST;
+    } else {
+      innerSession = it->second;
+    }
+  }
+  return innerSession->RunGraphWithIoBinding(graph_id, output_desc);
+}
+
+Status SessionManager::SaveVarCheckpoint(SessionId session_id, const std::string &file_path, bool incremental) {
+  if (!init_flag_) {
+    GELOGE(GE_SESSION_MANAGER_NOT_INIT);
+    return GE_SESSION_MANAGER_NOT_INIT;
+  }
+  SessionPtr innerSession = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::map<SessionId, SessionPtr>::iterator it = session_manager_map_.find(session_id);
+    if (it == session_manager_map_.end()) {
+      return GE_SESSION_NOT_EXIST;
+    } else {
+      innerSession = it->second;
+    }
+  }
+  return innerSession->SaveVarCheckpoint(file_path, incremental);
+}
+
+Status SessionManager::WaitVarCheckpoint(SessionId session_id) {
+  if (!init_flag_) {
+    GELOGE(GE_SESSION_MANAGER_NOT_INIT);
+    return GE_SESSION_MANAGER_NOT_INIT;
+  }
+  SessionPtr innerSession = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::map<SessionId, SessionPtr>::iterator it = session_manager_map_.find(session_id);
+    if (it == session_manager_map_.end()) {
+      return GE_SESSION_NOT_EXIST;
+    } else {
+      innerSession = it->second;
+    }
+  }
+  return innerSession->WaitVarCheckpoint();
+}
+
 Status SessionManager::GetVariables(SessionId session_id, const std::vector<std::string> &var_names,
                                     std::vector<Tensor> &var_values) {
   // step 0: init session manager
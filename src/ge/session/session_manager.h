@@ -124,6 +124,31 @@ class SessionManager {
   Status RunGraphAsync(SessionId session_id, uint32_t graph_id, const std::vector<InputTensorInfo> &inputs,
                        RunAsyncCallback callback);
 
+  ///
+  /// @ingroup ge_session
+  /// @brief bind user buffers to the inputs and outputs of a graph of the session with specific session id
+  /// @param [in] session_id session id
+  /// @param [in] graph_id graph id
+  /// @param [in] inputs input buffers with their data type and shape
+  /// @param [in] outputs output buffers, length of each is its capacity
+  /// @param [in] is_device_memory buffers are device memory or host memory
+  /// @return Status result of function
+  ///
+  Status RegisterIoBinding(SessionId session_id, uint32_t graph_id, const std::vector<InputTensorInfo> &inputs,
+                           const std::vector<InputTensorInfo> &outputs, bool is_device_memory);
+
+  Status UnregisterIoBinding(SessionId session_id, uint32_t graph_id);
+
+  ///
+  /// @ingroup ge_session
+  /// @brief run a graph of the session with specific session id on its bound buffers
+  /// @param [in] session_id session id
+  /// @param [in] graph_id graph id
+  /// @param [out] output_desc real descs of outputs written to the bound buffers
+  /// @return Status result of function
+  ///
+  Status RunGraphWithIoBinding(SessionId session_id, uint32_t graph_id, std::vector<TensorDesc> &output_desc);
+
   ///
   /// @ingroup ge_graph
   /// @brief get variables in the session with specific session id
@@ -134,6 +159,18 @@ class SessionManager {
   ///
   Status GetVariables(SessionId session_id, const std::vector<std::string> &var_names, std::vector<Tensor> &var_values);
 
+  ///
+  /// @ingroup ge_graph
+  /// @brief save the variables of the session with specific session id to a checkpoint file in background
+  /// @param [in] session_id session id
+  /// @param [in] file_path checkpoint file path
+  /// @param [in] incremental save only the variables changed since the last checkpoint
+  /// @return Status result of function
+  ///
+  Status SaveVarCheckpoint(SessionId session_id, const std::string &file_path, bool incremental);
+
+  Status WaitVarCheckpoint(SessionId session_id);
+
   ///
   /// @ingroup ge_graph
   /// @brief me register the callback function to get the result of summary or checkpoin
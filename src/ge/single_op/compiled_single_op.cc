@@ -0,0 +1,176 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "single_op/compiled_single_op.h"
+
+#include "common/ge/ge_util.h"
+#include "framework/common/debug/ge_log.h"
+#include "framework/common/debug/log.h"
+#include "framework/common/types.h"
+#include "graph/common/op_signature.h"
+#include "graph/utils/graph_utils.h"
+#include "runtime/rt.h"
+
+namespace ge {
+CompiledSingleOp::CompiledSingleOp(const std::string &model_name) : model_name_(model_name) {}
+
+CompiledSingleOp::~CompiledSingleOp() {
+  for (auto &weight_base : weight_bases_) {
+    auto rt_ret = rtFree(weight_base.second);
+    GE_IF_BOOL_EXEC(rt_ret != RT_ERROR_NONE, GELOGE(RT_FAILED, "rtFree failed, device id = %d", weight_base.first));
+  }
+  weight_bases_.clear();
+}
+
+Status CompiledSingleOp::Init(const ModelData &model_data) {
+  model_bytes_.assign(reinterpret_cast<const char *>(model_data.model_data), model_data.model_len);
+  auto ret = model_helper_.LoadModel(model_data);
+  if (ret != SUCCESS) {
+    GELOGE(ret, "LoadModel failed");
+    return ret;
+  }
+
+  ge_model_ = model_helper_.GetGeModel();
+  GE_CHECK_NOTNULL(ge_model_);
+  auto compute_graph = GraphUtils::GetComputeGraph(ge_model_->GetGraph());
+  if (compute_graph == nullptr) {
+    GELOGE(PARAM_INVALID, "[%s] compute_graph is null", model_name_.c_str());
+    return PARAM_INVALID;
+  }
+
+  // Kernel binaries are attached to the op descs once here, builders of all streams only read them
+  for (const auto &node : compute_graph->GetDirectNode()) {
+    auto op_desc = node->GetOpDesc();
+    GE_CHECK_NOTNULL(op_desc);
+    auto op_type = op_desc->GetType();
+    if (op_type == DATA_TYPE || op_type == AIPP_DATA_TYPE || op_type == NETOUTPUT) {
+      continue;
+    }
+
+    if (op_type == CONSTANT || op_type == CONSTANTOP) {
+      has_weight_ = true;
+      continue;
+    }
+
+    ge_model_->GetTBEKernelStore().LoadTBEKernelBinToOpDesc(op_desc);
+  }
+
+  return SUCCESS;
+}
+
+bool CompiledSingleOp::IsSameModel(const ModelData &model_data) const {
+  return (model_bytes_.size() == model_data.model_len) &&
+         (model_bytes_.compare(0, model_bytes_.size(), reinterpret_cast<const char *>(model_data.model_data),
+                               model_data.model_len) == 0);
+}
+
+Status CompiledSingleOp::GetWeightBase(uint64_t weight_size, uint8_t *&weight_base) {
+  // streams of the same model may run on different devices, each of them needs its own copy of weights
+  int32_t device_id = 0;
+  auto rt_ret = rtGetDevice(&device_id);
+  if (rt_ret != RT_ERROR_NONE) {
+    GELOGE(RT_FAILED, "rtGetDevice failed, ret = %d", rt_ret);
+    return RT_FAILED;
+  }
+  return GetDeviceWeightBase(device_id, weight_size, weight_base);
+}
+
+Status CompiledSingleOp::GetDeviceWeightBase(int32_t device_id, uint64_t weight_size, uint8_t *&weight_base) {
+  std::lock_guard<std::mutex> lk(weight_mutex_);
+  auto it = weight_bases_.find(device_id);
+  if (it != weight_bases_.end()) {
+    weight_base = it->second;
+    return SUCCESS;
+  }
+
+  uint8_t *buffer = nullptr;
+  auto ret = rtMalloc(reinterpret_cast<void **>(&buffer), weight_size, RT_MEMORY_HBM);
+  if (ret != RT_ERROR_NONE) {
+    GELOGE(RT_FAILED, "rtMalloc failed, size = %lu, ret = %d", weight_size, ret);
+    return RT_FAILED;
+  }
+  GE_PRINT_DYNAMIC_MEMORY(rtMalloc, "malloc weights memory on model execute.", weight_size)
+
+  auto weight_buffer = ge_model_->GetWeight();
+  GELOGI("[%s] To copy weight to device %d. weight size = %zu", model_name_.c_str(), device_id,
+         weight_buffer.GetSize());
+  ret = rtMemcpy(buffer, weight_size, weight_buffer.GetData(), weight_buffer.GetSize(), RT_MEMCPY_HOST_TO_DEVICE);
+  if (ret != RT_ERROR_NONE) {
+    GELOGE(RT_FAILED, "rtMemcpy weight failed, ret = %d", ret);
+    auto rt_ret = rtFree(buffer);
+    GE_IF_BOOL_EXEC(rt_ret != RT_ERROR_NONE, GELOGE(RT_FAILED, "rtFree failed"));
+    return RT_FAILED;
+  }
+
+  weight_bases_[device_id] = buffer;
+  weight_base = buffer;
+  return SUCCESS;
+}
+
+CompiledSingleOpCache &CompiledSingleOpCache::GetInstance() {
+  static CompiledSingleOpCache instance;
+  return instance;
+}
+
+std::string CompiledSingleOpCache::GenerateKey(const ModelData &model_data) {
+  // the model buffer of the caller may be reused for another model, so its address can not be taken as the key
+  std::string key;
+  OpSignature::AppendDigest(key, reinterpret_cast<const uint8_t *>(model_data.model_data), model_data.model_len);
+  return key;
+}
+
+Status CompiledSingleOpCache::GetCompiledOp(const std::string &model_name, const ModelData &model_data,
+                                            CompiledSingleOpPtr &compiled_op) {
+  GE_CHECK_NOTNULL(model_data.model_data);
+  auto key = GenerateKey(model_data);
+  std::lock_guard<std::mutex> lk(mutex_);
+  auto it = compiled_ops_.find(key);
+  if (it != compiled_ops_.end()) {
+    compiled_op = it->second.lock();
+    if ((compiled_op != nullptr) && compiled_op->IsSameModel(model_data)) {
+      GELOGD("[%s] Reuse compiled single op.", model_name.c_str());
+      return SUCCESS;
+    }
+    if (compiled_op != nullptr) {
+      GELOGW("[%s] Digest of model collides with compiled op of model %s, compile it again.", model_name.c_str(),
+             compiled_op->GetModelName().c_str());
+      compiled_op = nullptr;
+    }
+  }
+
+  // drop the entries whose ops have been released by all the streams
+  for (auto iter = compiled_ops_.begin(); iter != compiled_ops_.end();) {
+    if (iter->second.expired()) {
+      iter = compiled_ops_.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+
+  auto new_op = MakeShared<CompiledSingleOp>(model_name);
+  GE_CHECK_NOTNULL(new_op);
+  auto ret = new_op->Init(model_data);
+  if (ret != SUCCESS) {
+    GELOGE(ret, "Init compiled single op failed. model = %s", model_name.c_str());
+    return ret;
+  }
+
+  compiled_ops_[key] = new_op;
+  compiled_op = new_op;
+  GELOGI("[%s] Compiled single op added, cache size = %zu", model_name.c_str(), compiled_ops_.size());
+  return SUCCESS;
+}
+}  // namespace ge
@@ -0,0 +1,110 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GE_SINGLE_OP_COMPILED_SINGLE_OP_H_
+#define GE_SINGLE_OP_COMPILED_SINGLE_OP_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "common/ge_inner_error_codes.h"
+#include "common/helper/model_helper.h"
+
+namespace ge {
+///
+/// @ingroup ge
+/// @brief Immutable part of a single op model: the parsed model with kernel binaries attached to the op descs,
+///        and the weights on device. It is shared by all the streams executing the same model, each stream only
+///        builds its own tasks, args and feature map memory from it.
+///
+class CompiledSingleOp {
+ public:
+  explicit CompiledSingleOp(const std::string &model_name);
+  ~CompiledSingleOp();
+
+  CompiledSingleOp(const CompiledSingleOp &) = delete;
+  CompiledSingleOp &operator=(const CompiledSingleOp &) = delete;
+
+  Status Init(const ModelData &model_data);
+
+  ///
+  /// @ingroup ge
+  /// @brief check whether the op is compiled from the same model bytes
+  ///
+  bool IsSameModel(const ModelData &model_data) const;
+
+  const std::string &GetModelName() const { return model_name_; }
+
+  GeModelPtr GetGeModel() const { return ge_model_; }
+
+  bool HasWeight() const { return has_weight_; }
+
+  ///
+  /// @ingroup ge
+  /// @brief get the weights on the current device, they are copied to each device by its first caller
+  /// @param [in] weight_size weight size of the model
+  /// @param [out] weight_base device address of weights
+  /// @return Status
+  ///
+  Status GetWeightBase(uint64_t weight_size, uint8_t *&weight_base);
+
+ private:
+  Status GetDeviceWeightBase(int32_t device_id, uint64_t weight_size, uint8_t *&weight_base);
+
+  std::string model_name_;
+  std::string model_bytes_;
+  ModelHelper model_helper_;
+  GeModelPtr ge_model_;
+  bool has_weight_ = false;
+
+  std::mutex weight_mutex_;
+  // device id -> weights on the device
+  std::map<int32_t, uint8_t *> weight_bases_;
+};
+
+using CompiledSingleOpPtr = std::shared_ptr<CompiledSingleOp>;
+
+///
+/// @ingroup ge
+/// @brief Process wide cache of compiled single ops keyed by the model content, so that the same model loaded on
+///        many streams is parsed once and keeps one copy of weights on each device. Entries live as long as a stream
+///        holds them.
+///
+class CompiledSingleOpCache {
+ public:
+  static CompiledSingleOpCache &GetInstance();
+
+  CompiledSingleOpCache(const CompiledSingleOpCache &) = delete;
+  CompiledSingleOpCache &operator=(const CompiledSingleOpCache &) = delete;
+
+  Status GetCompiledOp(const std::string &model_name, const ModelData &model_data, CompiledSingleOpPtr &compiled_op);
+
+ private:
+  CompiledSingleOpCache() = default;
+  ~CompiledSingleOpCache() = default;
+
+  static std::string GenerateKey(const ModelData &model_data);
+
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::weak_ptr<CompiledSingleOp>> compiled_ops_;
+};
+}  // namespace ge
+
+#endif  // GE_SINGLE_OP_COMPILED_SINGLE_OP_H_
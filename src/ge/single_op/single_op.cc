@@ -218,8 +218,8 @@ Status DynamicSingleOp::ValidateParams(const vector<GeTensorDesc> &input_desc, c
   return SUCCESS;
 }
 
-Status DynamicSingleOp::AllocateWorkspaces(const std::vector<int64_t> &workspace_sizes,
-                                           std::vector<void *> &workspaces) {
+Status DynamicSingleOp::AllocateWorkspaces(WorkspaceArena &arena, const std::vector<int64_t> &workspace_sizes,
+                                           std::vector<void *> &workspaces, uint8_t *&ws_base) {
   static const std::string kPurpose("malloc workspace memory for dynamic op.");
   if (workspace_sizes.empty()) {
     GELOGD("No need to allocate workspace.");
@@ -235,9 +235,7 @@ Status DynamicSingleOp::AllocateWorkspaces(const std::vector<int64_t> &workspace
   }
 
   GELOGD("Total workspace size is %ld", total_size);
-  StreamResource *stream_resource = SingleOpManager::GetInstance().GetResource(resource_id_, stream_);
-  GE_CHECK_NOTNULL(stream_resource);
-  auto ws_base = stream_resource->MallocMemory(kPurpose, static_cast<size_t>(total_size));
+  ws_base = arena.Allocate(kPurpose, static_cast<size_t>(total_size));
   if (ws_base == nullptr) {
     GELOGE(MEMALLOC_FAILED, "Failed to allocate memory of size: %ld", total_size);
     return MEMALLOC_FAILED;
@@ -255,10 +253,17 @@ Status DynamicSingleOp::ExecuteTbeTask(const vector<GeTensorDesc> &input_desc, c
                                        vector<GeTensorDesc> &output_desc, vector<void *> &outputs) {
   GE_CHK_STATUS_RET_NOLOG(op_task_->UpdateRunInfo(input_desc, output_desc));
 
+  StreamResource *stream_resource = SingleOpManager::GetInstance().GetResource(resource_id_, stream_);
+  GE_CHECK_NOTNULL(stream_resource);
+  auto &arena = stream_resource->GetWorkspaceArena();
   std::vector<void *> workspace_buffers;
-  GE_CHK_STATUS_RET_NOLOG(AllocateWorkspaces(op_task_->GetWorkspaceSizes(), workspace_buffers));
+  uint8_t *ws_base = nullptr;
+  GE_CHK_STATUS_RET_NOLOG(AllocateWorkspaces(arena, op_task_->GetWorkspaceSizes(), workspace_buffers, ws_base));
 
-  return op_task_->LaunchKernel(inputs, outputs, workspace_buffers, stream_);
+  auto ret = op_task_->LaunchKernel(inputs, outputs, workspace_buffers, stream_);
+  // ops launched later on the stream run after this one, so the workspace can be handed out again right away
+  arena.Free(ws_base);
+  return ret;
 }
 
 Status DynamicSingleOp::ExecuteAsync(const vector<GeTensorDesc> &input_desc, const vector<DataBuffer> &input_buffers,
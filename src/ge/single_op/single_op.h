@@ -26,6 +26,7 @@
 #include "common/ge_inner_error_codes.h"
 #include "framework/executor/ge_executor.h"
 #include "runtime/stream.h"
+#include "single_op/workspace_arena.h"
 #include "task/op_task.h"
 #include "cce/aicpu_engine_struct.h"
 
@@ -71,7 +72,8 @@ class DynamicSingleOp {
   Status ValidateParams(const vector<GeTensorDesc> &input_desc, const std::vector<DataBuffer> &inputs,
                         std::vector<GeTensorDesc> &output_desc, std::vector<DataBuffer> &outputs) const;
 
-  Status AllocateWorkspaces(const std::vector<int64_t> &workspace_sizes, std::vector<void *> &workspaces);
+  Status AllocateWorkspaces(WorkspaceArena &arena, const std::vector<int64_t> &workspace_sizes,
+                            std::vector<void *> &workspaces, uint8_t *&ws_base);
 
   Status ExecuteTbeTask(const vector<GeTensorDesc> &input_desc, const vector<void *> &inputs,
                         vector<GeTensorDesc> &output_desc, vector<void *> &outputs);
@@ -69,6 +69,34 @@ FMK_FUNC_HOST_VISIBILITY FMK_FUNC_DEV_VISIBILITY Status SingleOpManager::Release
   return SUCCESS;
 }
 
+Status SingleOpManager::GetWorkspaceStats(void *stream, WorkspaceArenaStats &stats) {
+  uintptr_t resource_id = 0;
+  GE_CHK_STATUS_RET(GetResourceId(stream, resource_id));
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = stream_resources_.find(resource_id);
+  if (it == stream_resources_.end()) {
+    stats = WorkspaceArenaStats();
+    return SUCCESS;
+  }
+
+  stats = it->second->GetWorkspaceArena().GetStats();
+  GELOGD("Workspace of resource 0x%lx: allocated = %zu, in use = %zu, high water mark = %zu",
+         static_cast<uint64_t>(resource_id), stats.allocated_size, stats.in_use_size, stats.high_water_mark);
+  return SUCCESS;
+}
+
+Status SingleOpManager::TrimWorkspace(void *stream) {
+  uintptr_t resource_id = 0;
+  GE_CHK_STATUS_RET(GetResourceId(stream, resource_id));
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = stream_resources_.find(resource_id);
+  if (it == stream_resources_.end()) {
+    return SUCCESS;
+  }
+
+  return it->second->GetWorkspaceArena().Trim();
+}
+
 StreamResource *SingleOpManager::GetResource(uintptr_t resource_id, rtStream_t stream) {
   std::lock_guard<std::mutex> lock(mutex_);
   auto it = stream_resources_.find(resource_id);
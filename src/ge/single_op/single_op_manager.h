@@ -44,6 +44,23 @@ class SingleOpManager {
 
   Status ReleaseResource(void *stream);
 
+  ///
+  /// @ingroup ge
+  /// @brief get the statistics of workspace memory of dynamic ops executed on stream
+  /// @param [in] stream stream the ops executed on
+  /// @param [out] stats statistics of workspace arena
+  /// @return Status
+  ///
+  Status GetWorkspaceStats(void *stream, WorkspaceArenaStats &stats);
+
+  ///
+  /// @ingroup ge
+  /// @brief synchronize stream and release the cached workspace memory of it
+  /// @param [in] stream stream the ops executed on
+  /// @return Status
+  ///
+  Status TrimWorkspace(void *stream);
+
   void RegisterTilingFunc();
 
  private:
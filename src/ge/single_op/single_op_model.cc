@@ -55,7 +55,7 @@ Status SingleOpModel::InitModel() {
   model.model_len = ori_model_size_;
   model.model_data = const_cast<void *>(ori_model_data_);
 
-  auto ret = model_helper_.LoadModel(model);
+  auto ret = CompiledSingleOpCache::GetInstance().GetCompiledOp(model_name_, model, compiled_op_);
   if (ret != SUCCESS) {
     GELOGE(ret, "LoadModel failed");
     return ret;
@@ -64,10 +64,9 @@ Status SingleOpModel::InitModel() {
   return SUCCESS;
 }
 
-void SingleOpModel::ParseOpModelParams(ModelHelper &model_helper, SingleOpModelParam &param) {
+void SingleOpModel::ParseOpModelParams(const GeModelPtr &model, SingleOpModelParam &param) {
   int64_t value = 0;
   bool ret = false;
-  std::shared_ptr<ge::GeModel> model = model_helper.GetGeModel();
   GE_CHECK_NOTNULL_JUST_RETURN(model);
   ret = ge::AttrUtils::GetInt(model, ATTR_MODEL_MEMORY_SIZE, value);
   param.memory_size = ret ? static_cast<uint64_t>(value) : 0;
@@ -87,7 +86,8 @@ void SingleOpModel::ParseOpModelParams(ModelHelper &model_helper, SingleOpModelP
 }
 
 Status SingleOpModel::InitModelMem(StreamResource &res) {
-  ParseOpModelParams(model_helper_, model_params_);
+  GE_CHECK_NOTNULL(compiled_op_);
+  ParseOpModelParams(compiled_op_->GetGeModel(), model_params_);
 
   if (model_params_.memory_size > model_params_.zero_copy_mem_size) {
     const string purpose("malloc feature map memory on model execute.");
@@ -98,18 +98,9 @@ Status SingleOpModel::InitModelMem(StreamResource &res) {
     }
   }
 
-  if (model_params_.weight_size > 0 && has_weight_) {
-    const string purpose("malloc weights memory on model execute.");
-    model_params_.weight_base = res.MallocWeight(purpose, model_params_.weight_size);
-    if (model_params_.weight_base == nullptr) {
-      // no need to free memory, for that was handled by StreamResources
-      return RT_FAILED;
-    }
-
-    auto weight_buffer = model_helper_.GetGeModel()->GetWeight();
-    GELOGI("To copy weight to device. weight size = %zu", weight_buffer.GetSize());
-    GE_CHK_RT_RET(rtMemcpy(model_params_.weight_base, model_params_.weight_size, weight_buffer.GetData(),
-                           weight_buffer.GetSize(), RT_MEMCPY_HOST_TO_DEVICE));
+  // weights are read only, all the streams share the copy on device held by the compiled op
+  if (model_params_.weight_size > 0 && compiled_op_->HasWeight()) {
+    GE_CHK_STATUS_RET_NOLOG(compiled_op_->GetWeightBase(model_params_.weight_size, model_params_.weight_base));
   }
 
   return SUCCESS;
@@ -150,7 +141,8 @@ void SingleOpModel::ParseOutputNode(const OpDescPtr &op_desc) {
 }
 
 Status SingleOpModel::LoadAllNodes() {
-  auto ge_model = model_helper_.GetGeModel();
+  GE_CHECK_NOTNULL(compiled_op_);
+  auto ge_model = compiled_op_->GetGeModel();
   GE_CHECK_NOTNULL(ge_model);
   Graph graph = ge_model->GetGraph();
   auto compute_graph = GraphUtils::GetComputeGraph(graph);
@@ -176,17 +168,9 @@ Status SingleOpModel::LoadAllNodes() {
       continue;
     }
 
-    if (op_type == CONSTANT || op_type == CONSTANTOP) {
-      has_weight_ = true;
-      continue;
-    }
-
     if (op_type == NETOUTPUT) {
       netoutput_op_ = op_desc;
-      continue;
     }
-
-    ge_model->GetTBEKernelStore().LoadTBEKernelBinToOpDesc(op_desc);
   }
 
   return SUCCESS;
@@ -221,7 +205,8 @@ Status SingleOpModel::SetInputsAndOutputs(SingleOp &single_op) {
 }
 
 Status SingleOpModel::BuildTaskList(SingleOp &single_op) {
-  auto ge_model = model_helper_.GetGeModel();
+  GE_CHECK_NOTNULL(compiled_op_);
+  auto ge_model = compiled_op_->GetGeModel();
   GE_CHECK_NOTNULL(ge_model);
   auto tasks = ge_model->GetModelTaskDefPtr()->task();
   for (int i = 0; i < tasks.size(); ++i) {
@@ -401,7 +386,8 @@ Status SingleOpModel::BuildModelTaskKernel(const TaskDef &task_def, DynamicSingl
 }
 
 Status SingleOpModel::BuildTaskListForDynamicOp(DynamicSingleOp &single_op) {
-  auto ge_model = model_helper_.GetGeModel();
+  GE_CHECK_NOTNULL(compiled_op_);
+  auto ge_model = compiled_op_->GetGeModel();
   GE_CHECK_NOTNULL(ge_model);
 
   auto tasks = ge_model->GetModelTaskDefPtr()->task();
@@ -451,7 +437,7 @@ Status SingleOpModel::BuildTaskListForDynamicOp(DynamicSingleOp &single_op) {
 Status SingleOpModel::BuildDynamicOp(DynamicSingleOp &single_op) {
   single_op.num_inputs_ = data_ops_.size();
   single_op.num_outputs_ = netoutput_op_->GetAllInputsSize();
-  ParseOpModelParams(model_helper_, model_params_);
+  ParseOpModelParams(compiled_op_->GetGeModel(), model_params_);
   return BuildTaskListForDynamicOp(single_op);
 }
 }  // namespace ge
@@ -25,6 +25,7 @@
 
 #include "common/helper/model_helper.h"
 #include "graph/load/new_model_manager/davinci_model_parser.h"
+#include "single_op/compiled_single_op.h"
 #include "single_op/single_op.h"
 #include "single_op/stream_resource.h"
 
@@ -52,6 +53,8 @@ class SingleOpModel {
   Status BuildOp(StreamResource &resource, SingleOp &single_op);
   Status BuildDynamicOp(DynamicSingleOp &single_op);
 
+  const CompiledSingleOpPtr &GetCompiledOp() const { return compiled_op_; }
+
  private:
   Status InitModel();
   Status LoadAllNodes();
@@ -71,14 +74,14 @@ class SingleOpModel {
   Status BuildCpuKernelTask(const domi::KernelDef &kernel_def, OpTask **task);
   Status BuildModelTaskKernel(const domi::TaskDef &task_def, DynamicSingleOp &single_op);
 
-  static void ParseOpModelParams(ModelHelper &model_helper, SingleOpModelParam &param);
+  static void ParseOpModelParams(const GeModelPtr &model, SingleOpModelParam &param);
   void ParseArgTable(TbeOpTask *task, SingleOp &op);
 
   std::string model_name_;
   const void *ori_model_data_;
   uint32_t ori_model_size_;
 
-  ModelHelper model_helper_;
+  CompiledSingleOpPtr compiled_op_;
 
   map<uint32_t, NodePtr> op_list_;
   SingleOpModelParam model_params_;
@@ -89,7 +92,6 @@ class SingleOpModel {
   std::vector<size_t> output_sizes_;
   std::vector<OpDescPtr> data_ops_;
   OpDescPtr netoutput_op_;
-  bool has_weight_ = false;
 };
 }  // namespace ge
 
@@ -60,7 +60,10 @@ DynamicSingleOp *StreamResource::GetDynamicOperator(const void *key) {
   return it->second.get();
 }
 
-void StreamResource::SetStream(rtStream_t stream) { stream_ = stream; }
+void StreamResource::SetStream(rtStream_t stream) {
+  stream_ = stream;
+  workspace_arena_.SetStream(stream);
+}
 
 uint8_t *StreamResource::DoMallocMemory(const std::string &purpose, size_t size, size_t &max_allocated,
                                         std::vector<uint8_t *> &allocated) {
@@ -133,6 +136,7 @@ Status StreamResource::BuildDynamicOperator(const string &model_name, const Mode
 
   GELOGI("To build operator: %s", model_name.c_str());
   GE_CHK_STATUS_RET(model.BuildDynamicOp(*new_op), "Build op failed. op = %s, ret = %u", model_name.c_str(), ret);
+  compiled_ops_.emplace_back(model.GetCompiledOp());
   *single_op = new_op.get();
   dynamic_op_map_[model_data.model_data] = std::move(new_op);
   return SUCCESS;
@@ -161,6 +165,7 @@ Status StreamResource::BuildOperator(const string &model_name, const ModelData &
 
   GELOGI("To build operator: %s", model_name.c_str());
   GE_CHK_STATUS_RET(model.BuildOp(*this, *new_op), "Build op failed. op = %s, ret = %u", model_name.c_str(), ret);
+  compiled_ops_.emplace_back(model.GetCompiledOp());
 
   *single_op = new_op.get();
   op_map_[model_data.model_data] = std::move(new_op);
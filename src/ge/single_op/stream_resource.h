@@ -25,7 +25,9 @@
 
 #include "common/ge_inner_error_codes.h"
 #include "runtime/stream.h"
+#include "single_op/compiled_single_op.h"
 #include "single_op/single_op.h"
+#include "single_op/workspace_arena.h"
 
 namespace ge {
 class StreamResource {
@@ -48,6 +50,8 @@ class StreamResource {
   uint8_t *MallocMemory(const std::string &purpose, size_t size);
   uint8_t *MallocWeight(const std::string &purpose, size_t size);
 
+  WorkspaceArena &GetWorkspaceArena() { return workspace_arena_; }
+
  private:
   uint8_t *DoMallocMemory(const std::string &purpose, size_t size, size_t &max_allocated,
                           std::vector<uint8_t *> &allocated);
@@ -58,7 +62,10 @@ class StreamResource {
   std::vector<uint8_t *> weight_list_;
   std::unordered_map<const void *, std::unique_ptr<SingleOp>> op_map_;
   std::unordered_map<const void *, std::unique_ptr<DynamicSingleOp>> dynamic_op_map_;
+  // compiled ops shared with other streams, referred by the ops built on this stream
+  std::vector<CompiledSingleOpPtr> compiled_ops_;
   rtStream_t stream_ = nullptr;
+  WorkspaceArena workspace_arena_;
   std::mutex mu_;
   std::mutex stream_mu_;
 };
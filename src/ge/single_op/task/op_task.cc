@@ -196,6 +196,7 @@ Status TbeOpTask::UpdateNodeByShape(const vector<GeTensorDesc> &input_desc, cons
 
 void TbeOpTask::EnableDynamicSupport(const NodePtr &node, void *tiling_buffer, size_t max_tiling_size) {
   node_ = node;
+  owner_graph_ = node->GetOwnerComputeGraph();
   tiling_buffer_ = tiling_buffer;
   max_tiling_size_ = max_tiling_size;
 }
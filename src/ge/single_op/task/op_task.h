@@ -107,6 +107,8 @@ class TbeOpTask : public OpTask {
   uint32_t max_tiling_size_ = 0;
   std::string tiling_data_;
   NodePtr node_;
+  // keeps the graph owning node_ alive, node_ is a private copy for dynamic shape
+  ComputeGraphPtr owner_graph_;
 };
 
 class AiCpuBaseTask : public OpTask {
@@ -19,6 +19,7 @@
 #include <mutex>
 #include <vector>
 
+#include "common/ge/ge_util.h"
 #include "graph/debug/ge_attr_define.h"
 #include "graph/load/new_model_manager/model_utils.h"
 #include "graph/manager/graph_var_manager.h"
@@ -303,12 +304,21 @@ Status TbeTaskBuilder::InitTilingInfo(TbeOpTask &task) {
     return PARAM_INVALID;
   }
 
+  // Runtime shapes are written to the node on every execution, while the node of the compiled op is shared by
+  // all the streams, so the task works on a private copy of it.
+  auto op_desc = AttrUtils::CopyOpDesc(op_desc_);
+  GE_CHECK_NOTNULL(op_desc);
+  auto graph = MakeShared<ComputeGraph>(op_desc->GetName());
+  GE_CHECK_NOTNULL(graph);
+  auto node = graph->AddNode(op_desc);
+  GE_CHECK_NOTNULL(node);
+
   void *tiling_buffer = nullptr;
   GE_CHK_RT_RET(rtMalloc(&tiling_buffer, static_cast<uint64_t>(max_size), RT_MEMORY_HBM));
   GE_CHECK_NOTNULL(tiling_buffer);
   GELOGD("[%s] Done allocating tiling buffer, size=%ld.", op_desc_->GetName().c_str(), max_size);
 
-  task.EnableDynamicSupport(node_, tiling_buffer, static_cast<size_t>(max_size));
+  task.EnableDynamicSupport(node, tiling_buffer, static_cast<size_t>(max_size));
   return SUCCESS;
 }
 }  // namespace ge
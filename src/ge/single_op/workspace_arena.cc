@@ -0,0 +1,149 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "single_op/workspace_arena.h"
+
+#include <algorithm>
+
+#include "framework/common/debug/ge_log.h"
+#include "framework/common/debug/log.h"
+#include "runtime/rt.h"
+
+namespace ge {
+namespace {
+const size_t kMinSizeClass = 512;
+// sizes up to it are rounded up to power of 2, larger ones to multiple of kLargeSizeAlign
+const size_t kMaxPowerOfTwoClass = 64 * 1024 * 1024;
+const size_t kLargeSizeAlign = 2 * 1024 * 1024;
+// a cached block is reused only if it is at most this times of the requested size class
+const size_t kMaxReuseRatio = 2;
+}  // namespace
+
+WorkspaceArena::~WorkspaceArena() {
+  for (auto &block_and_size : block_sizes_) {
+    auto rt_ret = rtFree(block_and_size.first);
+    GE_IF_BOOL_EXEC(rt_ret != RT_ERROR_NONE, GELOGE(RT_FAILED, "rtFree failed"));
+  }
+}
+
+size_t WorkspaceArena::GetSizeClass(size_t size) {
+  if (size > kMaxPowerOfTwoClass) {
+    return (size + kLargeSizeAlign - 1) / kLargeSizeAlign * kLargeSizeAlign;
+  }
+  size_t size_class = kMinSizeClass;
+  while (size_class < size) {
+    size_class <<= 1;
+  }
+  return size_class;
+}
+
+uint8_t *WorkspaceArena::TakeCachedBlock(size_t size_class) {
+  auto it = free_bins_.lower_bound(size_class);
+  while (it != free_bins_.end() && it->second.empty()) {
+    it = free_bins_.erase(it);
+  }
+  if (it == free_bins_.end() || it->first / kMaxReuseRatio > size_class) {
+    return nullptr;
+  }
+
+  uint8_t *block = it->second.back();
+  it->second.pop_back();
+  return block;
+}
+
+uint8_t *WorkspaceArena::Allocate(const std::string &purpose, size_t size) {
+  size_t size_class = GetSizeClass(size);
+  std::lock_guard<std::mutex> lk(mutex_);
+  uint8_t *block = TakeCachedBlock(size_class);
+  if (block != nullptr) {
+    GELOGD("Reuse workspace block of size class %zu for size %zu", block_sizes_[block], size);
+    stats_.in_use_size += block_sizes_[block];
+    stats_.reuse_count++;
+    return block;
+  }
+
+  auto ret = rtMalloc(reinterpret_cast<void **>(&block), size_class, RT_MEMORY_HBM);
+  if (ret != RT_ERROR_NONE) {
+    GELOGW("rtMalloc failed, size = %zu, ret = %d, release cached workspace and retry", size_class, ret);
+    if (DoTrim() != SUCCESS) {
+      return nullptr;
+    }
+    ret = rtMalloc(reinterpret_cast<void **>(&block), size_class, RT_MEMORY_HBM);
+    if (ret != RT_ERROR_NONE) {
+      GELOGE(RT_FAILED, "rtMalloc failed, size = %zu, ret = %d", size_class, ret);
+      return nullptr;
+    }
+  }
+  GE_PRINT_DYNAMIC_MEMORY(rtMalloc, purpose.c_str(), size_class)
+
+  block_sizes_[block] = size_class;
+  stats_.allocated_size += size_class;
+  stats_.in_use_size += size_class;
+  stats_.high_water_mark = std::max(stats_.high_water_mark, stats_.allocated_size);
+  stats_.malloc_count++;
+  GELOGD("Malloc new workspace block succeeded. size class = %zu, total allocated = %zu", size_class,
+         stats_.allocated_size);
+  return block;
+}
+
+void WorkspaceArena::Free(uint8_t *block) {
+  if (block == nullptr) {
+    return;
+  }
+  std::lock_guard<std::mutex> lk(mutex_);
+  auto it = block_sizes_.find(block);
+  if (it == block_sizes_.end()) {
+    GELOGW("Block %p is not allocated by workspace arena", block);
+    return;
+  }
+  stats_.in_use_size -= it->second;
+  free_bins_[it->second].emplace_back(block);
+}
+
+Status WorkspaceArena::Trim() {
+  std::lock_guard<std::mutex> lk(mutex_);
+  return DoTrim();
+}
+
+Status WorkspaceArena::DoTrim() {
+  if (free_bins_.empty()) {
+    return SUCCESS;
+  }
+
+  // cached blocks may still be read by ops in flight
+  GE_CHK_RT_RET(rtStreamSynchronize(stream_));
+  size_t released_size = 0;
+  for (auto &bin : free_bins_) {
+    for (auto block : bin.second) {
+      auto rt_ret = rtFree(block);
+      GE_IF_BOOL_EXEC(rt_ret != RT_ERROR_NONE, GELOGE(RT_FAILED, "rtFree failed"));
+      (void)block_sizes_.erase(block);
+      released_size += bin.first;
+    }
+  }
+  free_bins_.clear();
+  stats_.allocated_size -= released_size;
+  stats_.trim_count++;
+  GELOGI("Workspace arena trimmed, released size = %zu, remaining size = %zu", released_size,
+         stats_.allocated_size);
+  return SUCCESS;
+}
+
+WorkspaceArenaStats WorkspaceArena::GetStats() {
+  std::lock_guard<std::mutex> lk(mutex_);
+  return stats_;
+}
+}  // namespace ge
@@ -0,0 +1,96 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GE_SINGLE_OP_WORKSPACE_ARENA_H_
+#define GE_SINGLE_OP_WORKSPACE_ARENA_H_
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/ge_inner_error_codes.h"
+#include "runtime/stream.h"
+
+namespace ge {
+struct WorkspaceArenaStats {
+  size_t allocated_size = 0;   // device memory held by the arena
+  size_t in_use_size = 0;      // memory handed out and not freed yet
+  size_t high_water_mark = 0;  // max allocated_size ever reached
+  uint64_t malloc_count = 0;
+  uint64_t reuse_count = 0;
+  uint64_t trim_count = 0;
+};
+
+///
+/// @ingroup ge
+/// @brief Workspace memory of the ops executed on one stream. Freed blocks are cached in size class bins and
+///        handed out again without synchronization: ops on a stream run in launch order, so a block freed after
+///        a launch is never touched by the device before the ops launched later. Cached blocks are only returned
+///        to the device after the stream is synchronized.
+///
+class WorkspaceArena {
+ public:
+  WorkspaceArena() = default;
+  ~WorkspaceArena();
+
+  WorkspaceArena(const WorkspaceArena &) = delete;
+  WorkspaceArena &operator=(const WorkspaceArena &) = delete;
+
+  void SetStream(rtStream_t stream) { stream_ = stream; }
+
+  ///
+  /// @ingroup ge
+  /// @brief allocate a block for the ops launched from now on, the content is not initialized
+  /// @param [in] purpose purpose of memory
+  /// @param [in] size size of memory
+  /// @return device address, nullptr if failed
+  ///
+  uint8_t *Allocate(const std::string &purpose, size_t size);
+
+  ///
+  /// @ingroup ge
+  /// @brief give the block back to the arena after the op using it has been launched on the stream
+  ///
+  void Free(uint8_t *block);
+
+  ///
+  /// @ingroup ge
+  /// @brief synchronize the stream and release the cached blocks to the device
+  /// @return Status
+  ///
+  Status Trim();
+
+  WorkspaceArenaStats GetStats();
+
+ private:
+  static size_t GetSizeClass(size_t size);
+  uint8_t *TakeCachedBlock(size_t size_class);
+  Status DoTrim();
+
+  rtStream_t stream_ = nullptr;
+  std::mutex mutex_;
+  // size class -> cached blocks
+  std::map<size_t, std::vector<uint8_t *>> free_bins_;
+  // all the blocks allocated from device and their size classes
+  std::unordered_map<uint8_t *, size_t> block_sizes_;
+  WorkspaceArenaStats stats_;
+};
+}  // namespace ge
+
+#endif  // GE_SINGLE_OP_WORKSPACE_ARENA_H_
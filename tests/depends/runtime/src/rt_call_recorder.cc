@@ -0,0 +1,88 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "rt_call_recorder.h"
+
+#include <chrono>
+#include <thread>
+
+namespace ge {
+RtCallRecorder &RtCallRecorder::Instance() {
+  static RtCallRecorder instance;
+  return instance;
+}
+
+void RtCallRecorder::Start(bool keep_trace) {
+  std::lock_guard<std::mutex> lk(mutex_);
+  call_counts_.clear();
+  trace_.clear();
+  keep_trace_ = keep_trace;
+  is_started_.store(true, std::memory_order_release);
+}
+
+void RtCallRecorder::Stop() { is_started_.store(false, std::memory_order_release); }
+
+void RtCallRecorder::SetLatency(const std::string &api, uint32_t latency_us) {
+  std::lock_guard<std::mutex> lk(mutex_);
+  latencies_[api] = latency_us;
+}
+
+void RtCallRecorder::ClearLatency() {
+  std::lock_guard<std::mutex> lk(mutex_);
+  latencies_.clear();
+}
+
+void RtCallRecorder::Record(const char *api) {
+  if (!is_started_.load(std::memory_order_acquire)) {
+    return;
+  }
+
+  uint32_t latency_us = 0;
+  {
+    std::lock_guard<std::mutex> lk(mutex_);
+    call_counts_[api]++;
+    if (keep_trace_) {
+      trace_.emplace_back(api);
+    }
+    auto it = latencies_.find(api);
+    if (it != latencies_.end()) {
+      latency_us = it->second;
+    }
+  }
+  if (latency_us > 0) {
+    std::this_thread::sleep_for(std::chrono::microseconds(latency_us));
+  }
+}
+
+std::map<std::string, uint64_t> RtCallRecorder::GetCallCounts() {
+  std::lock_guard<std::mutex> lk(mutex_);
+  return call_counts_;
+}
+
+std::vector<std::string> RtCallRecorder::GetTrace() {
+  std::lock_guard<std::mutex> lk(mutex_);
+  return trace_;
+}
+
+uint64_t RtCallRecorder::GetTotalCalls() {
+  std::lock_guard<std::mutex> lk(mutex_);
+  uint64_t total = 0;
+  for (const auto &api_and_count : call_counts_) {
+    total += api_and_count.second;
+  }
+  return total;
+}
+}  // namespace ge
@@ -0,0 +1,69 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TESTS_DEPENDS_RUNTIME_SRC_RT_CALL_RECORDER_H_
+#define TESTS_DEPENDS_RUNTIME_SRC_RT_CALL_RECORDER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ge {
+// Records the calls to the stubbed runtime while started, and makes the recorded apis take the latency of the device
+// by sleeping, so that it is seen in the wall time but not in the cpu time of the caller.
+class RtCallRecorder {
+ public:
+  static RtCallRecorder &Instance();
+
+  // clear the records and start recording, the call sequence is kept if keep_trace
+  void Start(bool keep_trace);
+  void Stop();
+
+  // simulated latency of api in microseconds, kept across Start and Stop
+  void SetLatency(const std::string &api, uint32_t latency_us);
+  void ClearLatency();
+
+  // memory of the stubbed runtime is host memory, the memcpy apis copy data when enabled, off by default since
+  // many tests pass fake device addresses
+  void SetMemcpyEnabled(bool enabled) { is_memcpy_enabled_.store(enabled); }
+  bool IsMemcpyEnabled() const { return is_memcpy_enabled_.load(); }
+
+  void Record(const char *api);
+
+  std::map<std::string, uint64_t> GetCallCounts();
+  std::vector<std::string> GetTrace();
+  uint64_t GetTotalCalls();
+
+ private:
+  RtCallRecorder() = default;
+  ~RtCallRecorder() = default;
+
+  std::atomic<bool> is_started_{false};
+  std::atomic<bool> is_memcpy_enabled_{false};
+  bool keep_trace_ = false;
+  std::mutex mutex_;
+  std::map<std::string, uint64_t> call_counts_;
+  std::vector<std::string> trace_;
+  std::map<std::string, uint32_t> latencies_;
+};
+}  // namespace ge
+
+#define RT_STUB_RECORD() ge::RtCallRecorder::Instance().Record(__FUNCTION__)
+
+#endif  // TESTS_DEPENDS_RUNTIME_SRC_RT_CALL_RECORDER_H_
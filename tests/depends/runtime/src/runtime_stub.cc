@@ -17,9 +17,14 @@
 #include <cce/dnn.h>
 #include <securec.h>
 
+#include "rt_call_recorder.h"
+
 #define EVENT_LENTH 10
 
-rtError_t rtCtxSetCurrent(rtContext_t ctx) { return RT_ERROR_NONE; }
+rtError_t rtCtxSetCurrent(rtContext_t ctx) {
+  RT_STUB_RECORD();
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtGetStreamId(rtStream_t stream, int32_t *stream_id) {
   *stream_id = 0;
@@ -27,6 +32,7 @@ rtError_t rtGetStreamId(rtStream_t stream, int32_t *stream_id) {
 }
 
 rtError_t rtCtxGetCurrent(rtContext_t *ctx) {
+  RT_STUB_RECORD();
   int x = 1;
   *ctx = (void *)x;
   return RT_ERROR_NONE;
@@ -40,70 +46,104 @@ rtError_t rtEventGetTimeStamp(uint64_t *time, rtEvent_t event) {
 }
 
 rtError_t rtEventCreate(rtEvent_t *event) {
+  RT_STUB_RECORD();
   *event = new int[EVENT_LENTH];
   return RT_ERROR_NONE;
 }
-rtError_t rtEventRecord(rtEvent_t event, rtStream_t stream) { return RT_ERROR_NONE; }
+rtError_t rtEventRecord(rtEvent_t event, rtStream_t stream) {
+  RT_STUB_RECORD();
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtEventSynchronize(rtEvent_t event) { return RT_ERROR_NONE; }
+rtError_t rtEventSynchronize(rtEvent_t event) {
+  RT_STUB_RECORD();
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtEventDestroy(rtEvent_t event) {
+  RT_STUB_RECORD();
   delete[](int *) event;
   return RT_ERROR_NONE;
 }
 
 rtError_t rtMalloc(void **dev_ptr, uint64_t size, rtMemType_t type) {
+  RT_STUB_RECORD();
   *dev_ptr = new uint8_t[size];
   return RT_ERROR_NONE;
 }
 
-rtError_t rtMemset(void *dev_ptr, uint64_t dest_max, uint32_t value, uint64_t count) { return RT_ERROR_NONE; }
+rtError_t rtMemset(void *dev_ptr, uint64_t dest_max, uint32_t value, uint64_t count) {
+  RT_STUB_RECORD();
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtFree(void *dev_ptr) {
+  RT_STUB_RECORD();
   delete[](uint8_t *) dev_ptr;
   return RT_ERROR_NONE;
 }
 
 rtError_t rtMallocHost(void **host_ptr, uint64_t size) {
+  RT_STUB_RECORD();
   *host_ptr = new uint8_t[size];
   return RT_ERROR_NONE;
 }
 
 rtError_t rtFreeHost(void *host_ptr) {
+  RT_STUB_RECORD();
   delete[](uint8_t *) host_ptr;
   return RT_ERROR_NONE;
 }
 
 rtError_t rtStreamCreate(rtStream_t *stream, int32_t priority) {
+  RT_STUB_RECORD();
   *stream = new uint32_t;
   return RT_ERROR_NONE;
 }
 
 rtError_t rtStreamDestroy(rtStream_t stream) {
+  RT_STUB_RECORD();
   if (stream != nullptr) {
     delete (uint32_t *)stream;
   }
   return RT_ERROR_NONE;
 }
 
-rtError_t rtSetDevice(int32_t device) { return RT_ERROR_NONE; }
+rtError_t rtSetDevice(int32_t device) {
+  RT_STUB_RECORD();
+  return RT_ERROR_NONE;
+}
 
-rtError_t rtStreamSynchronize(rtStream_t stream) { return RT_ERROR_NONE; }
+rtError_t rtStreamSynchronize(rtStream_t stream) {
+  RT_STUB_RECORD();
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtMemcpy(void *dst, uint64_t dest_max, const void *src, uint64_t count, rtMemcpyKind_t kind) {
+  RT_STUB_RECORD();
 #ifdef OTQT_UT
   if (dest_max == 12 && count == 12) {  // UTEST_kernelinfo_manager.all_success special treatment
     memcpy_s(dst, dest_max, src, count);
   }
 #endif
+  if (ge::RtCallRecorder::Instance().IsMemcpyEnabled() && (count > 0)) {
+    (void)memcpy_s(dst, dest_max, src, count);
+  }
   return RT_ERROR_NONE;
 }
 rtError_t rtMemcpyAsync(void *dst, uint64_t dest_max, const void *src, uint64_t count, rtMemcpyKind_t kind,
                         rtStream_t stream) {
+  RT_STUB_RECORD();
+  if (ge::RtCallRecorder::Instance().IsMemcpyEnabled() && (count > 0)) {
+    (void)memcpy_s(dst, dest_max, src, count);
+  }
   return RT_ERROR_NONE;
 }
 
-rtError_t rtStreamWaitEvent(rtStream_t stream, rtEvent_t event) { return RT_ERROR_NONE; }
+rtError_t rtStreamWaitEvent(rtStream_t stream, rtEvent_t event) {
+  RT_STUB_RECORD();
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtSetTSDevice(uint32_t tsId) {
   return RT_ERROR_NONE;
@@ -129,12 +169,16 @@ rtError_t rtFunctionRegister(void *bin_handle, const void *stub_func, const char
   return RT_ERROR_NONE;
 }
 
-rtError_t rtDevBinaryRegister(const rtDevBinary_t *bin, void **handle) { return RT_ERROR_NONE; }
+rtError_t rtDevBinaryRegister(const rtDevBinary_t *bin, void **handle) {
+  RT_STUB_RECORD();
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtKernelConfigTransArg(const void *ptr, uint64_t size, uint32_t flag, void **arg) { return RT_ERROR_NONE; }
 
 rtError_t rtKernelLaunch(const void *stub_func, uint32_t block_dim, void *args, uint32_t args_size, rtSmDesc_t *sm_desc,
                          rtStream_t stream) {
+  RT_STUB_RECORD();
   return RT_ERROR_NONE;
 }
 rtError_t rtSetupArgument(const void *arg, uint32_t size, uint32_t offset) { return RT_ERROR_NONE; }
@@ -188,20 +232,29 @@ rtError_t rtMetadataRegister(void *handle, const char *meta_data) { return RT_ER
 rtError_t rtSetTaskGenCallback(rtTaskGenCallback callback) { return RT_ERROR_NONE; }
 
 rtError_t rtModelCreate(rtModel_t *model, uint32_t flag) {
+  RT_STUB_RECORD();
   *model = new uint32_t;
   return RT_ERROR_NONE;
 }
 
 rtError_t rtModelDestroy(rtModel_t model) {
+  RT_STUB_RECORD();
   delete model;
   return RT_ERROR_NONE;
 }
 
-rtError_t rtModelBindStream(rtModel_t model, rtStream_t stream, uint32_t flag) { return RT_ERROR_NONE; }
+rtError_t rtModelBindStream(rtModel_t model, rtStream_t stream, uint32_t flag) {
+  RT_STUB_RECORD();
+  return RT_ERROR_NONE;
+}
 rtError_t rtModelUnbindStream(rtModel_t model, rtStream_t stream) { return RT_ERROR_NONE; }
-rtError_t rtModelExecute(rtModel_t model, rtStream_t stream, uint32_t flag) { return RT_ERROR_NONE; }
+rtError_t rtModelExecute(rtModel_t model, rtStream_t stream, uint32_t flag) {
+  RT_STUB_RECORD();
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtGetFunctionByName(const char *stub_name, void **stub_func) {
+  RT_STUB_RECORD();
   *(char **)stub_func = "func";
   return RT_ERROR_NONE;
 }
@@ -210,14 +263,21 @@ rtError_t rtGetAddrByFun(const void *stubFunc, void **addr)
   *(char**)addr =  "dev_func";
   return RT_ERROR_NONE;
 }
-rtError_t rtQueryFunctionRegistered(const char *stub_name) { return RT_ERROR_NONE; }
+rtError_t rtQueryFunctionRegistered(const char *stub_name) {
+  RT_STUB_RECORD();
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtCtxCreate(rtContext_t *ctx, uint32_t flags, int32_t device) { return RT_ERROR_NONE; }
 
-rtError_t rtKernelLaunchEx(void *args, uint32_t args_size, uint32_t flags, rtStream_t stream_) { return RT_ERROR_NONE; }
+rtError_t rtKernelLaunchEx(void *args, uint32_t args_size, uint32_t flags, rtStream_t stream_) {
+  RT_STUB_RECORD();
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtCpuKernelLaunch(const void *so_name, const void *kernel_name, uint32_t block_dim, const void *args,
                             uint32_t args_size, rtSmDesc_t *sm_desc, rtStream_t stream) {
+  RT_STUB_RECORD();
   return RT_ERROR_NONE;
 }
 
@@ -258,9 +318,13 @@ rtError_t rtLabelGoto(rtLabel_t label, rtStream_t stream) { return RT_ERROR_NONE
 
 rtError_t rtInvalidCache(uint64_t base, uint32_t len) { return RT_ERROR_NONE; }
 
-rtError_t rtModelLoadComplete(rtModel_t model) { return RT_ERROR_NONE; }
+rtError_t rtModelLoadComplete(rtModel_t model) {
+  RT_STUB_RECORD();
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtStreamCreateWithFlags(rtStream_t *stream, int32_t priority, uint32_t flags) {
+  RT_STUB_RECORD();
   *stream = new uint32_t;
   return RT_ERROR_NONE;
 }
@@ -284,17 +348,22 @@ rtError_t rtStreamActive(rtStream_t active_stream, rtStream_t stream) { return R
 
 rtError_t rtEventReset(rtEvent_t event, rtStream_t stream) { return RT_ERROR_NONE; }
 
-rtError_t rtGetDevice(int32_t *device) { return RT_ERROR_NONE; }
+rtError_t rtGetDevice(int32_t *device) {
+  RT_STUB_RECORD();
+  return RT_ERROR_NONE;
+}
 
 rtError_t rtDatadumpInfoLoad(const void *dump_info, uint32_t length) { return RT_ERROR_NONE; }
 
 rtError_t rtKernelLaunchWithFlag(const void *stub_func, uint32_t block_dim, void *args, uint32_t args_size,
                                  rtSmDesc_t *sm_desc, rtStream_t stream_, uint32_t flags) {
+  RT_STUB_RECORD();
   return RT_ERROR_NONE;
 }
 
 rtError_t rtCpuKernelLaunchWithFlag(const void *so_name, const void *kernel_name, uint32_t core_dim, const void *args,
                                     uint32_t args_size, rtL2Ctrl_t *l2ctrl, rtStream_t stream_, uint32_t flags) {
+  RT_STUB_RECORD();
   return RT_ERROR_NONE;
 }
 
@@ -307,3 +376,33 @@ rtError_t rtModelBindQueue(rtModel_t model, uint32_t queueId, rtModelQueueFlag_t
 {
   return RT_ERROR_NONE;
 }
+
+rtError_t rtDumpAddrSet(rtModel_t model, void *addr, uint32_t dumpSize, uint32_t flag) { return RT_ERROR_NONE; }
+
+rtError_t rtGetAicpuDeploy(rtAicpuDeployType_t *deplyType) {
+  *deplyType = AICPU_DEPLOY_CROSS_OS;
+  return RT_ERROR_NONE;
+}
+
+rtError_t rtDebugRegister(rtModel_t model, uint32_t flag, const void *addr, uint32_t *streamId, uint32_t *taskId) {
+  return RT_ERROR_NONE;
+}
+
+rtError_t rtDebugUnRegister(rtModel_t model) { return RT_ERROR_NONE; }
+
+rtError_t rtSetTaskFailCallback(rtTaskFailCallback callback) { return RT_ERROR_NONE; }
+
+rtError_t rtLabelCreateEx(rtLabel_t *label, rtStream_t stream) { return RT_ERROR_NONE; }
+
+rtError_t rtLabelGotoEx(rtLabel_t label, rtStream_t stream) { return RT_ERROR_NONE; }
+
+rtError_t rtLabelListCpy(rtLabel_t *label, uint32_t labelNumber, void *dst, uint32_t dstMax) { return RT_ERROR_NONE; }
+
+rtError_t rtLabelSwitchByIndex(void *ptr, uint32_t max, void *labelInfoPtr, rtStream_t stream) {
+  return RT_ERROR_NONE;
+}
+
+rtError_t rtStreamSwitchN(void *ptr, uint32_t size, void *valuePtr, rtStream_t *trueStreamPtr, uint32_t elementSize,
+                          rtStream_t stream, rtSwitchDataType_t dataType) {
+  return RT_ERROR_NONE;
+}
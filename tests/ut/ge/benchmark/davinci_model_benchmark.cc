@@ -0,0 +1,597 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Host side benchmark of DavinciModel against the stubbed runtime. It builds synthetic models of TE kernel tasks,
+// loads them and runs requests through the zero copy and the ReturnResult paths, reporting cpu time, host allocations
+// and runtime calls per request. Device latency is simulated by the stub, see --latency. The zero copy path is run
+// again with model execute profiling on, reporting the records sent to a counting profiling reporter.
+//
+// usage: ge_davinci_model_benchmark [--tasks=N] [--inputs=N] [--outputs=N] [--gears=N] [--tensor_size=BYTES]
+//                                   [--requests=N] [--latency=API:US[,API:US...]]
+
+#include <time.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "cce/taskdown_common.hpp"
+#include "common/profiling/profiling_manager.h"
+#include "common/types.h"
+#include "graph/compute_graph.h"
+#include "graph/debug/ge_attr_define.h"
+#include "graph/load/new_model_manager/davinci_model.h"
+#include "graph/manager/graph_mem_allocator.h"
+#include "graph/manager/graph_var_manager.h"
+#include "graph/op_kernel_bin.h"
+#include "graph/utils/attr_utils.h"
+#include "graph/utils/graph_utils.h"
+#include "graph/utils/tensor_utils.h"
+#include "register/register_types.h"
+#include "rt_call_recorder.h"
+
+namespace {
+std::atomic<uint64_t> g_alloc_count{0};
+std::atomic<uint64_t> g_alloc_bytes{0};
+
+void *CountedMalloc(size_t size) {
+  g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+  g_alloc_bytes.fetch_add(size, std::memory_order_relaxed);
+  return std::malloc(size == 0 ? 1 : size);
+}
+}  // namespace
+
+// count every host allocation of the process, including the fake device memory of the stubbed runtime
+void *operator new(size_t size) {
+  void *ptr = CountedMalloc(size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+void *operator new[](size_t size) { return operator new(size); }
+void *operator new(size_t size, const std::nothrow_t &) noexcept { return CountedMalloc(size); }
+void *operator new[](size_t size, const std::nothrow_t &) noexcept { return CountedMalloc(size); }
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { std::free(ptr); }
+
+namespace ge {
+namespace {
+const uint64_t kSessionId = 0;
+const uint32_t kAddrLen = sizeof(void *);
+const char *const kBatchLabelPrefix = "Batch_";
+
+struct BenchmarkOptions {
+  uint32_t task_num = 64;
+  uint32_t input_num = 4;
+  uint32_t output_num = 2;
+  uint32_t gear_num = 1;
+  int64_t tensor_size = 4096;
+  uint32_t request_num = 1000;
+  std::map<std::string, uint32_t> latencies;
+};
+
+struct Counters {
+  int64_t wall_ns = 0;
+  int64_t cpu_ns = 0;
+  uint64_t alloc_count = 0;
+  uint64_t alloc_bytes = 0;
+
+  static Counters Now() {
+    Counters counters;
+    counters.wall_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         std::chrono::steady_clock::now().time_since_epoch())
+                         .count();
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    counters.cpu_ns = static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+    counters.alloc_count = g_alloc_count.load(std::memory_order_relaxed);
+    counters.alloc_bytes = g_alloc_bytes.load(std::memory_order_relaxed);
+    return counters;
+  }
+
+  Counters operator-(const Counters &other) const {
+    Counters diff;
+    diff.wall_ns = wall_ns - other.wall_ns;
+    diff.cpu_ns = cpu_ns - other.cpu_ns;
+    diff.alloc_count = alloc_count - other.alloc_count;
+    diff.alloc_bytes = alloc_bytes - other.alloc_bytes;
+    return diff;
+  }
+};
+
+class NullListener : public ModelListener {
+ public:
+  Status OnComputeDone(uint32_t model_id, uint32_t data_index, uint32_t result_code,
+                       std::vector<OutputTensorInfo> &outputs) override {
+    return SUCCESS;
+  }
+};
+
+// takes the place of the profiler, counting the records reported to it
+class CountingReporter : public Msprof::Engine::Reporter {
+ public:
+  int Report(const Msprof::Engine::ReporterData *data) override {
+    report_count.fetch_add(1, std::memory_order_relaxed);
+    report_bytes.fetch_add(data->dataLen, std::memory_order_relaxed);
+    return 0;
+  }
+  int Flush() override { return 0; }
+
+  std::atomic<uint64_t> report_count{0};
+  std::atomic<uint64_t> report_bytes{0};
+};
+
+///
+/// Turns the profiling of model load and execute on the way the profiling options of a session do, and registers the
+/// reporter in place of the profiler. The device list is filled by the real profiler only, so reports of load are
+/// dropped and only those of execute reach the reporter.
+///
+void EnableProfiling(PluginImpl &plugin, CountingReporter &reporter) {
+  Options options;
+  options.profiling_mode = "1";
+  options.profiling_options = "task_trace";
+  (void)ProfilingManager::Instance().InitFromOptions(options);
+  (void)plugin.Init(&reporter);
+}
+
+void DisableProfiling(PluginImpl &plugin) {
+  (void)ProfilingManager::Instance().InitFromOptions(Options());
+  (void)plugin.UnInit();
+}
+
+bool ParseUint(const char *arg, const char *name, uint32_t &value) {
+  size_t len = strlen(name);
+  if (strncmp(arg, name, len) != 0) {
+    return false;
+  }
+  value = static_cast<uint32_t>(std::strtoul(arg + len, nullptr, 10));
+  return true;
+}
+
+bool ParseLatencies(const char *arg, std::map<std::string, uint32_t> &latencies) {
+  const char *const kName = "--latency=";
+  if (strncmp(arg, kName, strlen(kName)) != 0) {
+    return false;
+  }
+  std::string items(arg + strlen(kName));
+  size_t begin = 0;
+  while (begin < items.size()) {
+    size_t end = items.find(',', begin);
+    end = (end == std::string::npos) ? items.size() : end;
+    std::string item = items.substr(begin, end - begin);
+    size_t sep = item.find(':');
+    if (sep != std::string::npos) {
+      latencies[item.substr(0, sep)] = static_cast<uint32_t>(std::strtoul(item.c_str() + sep + 1, nullptr, 10));
+    }
+    begin = end + 1;
+  }
+  return true;
+}
+
+bool ParseOptions(int argc, char **argv, BenchmarkOptions &options) {
+  for (int i = 1; i < argc; ++i) {
+    uint32_t tensor_size = 0;
+    if (ParseUint(argv[i], "--tasks=", options.task_num) || ParseUint(argv[i], "--inputs=", options.input_num) ||
+        ParseUint(argv[i], "--outputs=", options.output_num) || ParseUint(argv[i], "--gears=", options.gear_num) ||
+        ParseUint(argv[i], "--requests=", options.request_num) || ParseLatencies(argv[i], options.latencies)) {
+      continue;
+    }
+    if (ParseUint(argv[i], "--tensor_size=", tensor_size)) {
+      options.tensor_size = tensor_size;
+      continue;
+    }
+    fprintf(stderr, "Unknown option %s\n", argv[i]);
+    return false;
+  }
+  if ((options.task_num == 0) || (options.input_num == 0) || (options.output_num == 0) || (options.gear_num == 0) ||
+      (options.tensor_size < static_cast<int64_t>(sizeof(float))) || (options.request_num == 0)) {
+    fprintf(stderr, "tasks, inputs, outputs, gears, requests and tensor_size must be positive\n");
+    return false;
+  }
+  return true;
+}
+
+GeTensorDesc CreateTensorDesc(int64_t size) {
+  GeTensorDesc tensor_desc(GeShape({size / static_cast<int64_t>(sizeof(float))}), FORMAT_ND, DT_FLOAT);
+  TensorUtils::SetSize(tensor_desc, size);
+  return tensor_desc;
+}
+
+///
+/// Synthetic model: Data ops feed a chain of TE kernels per gear, the chains of all gears share the feature map like
+/// the branches of a multi-batch model do, and their last kernels are merged into NetOutput. Layout of feature map:
+/// | inputs | 2 intermediate buffers used in turn | outputs |
+///
+class SyntheticModelBuilder {
+ public:
+  explicit SyntheticModelBuilder(const BenchmarkOptions &options) : options_(options) {}
+
+  GeModelPtr Build() {
+    graph_ = std::make_shared<ComputeGraph>("benchmark_graph");
+    task_def_ = std::make_shared<domi::ModelTaskDef>();
+    const int64_t size = options_.tensor_size;
+    const int64_t mid_offset = options_.input_num * size;
+    const int64_t output_offset = mid_offset + 2 * size;
+
+    std::vector<NodePtr> data_nodes;
+    for (uint32_t i = 0; i < options_.input_num; ++i) {
+      auto op_desc = CreateOpDesc("data_" + std::to_string(i), DATA);
+      op_desc->AddOutputDesc(CreateTensorDesc(size));
+      op_desc->SetOutputOffset({i * size});
+      (void)AttrUtils::SetInt(op_desc, ATTR_NAME_INDEX, i);
+      data_nodes.emplace_back(graph_->AddNode(op_desc));
+    }
+
+    std::vector<NodePtr> gear_outputs;
+    for (uint32_t gear = 0; gear < options_.gear_num; ++gear) {
+      NodePtr last_node = nullptr;
+      for (uint32_t k = 0; k < options_.task_num; ++k) {
+        std::vector<int64_t> input_offsets;
+        if (k == 0) {
+          for (uint32_t i = 0; i < options_.input_num; ++i) {
+            input_offsets.emplace_back(i * size);
+          }
+        } else {
+          input_offsets.emplace_back(mid_offset + ((k - 1) % 2) * size);
+        }
+        std::vector<int64_t> output_offsets;
+        if (k + 1 == options_.task_num) {
+          for (uint32_t j = 0; j < options_.output_num; ++j) {
+            output_offsets.emplace_back(output_offset + j * size);
+          }
+        } else {
+          output_offsets.emplace_back(mid_offset + (k % 2) * size);
+        }
+
+        auto node = AddKernel("gear" + std::to_string(gear) + "_kernel" + std::to_string(k), gear, input_offsets,
+                              output_offsets);
+        for (size_t i = 0; i < input_offsets.size(); ++i) {
+          const auto &src = (k == 0) ? data_nodes[i] : last_node;
+          (void)GraphUtils::AddEdge(src->GetOutDataAnchor(0), node->GetInDataAnchor(i));
+        }
+        last_node = node;
+      }
+      gear_outputs.emplace_back(last_node);
+    }
+
+    auto net_output_desc = CreateOpDesc("net_output", NETOUTPUT);
+    std::vector<int64_t> net_output_offsets;
+    for (uint32_t j = 0; j < options_.output_num; ++j) {
+      net_output_desc->AddInputDesc(CreateTensorDesc(size));
+      net_output_offsets.emplace_back(output_offset + j * size);
+    }
+    net_output_desc->SetInputOffset(net_output_offsets);
+    auto net_output = graph_->AddNode(net_output_desc);
+    for (uint32_t j = 0; j < options_.output_num; ++j) {
+      if (options_.gear_num == 1) {
+        (void)GraphUtils::AddEdge(gear_outputs[0]->GetOutDataAnchor(j), net_output->GetInDataAnchor(j));
+        continue;
+      }
+      auto merge_desc = CreateOpDesc("merge_" + std::to_string(j), MERGE);
+      for (uint32_t gear = 0; gear < options_.gear_num; ++gear) {
+        merge_desc->AddInputDesc(CreateTensorDesc(size));
+      }
+      merge_desc->AddOutputDesc(CreateTensorDesc(size));
+      merge_desc->SetInputOffset(std::vector<int64_t>(options_.gear_num, output_offset + j * size));
+      merge_desc->SetOutputOffset({output_offset + j * size});
+      auto merge = graph_->AddNode(merge_desc);
+      for (uint32_t gear = 0; gear < options_.gear_num; ++gear) {
+        (void)GraphUtils::AddEdge(gear_outputs[gear]->GetOutDataAnchor(j), merge->GetInDataAnchor(gear));
+      }
+      (void)GraphUtils::AddEdge(merge->GetOutDataAnchor(0), net_output->GetInDataAnchor(j));
+    }
+
+    auto ge_model = std::make_shared<GeModel>();
+    ge_model->SetName("benchmark_model");
+    ge_model->SetGraph(GraphUtils::CreateGraphFromComputeGraph(graph_));
+    ge_model->SetModelTaskDef(task_def_);
+    (void)AttrUtils::SetInt(ge_model, ATTR_MODEL_MEMORY_SIZE, output_offset + options_.output_num * size);
+    (void)AttrUtils::SetInt(ge_model, ATTR_MODEL_WEIGHT_SIZE, 0);
+    (void)AttrUtils::SetInt(ge_model, ATTR_MODEL_STREAM_NUM, 1);
+    (void)AttrUtils::SetInt(ge_model, ATTR_MODEL_EVENT_NUM, 0);
+    (void)AttrUtils::SetInt(ge_model, ATTR_MODEL_LABEL_NUM, 0);
+    (void)AttrUtils::SetInt(ge_model, ATTR_MODEL_BATCH_NUM, options_.gear_num);
+    (void)AttrUtils::SetInt(ge_model, MODEL_ATTR_TASK_GEN_BASE_ADDR, 0);
+    (void)AttrUtils::SetInt(ge_model, MODEL_ATTR_SESSION_ID, kSessionId);
+    return ge_model;
+  }
+
+ private:
+  OpDescPtr CreateOpDesc(const std::string &name, const std::string &type) {
+    auto op_desc = std::make_shared<OpDesc>(name, type);
+    op_desc->SetId(next_op_id_++);
+    return op_desc;
+  }
+
+  NodePtr AddKernel(const std::string &name, uint32_t gear, const std::vector<int64_t> &input_offsets,
+                    const std::vector<int64_t> &output_offsets) {
+    auto op_desc = CreateOpDesc(name, "BenchmarkKernel");
+    for (size_t i = 0; i < input_offsets.size(); ++i) {
+      op_desc->AddInputDesc(CreateTensorDesc(options_.tensor_size));
+    }
+    for (size_t i = 0; i < output_offsets.size(); ++i) {
+      op_desc->AddOutputDesc(CreateTensorDesc(options_.tensor_size));
+    }
+    op_desc->SetInputOffset(input_offsets);
+    op_desc->SetOutputOffset(output_offsets);
+    if (options_.gear_num > 1) {
+      (void)AttrUtils::SetStr(op_desc, ATTR_NAME_BATCH_LABEL, kBatchLabelPrefix + std::to_string(gear));
+    }
+    (void)AttrUtils::SetInt(op_desc, ATTR_NAME_IMPLY_TYPE, static_cast<int64_t>(domi::ImplyType::TVM));
+    (void)AttrUtils::SetStr(op_desc, TVM_ATTR_NAME_MAGIC, "RT_DEV_BINARY_MAGIC_ELF");
+    std::vector<char> kernel_bin(64, 0);
+    TBEKernelPtr tbe_kernel = std::make_shared<OpKernelBin>(name, std::move(kernel_bin));
+    (void)op_desc->SetExtAttr(OP_EXTATTR_NAME_TBE_KERNEL, tbe_kernel);
+
+    domi::TaskDef *task_def = task_def_->add_task();
+    task_def->set_type(RT_MODEL_TASK_KERNEL);
+    task_def->set_stream_id(0);
+    domi::KernelDef *kernel_def = task_def->mutable_kernel();
+    uint32_t args_size = kAddrLen * static_cast<uint32_t>(input_offsets.size() + output_offsets.size());
+    kernel_def->set_stub_func(name);
+    kernel_def->set_block_dim(1);
+    kernel_def->set_args(std::string(args_size, '\0'));
+    kernel_def->set_args_size(args_size);
+    domi::KernelContext *context = kernel_def->mutable_context();
+    context->set_kernel_type(static_cast<uint32_t>(cce::ccKernelType::TE));
+    context->set_op_index(static_cast<uint32_t>(op_desc->GetId()));
+    uint16_t args_offset = 0;
+    context->set_args_offset(&args_offset, sizeof(args_offset));
+    return graph_->AddNode(op_desc);
+  }
+
+  const BenchmarkOptions &options_;
+  ComputeGraphPtr graph_;
+  std::shared_ptr<domi::ModelTaskDef> task_def_;
+  int64_t next_op_id_ = 0;
+};
+
+struct RequestBuffers {
+  std::vector<std::vector<uint8_t>> inputs;
+  std::vector<std::vector<uint8_t>> outputs;
+
+  explicit RequestBuffers(const BenchmarkOptions &options)
+      : inputs(options.input_num, std::vector<uint8_t>(options.tensor_size)),
+        outputs(options.output_num, std::vector<uint8_t>(options.tensor_size)) {}
+
+  void Fill(uint32_t request_index, const BenchmarkOptions &options, InputData &input_data, OutputData &output_data) {
+    input_data.index = request_index;
+    input_data.blobs.clear();
+    for (auto &input : inputs) {
+      input_data.blobs.emplace_back(input.data(), input.size(), false);
+    }
+    input_data.is_dynamic_batch = options.gear_num > 1;
+    input_data.batch_label =
+      input_data.is_dynamic_batch ? kBatchLabelPrefix + std::to_string(request_index % options.gear_num) : "";
+    output_data.blobs.clear();
+    for (auto &output : outputs) {
+      output_data.blobs.emplace_back(output.data(), output.size(), false);
+    }
+  }
+};
+
+void PrintCallCounts(const std::map<std::string, uint64_t> &call_counts, uint32_t divisor) {
+  std::vector<std::pair<uint64_t, std::string>> sorted_counts;
+  for (const auto &api_and_count : call_counts) {
+    sorted_counts.emplace_back(api_and_count.second, api_and_count.first);
+  }
+  std::sort(sorted_counts.rbegin(), sorted_counts.rend());
+  for (const auto &count_and_api : sorted_counts) {
+    printf("    %-28s %10.2f\n", count_and_api.second.c_str(), static_cast<double>(count_and_api.first) / divisor);
+  }
+}
+
+void PrintResult(const std::string &scenario, const Counters &counters, uint32_t request_num,
+                 std::vector<int64_t> &cpu_ns_per_request) {
+  auto &recorder = RtCallRecorder::Instance();
+  printf("[%s] requests %u\n", scenario.c_str(), request_num);
+  printf("  wall time per request  %10.2f us\n", counters.wall_ns / 1000.0 / request_num);
+  printf("  cpu time per request   %10.2f us", counters.cpu_ns / 1000.0 / request_num);
+  if (!cpu_ns_per_request.empty()) {
+    std::sort(cpu_ns_per_request.begin(), cpu_ns_per_request.end());
+    size_t p99_index = std::min(cpu_ns_per_request.size() - 1, cpu_ns_per_request.size() * 99 / 100);
+    printf(" (p50 %.2f us, p99 %.2f us)", cpu_ns_per_request[cpu_ns_per_request.size() / 2] / 1000.0,
+           cpu_ns_per_request[p99_index] / 1000.0);
+  }
+  printf("\n");
+  printf("  allocations per request %9.2f (%.0f bytes)\n", static_cast<double>(counters.alloc_count) / request_num,
+         static_cast<double>(counters.alloc_bytes) / request_num);
+  printf("  rt calls per request   %10.2f\n", static_cast<double>(recorder.GetTotalCalls()) / request_num);
+  PrintCallCounts(recorder.GetCallCounts(), request_num);
+}
+
+// run the requests twice with the call sequence recorded, requests of the same gear must make the same calls
+bool CheckReplay(const BenchmarkOptions &options, const std::function<Status(uint32_t)> &run_request) {
+  auto &recorder = RtCallRecorder::Instance();
+  std::vector<std::vector<std::string>> gear_traces(options.gear_num);
+  uint32_t replay_num = std::min(options.request_num, options.gear_num * 4);
+  for (uint32_t round = 0; round < 2; ++round) {
+    for (uint32_t r = 0; r < replay_num; ++r) {
+      recorder.Start(true);
+      Status ret = run_request(r);
+      recorder.Stop();
+      if (ret != SUCCESS) {
+        return false;
+      }
+      auto trace = recorder.GetTrace();
+      auto &gear_trace = gear_traces[r % options.gear_num];
+      if (gear_trace.empty()) {
+        gear_trace = trace;
+      } else if (gear_trace != trace) {
+        printf("  replay: request %u made %zu rt calls, %zu by the first one of its gear\n", r, trace.size(),
+               gear_trace.size());
+        return false;
+      }
+    }
+  }
+  printf("  replay: identical rt call sequence for the requests of each gear\n");
+  return true;
+}
+
+Status LoadModel(const BenchmarkOptions &options, const std::shared_ptr<ModelListener> &listener, uint32_t model_id,
+                 std::unique_ptr<DavinciModel> &model) {
+  auto &recorder = RtCallRecorder::Instance();
+  recorder.Start(false);
+  Counters start = Counters::Now();
+  SyntheticModelBuilder builder(options);
+  GeModelPtr ge_model = builder.Build();
+  model.reset(new DavinciModel(0, listener));
+  model->SetId(model_id);
+  Status ret = model->Assign(ge_model);
+  if (ret == SUCCESS) {
+    ret = model->Init();
+  }
+  Counters load = Counters::Now() - start;
+  recorder.Stop();
+  if (ret != SUCCESS) {
+    fprintf(stderr, "Failed to load model, ret %u\n", ret);
+    return ret;
+  }
+  std::vector<int64_t> no_samples;
+  PrintResult("load model " + std::to_string(model_id), load, 1, no_samples);
+  return SUCCESS;
+}
+
+Status RunScenario(const std::string &scenario, const BenchmarkOptions &options,
+                   const std::function<Status(uint32_t)> &run_request) {
+  // warm up, so that the first binding of user buffers is not taken in
+  for (uint32_t r = 0; r < std::min(options.request_num, options.gear_num * 2); ++r) {
+    GE_CHK_STATUS_RET(run_request(r), "Warm up of %s failed", scenario.c_str());
+  }
+
+  auto &recorder = RtCallRecorder::Instance();
+  std::vector<int64_t> cpu_ns_per_request;
+  cpu_ns_per_request.reserve(options.request_num);
+  recorder.Start(false);
+  Counters start = Counters::Now();
+  Counters last = start;
+  for (uint32_t r = 0; r < options.request_num; ++r) {
+    Status ret = run_request(r);
+    if (ret != SUCCESS) {
+      recorder.Stop();
+      GELOGE(ret, "Request %u of %s failed", r, scenario.c_str());
+      return ret;
+    }
+    Counters now = Counters::Now();
+    cpu_ns_per_request.emplace_back(now.cpu_ns - last.cpu_ns);
+    last = now;
+  }
+  Counters total = Counters::Now() - start;
+  recorder.Stop();
+  PrintResult(scenario, total, options.request_num, cpu_ns_per_request);
+  return CheckReplay(options, run_request) ? SUCCESS : FAILED;
+}
+
+int RunBenchmark(const BenchmarkOptions &options) {
+  printf("tasks %u, inputs %u, outputs %u, gears %u, tensor size %ld\n", options.task_num, options.input_num,
+         options.output_num, options.gear_num, options.tensor_size);
+  auto &recorder = RtCallRecorder::Instance();
+  for (const auto &api_and_latency : options.latencies) {
+    printf("simulated latency of %s: %u us\n", api_and_latency.first.c_str(), api_and_latency.second);
+    recorder.SetLatency(api_and_latency.first, api_and_latency.second);
+  }
+  (void)MemManager::Instance().Initialize(std::vector<rtMemType_t>({RT_MEMORY_HBM}));
+  (void)VarManager::Instance(kSessionId)->Init(0, kSessionId, 0, 0);
+
+  // zero copy path: user buffers are bound to task args, outputs are written in place
+  std::shared_ptr<ModelListener> listener = std::make_shared<NullListener>();
+  std::unique_ptr<DavinciModel> sync_model;
+  if (LoadModel(options, listener, 1, sync_model) != SUCCESS) {
+    return 1;
+  }
+  RequestBuffers sync_buffers(options);
+  InputData sync_input;
+  OutputData sync_output;
+  Status ret = RunScenario("execute zero copy", options, [&](uint32_t r) -> Status {
+    sync_buffers.Fill(r, options, sync_input, sync_output);
+    return sync_model->NnExecute(nullptr, false, sync_input, sync_output);
+  });
+  if (ret != SUCCESS) {
+    return 1;
+  }
+
+  // async path: outputs are copied back to host by ReturnResult
+  std::unique_ptr<DavinciModel> async_model;
+  if (LoadModel(options, listener, 2, async_model) != SUCCESS) {
+    return 1;
+  }
+  rtStream_t stream = nullptr;
+  GE_CHK_RT_EXEC(rtStreamCreate(&stream, 0), return 1);
+  RequestBuffers async_buffers(options);
+  InputData async_input;
+  OutputData async_output;
+  ret = RunScenario("execute async and return result", options, [&](uint32_t r) -> Status {
+    async_buffers.Fill(r, options, async_input, async_output);
+    GE_CHK_STATUS_RET_NOLOG(async_model->NnExecute(stream, true, async_input, async_output));
+    GE_CHK_RT_RET(rtStreamSynchronize(stream));
+    return async_model->ReturnResult(r, true, false, &async_output);
+  });
+  (void)rtStreamDestroy(stream);
+  if (ret != SUCCESS) {
+    return 1;
+  }
+
+  // zero copy path with profiling on: timestamps are taken around the stages and reported per request
+  PluginImpl plugin(GE_PROFILING_MODULE);
+  CountingReporter reporter;
+  EnableProfiling(plugin, reporter);
+  std::unique_ptr<DavinciModel> profiling_model;
+  if (LoadModel(options, listener, 3, profiling_model) != SUCCESS) {
+    DisableProfiling(plugin);
+    return 1;
+  }
+  RequestBuffers profiling_buffers(options);
+  InputData profiling_input;
+  OutputData profiling_output;
+  uint64_t report_count = reporter.report_count.load();
+  uint64_t report_bytes = reporter.report_bytes.load();
+  ret = RunScenario("execute zero copy with profiling", options, [&](uint32_t r) -> Status {
+    profiling_buffers.Fill(r, options, profiling_input, profiling_output);
+    return profiling_model->NnExecute(nullptr, false, profiling_input, profiling_output);
+  });
+  // the requests of the warm up and the replay check report too
+  printf("  profiling reports      %10lu (%lu bytes)\n", reporter.report_count.load() - report_count,
+         reporter.report_bytes.load() - report_bytes);
+  DisableProfiling(plugin);
+
+  sync_model.reset();
+  async_model.reset();
+  profiling_model.reset();
+  VarManagerPool::Instance().Destory();
+  MemManager::Instance().Finalize();
+  return ret == SUCCESS ? 0 : 1;
+}
+}  // namespace
+}  // namespace ge
+
+int main(int argc, char **argv) {
+  ge::BenchmarkOptions options;
+  if (!ge::ParseOptions(argc, argv, options)) {
+    return 1;
+  }
+  return ge::RunBenchmark(options);
+}
@@ -0,0 +1,211 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmark of the host constant folding kernels. Every kernel is run through KernelFactory on a [rows, cols] tensor
+// of --elements elements, the way ConstantFoldingPass calls it, reporting wall and cpu time per Compute call.
+//
+// usage: ge_host_kernel_benchmark [--elements=N] [--cols=N] [--iterations=N] [--kernel=TYPE]
+
+#include <time.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "common/types.h"
+#include "graph/debug/ge_attr_define.h"
+#include "graph/op_desc.h"
+#include "graph/utils/attr_utils.h"
+#include "graph/utils/tensor_utils.h"
+#include "inc/kernel.h"
+#include "inc/kernel_factory.h"
+
+namespace ge {
+namespace {
+struct BenchmarkOptions {
+  uint32_t element_num = 1U << 20;
+  uint32_t col_num = 256;
+  uint32_t iteration_num = 20;
+  std::string kernel;
+};
+
+struct KernelCase {
+  std::string type;
+  OpDescPtr op_desc;
+  std::vector<ConstGeTensorPtr> inputs;
+};
+
+bool ParseUint(const char *arg, const char *name, uint32_t &value) {
+  size_t len = strlen(name);
+  if (strncmp(arg, name, len) != 0) {
+    return false;
+  }
+  value = static_cast<uint32_t>(std::strtoul(arg + len, nullptr, 10));
+  return true;
+}
+
+bool ParseOptions(int argc, char **argv, BenchmarkOptions &options) {
+  const char *const kKernelName = "--kernel=";
+  for (int i = 1; i < argc; ++i) {
+    if (ParseUint(argv[i], "--elements=", options.element_num) || ParseUint(argv[i], "--cols=", options.col_num) ||
+        ParseUint(argv[i], "--iterations=", options.iteration_num)) {
+      continue;
+    }
+    if (strncmp(argv[i], kKernelName, strlen(kKernelName)) == 0) {
+      options.kernel = argv[i] + strlen(kKernelName);
+      continue;
+    }
+    fprintf(stderr, "Unknown option %s\n", argv[i]);
+    return false;
+  }
+  if ((options.col_num == 0) || (options.element_num < options.col_num) || (options.iteration_num == 0)) {
+    fprintf(stderr, "cols and iterations must be positive, elements must not be less than cols\n");
+    return false;
+  }
+  return true;
+}
+
+int64_t NowCpuNs() {
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+int64_t NowWallNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+template <typename T>
+ConstGeTensorPtr CreateTensor(const std::vector<int64_t> &dims, DataType data_type, T value) {
+  GeTensorDesc tensor_desc(GeShape(dims), FORMAT_ND, data_type);
+  int64_t shape_size = GeShape(dims).GetShapeSize();
+  std::vector<T> data(static_cast<size_t>(shape_size == 0 ? 1 : shape_size), value);
+  return std::make_shared<GeTensor>(tensor_desc, reinterpret_cast<const uint8_t *>(data.data()),
+                                    data.size() * sizeof(T));
+}
+
+OpDescPtr CreateOpDesc(const std::string &type, const std::vector<ConstGeTensorPtr> &inputs,
+                       const GeTensorDesc &output_desc) {
+  auto op_desc = std::make_shared<OpDesc>("benchmark_" + type, type);
+  for (const auto &input : inputs) {
+    (void)op_desc->AddInputDesc(input->GetTensorDesc());
+  }
+  (void)op_desc->AddOutputDesc(output_desc);
+  return op_desc;
+}
+
+KernelCase CreateElementwiseCase(const std::string &type, const std::vector<ConstGeTensorPtr> &inputs) {
+  GeTensorDesc output_desc = inputs[0]->GetTensorDesc();
+  return {type, CreateOpDesc(type, inputs, output_desc), inputs};
+}
+
+std::vector<KernelCase> CreateCases(const BenchmarkOptions &options) {
+  int64_t rows = options.element_num / options.col_num;
+  int64_t cols = options.col_num;
+  std::vector<KernelCase> cases;
+  // the bias of the broadcast kernels is a row, which is repeated along the first dim
+  cases.emplace_back(CreateElementwiseCase(
+    ADD, {CreateTensor<float>({rows, cols}, DT_FLOAT, 1.5f), CreateTensor<float>({cols}, DT_FLOAT, 2.5f)}));
+  cases.emplace_back(CreateElementwiseCase(
+    MUL, {CreateTensor<int32_t>({rows, cols}, DT_INT32, 3), CreateTensor<int32_t>({1, cols}, DT_INT32, 7)}));
+  cases.emplace_back(CreateElementwiseCase(
+    SUB, {CreateTensor<float>({rows, cols}, DT_FLOAT, 1.5f), CreateTensor<float>({cols}, DT_FLOAT, 2.5f)}));
+  cases.emplace_back(CreateElementwiseCase(RSQRT, {CreateTensor<float>({rows, cols}, DT_FLOAT, 4.0f)}));
+
+  std::vector<ConstGeTensorPtr> reduce_inputs = {CreateTensor<int32_t>({rows, cols}, DT_INT32, 1),
+                                                 CreateTensor<int32_t>({1}, DT_INT32, 1)};
+  GeTensorDesc reduce_output(GeShape({rows}), FORMAT_ND, DT_INT32);
+  cases.push_back({REDUCEPROD, CreateOpDesc(REDUCEPROD, reduce_inputs, reduce_output), reduce_inputs});
+
+  std::vector<ConstGeTensorPtr> concat_inputs = {CreateTensor<float>({rows, cols}, DT_FLOAT, 1.0f),
+                                                 CreateTensor<float>({rows, cols}, DT_FLOAT, 2.0f),
+                                                 CreateTensor<int32_t>({}, DT_INT32, 1)};
+  GeTensorDesc concat_output(GeShape({rows, cols * 2}), FORMAT_ND, DT_FLOAT);
+  auto concat_desc = CreateOpDesc(CONCATV2, concat_inputs, concat_output);
+  (void)AttrUtils::SetInt(concat_desc, ATTR_NAME_T, static_cast<int64_t>(DT_FLOAT));
+  cases.push_back({CONCATV2, concat_desc, concat_inputs});
+
+  std::vector<ConstGeTensorPtr> transpose_inputs = {CreateTensor<float>({rows, cols}, DT_FLOAT, 1.0f),
+                                                    CreateTensor<int32_t>({2}, DT_INT32, 0)};
+  // perm {1, 0}
+  const_cast<int32_t *>(reinterpret_cast<const int32_t *>(transpose_inputs[1]->GetData().data()))[0] = 1;
+  GeTensorDesc transpose_output(GeShape({cols, rows}), FORMAT_ND, DT_FLOAT);
+  cases.push_back({TRANSPOSE, CreateOpDesc(TRANSPOSE, transpose_inputs, transpose_output), transpose_inputs});
+
+  std::vector<ConstGeTensorPtr> cast_inputs = {CreateTensor<float>({rows, cols}, DT_FLOAT, 1.0f)};
+  GeTensorDesc cast_output(GeShape({rows, cols}), FORMAT_ND, DT_FLOAT16);
+  cases.push_back({CAST, CreateOpDesc(CAST, cast_inputs, cast_output), cast_inputs});
+  return cases;
+}
+
+Status RunCase(const KernelCase &kernel_case, const BenchmarkOptions &options) {
+  auto kernel = KernelFactory::Instance().Create(kernel_case.type);
+  if (kernel == nullptr) {
+    fprintf(stderr, "No host kernel registered for %s\n", kernel_case.type.c_str());
+    return FAILED;
+  }
+  // warm up, the first call also pays for the threads of the pool
+  std::vector<GeTensorPtr> outputs;
+  Status ret = kernel->Compute(kernel_case.op_desc, kernel_case.inputs, outputs);
+  if ((ret != SUCCESS) || outputs.empty()) {
+    fprintf(stderr, "Host kernel %s failed to compute, ret %u\n", kernel_case.type.c_str(), ret);
+    return FAILED;
+  }
+  size_t output_bytes = outputs[0]->GetData().size();
+
+  int64_t start_wall = NowWallNs();
+  int64_t start_cpu = NowCpuNs();
+  for (uint32_t i = 0; i < options.iteration_num; ++i) {
+    outputs.clear();
+    ret = kernel->Compute(kernel_case.op_desc, kernel_case.inputs, outputs);
+    if (ret != SUCCESS) {
+      fprintf(stderr, "Host kernel %s failed to compute, ret %u\n", kernel_case.type.c_str(), ret);
+      return FAILED;
+    }
+  }
+  int64_t wall_ns = NowWallNs() - start_wall;
+  int64_t cpu_ns = NowCpuNs() - start_cpu;
+  printf("[%s] elements %u, iterations %u\n", kernel_case.type.c_str(), options.element_num, options.iteration_num);
+  printf("  wall time per compute  %10.2f us\n", wall_ns / 1000.0 / options.iteration_num);
+  printf("  cpu time per compute   %10.2f us\n", cpu_ns / 1000.0 / options.iteration_num);
+  printf("  output throughput      %10.2f MB/s\n",
+         (wall_ns == 0) ? 0.0 : output_bytes * 1000.0 * options.iteration_num / wall_ns);
+  return SUCCESS;
+}
+}  // namespace
+}  // namespace ge
+
+int main(int argc, char **argv) {
+  ge::BenchmarkOptions options;
+  if (!ge::ParseOptions(argc, argv, options)) {
+    return 1;
+  }
+  int result = 0;
+  for (const auto &kernel_case : ge::CreateCases(options)) {
+    if (!options.kernel.empty() && (kernel_case.type != options.kernel)) {
+      continue;
+    }
+    if (ge::RunCase(kernel_case, options) != ge::SUCCESS) {
+      result = 1;
+    }
+  }
+  return result;
+}
@@ -0,0 +1,288 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Host side benchmark of the per iteration overhead of a known shape subgraph in the hybrid executor, against the
+// stubbed runtime. The subgraph holds one node whose task only launches (no device work), so what is reported is the
+// executor around it, piece by piece: creating or reusing the TaskContext, ExecutionEngine::ExecuteAsync with the
+// NodeDoneCallback run inline or through the CallbackManager thread, and SubgraphExecutor::ExecuteAsync of the whole
+// subgraph. Each iteration waits for its done callback, as the execution of a model does. Wall time, cpu time of the
+// process, host allocations and runtime calls are reported per iteration.
+//
+// usage: ge_known_subgraph_benchmark [--iterations=N]
+
+#include <time.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "graph/compute_graph.h"
+#include "graph/manager/graph_mem_allocator.h"
+#include "graph/utils/tensor_utils.h"
+#include "hybrid/common/npu_memory_allocator.h"
+#include "rt_call_recorder.h"
+
+// the subgraph is assembled by hand instead of by HybridModelBuilder
+#define protected public
+#define private public
+#include "hybrid/executor/hybrid_execution_context.h"
+#include "hybrid/executor/rt_callback_manager.h"
+#include "hybrid/executor/subgraph_context.h"
+#include "hybrid/executor/subgraph_executor.h"
+#include "hybrid/executor/worker/execution_engine.h"
+#include "hybrid/model/graph_item.h"
+#include "hybrid/node_executor/node_executor.h"
+#include "hybrid/node_executor/task_context.h"
+#undef private
+#undef protected
+
+namespace {
+std::atomic<uint64_t> g_alloc_count{0};
+
+void *CountedMalloc(size_t size) {
+  g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+  return std::malloc(size == 0 ? 1 : size);
+}
+}  // namespace
+
+// count every host allocation of the process, the callback thread included
+void *operator new(size_t size) {
+  void *ptr = CountedMalloc(size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+void *operator new[](size_t size) { return operator new(size); }
+void *operator new(size_t size, const std::nothrow_t &) noexcept { return CountedMalloc(size); }
+void *operator new[](size_t size, const std::nothrow_t &) noexcept { return CountedMalloc(size); }
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { std::free(ptr); }
+
+namespace ge {
+namespace hybrid {
+namespace {
+const int64_t kElementNum = 16;
+
+int64_t NowCpuNs() {
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+int64_t NowWallNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+// launches nothing, the done callback runs inline or is registered to the CallbackManager like a known node task
+class LaunchOnlyTask : public NodeTask {
+ public:
+  Status UpdateArgs(TaskContext &context) override { return SUCCESS; }
+
+  Status ExecuteAsync(TaskContext &context, std::function<void()> done_callback) override {
+    if (!use_callback_manager) {
+      done_callback();
+      done_count.fetch_add(1, std::memory_order_release);
+      return SUCCESS;
+    }
+    return context.RegisterCallback([this, done_callback]() {
+      done_callback();
+      done_count.fetch_add(1, std::memory_order_release);
+    });
+  }
+
+  void WaitDone(uint64_t count) const {
+    while (done_count.load(std::memory_order_acquire) < count) {
+      std::this_thread::yield();
+    }
+  }
+
+  bool use_callback_manager = false;
+  std::atomic<uint64_t> done_count{0};
+};
+
+class LaunchOnlyExecutor : public NodeExecutor {};
+
+struct BenchmarkOptions {
+  uint32_t iteration_num = 10000;
+};
+
+bool ParseOptions(int argc, char **argv, BenchmarkOptions &options) {
+  const char *const kIterationsName = "--iterations=";
+  for (int i = 1; i < argc; ++i) {
+    if (strncmp(argv[i], kIterationsName, strlen(kIterationsName)) == 0) {
+      options.iteration_num = static_cast<uint32_t>(std::strtoul(argv[i] + strlen(kIterationsName), nullptr, 10));
+      continue;
+    }
+    fprintf(stderr, "Unknown option %s\n", argv[i]);
+    return false;
+  }
+  if (options.iteration_num == 0) {
+    fprintf(stderr, "iterations must be positive\n");
+    return false;
+  }
+  return true;
+}
+
+Status RunScenario(const std::string &scenario, uint32_t iteration_num, const std::function<Status()> &iterate) {
+  auto &recorder = RtCallRecorder::Instance();
+  recorder.Start(false);
+  uint64_t alloc_count = g_alloc_count.load();
+  int64_t wall_start = NowWallNs();
+  int64_t cpu_start = NowCpuNs();
+  for (uint32_t i = 0; i < iteration_num; ++i) {
+    Status ret = iterate();
+    if (ret != SUCCESS) {
+      recorder.Stop();
+      GELOGE(ret, "Iteration %u of %s failed", i, scenario.c_str());
+      return ret;
+    }
+  }
+  int64_t cpu_ns = NowCpuNs() - cpu_start;
+  int64_t wall_ns = NowWallNs() - wall_start;
+  alloc_count = g_alloc_count.load() - alloc_count;
+  recorder.Stop();
+  printf("[%s]\n", scenario.c_str());
+  printf("  wall time per iteration  %10.3f us\n", wall_ns / 1000.0 / iteration_num);
+  printf("  cpu time per iteration   %10.3f us\n", cpu_ns / 1000.0 / iteration_num);
+  printf("  allocations per iteration %9.2f\n", static_cast<double>(alloc_count) / iteration_num);
+  printf("  rt calls per iteration   %10.2f\n", static_cast<double>(recorder.GetTotalCalls()) / iteration_num);
+  return SUCCESS;
+}
+
+class KnownSubgraphBenchmark {
+ public:
+  Status Init() {
+    GeTensorDesc tensor_desc(GeShape({kElementNum}), FORMAT_ND, DT_INT32);
+    TensorUtils::SetSize(tensor_desc, kElementNum * sizeof(int32_t));
+    auto op_desc = std::make_shared<OpDesc>("known_node", "PartitionedCall");
+    op_desc->AddOutputDesc("y", tensor_desc);
+    node_item_.reset(new (std::nothrow) NodeItem(graph_->AddNode(op_desc)));
+    GE_CHECK_NOTNULL(node_item_);
+    GE_CHK_STATUS_RET_NOLOG(node_item_->Init());
+    node_item_->input_start = 0;
+    node_item_->output_start = 0;
+    node_item_->outputs.resize(node_item_->num_outputs);
+    node_item_->node_executor = &node_executor_;
+    node_task_ = std::make_shared<LaunchOnlyTask>();
+    node_item_->kernel_task = node_task_;
+    graph_item_.node_items_ = {node_item_.get()};
+    graph_item_.total_inputs_ = node_item_->num_inputs;
+    graph_item_.total_outputs_ = node_item_->num_outputs;
+    graph_item_.is_dynamic_ = false;
+
+    execution_context_.allocator = NpuMemoryAllocator::GetAllocator(0);
+    GE_CHECK_NOTNULL(execution_context_.allocator);
+    execution_context_.callback_manager.reset(new (std::nothrow) CallbackManager(nullptr));
+    GE_CHECK_NOTNULL(execution_context_.callback_manager);
+    GE_CHK_STATUS_RET_NOLOG(execution_context_.callback_manager->Init());
+    subgraph_context_.reset(new (std::nothrow) SubgraphContext(&graph_item_));
+    GE_CHECK_NOTNULL(subgraph_context_);
+    return subgraph_context_->Init();
+  }
+
+  Status Run(uint32_t iteration_num) {
+    auto node_state = subgraph_context_->GetOrCreateNodeState(node_item_.get());
+    GE_CHECK_NOTNULL(node_state);
+    node_state->SetKernelTask(node_task_);
+    GE_CHK_STATUS_RET_NOLOG(RunScenario("TaskContext::Create", iteration_num, [&]() -> Status {
+      auto task_context = TaskContext::Create(*node_item_, &execution_context_, subgraph_context_.get());
+      return (task_context == nullptr) ? INTERNAL_ERROR : SUCCESS;
+    }));
+    GE_CHK_STATUS_RET_NOLOG(RunScenario("TaskContext reused by the node state", iteration_num, [&]() -> Status {
+      return (node_state->GetOrCreateTaskContext(&execution_context_) == nullptr) ? INTERNAL_ERROR : SUCCESS;
+    }));
+
+    auto execute_node = [&]() -> Status {
+      auto task_context = node_state->GetOrCreateTaskContext(&execution_context_);
+      GE_CHECK_NOTNULL(task_context);
+      uint64_t done_count = node_task_->done_count.load() + 1;
+      GE_CHK_STATUS_RET_NOLOG(ExecutionEngine::ExecuteAsync(*node_state, *task_context, execution_context_, false));
+      node_task_->WaitDone(done_count);
+      return SUCCESS;
+    };
+    node_task_->use_callback_manager = false;
+    GE_CHK_STATUS_RET_NOLOG(RunScenario("ExecuteAsync, NodeDoneCallback inline", iteration_num, execute_node));
+    node_task_->use_callback_manager = true;
+    GE_CHK_STATUS_RET_NOLOG(RunScenario("ExecuteAsync, NodeDoneCallback by CallbackManager", iteration_num,
+                                        execute_node));
+
+    SubgraphExecutor executor(&graph_item_, &execution_context_);
+    std::vector<TensorValue> inputs;
+    std::vector<ConstGeTensorDescPtr> input_desc;
+    return RunScenario("SubgraphExecutor::ExecuteAsync of the known shape subgraph", iteration_num, [&]() -> Status {
+      uint64_t done_count = node_task_->done_count.load() + 1;
+      GE_CHK_STATUS_RET_NOLOG(executor.ExecuteAsync(inputs, input_desc));
+      node_task_->WaitDone(done_count);
+      return SUCCESS;
+    });
+  }
+
+  void Finalize() {
+    if (execution_context_.callback_manager != nullptr) {
+      (void)execution_context_.callback_manager->Destroy();
+    }
+  }
+
+ private:
+  ComputeGraphPtr graph_ = std::make_shared<ComputeGraph>("known_subgraph");
+  GraphExecutionContext execution_context_;
+  GraphItem graph_item_;
+  LaunchOnlyExecutor node_executor_;
+  std::unique_ptr<NodeItem> node_item_;
+  std::shared_ptr<LaunchOnlyTask> node_task_;
+  std::unique_ptr<SubgraphContext> subgraph_context_;
+};
+
+int RunBenchmark(const BenchmarkOptions &options) {
+  (void)MemManager::Instance().Initialize(std::vector<rtMemType_t>({RT_MEMORY_HBM}));
+  printf("iterations %u\n", options.iteration_num);
+  Status ret = SUCCESS;
+  {
+    KnownSubgraphBenchmark benchmark;
+    ret = benchmark.Init();
+    if (ret == SUCCESS) {
+      ret = benchmark.Run(options.iteration_num);
+    }
+    benchmark.Finalize();
+  }
+  MemManager::Instance().Finalize();
+  return ret == SUCCESS ? 0 : 1;
+}
+}  // namespace
+}  // namespace hybrid
+}  // namespace ge
+
+int main(int argc, char **argv) {
+  ge::hybrid::BenchmarkOptions options;
+  if (!ge::hybrid::ParseOptions(argc, argv, options)) {
+    return 1;
+  }
+  return ge::hybrid::RunBenchmark(options);
+}
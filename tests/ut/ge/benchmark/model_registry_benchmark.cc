@@ -0,0 +1,198 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Host side benchmark of concurrent model lookups in the ModelManager registry, against the stubbed runtime. N reader
+// threads look up M registered models, as the execute path does for every request, either through the copy-on-write
+// registry read by ModelManager::GetModel or under map_mutex_ as the registry was read before it was copy-on-write.
+// Each thread count is run once with the registry untouched and once with a writer that keeps unloading and reloading
+// one of the models. Wall time and cpu time of the process per lookup, lookup throughput and the reloads done by the
+// writer are reported.
+//
+// usage: ge_model_registry_benchmark [--lookups=N] [--models=M] [--max_threads=T]
+
+#include <time.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// the locked lookup reads the registry the way GetModel did before, under map_mutex_
+#define protected public
+#define private public
+#include "graph/load/new_model_manager/davinci_model.h"
+#include "graph/load/new_model_manager/model_manager.h"
+#undef private
+#undef protected
+
+namespace ge {
+namespace {
+int64_t NowCpuNs() {
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+int64_t NowWallNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+struct BenchmarkOptions {
+  uint32_t lookup_num = 1000000;
+  uint32_t model_num = 16;
+  uint32_t max_thread_num = 8;
+};
+
+bool ParseOptions(int argc, char **argv, BenchmarkOptions &options) {
+  const char *const kLookupsName = "--lookups=";
+  const char *const kModelsName = "--models=";
+  const char *const kMaxThreadsName = "--max_threads=";
+  for (int i = 1; i < argc; ++i) {
+    if (strncmp(argv[i], kLookupsName, strlen(kLookupsName)) == 0) {
+      options.lookup_num = static_cast<uint32_t>(std::strtoul(argv[i] + strlen(kLookupsName), nullptr, 10));
+      continue;
+    }
+    if (strncmp(argv[i], kModelsName, strlen(kModelsName)) == 0) {
+      options.model_num = static_cast<uint32_t>(std::strtoul(argv[i] + strlen(kModelsName), nullptr, 10));
+      continue;
+    }
+    if (strncmp(argv[i], kMaxThreadsName, strlen(kMaxThreadsName)) == 0) {
+      options.max_thread_num = static_cast<uint32_t>(std::strtoul(argv[i] + strlen(kMaxThreadsName), nullptr, 10));
+      continue;
+    }
+    fprintf(stderr, "Unknown option %s\n", argv[i]);
+    return false;
+  }
+  if (options.lookup_num == 0 || options.model_num == 0 || options.max_thread_num == 0) {
+    fprintf(stderr, "lookups, models and max_threads must be positive\n");
+    return false;
+  }
+  return true;
+}
+
+std::shared_ptr<DavinciModel> CreateModel(uint32_t id) {
+  auto davinci_model = std::make_shared<DavinciModel>(0, nullptr);
+  davinci_model->SetId(id);
+  return davinci_model;
+}
+
+using LookupFunc = std::function<std::shared_ptr<DavinciModel>(ModelManager &, uint32_t)>;
+
+std::shared_ptr<DavinciModel> LockedLookup(ModelManager &manager, uint32_t id) {
+  std::lock_guard<std::mutex> lock(manager.map_mutex_);
+  auto it = manager.model_map_->find(id);
+  return (it == manager.model_map_->end()) ? nullptr : it->second;
+}
+
+std::shared_ptr<DavinciModel> SnapshotLookup(ModelManager &manager, uint32_t id) { return manager.GetModel(id); }
+
+// every reader does lookup_num lookups over all models, the churn model may be missing while it is reloaded
+Status RunScenario(const std::string &scenario, const BenchmarkOptions &options, uint32_t thread_num, bool with_writer,
+                   const LookupFunc &lookup) {
+  const uint32_t kChurnModelId = 1;
+  ModelManager manager;
+  for (uint32_t id = 1; id <= options.model_num; ++id) {
+    auto davinci_model = CreateModel(id);
+    manager.InsertModel(id, davinci_model);
+  }
+
+  std::atomic<bool> stop(false);
+  std::atomic<uint64_t> reload_count(0);
+  std::thread writer;
+  if (with_writer) {
+    writer = std::thread([&]() {
+      while (!stop.load(std::memory_order_acquire)) {
+        (void)manager.DeleteModel(kChurnModelId);
+        auto davinci_model = CreateModel(kChurnModelId);
+        manager.InsertModel(kChurnModelId, davinci_model);
+        reload_count.fetch_add(1, std::memory_order_relaxed);
+      }
+    });
+  }
+
+  std::atomic<uint64_t> mismatch(0);
+  std::vector<std::thread> readers;
+  int64_t wall_start = NowWallNs();
+  int64_t cpu_start = NowCpuNs();
+  for (uint32_t i = 0; i < thread_num; ++i) {
+    readers.emplace_back([&, i]() {
+      for (uint32_t n = 0; n < options.lookup_num; ++n) {
+        uint32_t id = (i + n) % options.model_num + 1;
+        auto davinci_model = lookup(manager, id);
+        if ((davinci_model == nullptr) ? (id != kChurnModelId) : (davinci_model->Id() != id)) {
+          mismatch.fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+    });
+  }
+  for (auto &reader : readers) {
+    reader.join();
+  }
+  int64_t cpu_ns = NowCpuNs() - cpu_start;
+  int64_t wall_ns = NowWallNs() - wall_start;
+  stop.store(true, std::memory_order_release);
+  if (writer.joinable()) {
+    writer.join();
+  }
+  if (mismatch.load() != 0) {
+    GELOGE(INTERNAL_ERROR, "%s: %lu lookups returned a wrong model", scenario.c_str(), mismatch.load());
+    return INTERNAL_ERROR;
+  }
+
+  uint64_t total_lookups = static_cast<uint64_t>(options.lookup_num) * thread_num;
+  printf("[%s, %u threads%s]\n", scenario.c_str(), thread_num, with_writer ? ", writer reloading" : "");
+  printf("  wall time per lookup of a thread %6.3f ns\n", static_cast<double>(wall_ns) / options.lookup_num);
+  printf("  cpu time per lookup      %10.3f ns\n", static_cast<double>(cpu_ns) / total_lookups);
+  printf("  lookups per second       %10.3f M\n", total_lookups * 1000.0 / wall_ns);
+  if (with_writer) {
+    printf("  reloads by the writer    %10lu\n", reload_count.load());
+  }
+  return SUCCESS;
+}
+
+int RunBenchmark(const BenchmarkOptions &options) {
+  printf("lookups per thread %u, models %u\n", options.lookup_num, options.model_num);
+  for (uint32_t thread_num = 1; thread_num <= options.max_thread_num; thread_num *= 2) {
+    for (bool with_writer : {false, true}) {
+      if (RunScenario("locked lookup", options, thread_num, with_writer, LockedLookup) != SUCCESS) {
+        return 1;
+      }
+      if (RunScenario("copy-on-write lookup", options, thread_num, with_writer, SnapshotLookup) != SUCCESS) {
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+}  // namespace
+}  // namespace ge
+
+int main(int argc, char **argv) {
+  ge::BenchmarkOptions options;
+  if (!ge::ParseOptions(argc, argv, options)) {
+    return 1;
+  }
+  return ge::RunBenchmark(options);
+}
@@ -0,0 +1,169 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmark of the NodeDoneManager completion table of the hybrid executor. Node i waits for node i - 1 and node
+// i / 2, and T threads execute the nodes in turn, so most dependencies cross threads as they do between the workers
+// of a dynamic shape graph. The table is reset and reused for every iteration, as for every execution of a model.
+// A single thread awaiting nodes that are already done is run as well, that is the path taken by most nodes of a
+// graph. Wall time and cpu time of the process per awaited dependency are reported.
+//
+// usage: ge_node_done_manager_benchmark [--nodes=N] [--max_threads=T] [--iterations=I]
+
+#include <time.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hybrid/executor/node_done_manager.h"
+
+namespace ge {
+namespace hybrid {
+namespace {
+int64_t NowCpuNs() {
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+int64_t NowWallNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+struct BenchmarkOptions {
+  uint32_t node_num = 4096;
+  uint32_t max_thread_num = 8;
+  uint32_t iteration_num = 100;
+};
+
+bool ParseOptions(int argc, char **argv, BenchmarkOptions &options) {
+  const char *const kNodesName = "--nodes=";
+  const char *const kMaxThreadsName = "--max_threads=";
+  const char *const kIterationsName = "--iterations=";
+  for (int i = 1; i < argc; ++i) {
+    if (strncmp(argv[i], kNodesName, strlen(kNodesName)) == 0) {
+      options.node_num = static_cast<uint32_t>(std::strtoul(argv[i] + strlen(kNodesName), nullptr, 10));
+      continue;
+    }
+    if (strncmp(argv[i], kMaxThreadsName, strlen(kMaxThreadsName)) == 0) {
+      options.max_thread_num = static_cast<uint32_t>(std::strtoul(argv[i] + strlen(kMaxThreadsName), nullptr, 10));
+      continue;
+    }
+    if (strncmp(argv[i], kIterationsName, strlen(kIterationsName)) == 0) {
+      options.iteration_num = static_cast<uint32_t>(std::strtoul(argv[i] + strlen(kIterationsName), nullptr, 10));
+      continue;
+    }
+    fprintf(stderr, "Unknown option %s\n", argv[i]);
+    return false;
+  }
+  if (options.node_num < 2 || options.max_thread_num == 0 || options.iteration_num == 0) {
+    fprintf(stderr, "nodes must be at least 2, max_threads and iterations must be positive\n");
+    return false;
+  }
+  return true;
+}
+
+// the iteration returns the number of failed awaits
+int RunScenario(const std::string &scenario, const BenchmarkOptions &options, uint64_t await_num,
+                const std::function<uint64_t()> &iterate) {
+  uint64_t failed_num = 0;
+  int64_t wall_start = NowWallNs();
+  int64_t cpu_start = NowCpuNs();
+  for (uint32_t i = 0; i < options.iteration_num; ++i) {
+    failed_num += iterate();
+  }
+  int64_t cpu_ns = NowCpuNs() - cpu_start;
+  int64_t wall_ns = NowWallNs() - wall_start;
+  if (failed_num != 0) {
+    fprintf(stderr, "%s: %lu awaits failed\n", scenario.c_str(), failed_num);
+    return 1;
+  }
+
+  uint64_t total_awaits = await_num * options.iteration_num;
+  printf("[%s]\n", scenario.c_str());
+  printf("  wall time per iteration  %10.3f us\n", wall_ns / 1000.0 / options.iteration_num);
+  printf("  wall time per await      %10.3f ns\n", static_cast<double>(wall_ns) / total_awaits);
+  printf("  cpu time per await       %10.3f ns\n", static_cast<double>(cpu_ns) / total_awaits);
+  return 0;
+}
+
+int RunBenchmark(const BenchmarkOptions &options) {
+  const int node_num = static_cast<int>(options.node_num);
+  const uint64_t await_num = 2 * static_cast<uint64_t>(node_num - 1);
+  printf("nodes %u, iterations %u\n", options.node_num, options.iteration_num);
+  NodeDoneManager manager;
+  manager.Init(options.node_num);
+
+  int ret = RunScenario("await of done nodes, 1 thread", options, await_num, [&]() -> uint64_t {
+    manager.Reset();
+    uint64_t failed_num = 0;
+    for (int i = 0; i < node_num; ++i) {
+      if ((i > 0) && (!manager.Await(i - 1) || !manager.Await(i / 2))) {
+        ++failed_num;
+      }
+      manager.NodeDone(i);
+    }
+    return failed_num;
+  });
+  if (ret != 0) {
+    return ret;
+  }
+
+  for (uint32_t thread_num = 2; thread_num <= options.max_thread_num; thread_num *= 2) {
+    std::string scenario = "dependencies across " + std::to_string(thread_num) + " threads";
+    ret = RunScenario(scenario, options, await_num, [&]() -> uint64_t {
+      manager.Reset();
+      std::atomic<uint64_t> failed_num(0);
+      std::vector<std::thread> workers;
+      for (uint32_t t = 0; t < thread_num; ++t) {
+        workers.emplace_back([&manager, &failed_num, t, thread_num, node_num]() {
+          for (int i = static_cast<int>(t); i < node_num; i += static_cast<int>(thread_num)) {
+            if ((i > 0) && (!manager.Await(i - 1) || !manager.Await(i / 2))) {
+              failed_num.fetch_add(1, std::memory_order_relaxed);
+            }
+            manager.NodeDone(i);
+          }
+        });
+      }
+      for (auto &worker : workers) {
+        worker.join();
+      }
+      return failed_num.load();
+    });
+    if (ret != 0) {
+      return ret;
+    }
+  }
+  return 0;
+}
+}  // namespace
+}  // namespace hybrid
+}  // namespace ge
+
+int main(int argc, char **argv) {
+  ge::hybrid::BenchmarkOptions options;
+  if (!ge::hybrid::ParseOptions(argc, argv, options)) {
+    return 1;
+  }
+  return ge::hybrid::RunBenchmark(options);
+}
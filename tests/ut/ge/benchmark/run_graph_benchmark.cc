@@ -0,0 +1,291 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Host side benchmark of the overhead of running a graph against the size of its tensors. A static model of one TE
+// kernel between a Data and NetOutput is loaded for each size and run by GraphExecutor through the staging buffers of
+// RunGraph, through host buffers bound to the graph and through device buffers bound to the graph. The stubbed
+// runtime copies memory (its device memory is host memory), so the copies of each path are paid for in the wall and
+// cpu time reported per run, next to the runtime calls per run.
+//
+// usage: ge_run_graph_benchmark [--sizes=BYTES[,BYTES...]] [--runs=N]
+
+#include <time.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "cce/taskdown_common.hpp"
+#include "common/types.h"
+#include "graph/compute_graph.h"
+#include "graph/debug/ge_attr_define.h"
+#include "graph/execute/graph_execute.h"
+#include "graph/load/new_model_manager/model_manager.h"
+#include "graph/manager/graph_manager_utils.h"
+#include "graph/manager/graph_mem_allocator.h"
+#include "graph/manager/graph_var_manager.h"
+#include "graph/op_kernel_bin.h"
+#include "graph/utils/attr_utils.h"
+#include "graph/utils/graph_utils.h"
+#include "graph/utils/tensor_utils.h"
+#include "model/ge_root_model.h"
+#include "rt_call_recorder.h"
+
+namespace ge {
+namespace {
+const uint64_t kSessionId = 0;
+const uint32_t kGraphId = 1;
+const uint32_t kBaseModelId = 0xFF00;
+
+struct BenchmarkOptions {
+  std::vector<int64_t> sizes = {4 * 1024, 64 * 1024, 1024 * 1024, 16 * 1024 * 1024};
+  uint32_t run_num = 200;
+};
+
+bool ParseOptions(int argc, char **argv, BenchmarkOptions &options) {
+  const char *const kSizesName = "--sizes=";
+  const char *const kRunsName = "--runs=";
+  for (int i = 1; i < argc; ++i) {
+    if (strncmp(argv[i], kSizesName, strlen(kSizesName)) == 0) {
+      options.sizes.clear();
+      const char *item = argv[i] + strlen(kSizesName);
+      while (*item != '\0') {
+        char *end = nullptr;
+        options.sizes.emplace_back(std::strtoll(item, &end, 10));
+        item = (*end == ',') ? end + 1 : end;
+        if (end == item) {
+          break;
+        }
+      }
+      continue;
+    }
+    if (strncmp(argv[i], kRunsName, strlen(kRunsName)) == 0) {
+      options.run_num = static_cast<uint32_t>(std::strtoul(argv[i] + strlen(kRunsName), nullptr, 10));
+      continue;
+    }
+    fprintf(stderr, "Unknown option %s\n", argv[i]);
+    return false;
+  }
+  bool sizes_valid = !options.sizes.empty() && std::all_of(options.sizes.begin(), options.sizes.end(), [](int64_t s) {
+    return (s >= static_cast<int64_t>(sizeof(float))) && (s % sizeof(float) == 0);
+  });
+  if (!sizes_valid || (options.run_num == 0)) {
+    fprintf(stderr, "sizes must be positive multiples of 4, runs must be positive\n");
+    return false;
+  }
+  return true;
+}
+
+int64_t NowCpuNs() {
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+int64_t NowWallNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+GeTensorDesc CreateTensorDesc(int64_t size) {
+  GeTensorDesc tensor_desc(GeShape({size / static_cast<int64_t>(sizeof(float))}), FORMAT_ND, DT_FLOAT);
+  TensorUtils::SetSize(tensor_desc, size);
+  return tensor_desc;
+}
+
+///
+/// Model of Data -> TE kernel -> NetOutput, layout of feature map: | input | output |
+///
+GeRootModelPtr BuildModel(int64_t size) {
+  auto graph = std::make_shared<ComputeGraph>("run_graph_benchmark");
+  auto data_desc = std::make_shared<OpDesc>("data", DATA);
+  data_desc->SetId(0);
+  data_desc->AddInputDesc(CreateTensorDesc(size));
+  data_desc->AddOutputDesc(CreateTensorDesc(size));
+  data_desc->SetOutputOffset({0});
+  (void)AttrUtils::SetInt(data_desc, ATTR_NAME_INDEX, 0);
+  auto data = graph->AddNode(data_desc);
+
+  auto kernel_desc = std::make_shared<OpDesc>("kernel", "BenchmarkKernel");
+  kernel_desc->SetId(1);
+  kernel_desc->AddInputDesc(CreateTensorDesc(size));
+  kernel_desc->AddOutputDesc(CreateTensorDesc(size));
+  kernel_desc->SetInputOffset({0});
+  kernel_desc->SetOutputOffset({size});
+  (void)AttrUtils::SetInt(kernel_desc, ATTR_NAME_IMPLY_TYPE, static_cast<int64_t>(domi::ImplyType::TVM));
+  (void)AttrUtils::SetStr(kernel_desc, TVM_ATTR_NAME_MAGIC, "RT_DEV_BINARY_MAGIC_ELF");
+  std::vector<char> kernel_bin(64, 0);
+  (void)kernel_desc->SetExtAttr(OP_EXTATTR_NAME_TBE_KERNEL,
+                                std::make_shared<OpKernelBin>("kernel", std::move(kernel_bin)));
+  auto kernel = graph->AddNode(kernel_desc);
+
+  auto net_output_desc = std::make_shared<OpDesc>("net_output", NETOUTPUT);
+  net_output_desc->SetId(2);
+  net_output_desc->AddInputDesc(CreateTensorDesc(size));
+  net_output_desc->SetInputOffset({size});
+  net_output_desc->SetSrcName({"kernel"});
+  net_output_desc->SetSrcIndex({0});
+  auto net_output = graph->AddNode(net_output_desc);
+  (void)GraphUtils::AddEdge(data->GetOutDataAnchor(0), kernel->GetInDataAnchor(0));
+  (void)GraphUtils::AddEdge(kernel->GetOutDataAnchor(0), net_output->GetInDataAnchor(0));
+
+  auto task_def = std::make_shared<domi::ModelTaskDef>();
+  domi::TaskDef *kernel_task = task_def->add_task();
+  kernel_task->set_type(RT_MODEL_TASK_KERNEL);
+  kernel_task->set_stream_id(0);
+  domi::KernelDef *kernel_def = kernel_task->mutable_kernel();
+  kernel_def->set_stub_func("kernel");
+  kernel_def->set_block_dim(1);
+  kernel_def->set_args(std::string(2 * sizeof(void *), '\0'));
+  kernel_def->set_args_size(2 * sizeof(void *));
+  domi::KernelContext *context = kernel_def->mutable_context();
+  context->set_kernel_type(static_cast<uint32_t>(cce::ccKernelType::TE));
+  context->set_op_index(1);
+  uint16_t args_offset = 0;
+  context->set_args_offset(&args_offset, sizeof(args_offset));
+
+  auto ge_model = std::make_shared<GeModel>();
+  ge_model->SetName("run_graph_benchmark");
+  ge_model->SetGraph(GraphUtils::CreateGraphFromComputeGraph(graph));
+  ge_model->SetModelTaskDef(task_def);
+  (void)AttrUtils::SetInt(ge_model, ATTR_MODEL_MEMORY_SIZE, 2 * size);
+  (void)AttrUtils::SetInt(ge_model, ATTR_MODEL_WEIGHT_SIZE, 0);
+  (void)AttrUtils::SetInt(ge_model, ATTR_MODEL_STREAM_NUM, 1);
+  (void)AttrUtils::SetInt(ge_model, ATTR_MODEL_EVENT_NUM, 0);
+  (void)AttrUtils::SetInt(ge_model, ATTR_MODEL_LABEL_NUM, 0);
+  (void)AttrUtils::SetInt(ge_model, MODEL_ATTR_TASK_GEN_BASE_ADDR, 0);
+  (void)AttrUtils::SetInt(ge_model, MODEL_ATTR_SESSION_ID, kSessionId);
+  auto ge_root_model = std::make_shared<GeRootModel>(graph);
+  ge_root_model->SetSubgraphInstanceNameToModel(graph->GetName(), ge_model);
+  return ge_root_model;
+}
+
+void PrintResult(const std::string &scenario, int64_t wall_ns, int64_t cpu_ns, uint32_t run_num) {
+  auto &recorder = RtCallRecorder::Instance();
+  printf("  %-24s wall %10.2f us  cpu %10.2f us  rt calls %6.2f", scenario.c_str(), wall_ns / 1000.0 / run_num,
+         cpu_ns / 1000.0 / run_num, static_cast<double>(recorder.GetTotalCalls()) / run_num);
+  for (const auto &api_and_count : recorder.GetCallCounts()) {
+    if ((api_and_count.first.find("Memcpy") != std::string::npos) ||
+        (api_and_count.first.find("MallocHost") != std::string::npos)) {
+      printf("  %s %.2f", api_and_count.first.c_str(), static_cast<double>(api_and_count.second) / run_num);
+    }
+  }
+  printf("\n");
+}
+
+Status RunScenario(const std::string &scenario, uint32_t run_num, const std::function<Status()> &run) {
+  // warm up, so that the staging buffers and the first binding are not taken in
+  GE_CHK_STATUS_RET(run(), "Warm up of %s failed", scenario.c_str());
+  auto &recorder = RtCallRecorder::Instance();
+  recorder.Start(false);
+  int64_t wall_start = NowWallNs();
+  int64_t cpu_start = NowCpuNs();
+  for (uint32_t r = 0; r < run_num; ++r) {
+    Status ret = run();
+    if (ret != SUCCESS) {
+      recorder.Stop();
+      GELOGE(ret, "Run %u of %s failed", r, scenario.c_str());
+      return ret;
+    }
+  }
+  int64_t cpu_ns = NowCpuNs() - cpu_start;
+  int64_t wall_ns = NowWallNs() - wall_start;
+  recorder.Stop();
+  PrintResult(scenario, wall_ns, cpu_ns, run_num);
+  return SUCCESS;
+}
+
+Status RunSize(int64_t size, uint32_t model_id, const BenchmarkOptions &options) {
+  std::mutex mutex;
+  std::condition_variable condition;
+  auto listener = std::make_shared<GraphModelListener>(mutex, condition);
+  auto model_manager = ModelManager::GetInstance();
+  GE_CHK_STATUS_RET(model_manager->LoadModelOnline(model_id, BuildModel(size), listener),
+                    "Load model of size %ld failed", size);
+  Status ret = model_manager->Start(model_id);
+
+  GraphExecutor executor;
+  if (ret == SUCCESS) {
+    ret = executor.SetCondition(&mutex, &condition, listener);
+  }
+  std::vector<uint8_t> input(static_cast<size_t>(size), 1);
+  std::vector<uint8_t> output(static_cast<size_t>(size), 0);
+  printf("tensor size %ld\n", size);
+
+  // RunGraph: inputs and outputs are staged in page locked buffers, outputs are copied again to the output tensors
+  std::vector<GeTensor> input_tensors = {GeTensor(CreateTensorDesc(size), input)};
+  if (ret == SUCCESS) {
+    ret = RunScenario("staging buffers", options.run_num, [&]() -> Status {
+      std::vector<GeTensor> output_tensors;
+      return executor.ExecuteGraph(kGraphId, model_id, input_tensors, output_tensors);
+    });
+  }
+
+  GraphIoBinding host_binding;
+  host_binding.inputs.emplace_back(input.data(), input.size(), false);
+  host_binding.outputs.emplace_back(output.data(), output.size(), false);
+  std::vector<GeTensorDesc> output_desc;
+  if (ret == SUCCESS) {
+    ret = RunScenario("host io binding", options.run_num, [&]() -> Status {
+      return executor.ExecuteGraphWithIoBinding(kGraphId, model_id, host_binding, output_desc);
+    });
+  }
+
+  // stubbed device memory is host memory, so host buffers stand for device ones
+  GraphIoBinding device_binding = host_binding;
+  device_binding.is_device_memory = true;
+  if (ret == SUCCESS) {
+    ret = RunScenario("device io binding", options.run_num, [&]() -> Status {
+      return executor.ExecuteGraphWithIoBinding(kGraphId, model_id, device_binding, output_desc);
+    });
+  }
+
+  (void)model_manager->Stop(model_id);
+  (void)model_manager->Unload(model_id);
+  return ret;
+}
+
+int RunBenchmark(const BenchmarkOptions &options) {
+  RtCallRecorder::Instance().SetMemcpyEnabled(true);
+  (void)MemManager::Instance().Initialize(std::vector<rtMemType_t>({RT_MEMORY_HBM}));
+  (void)VarManager::Instance(kSessionId)->Init(0, kSessionId, 0, 0);
+  printf("runs %u\n", options.run_num);
+  Status ret = SUCCESS;
+  for (size_t i = 0; (ret == SUCCESS) && (i < options.sizes.size()); ++i) {
+    ret = RunSize(options.sizes[i], kBaseModelId + static_cast<uint32_t>(i), options);
+  }
+  VarManagerPool::Instance().Destory();
+  MemManager::Instance().Finalize();
+  return ret == SUCCESS ? 0 : 1;
+}
+}  // namespace
+}  // namespace ge
+
+int main(int argc, char **argv) {
+  ge::BenchmarkOptions options;
+  if (!ge::ParseOptions(argc, argv, options)) {
+    return 1;
+  }
+  return ge::RunBenchmark(options);
+}
@@ -0,0 +1,206 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmark of memory reuse across streams in BinaryBlockMemAssigner. The graph has S streams, each a chain of N nodes
+// whose outputs cycle through a few sizes, and every --cross_interval steps a node feeds the next node of the next
+// stream. The memory of the blocks is reported before life time reuse, after the reuse whose order is already kept
+// by the streams and events of the graph, and after the reuse that adds control edges for new events, together with
+// the feature map size and the events left by StreamAllocator once OptimizeSyncEvents ran, without and with the
+// control edges. Wall time of AssignMemoryWithReuse is reported as well.
+//
+// usage: ge_stream_mem_reuse_benchmark [--max_streams=S] [--nodes=N] [--cross_interval=K] [--iterations=I]
+
+#include <time.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <list>
+#include <map>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "engine_manager/dnnengine_manager.h"
+#include "graph/compute_graph.h"
+#include "graph/manager/graph_manager_utils.h"
+#include "graph/utils/graph_utils.h"
+#include "graph/utils/tensor_utils.h"
+
+// the events are counted right after OptimizeSyncEvents, without building the whole stream allocation
+#define protected public
+#define private public
+#include "graph/build/memory/binary_block_mem_assigner.h"
+#include "graph/build/stream_allocator.h"
+#undef private
+#undef protected
+
+namespace ge {
+namespace {
+const int64_t kSizeUnit = 4096;
+const int64_t kSizeKinds = 8;
+
+int64_t NowWallNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+struct BenchmarkOptions {
+  uint32_t max_stream_num = 8;
+  uint32_t node_num = 256;
+  uint32_t cross_interval = 4;
+  uint32_t iteration_num = 10;
+};
+
+bool ParseOptions(int argc, char **argv, BenchmarkOptions &options) {
+  const char *const kMaxStreamsName = "--max_streams=";
+  const char *const kNodesName = "--nodes=";
+  const char *const kCrossIntervalName = "--cross_interval=";
+  const char *const kIterationsName = "--iterations=";
+  for (int i = 1; i < argc; ++i) {
+    if (strncmp(argv[i], kMaxStreamsName, strlen(kMaxStreamsName)) == 0) {
+      options.max_stream_num = static_cast<uint32_t>(std::strtoul(argv[i] + strlen(kMaxStreamsName), nullptr, 10));
+      continue;
+    }
+    if (strncmp(argv[i], kNodesName, strlen(kNodesName)) == 0) {
+      options.node_num = static_cast<uint32_t>(std::strtoul(argv[i] + strlen(kNodesName), nullptr, 10));
+      continue;
+    }
+    if (strncmp(argv[i], kCrossIntervalName, strlen(kCrossIntervalName)) == 0) {
+      options.cross_interval =
+        static_cast<uint32_t>(std::strtoul(argv[i] + strlen(kCrossIntervalName), nullptr, 10));
+      continue;
+    }
+    if (strncmp(argv[i], kIterationsName, strlen(kIterationsName)) == 0) {
+      options.iteration_num = static_cast<uint32_t>(std::strtoul(argv[i] + strlen(kIterationsName), nullptr, 10));
+      continue;
+    }
+    fprintf(stderr, "Unknown option %s\n", argv[i]);
+    return false;
+  }
+  if (options.max_stream_num == 0 || options.node_num == 0 || options.cross_interval == 0 ||
+      options.iteration_num == 0) {
+    fprintf(stderr, "max_streams, nodes, cross_interval and iterations must be positive\n");
+    return false;
+  }
+  return true;
+}
+
+// nodes are added step by step over the streams, so the id order is a topological order
+ComputeGraphPtr BuildGraph(uint32_t stream_num, const BenchmarkOptions &options) {
+  auto graph = std::make_shared<ComputeGraph>("stream_mem_reuse");
+  std::vector<std::vector<NodePtr>> stream_nodes(stream_num);
+  for (uint32_t step = 0; step < options.node_num; ++step) {
+    for (uint32_t stream_id = 0; stream_id < stream_num; ++stream_id) {
+      int64_t size = (1 + (step * 5 + stream_id * 3) % kSizeKinds) * kSizeUnit;
+      GeTensorDesc tensor_desc(GeShape({size / static_cast<int64_t>(sizeof(float))}), FORMAT_ND, DT_FLOAT);
+      TensorUtils::SetSize(tensor_desc, size);
+      auto op_desc = std::make_shared<OpDesc>("node_" + std::to_string(stream_id) + "_" + std::to_string(step), "Test");
+      op_desc->AddInputDesc(tensor_desc);
+      op_desc->AddInputDesc(tensor_desc);
+      op_desc->AddOutputDesc(tensor_desc);
+      op_desc->SetStreamId(stream_id);
+      op_desc->SetId(static_cast<int64_t>(graph->GetDirectNodesSize()));
+      stream_nodes[stream_id].emplace_back(graph->AddNode(op_desc));
+    }
+  }
+  for (uint32_t stream_id = 0; stream_id < stream_num; ++stream_id) {
+    const auto &nodes = stream_nodes[stream_id];
+    for (uint32_t step = 1; step < options.node_num; ++step) {
+      (void)GraphUtils::AddEdge(nodes[step - 1]->GetOutDataAnchor(0), nodes[step]->GetInDataAnchor(0));
+      if ((stream_num > 1) && (step % options.cross_interval == 0)) {
+        const auto &next_nodes = stream_nodes[(stream_id + 1) % stream_num];
+        (void)GraphUtils::AddEdge(nodes[step - 1]->GetOutDataAnchor(0), next_nodes[step]->GetInDataAnchor(1));
+      }
+    }
+  }
+  return graph;
+}
+
+// send events left after OptimizeSyncEvents, each of them is one send/recv pair on the device
+Status CountEvents(const ComputeGraphPtr &graph, size_t &event_num) {
+  Graph2SubGraphInfoList subgraphs;
+  StreamAllocator stream_allocator(graph, subgraphs);
+  GE_CHK_STATUS_RET(stream_allocator.InsertSyncEvents(), "Insert sync events failed.");
+  GE_CHK_STATUS_RET(stream_allocator.OptimizeSyncEvents(), "Optimize sync events failed.");
+  event_num = 0;
+  for (const auto &node_events : stream_allocator.node_to_send_events_) {
+    event_num += node_events.second.size();
+  }
+  return SUCCESS;
+}
+
+Status RunScenario(uint32_t stream_num, const BenchmarkOptions &options) {
+  int64_t assign_ns = 0;
+  LifeReuseStat stat;
+  size_t mem_offset = 0;
+  size_t events_before = 0;
+  size_t events_after = 0;
+  for (uint32_t i = 0; i < options.iteration_num; ++i) {
+    auto graph = BuildGraph(stream_num, options);
+    std::map<std::string, std::list<NodeIndexIO>> symbol_to_anchors;
+    std::map<std::string, std::string> anchor_to_symbol;
+    GE_CHK_STATUS_RET(GraphUtils::GetRefMapping(graph, symbol_to_anchors, anchor_to_symbol), "Get ref mapping failed.");
+    BinaryBlockMemAssigner assigner(graph, anchor_to_symbol, symbol_to_anchors);
+    std::vector<int64_t> ranges;
+    GE_CHK_STATUS_RET(assigner.GetMemoryRanges(ranges), "Get memory ranges failed.");
+    int64_t wall_start = NowWallNs();
+    assigner.AssignMemoryWithReuse(ranges);
+    assign_ns += NowWallNs() - wall_start;
+    stat = assigner.GetLifeReuseStat();
+    mem_offset = assigner.GetMemOffset();
+
+    GE_CHK_STATUS_RET_NOLOG(CountEvents(graph, events_before));
+    GE_CHK_STATUS_RET(assigner.AddReuseWaitEdges(), "Add control edges for memory reuse failed.");
+    GE_CHK_STATUS_RET_NOLOG(CountEvents(graph, events_after));
+  }
+
+  printf("[%u streams, %u nodes per stream, cross stream edge every %u nodes]\n", stream_num, options.node_num,
+         options.cross_interval);
+  printf("  blocks before life time reuse       %12zu bytes\n", stat.size_before_reuse);
+  printf("  blocks after ordered reuse          %12zu bytes\n", stat.size_after_ordered_reuse);
+  printf("  blocks after reuse by events        %12zu bytes\n", stat.size_after_reuse);
+  printf("  feature map size                    %12zu bytes\n", mem_offset);
+  printf("  blocks reused across streams        %12zu\n", stat.cross_stream_reuse_num);
+  printf("  blocks reused by new events         %12zu\n", stat.event_reuse_num);
+  printf("  control edges added                 %12zu\n", stat.wait_edge_num);
+  printf("  events without the control edges    %12zu\n", events_before);
+  printf("  events with the control edges       %12zu\n", events_after);
+  printf("  AssignMemoryWithReuse wall time     %12.3f us\n", assign_ns / 1000.0 / options.iteration_num);
+  return SUCCESS;
+}
+
+int RunBenchmark(const BenchmarkOptions &options) {
+  for (uint32_t stream_num = 1; stream_num <= options.max_stream_num; stream_num *= 2) {
+    if (RunScenario(stream_num, options) != SUCCESS) {
+      return 1;
+    }
+  }
+  return 0;
+}
+}  // namespace
+}  // namespace ge
+
+int main(int argc, char **argv) {
+  ge::BenchmarkOptions options;
+  if (!ge::ParseOptions(argc, argv, options)) {
+    return 1;
+  }
+  return ge::RunBenchmark(options);
+}
@@ -0,0 +1,236 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmark of the variable lookups of a variable heavy graph in VarManager. The graph holds V Variable nodes named
+// like the weights of a deep model, and each of them has its memory assigned by VarManager. Every run looks up the
+// address of each Variable node of the graph from N threads, as loading and executing the graph does. The lookup is
+// done under the session mutex as VarManager did before its lookups were lock free, by name without lock, and by the
+// VarId resolved once when the graph is loaded. Each of them is run once with the variables untouched and once with a
+// writer that keeps assigning new variables. Wall time and cpu time of the process per lookup are reported.
+//
+// usage: ge_var_manager_benchmark [--vars=V] [--runs=R] [--max_threads=N]
+
+#include <time.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "common/types.h"
+#include "graph/compute_graph.h"
+#include "graph/utils/tensor_utils.h"
+
+// the locked lookup takes the session mutex the way VarManager lookups did before
+#define protected public
+#define private public
+#include "graph/manager/graph_var_manager.h"
+#undef private
+#undef protected
+
+namespace ge {
+namespace {
+const uint64_t kSessionId = 3001;
+const int64_t kVarDim = 64;
+
+int64_t NowCpuNs() {
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+int64_t NowWallNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+struct BenchmarkOptions {
+  uint32_t var_num = 4096;
+  uint32_t run_num = 50;
+  uint32_t max_thread_num = 4;
+};
+
+bool ParseOptions(int argc, char **argv, BenchmarkOptions &options) {
+  const char *const kVarsName = "--vars=";
+  const char *const kRunsName = "--runs=";
+  const char *const kMaxThreadsName = "--max_threads=";
+  for (int i = 1; i < argc; ++i) {
+    if (strncmp(argv[i], kVarsName, strlen(kVarsName)) == 0) {
+      options.var_num = static_cast<uint32_t>(std::strtoul(argv[i] + strlen(kVarsName), nullptr, 10));
+      continue;
+    }
+    if (strncmp(argv[i], kRunsName, strlen(kRunsName)) == 0) {
+      options.run_num = static_cast<uint32_t>(std::strtoul(argv[i] + strlen(kRunsName), nullptr, 10));
+      continue;
+    }
+    if (strncmp(argv[i], kMaxThreadsName, strlen(kMaxThreadsName)) == 0) {
+      options.max_thread_num = static_cast<uint32_t>(std::strtoul(argv[i] + strlen(kMaxThreadsName), nullptr, 10));
+      continue;
+    }
+    fprintf(stderr, "Unknown option %s\n", argv[i]);
+    return false;
+  }
+  if (options.var_num == 0 || options.run_num == 0 || options.max_thread_num == 0) {
+    fprintf(stderr, "vars, runs and max_threads must be positive\n");
+    return false;
+  }
+  return true;
+}
+
+// a variable node of the graph with the id resolved at load
+struct VarNode {
+  NodePtr node;
+  VarId var_id;
+};
+
+ComputeGraphPtr BuildVariableGraph(uint32_t var_num) {
+  auto graph = std::make_shared<ComputeGraph>("variable_heavy");
+  GeTensorDesc tensor_desc(GeShape({kVarDim, kVarDim}), FORMAT_NCHW, DT_FLOAT);
+  TensorUtils::SetSize(tensor_desc, kVarDim * kVarDim * sizeof(float));
+  for (uint32_t i = 0; i < var_num; ++i) {
+    std::string name = "model/block_" + std::to_string(i / 64) + "/layer_" + std::to_string(i / 8 % 8) + "/weight_" +
+                       std::to_string(i % 8);
+    auto op_desc = std::make_shared<OpDesc>(name, VARIABLE);
+    op_desc->AddOutputDesc(tensor_desc);
+    (void)graph->AddNode(op_desc);
+  }
+  return graph;
+}
+
+using LookupFunc = std::function<Status(VarManager &, const VarNode &, uint8_t **)>;
+
+Status LockedLookup(VarManager &var_manager, const VarNode &var_node, uint8_t **addr) {
+  std::lock_guard<std::recursive_mutex> lock(var_manager.mutex_);
+  return var_manager.GetVarAddr(var_node.node->GetName(), var_node.node->GetOpDesc()->GetOutputDesc(0), addr);
+}
+
+Status NameLookup(VarManager &var_manager, const VarNode &var_node, uint8_t **addr) {
+  return var_manager.GetVarAddr(var_node.node->GetName(), var_node.node->GetOpDesc()->GetOutputDesc(0), addr);
+}
+
+Status IdLookup(VarManager &var_manager, const VarNode &var_node, uint8_t **addr) {
+  rtMemType_t memory_type = RT_MEMORY_HBM;
+  return var_manager.GetVarAddr(var_node.var_id, var_node.node->GetOpDesc()->GetOutputDesc(0), addr, memory_type);
+}
+
+Status RunScenario(const std::string &scenario, const BenchmarkOptions &options, VarManager &var_manager,
+                   const std::vector<VarNode> &var_nodes, uint32_t thread_num, bool with_writer,
+                   const LookupFunc &lookup) {
+  std::atomic<bool> stop(false);
+  std::atomic<uint64_t> assign_count(0);
+  std::thread writer;
+  if (with_writer) {
+    writer = std::thread([&]() {
+      GeTensorDesc tensor_desc(GeShape({1}), FORMAT_ND, DT_FLOAT);
+      TensorUtils::SetSize(tensor_desc, sizeof(float));
+      while (!stop.load(std::memory_order_acquire)) {
+        uint64_t index = assign_count.fetch_add(1, std::memory_order_relaxed);
+        (void)var_manager.AssignVarMem(scenario + "/new_var_" + std::to_string(index), tensor_desc, RT_MEMORY_HBM);
+      }
+    });
+  }
+
+  std::atomic<uint64_t> failed_num(0);
+  std::vector<std::thread> readers;
+  int64_t wall_start = NowWallNs();
+  int64_t cpu_start = NowCpuNs();
+  for (uint32_t t = 0; t < thread_num; ++t) {
+    readers.emplace_back([&]() {
+      for (uint32_t run = 0; run < options.run_num; ++run) {
+        for (const auto &var_node : var_nodes) {
+          uint8_t *addr = nullptr;
+          if ((lookup(var_manager, var_node, &addr) != SUCCESS) || (addr == nullptr)) {
+            failed_num.fetch_add(1, std::memory_order_relaxed);
+          }
+        }
+      }
+    });
+  }
+  for (auto &reader : readers) {
+    reader.join();
+  }
+  int64_t cpu_ns = NowCpuNs() - cpu_start;
+  int64_t wall_ns = NowWallNs() - wall_start;
+  stop.store(true, std::memory_order_release);
+  if (writer.joinable()) {
+    writer.join();
+  }
+  if (failed_num.load() != 0) {
+    GELOGE(INTERNAL_ERROR, "%s: %lu lookups failed", scenario.c_str(), failed_num.load());
+    return INTERNAL_ERROR;
+  }
+
+  uint64_t thread_lookups = static_cast<uint64_t>(options.run_num) * var_nodes.size();
+  printf("[%s, %u threads%s]\n", scenario.c_str(), thread_num, with_writer ? ", writer assigning" : "");
+  printf("  wall time per run of a thread  %10.3f us\n", wall_ns / 1000.0 / options.run_num);
+  printf("  wall time per lookup of a thread %8.3f ns\n", static_cast<double>(wall_ns) / thread_lookups);
+  printf("  cpu time per lookup            %10.3f ns\n", static_cast<double>(cpu_ns) / (thread_lookups * thread_num));
+  if (with_writer) {
+    printf("  variables assigned by the writer %8lu\n", assign_count.load());
+  }
+  return SUCCESS;
+}
+
+Status RunBenchmark(const BenchmarkOptions &options) {
+  auto var_manager = VarManager::Instance(kSessionId);
+  GE_CHECK_NOTNULL(var_manager);
+  GE_CHK_STATUS_RET(var_manager->Init(0, kSessionId, 0, 0), "Init var manager failed.");
+  auto graph = BuildVariableGraph(options.var_num);
+  std::vector<VarNode> var_nodes;
+  for (const auto &node : graph->GetDirectNode()) {
+    GE_CHK_STATUS_RET(var_manager->AssignVarMem(node->GetName(), node->GetOpDesc()->GetOutputDesc(0), RT_MEMORY_HBM),
+                      "Assign memory of %s failed.", node->GetName().c_str());
+  }
+  for (const auto &node : graph->GetDirectNode()) {
+    var_nodes.emplace_back(VarNode{node, var_manager->GetVarId(node->GetName())});
+  }
+
+  printf("variables %u, runs %u\n", options.var_num, options.run_num);
+  for (uint32_t thread_num = 1; thread_num <= options.max_thread_num; thread_num *= 2) {
+    for (bool with_writer : {false, true}) {
+      GE_CHK_STATUS_RET_NOLOG(
+        RunScenario("locked lookup by name", options, *var_manager, var_nodes, thread_num, with_writer, LockedLookup));
+      GE_CHK_STATUS_RET_NOLOG(
+        RunScenario("lookup by name", options, *var_manager, var_nodes, thread_num, with_writer, NameLookup));
+      GE_CHK_STATUS_RET_NOLOG(
+        RunScenario("lookup by var id", options, *var_manager, var_nodes, thread_num, with_writer, IdLookup));
+    }
+  }
+  return SUCCESS;
+}
+}  // namespace
+}  // namespace ge
+
+int main(int argc, char **argv) {
+  ge::BenchmarkOptions options;
+  if (!ge::ParseOptions(argc, argv, options)) {
+    return 1;
+  }
+  ge::Status ret = ge::RunBenchmark(options);
+  ge::VarManagerPool::Instance().RemoveVarManager(ge::kSessionId);
+  return ret == ge::SUCCESS ? 0 : 1;
+}
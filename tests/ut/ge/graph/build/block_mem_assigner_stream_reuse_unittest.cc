@@ -0,0 +1,165 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "graph/compute_graph.h"
+#include "graph/utils/graph_utils.h"
+#include "graph/utils/tensor_utils.h"
+
+#define protected public
+#define private public
+#include "graph/build/memory/binary_block_mem_assigner.h"
+#undef private
+#undef protected
+
+using namespace std;
+using namespace testing;
+
+namespace ge {
+namespace {
+const int64_t kSmallSize = 1024;
+const int64_t kLargeSize = 8192;
+}  // namespace
+
+class UtestBlockMemAssignerStreamReuse : public testing::Test {
+ protected:
+  void SetUp() {}
+
+  void TearDown() {}
+
+  NodePtr AddNode(const string &name, int64_t stream_id, int64_t output_size = -1) {
+    auto op_desc = std::make_shared<OpDesc>(name, "Test");
+    op_desc->AddInputDesc(GeTensorDesc());
+    if (output_size >= 0) {
+      GeTensorDesc tensor_desc(GeShape({output_size / static_cast<int64_t>(sizeof(float))}), FORMAT_ND, DT_FLOAT);
+      TensorUtils::SetSize(tensor_desc, output_size);
+      op_desc->AddOutputDesc(tensor_desc);
+    }
+    op_desc->SetStreamId(stream_id);
+    op_desc->SetId(static_cast<int64_t>(graph_->GetDirectNodesSize()));
+    return graph_->AddNode(op_desc);
+  }
+
+  // stream 0: a -> b, e, stream 1: c -> d, the output of c is not ordered after the output of a
+  void BuildParallelStreams() {
+    node_a_ = AddNode("a", 0, kLargeSize);
+    node_b_ = AddNode("b", 0);
+    node_e_ = AddNode("e", 0);
+    node_c_ = AddNode("c", 1, kSmallSize);
+    node_d_ = AddNode("d", 1);
+    (void)GraphUtils::AddEdge(node_a_->GetOutDataAnchor(0), node_b_->GetInDataAnchor(0));
+    (void)GraphUtils::AddEdge(node_c_->GetOutDataAnchor(0), node_d_->GetInDataAnchor(0));
+  }
+
+  void AssignMemory(BinaryBlockMemAssigner &assigner) {
+    vector<int64_t> ranges;
+    ASSERT_EQ(assigner.GetMemoryRanges(ranges), SUCCESS);
+    assigner.AssignMemoryWithReuse(ranges);
+  }
+
+  ComputeGraphPtr graph_ = std::make_shared<ComputeGraph>("test");
+  NodePtr node_a_;
+  NodePtr node_b_;
+  NodePtr node_c_;
+  NodePtr node_d_;
+  NodePtr node_e_;
+  std::map<std::string, std::list<NodeIndexIO>> symbol_to_anchors_;
+  std::map<std::string, std::string> anchor_to_symbol_;
+};
+
+TEST_F(UtestBlockMemAssignerStreamReuse, depend_stream_life) {
+  // stream 0: a -> b, stream 1: c, stream 2: e -> f, stream 3: g
+  auto node_a = AddNode("a", 0, kSmallSize);
+  auto node_b = AddNode("b", 0, kSmallSize);
+  auto node_c = AddNode("c", 1, kSmallSize);
+  auto node_e = AddNode("e", 2, kSmallSize);
+  auto node_f = AddNode("f", 2, kSmallSize);
+  auto node_g = AddNode("g", 3, kSmallSize);
+  (void)GraphUtils::AddEdge(node_a->GetOutDataAnchor(0), node_b->GetInDataAnchor(0));
+  (void)GraphUtils::AddEdge(node_a->GetOutControlAnchor(), node_c->GetInControlAnchor());
+  (void)GraphUtils::AddEdge(node_c->GetOutDataAnchor(0), node_f->GetInDataAnchor(0));
+  (void)GraphUtils::AddEdge(node_f->GetOutDataAnchor(0), node_g->GetInDataAnchor(0));
+  BinaryBlockMemAssigner assigner(graph_, anchor_to_symbol_, symbol_to_anchors_);
+  assigner.InitDependStreamLife();
+
+  // f follows e on its stream, and c which follows a
+  auto &depend_life_f = assigner.total_node_depend_stream_life_[node_f->GetOpDesc()->GetId()];
+  EXPECT_EQ(depend_life_f[0], node_a->GetOpDesc()->GetId());
+  EXPECT_EQ(depend_life_f[1], node_c->GetOpDesc()->GetId());
+  EXPECT_EQ(depend_life_f[2], node_e->GetOpDesc()->GetId());
+  auto &depend_life_g = assigner.total_node_depend_stream_life_[node_g->GetOpDesc()->GetId()];
+  EXPECT_EQ(depend_life_g[0], node_a->GetOpDesc()->GetId());
+  EXPECT_EQ(depend_life_g[2], node_f->GetOpDesc()->GetId());
+  EXPECT_EQ(depend_life_g.count(3), 0);
+}
+
+TEST_F(UtestBlockMemAssignerStreamReuse, reuse_across_streams_by_event) {
+  BuildParallelStreams();
+  ASSERT_EQ(GraphUtils::GetRefMapping(graph_, symbol_to_anchors_, anchor_to_symbol_), GRAPH_SUCCESS);
+  BinaryBlockMemAssigner assigner(graph_, anchor_to_symbol_, symbol_to_anchors_);
+  AssignMemory(assigner);
+
+  const auto &stat = assigner.GetLifeReuseStat();
+  EXPECT_EQ(stat.size_after_ordered_reuse, stat.size_before_reuse);
+  EXPECT_LT(stat.size_after_reuse, stat.size_after_ordered_reuse);
+  EXPECT_EQ(stat.event_reuse_num, 1);
+  ASSERT_EQ(assigner.reuse_wait_edges_.size(), 1);
+  EXPECT_EQ(assigner.reuse_wait_edges_[0].first, node_b_);
+  EXPECT_EQ(assigner.reuse_wait_edges_[0].second, node_c_);
+
+  // c waits for b, which is the last user of the output of a
+  EXPECT_FALSE(node_b_->GetOutControlAnchor()->IsLinkedWith(node_c_->GetInControlAnchor()));
+  EXPECT_EQ(assigner.AddReuseWaitEdges(), SUCCESS);
+  EXPECT_TRUE(node_b_->GetOutControlAnchor()->IsLinkedWith(node_c_->GetInControlAnchor()));
+  EXPECT_EQ(assigner.AddReuseWaitEdges(), SUCCESS);
+  EXPECT_EQ(node_c_->GetInControlNodes().size(), 1);
+}
+
+TEST_F(UtestBlockMemAssignerStreamReuse, reuse_across_streams_ordered) {
+  BuildParallelStreams();
+  // the order is already kept by the event between e, which runs after b, and c
+  (void)GraphUtils::AddEdge(node_e_->GetOutControlAnchor(), node_c_->GetInControlAnchor());
+  ASSERT_EQ(GraphUtils::GetRefMapping(graph_, symbol_to_anchors_, anchor_to_symbol_), GRAPH_SUCCESS);
+  BinaryBlockMemAssigner assigner(graph_, anchor_to_symbol_, symbol_to_anchors_);
+  AssignMemory(assigner);
+
+  const auto &stat = assigner.GetLifeReuseStat();
+  EXPECT_LT(stat.size_after_ordered_reuse, stat.size_before_reuse);
+  EXPECT_EQ(stat.size_after_reuse, stat.size_after_ordered_reuse);
+  EXPECT_EQ(stat.cross_stream_reuse_num, 1);
+  EXPECT_EQ(stat.event_reuse_num, 0);
+  EXPECT_TRUE(assigner.reuse_wait_edges_.empty());
+}
+
+TEST_F(UtestBlockMemAssignerStreamReuse, no_reuse_when_used_after_first_node) {
+  BuildParallelStreams();
+  // d on the other stream reads the output of a after c begins
+  (void)node_d_->AddLinkFrom(node_a_);
+  ASSERT_EQ(GraphUtils::GetRefMapping(graph_, symbol_to_anchors_, anchor_to_symbol_), GRAPH_SUCCESS);
+  BinaryBlockMemAssigner assigner(graph_, anchor_to_symbol_, symbol_to_anchors_);
+  AssignMemory(assigner);
+
+  const auto &stat = assigner.GetLifeReuseStat();
+  EXPECT_EQ(stat.size_after_reuse, stat.size_before_reuse);
+  EXPECT_TRUE(assigner.reuse_wait_edges_.empty());
+}
+}  // namespace ge
@@ -0,0 +1,182 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "cce/taskdown_common.hpp"
+#include "external/ge/ge_api_types.h"
+#include "graph/compute_graph.h"
+#include "graph/debug/ge_attr_define.h"
+#include "graph/ge_local_context.h"
+#include "graph/utils/attr_utils.h"
+#include "graph/utils/graph_utils.h"
+#include "graph/utils/tensor_utils.h"
+
+#define protected public
+#define private public
+#include "graph/build/task_generator.h"
+#undef private
+#undef protected
+
+using namespace std;
+using namespace testing;
+
+namespace ge {
+namespace {
+const int64_t kSmallTensorSize = 1024;
+// the io of the kernel takes longer than a launch
+const int64_t kLargeTensorSize = 1024 * 1024;
+}  // namespace
+
+class UtestTaskGenerator : public testing::Test {
+ protected:
+  void SetUp() {
+    SetAutoSuperKernel("1");
+    graph_ = std::make_shared<ComputeGraph>("test");
+    auto op_desc = std::make_shared<OpDesc>("data", "Data");
+    op_desc->AddOutputDesc(CreateTensorDesc(kSmallTensorSize));
+    data_ = graph_->AddNode(op_desc);
+  }
+
+  void TearDown() { GetThreadLocalContext().SetGraphOption({}); }
+
+  static void SetAutoSuperKernel(const std::string &value) {
+    GetThreadLocalContext().SetGraphOption({{OPTION_AUTO_SUPER_KERNEL, value}});
+  }
+
+  static GeTensorDesc CreateTensorDesc(int64_t size) {
+    GeTensorDesc tensor_desc(GeShape({size}), FORMAT_ND, DT_INT8);
+    TensorUtils::SetSize(tensor_desc, size);
+    return tensor_desc;
+  }
+
+  // a tbe kernel with one task reading the output of input_node
+  NodePtr AddKernel(const std::string &name, const NodePtr &input_node, uint32_t block_dim = 1,
+                    int64_t size = kSmallTensorSize) {
+    auto op_desc = std::make_shared<OpDesc>(name, "Kernel");
+    op_desc->AddInputDesc(CreateTensorDesc(size));
+    op_desc->AddOutputDesc(CreateTensorDesc(size));
+    auto node = graph_->AddNode(op_desc);
+    (void)GraphUtils::AddEdge(input_node->GetOutDataAnchor(0), node->GetInDataAnchor(0));
+
+    domi::TaskDef task_def;
+    task_def.set_type(RT_MODEL_TASK_KERNEL);
+    task_def.set_stream_id(0);
+    task_def.mutable_kernel()->set_block_dim(block_dim);
+    task_def.mutable_kernel()->mutable_context()->set_kernel_type(static_cast<uint32_t>(cce::ccKernelType::TE));
+    op_name_map_[static_cast<uint32_t>(task_def_list_.size())] = name;
+    task_def_list_.emplace_back(task_def);
+    return node;
+  }
+
+  Status BatchSmallKernels() { return task_generator_.BatchSmallKernels(graph_, task_def_list_, op_name_map_); }
+
+  static int64_t GetBatchKey(const NodePtr &node) {
+    int64_t batch_key = 0;
+    return AttrUtils::GetInt(node->GetOpDesc(), ATTR_NAME_SUPER_KERNEL_BATCH_KEY, batch_key) ? batch_key : 0;
+  }
+
+  static bool IsBatchEnd(const NodePtr &node) {
+    bool is_batch_end = false;
+    return AttrUtils::GetBool(node->GetOpDesc(), ATTR_NAME_SUPER_KERNEL_BATCH_END, is_batch_end) && is_batch_end;
+  }
+
+  TaskGenerator task_generator_{nullptr, 0};
+  ComputeGraphPtr graph_;
+  NodePtr data_;
+  std::vector<domi::TaskDef> task_def_list_;
+  std::map<uint32_t, std::string> op_name_map_;
+};
+
+TEST_F(UtestTaskGenerator, batch_chain_of_small_kernels) {
+  std::vector<NodePtr> kernels;
+  NodePtr last_node = data_;
+  for (int i = 0; i < 4; ++i) {
+    last_node = AddKernel("kernel" + std::to_string(i), last_node);
+    kernels.emplace_back(last_node);
+  }
+  ASSERT_EQ(BatchSmallKernels(), SUCCESS);
+  for (const auto &kernel : kernels) {
+    EXPECT_EQ(GetBatchKey(kernel), -2);
+  }
+  EXPECT_FALSE(IsBatchEnd(kernels[0]));
+  EXPECT_FALSE(IsBatchEnd(kernels[2]));
+  EXPECT_TRUE(IsBatchEnd(kernels[3]));
+}
+
+TEST_F(UtestTaskGenerator, batch_breaks_at_multi_block_or_unchained_kernel) {
+  auto kernel0 = AddKernel("kernel0", data_);
+  auto kernel1 = AddKernel("kernel1", kernel0);
+  // blocks of a multi block kernel may read outputs of the previous kernel written by other blocks
+  auto multi_block = AddKernel("multi_block", kernel1, 2);
+  auto kernel2 = AddKernel("kernel2", multi_block);
+  auto kernel3 = AddKernel("kernel3", kernel2);
+  // does not read the output of kernel3
+  auto unchained = AddKernel("unchained", data_);
+  ASSERT_EQ(BatchSmallKernels(), SUCCESS);
+
+  EXPECT_EQ(GetBatchKey(kernel0), -2);
+  EXPECT_EQ(GetBatchKey(kernel1), -2);
+  EXPECT_TRUE(IsBatchEnd(kernel1));
+  EXPECT_EQ(GetBatchKey(multi_block), 0);
+  EXPECT_EQ(GetBatchKey(kernel2), -3);
+  EXPECT_EQ(GetBatchKey(kernel3), -3);
+  EXPECT_TRUE(IsBatchEnd(kernel3));
+  EXPECT_EQ(GetBatchKey(unchained), 0);
+}
+
+TEST_F(UtestTaskGenerator, batch_only_launch_bound_kernels) {
+  auto kernel0 = AddKernel("kernel0", data_);
+  auto large = AddKernel("large", kernel0, 1, kLargeTensorSize);
+  auto kernel1 = AddKernel("kernel1", large);
+  auto kernel2 = AddKernel("kernel2", kernel1);
+  ASSERT_EQ(BatchSmallKernels(), SUCCESS);
+
+  // a single kernel saves no launch
+  EXPECT_EQ(GetBatchKey(kernel0), 0);
+  EXPECT_FALSE(IsBatchEnd(kernel0));
+  EXPECT_EQ(GetBatchKey(large), 0);
+  EXPECT_EQ(GetBatchKey(kernel1), -2);
+  EXPECT_EQ(GetBatchKey(kernel2), -2);
+}
+
+TEST_F(UtestTaskGenerator, batches_dropped_when_tasks_generated_again) {
+  auto kernel0 = AddKernel("kernel0", data_);
+  auto kernel1 = AddKernel("kernel1", kernel0);
+  auto kernel2 = AddKernel("kernel2", kernel1);
+  ASSERT_EQ(BatchSmallKernels(), SUCCESS);
+  EXPECT_EQ(GetBatchKey(kernel0), -2);
+  EXPECT_TRUE(IsBatchEnd(kernel2));
+
+  // kernel2 runs on more blocks now, the end of the batch moves to kernel1
+  task_def_list_[2].mutable_kernel()->set_block_dim(2);
+  ASSERT_EQ(BatchSmallKernels(), SUCCESS);
+  EXPECT_EQ(GetBatchKey(kernel0), -2);
+  EXPECT_TRUE(IsBatchEnd(kernel1));
+  EXPECT_EQ(GetBatchKey(kernel2), 0);
+  EXPECT_FALSE(IsBatchEnd(kernel2));
+
+  SetAutoSuperKernel("0");
+  ASSERT_EQ(BatchSmallKernels(), SUCCESS);
+  for (const auto &kernel : {kernel0, kernel1, kernel2}) {
+    EXPECT_FALSE(kernel->GetOpDesc()->HasAttr(ATTR_NAME_SUPER_KERNEL_BATCH_KEY));
+    EXPECT_FALSE(kernel->GetOpDesc()->HasAttr(ATTR_NAME_SUPER_KERNEL_BATCH_END));
+  }
+}
+}  // namespace ge
@@ -0,0 +1,280 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "cce/taskdown_common.hpp"
+#include "common/types.h"
+#include "framework/common/ge_inner_error_codes.h"
+#include "graph/compute_graph.h"
+#include "graph/debug/ge_attr_define.h"
+#include "graph/execute/graph_execute.h"
+#include "graph/manager/graph_manager_utils.h"
+#include "graph/manager/graph_mem_allocator.h"
+#include "graph/manager/graph_var_manager.h"
+#include "graph/op_kernel_bin.h"
+#include "graph/utils/attr_utils.h"
+#include "graph/utils/graph_utils.h"
+#include "graph/utils/tensor_utils.h"
+#include "rt_call_recorder.h"
+
+#define protected public
+#define private public
+#include "graph/load/new_model_manager/davinci_model.h"
+#include "graph/load/new_model_manager/model_manager.h"
+#undef private
+#undef protected
+
+using namespace testing;
+namespace ge {
+namespace {
+const uint32_t kInvalidModelId = 0xFFFF;
+const uint32_t kModelId = 0xFF00;
+const uint64_t kSessionId = 0;
+const size_t kBufferSize = 64;
+}  // namespace
+
+class UtestGraphExecute : public testing::Test {
+ protected:
+  void SetUp() {
+    listener_ = std::make_shared<GraphModelListener>(mutex_, condition_);
+    input_buffer_.resize(kBufferSize);
+    output_buffer_.resize(kBufferSize);
+    io_binding_.inputs.emplace_back(input_buffer_.data(), input_buffer_.size(), false);
+    io_binding_.outputs.emplace_back(output_buffer_.data(), output_buffer_.size(), false);
+  }
+
+  void TearDown() {
+    if (model_ != nullptr) {
+      (void)model_->ModelRunStop();
+      (void)ModelManager::GetInstance()->DeleteModel(kModelId);
+      model_.reset();
+      RtCallRecorder::Instance().SetMemcpyEnabled(false);
+      VarManagerPool::Instance().Destory();
+      MemManager::Instance().Finalize();
+    }
+  }
+
+  static GeTensorDesc CreateTensorDesc() {
+    GeTensorDesc tensor_desc(GeShape({static_cast<int64_t>(kBufferSize / sizeof(float))}), FORMAT_ND, DT_FLOAT);
+    TensorUtils::SetSize(tensor_desc, kBufferSize);
+    return tensor_desc;
+  }
+
+  ///
+  /// Loads a static model of Data -> TE kernel -> NetOutput into the model manager, the feature map is
+  /// | input | output |. The stubbed device memory is host memory, which the runtime copies in memcpy mode.
+  ///
+  void LoadModel() {
+    RtCallRecorder::Instance().SetMemcpyEnabled(true);
+    ASSERT_EQ(MemManager::Instance().Initialize(std::vector<rtMemType_t>({RT_MEMORY_HBM})), SUCCESS);
+    ASSERT_EQ(VarManager::Instance(kSessionId)->Init(0, kSessionId, 0, 0), SUCCESS);
+
+    auto graph = std::make_shared<ComputeGraph>("io_binding_graph");
+    auto data_desc = std::make_shared<OpDesc>("data", DATA);
+    data_desc->SetId(0);
+    data_desc->AddInputDesc(CreateTensorDesc());
+    data_desc->AddOutputDesc(CreateTensorDesc());
+    data_desc->SetOutputOffset({0});
+    (void)AttrUtils::SetInt(data_desc, ATTR_NAME_INDEX, 0);
+    auto data = graph->AddNode(data_desc);
+
+    auto kernel_desc = std::make_shared<OpDesc>("kernel", "IoBindingKernel");
+    kernel_desc->SetId(1);
+    kernel_desc->AddInputDesc(CreateTensorDesc());
+    kernel_desc->AddOutputDesc(CreateTensorDesc());
+    kernel_desc->SetInputOffset({0});
+    kernel_desc->SetOutputOffset({static_cast<int64_t>(kBufferSize)});
+    (void)AttrUtils::SetInt(kernel_desc, ATTR_NAME_IMPLY_TYPE, static_cast<int64_t>(domi::ImplyType::TVM));
+    (void)AttrUtils::SetStr(kernel_desc, TVM_ATTR_NAME_MAGIC, "RT_DEV_BINARY_MAGIC_ELF");
+    std::vector<char> kernel_bin(64, 0);
+    (void)kernel_desc->SetExtAttr(OP_EXTATTR_NAME_TBE_KERNEL,
+                                  std::make_shared<OpKernelBin>("kernel", std::move(kernel_bin)));
+    auto kernel = graph->AddNode(kernel_desc);
+
+    auto net_output_desc = std::make_shared<OpDesc>("net_output", NETOUTPUT);
+    net_output_desc->SetId(2);
+    net_output_desc->AddInputDesc(CreateTensorDesc());
+    net_output_desc->SetInputOffset({static_cast<int64_t>(kBufferSize)});
+    net_output_desc->SetSrcName({"kernel"});
+    net_output_desc->SetSrcIndex({0});
+    auto net_output = graph->AddNode(net_output_desc);
+    (void)GraphUtils::AddEdge(data->GetOutDataAnchor(0), kernel->GetInDataAnchor(0));
+    (void)GraphUtils::AddEdge(kernel->GetOutDataAnchor(0), net_output->GetInDataAnchor(0));
+
+    auto task_def = std::make_shared<domi::ModelTaskDef>();
+    domi::TaskDef *kernel_task = task_def->add_task();
+    kernel_task->set_type(RT_MODEL_TASK_KERNEL);
+    kernel_task->set_stream_id(0);
+    domi::KernelDef *kernel_def = kernel_task->mutable_kernel();
+    kernel_def->set_stub_func("kernel");
+    kernel_def->set_block_dim(1);
+    kernel_def->set_args(std::string(2 * sizeof(void *), '\0'));
+    kernel_def->set_args_size(2 * sizeof(void *));
+    domi::KernelContext *context = kernel_def->mutable_context();
+    context->set_kernel_type(static_cast<uint32_t>(cce::ccKernelType::TE));
+    context->set_op_index(1);
+    uint16_t args_offset = 0;
+    context->set_args_offset(&args_offset, sizeof(args_offset));
+
+    auto ge_model = std::make_shared<GeModel>();
+    ge_model->SetName("io_binding_model");
+    ge_model->SetGraph(GraphUtils::CreateGraphFromComputeGraph(graph));
+    ge_model->SetModelTaskDef(task_def);
+    (void)AttrUtils::SetInt(ge_model, ATTR_MODEL_MEMORY_SIZE, 2 * kBufferSize);
+    (void)AttrUtils::SetInt(ge_model, ATTR_MODEL_WEIGHT_SIZE, 0);
+    (void)AttrUtils::SetInt(ge_model, ATTR_MODEL_STREAM_NUM, 1);
+    (void)AttrUtils::SetInt(ge_model, ATTR_MODEL_EVENT_NUM, 0);
+    (void)AttrUtils::SetInt(ge_model, ATTR_MODEL_LABEL_NUM, 0);
+    (void)AttrUtils::SetInt(ge_model, MODEL_ATTR_TASK_GEN_BASE_ADDR, 0);
+    (void)AttrUtils::SetInt(ge_model, MODEL_ATTR_SESSION_ID, kSessionId);
+
+    model_ = std::make_shared<DavinciModel>(0, listener_);
+    model_->SetId(kModelId);
+    ASSERT_EQ(model_->Assign(ge_model), SUCCESS);
+    ASSERT_EQ(model_->Init(), SUCCESS);
+    ModelManager::GetInstance()->InsertModel(kModelId, model_);
+  }
+
+  // whether args of the kernel address the input and the output at the given addresses
+  bool KernelArgsAddress(const void *input_addr, const void *output_addr) const {
+    if (model_->zero_copy_tasks_.size() != 1) {
+      return false;
+    }
+    const auto &args = model_->zero_copy_tasks_[0].args_info_;
+    uint64_t addrs[2] = {0};
+    if (args.size() < sizeof(addrs)) {
+      return false;
+    }
+    (void)memcpy(addrs, args.data(), sizeof(addrs));
+    return (addrs[0] == reinterpret_cast<uintptr_t>(input_addr)) &&
+           (addrs[1] == reinterpret_cast<uintptr_t>(output_addr));
+  }
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::shared_ptr<GraphModelListener> listener_;
+  std::vector<uint8_t> input_buffer_;
+  std::vector<uint8_t> output_buffer_;
+  GraphIoBinding io_binding_;
+  std::shared_ptr<DavinciModel> model_;
+};
+
+TEST_F(UtestGraphExecute, io_binding_not_init) {
+  GraphExecutor executor;
+  std::vector<GeTensorDesc> output_desc;
+  EXPECT_EQ(executor.ExecuteGraphWithIoBinding(1, kInvalidModelId, io_binding_, output_desc),
+            GE_GRAPH_EXECUTE_NOT_INIT);
+}
+
+TEST_F(UtestGraphExecute, io_binding_invalid_buffer) {
+  GraphExecutor executor;
+  ASSERT_EQ(executor.SetCondition(&mutex_, &condition_, listener_), SUCCESS);
+  std::vector<GeTensorDesc> output_desc;
+
+  GraphIoBinding null_input = io_binding_;
+  null_input.inputs[0].data = nullptr;
+  EXPECT_EQ(executor.ExecuteGraphWithIoBinding(1, kInvalidModelId, null_input, output_desc), PARAM_INVALID);
+
+  GraphIoBinding null_output = io_binding_;
+  null_output.outputs[0].data = nullptr;
+  EXPECT_EQ(executor.ExecuteGraphWithIoBinding(1, kInvalidModelId, null_output, output_desc), PARAM_INVALID);
+}
+
+TEST_F(UtestGraphExecute, io_binding_device_memory_of_train_graph) {
+  GraphExecutor executor;
+  ASSERT_EQ(executor.SetCondition(&mutex_, &condition_, listener_), SUCCESS);
+  executor.SetTrainFlag(true);
+  io_binding_.is_device_memory = true;
+  std::vector<GeTensorDesc> output_desc;
+  EXPECT_EQ(executor.ExecuteGraphWithIoBinding(1, kInvalidModelId, io_binding_, output_desc), PARAM_INVALID);
+}
+
+TEST_F(UtestGraphExecute, io_binding_model_not_loaded) {
+  GraphExecutor executor;
+  ASSERT_EQ(executor.SetCondition(&mutex_, &condition_, listener_), SUCCESS);
+  std::vector<GeTensorDesc> output_desc;
+  EXPECT_EQ(executor.ExecuteGraphWithIoBinding(1, kInvalidModelId, io_binding_, output_desc),
+            GE_GRAPH_SYNC_MODEL_FAILED);
+  EXPECT_TRUE(output_desc.empty());
+}
+
+TEST_F(UtestGraphExecute, io_binding_device_memory_is_zero_copy) {
+  LoadModel();
+  GraphExecutor executor;
+  ASSERT_EQ(executor.SetCondition(&mutex_, &condition_, listener_), SUCCESS);
+  io_binding_.is_device_memory = true;
+  std::vector<GeTensorDesc> output_desc;
+  ASSERT_EQ(executor.ExecuteGraphWithIoBinding(1, kModelId, io_binding_, output_desc), SUCCESS);
+  ASSERT_EQ(output_desc.size(), 1);
+  EXPECT_EQ(output_desc[0].GetShape().GetDims(), std::vector<int64_t>({kBufferSize / sizeof(float)}));
+  EXPECT_EQ(output_desc[0].GetDataType(), DT_FLOAT);
+  // the kernel reads and writes the bound buffers in place
+  EXPECT_TRUE(model_->is_io_args_bound_);
+  EXPECT_TRUE(KernelArgsAddress(input_buffer_.data(), output_buffer_.data()));
+
+  // the model run thread gives the model io memory back to the kernel before its next run
+  ASSERT_EQ(model_->RestoreIoTaskArgs(), SUCCESS);
+  EXPECT_FALSE(model_->is_io_args_bound_);
+  EXPECT_TRUE(KernelArgsAddress(model_->mem_base_, model_->mem_base_ + kBufferSize));
+  EXPECT_EQ(model_->RestoreIoTaskArgs(), SUCCESS);
+}
+
+TEST_F(UtestGraphExecute, io_binding_host_memory_copies_once) {
+  LoadModel();
+  ASSERT_EQ(model_->ModelRunStart(), SUCCESS);
+  GraphExecutor executor;
+  ASSERT_EQ(executor.SetCondition(&mutex_, &condition_, listener_), SUCCESS);
+  for (size_t i = 0; i < kBufferSize; ++i) {
+    input_buffer_[i] = static_cast<uint8_t>(i + 1);
+    // what the kernel would have written
+    model_->mem_base_[kBufferSize + i] = static_cast<uint8_t>(i * 3);
+  }
+  std::vector<GeTensorDesc> output_desc;
+  RtCallRecorder::Instance().Start(false);
+  ASSERT_EQ(executor.ExecuteGraphWithIoBinding(1, kModelId, io_binding_, output_desc), SUCCESS);
+  auto call_counts = RtCallRecorder::Instance().GetCallCounts();
+  RtCallRecorder::Instance().Stop();
+  EXPECT_EQ(output_desc.size(), 1);
+  // no staging buffer between the bound buffers and the model io memory
+  EXPECT_EQ(call_counts["rtMallocHost"], 0);
+  EXPECT_EQ(std::vector<uint8_t>(model_->mem_base_, model_->mem_base_ + kBufferSize), input_buffer_);
+  EXPECT_EQ(std::vector<uint8_t>(model_->mem_base_ + kBufferSize, model_->mem_base_ + 2 * kBufferSize),
+            output_buffer_);
+  EXPECT_TRUE(KernelArgsAddress(model_->mem_base_, model_->mem_base_ + kBufferSize));
+}
+
+TEST_F(UtestGraphExecute, io_binding_host_memory_restores_device_binding) {
+  LoadModel();
+  ASSERT_EQ(model_->ModelRunStart(), SUCCESS);
+  GraphExecutor executor;
+  ASSERT_EQ(executor.SetCondition(&mutex_, &condition_, listener_), SUCCESS);
+  GraphIoBinding device_binding = io_binding_;
+  device_binding.is_device_memory = true;
+  std::vector<GeTensorDesc> output_desc;
+  ASSERT_EQ(executor.ExecuteGraphWithIoBinding(1, kModelId, device_binding, output_desc), SUCCESS);
+  EXPECT_TRUE(KernelArgsAddress(input_buffer_.data(), output_buffer_.data()));
+
+  // a run of the model thread after a device binding run must not address the user buffers
+  ASSERT_EQ(executor.ExecuteGraphWithIoBinding(1, kModelId, io_binding_, output_desc), SUCCESS);
+  EXPECT_FALSE(model_->is_io_args_bound_);
+  EXPECT_TRUE(KernelArgsAddress(model_->mem_base_, model_->mem_base_ + kBufferSize));
+}
+}  // namespace ge
@@ -85,3 +85,28 @@ TEST_F(UtestGeExecutor, fail_CommandHandle_model_manager_HandleCommand_error) {
   ge::Status ret = ge_executor.CommandHandle(cmd);
   EXPECT_EQ(ge::PARAM_INVALID, ret);
 }
+
+TEST_F(UtestGeExecutor, io_binding_register_and_exec) {
+  uint32_t model_id = 1;
+  ge::GeExecutor ge_executor;
+  ge_executor.isInit_ = true;
+  uint8_t input[16] = {0};
+  std::vector<DataBuffer> inputs = {DataBuffer(input, sizeof(input), false)};
+  std::vector<DataBuffer> null_outputs = {DataBuffer(nullptr, 16, false)};
+  std::vector<GeTensorDesc> input_desc;
+  std::vector<GeTensorDesc> output_desc;
+
+  EXPECT_EQ(ge_executor.RegisterIoBinding(model_id, inputs, input_desc, null_outputs, true), ge::PARAM_INVALID);
+  // a model without binding is not executed
+  EXPECT_EQ(ge_executor.ExecModelWithIoBinding(model_id, nullptr, output_desc), ge::PARAM_INVALID);
+
+  std::vector<DataBuffer> outputs = {DataBuffer(input, sizeof(input), false)};
+  EXPECT_EQ(ge_executor.RegisterIoBinding(model_id, inputs, input_desc, outputs, true), ge::SUCCESS);
+  // the model is not loaded
+  EXPECT_NE(ge_executor.ExecModelWithIoBinding(model_id, nullptr, output_desc), ge::SUCCESS);
+  EXPECT_EQ(ge_executor.UnregisterIoBinding(model_id), ge::SUCCESS);
+  EXPECT_EQ(ge_executor.ExecModelWithIoBinding(model_id, nullptr, output_desc), ge::PARAM_INVALID);
+
+  ge_executor.isInit_ = false;
+  EXPECT_EQ(ge_executor.RegisterIoBinding(model_id, inputs, input_desc, outputs, true), ge::GE_EXEC_NOT_INIT);
+}
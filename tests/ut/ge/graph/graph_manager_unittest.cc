@@ -0,0 +1,119 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "graph/compute_graph.h"
+#include "graph/utils/graph_utils.h"
+
+#define protected public
+#define private public
+#include "graph/manager/graph_manager.h"
+#include "graph/manager/graph_manager_utils.h"
+#undef private
+#undef protected
+
+using namespace std;
+using namespace testing;
+
+namespace ge {
+namespace {
+const GraphId kGraphId = 1;
+const uint32_t kRunThreadNum = 4;
+}  // namespace
+
+class UtestGraphManager : public testing::Test {
+ protected:
+  void SetUp() {
+    graph_node_ = std::make_shared<GraphNode>(kGraphId);
+    auto compute_graph = std::make_shared<ComputeGraph>("test");
+    graph_node_->SetGraph(std::make_shared<Graph>(GraphUtils::CreateGraphFromComputeGraph(compute_graph)));
+    graph_node_->SetBuildFlag(true);
+    graph_node_->SetLoadFlag(true);
+    // the model id of the replica is never loaded, a run of it fails in the executor
+    graph_node_->AddRunReplica(graph_manager_.CreateRunReplica());
+    graph_manager_.graph_map_[kGraphId] = graph_node_;
+  }
+
+  void TearDown() { graph_manager_.graph_map_.clear(); }
+
+  OmgContext omg_context_;
+  GraphManager graph_manager_{omg_context_};
+  GraphNodePtr graph_node_;
+};
+
+TEST_F(UtestGraphManager, remove_graph_refused_while_pinned_for_run) {
+  graph_node_->PinForRun();
+  EXPECT_TRUE(graph_node_->IsExecuting());
+  EXPECT_EQ(graph_manager_.RemoveGraph(kGraphId), GE_GRAPH_GRAPH_IS_RUNNING);
+  EXPECT_EQ(graph_manager_.graph_map_.count(kGraphId), 1);
+
+  graph_node_->UnpinForRun();
+  EXPECT_FALSE(graph_node_->IsExecuting());
+  EXPECT_EQ(graph_manager_.RemoveGraph(kGraphId), SUCCESS);
+  EXPECT_EQ(graph_manager_.graph_map_.count(kGraphId), 0);
+}
+
+TEST_F(UtestGraphManager, remove_graph_refused_while_replica_held) {
+  GraphRunReplicaPtr replica = graph_node_->AcquireRunReplica();
+  ASSERT_NE(replica, nullptr);
+  EXPECT_EQ(graph_manager_.RemoveGraph(kGraphId), GE_GRAPH_GRAPH_IS_RUNNING);
+
+  graph_node_->ReleaseRunReplica(replica);
+  EXPECT_EQ(graph_manager_.RemoveGraph(kGraphId), SUCCESS);
+}
+
+TEST_F(UtestGraphManager, run_graph_without_replica_fails) {
+  graph_node_->ClearRunReplicas();
+  std::vector<GeTensor> inputs;
+  std::vector<GeTensor> outputs;
+  EXPECT_EQ(graph_manager_.RunGraph(kGraphId, inputs, outputs, 0), GE_GRAPH_NOT_INIT);
+  EXPECT_FALSE(graph_node_->IsExecuting());
+}
+
+TEST_F(UtestGraphManager, concurrent_run_and_remove_graph) {
+  std::atomic<bool> removed(false);
+  std::atomic<uint32_t> not_init_num(0);
+  std::vector<std::thread> run_threads;
+  for (uint32_t i = 0; i < kRunThreadNum; ++i) {
+    run_threads.emplace_back([this, &removed, &not_init_num]() {
+      std::vector<GeTensor> inputs;
+      while (!removed) {
+        std::vector<GeTensor> outputs;
+        // a run either finds the graph with its replica or does not find the graph at all
+        if (graph_manager_.RunGraph(kGraphId, inputs, outputs, 0) == GE_GRAPH_NOT_INIT) {
+          ++not_init_num;
+        }
+      }
+    });
+  }
+
+  Status ret = GE_GRAPH_GRAPH_IS_RUNNING;
+  while (ret == GE_GRAPH_GRAPH_IS_RUNNING) {
+    ret = graph_manager_.RemoveGraph(kGraphId);
+  }
+  removed = true;
+  for (auto &run_thread : run_threads) {
+    run_thread.join();
+  }
+  EXPECT_EQ(ret, SUCCESS);
+  EXPECT_EQ(not_init_num, 0);
+  EXPECT_FALSE(graph_node_->IsExecuting());
+}
+}  // namespace ge
@@ -16,6 +16,7 @@
 
 
 #include <gtest/gtest.h>
+#include <thread>
 
 #include "graph/load/new_model_manager/data_inputer.h"
 
@@ -61,4 +62,71 @@ TEST_F(UtestModelManagerDataInputer, success_inputdatawrapper_init) {
   input_data_wrapper = NULL;
 }
 
+TEST_F(UtestModelManagerDataInputer, pop_batch_in_push_order) {
+  DataInputer data_inputer;
+  for (uint32_t i = 0; i < 3; ++i) {
+    auto data_wrapper = InputDataWrapper::Acquire();
+    ASSERT_NE(data_wrapper, nullptr);
+    InputData input_data;
+    input_data.index = i;
+    OutputData output_data;
+    EXPECT_EQ(data_wrapper->Init(input_data, output_data), SUCCESS);
+    EXPECT_EQ(data_inputer.Push(data_wrapper), SUCCESS);
+  }
+
+  std::vector<std::shared_ptr<InputDataWrapper>> data_wrappers;
+  EXPECT_EQ(data_inputer.PopBatch(data_wrappers, 2), SUCCESS);
+  ASSERT_EQ(data_wrappers.size(), 2);
+  EXPECT_EQ(data_wrappers[0]->GetInput().index, 0);
+  EXPECT_EQ(data_wrappers[1]->GetInput().index, 1);
+
+  std::shared_ptr<InputDataWrapper> data_wrapper;
+  EXPECT_EQ(data_inputer.Pop(data_wrapper), SUCCESS);
+  ASSERT_NE(data_wrapper, nullptr);
+  EXPECT_EQ(data_wrapper->GetInput().index, 2);
+}
+
+TEST_F(UtestModelManagerDataInputer, push_fail_when_full) {
+  DataInputer data_inputer;
+  auto data_wrapper = InputDataWrapper::Acquire();
+  ASSERT_NE(data_wrapper, nullptr);
+  while (!data_inputer.IsDataFull()) {
+    EXPECT_EQ(data_inputer.Push(data_wrapper), SUCCESS);
+  }
+  EXPECT_EQ(data_inputer.Push(data_wrapper), INTERNAL_ERROR);
+}
+
+TEST_F(UtestModelManagerDataInputer, pop_fail_after_stop) {
+  DataInputer data_inputer;
+  std::thread stop_thread([&data_inputer]() { data_inputer.Stop(); });
+  std::shared_ptr<InputDataWrapper> data_wrapper;
+  EXPECT_EQ(data_inputer.Pop(data_wrapper), INTERNAL_ERROR);
+  stop_thread.join();
+  EXPECT_EQ(data_inputer.Push(InputDataWrapper::Acquire()), INTERNAL_ERROR);
+}
+
+TEST_F(UtestModelManagerDataInputer, wrapper_reused_after_release) {
+  InputData input_data;
+  input_data.blobs.resize(2);
+  OutputData output_data;
+  auto data_wrapper = InputDataWrapper::Acquire();
+  ASSERT_NE(data_wrapper, nullptr);
+  EXPECT_EQ(data_wrapper->Init(input_data, output_data), SUCCESS);
+  InputDataWrapper *released = data_wrapper.get();
+  data_wrapper.reset();
+
+  // wrappers released by other cases may be handed out first
+  std::vector<std::shared_ptr<InputDataWrapper>> data_wrappers;
+  while (data_wrappers.size() < 512) {
+    data_wrapper = InputDataWrapper::Acquire();
+    ASSERT_NE(data_wrapper, nullptr);
+    data_wrappers.emplace_back(data_wrapper);
+    if (data_wrapper.get() == released) {
+      break;
+    }
+  }
+  ASSERT_EQ(data_wrapper.get(), released);
+  EXPECT_TRUE(data_wrapper->GetInput().blobs.empty());
+  EXPECT_EQ(data_wrapper->Init(input_data, output_data), SUCCESS);
+}
 }  // namespace ge
@@ -0,0 +1,146 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+#include "common/types.h"
+#include "graph/op_desc.h"
+
+#define protected public
+#define private public
+#include "graph/load/new_model_manager/davinci_model.h"
+#include "graph/load/new_model_manager/task_info/task_info.h"
+#undef private
+#undef protected
+
+using namespace std;
+using namespace testing;
+
+namespace ge {
+namespace {
+const int64_t kInputOffset = 0;
+const int64_t kFeatureMapOffset = 256;
+const int64_t kOutputOffset = 512;
+const size_t kMemSize = 1024;
+
+// io addrs of the task are offsets in the feature map of its model
+class FeatureMapTaskInfo : public TaskInfo {
+ public:
+  FeatureMapTaskInfo(DavinciModel *davinci_model, const vector<int64_t> &offsets)
+      : davinci_model_(davinci_model), offsets_(offsets) {}
+
+  Status Init(const domi::TaskDef &task_def, DavinciModel *davinci_model) override { return SUCCESS; }
+
+  Status Distribute() override { return SUCCESS; }
+
+  Status UpdateArgs() override {
+    vector<void *> io_addrs;
+    for (int64_t offset : offsets_) {
+      io_addrs.emplace_back(davinci_model_->runtime_param_.mem_base + offset);
+    }
+    davinci_model_->SetTotalIOAddrs(io_addrs);
+    return SUCCESS;
+  }
+
+ private:
+  DavinciModel *davinci_model_;
+  vector<int64_t> offsets_;
+};
+}  // namespace
+
+class UtestKnownNodeArgs : public testing::Test {
+ protected:
+  void SetUp() {
+    model_.SetKnownNode(true);
+    model_.UpdateMemBase(mem_base_);
+    model_.runtime_param_.mem_size = kMemSize;
+
+    OpDescPtr data_op = std::make_shared<OpDesc>("data", DATA);
+    data_op->AddOutputDesc(GeTensorDesc());
+    data_op->SetOutputOffset({kInputOffset});
+    model_.data_op_list_.push_back(data_op);
+    OpDescPtr output_op = std::make_shared<OpDesc>("output", NETOUTPUT);
+    output_op->AddInputDesc(GeTensorDesc());
+    output_op->SetInputOffset({kOutputOffset});
+    model_.output_op_list_.push_back(output_op);
+
+    // args of the task: model input, feature map, model output
+    model_.task_list_.push_back(std::make_shared<FeatureMapTaskInfo>(
+      &model_, vector<int64_t>({kInputOffset, kFeatureMapOffset, kOutputOffset})));
+  }
+
+  void TearDown() {}
+
+  uint8_t mem_base_[kMemSize] = {0};
+  DavinciModel model_{0, nullptr};
+};
+
+TEST_F(UtestKnownNodeArgs, update_known_node_args_patch_io_slots) {
+  ASSERT_EQ(model_.InitKnownNodeArgs(), SUCCESS);
+  EXPECT_EQ(model_.known_io_arg_slots_.size(), 2);
+
+  uint8_t input_buffer[8] = {0};
+  uint8_t output_buffer[8] = {0};
+  vector<void *> inputs = {input_buffer};
+  vector<void *> outputs = {output_buffer};
+  void *feature_map = mem_base_ + kFeatureMapOffset;
+  EXPECT_EQ(model_.UpdateKnownNodeArgs(inputs, outputs), SUCCESS);
+  vector<void *> expected_addrs = {input_buffer, feature_map, output_buffer};
+  EXPECT_EQ(model_.total_io_addrs_, expected_addrs);
+
+  // same addresses as the last iteration, args on device are still valid
+  model_.total_io_addrs_.clear();
+  EXPECT_EQ(model_.UpdateKnownNodeArgs(inputs, outputs), SUCCESS);
+  EXPECT_TRUE(model_.total_io_addrs_.empty());
+
+  uint8_t other_input_buffer[8] = {0};
+  inputs = {other_input_buffer};
+  EXPECT_EQ(model_.UpdateKnownNodeArgs(inputs, outputs), SUCCESS);
+  expected_addrs = {other_input_buffer, feature_map, output_buffer};
+  EXPECT_EQ(model_.total_io_addrs_, expected_addrs);
+
+  // the output of the model is not given
+  EXPECT_NE(model_.UpdateKnownNodeArgs(inputs, {}), SUCCESS);
+}
+
+TEST_F(UtestKnownNodeArgs, io_slots_kept_when_mem_base_changes) {
+  // loaded before the first execution allocates the mem base
+  model_.UpdateMemBase(nullptr);
+  ASSERT_EQ(model_.InitKnownNodeArgs(), SUCCESS);
+  const auto slots = model_.known_io_arg_slots_;
+  EXPECT_EQ(slots.size(), 2);
+
+  uint8_t input_buffer[8] = {0};
+  uint8_t output_buffer[8] = {0};
+  vector<void *> inputs = {input_buffer};
+  vector<void *> outputs = {output_buffer};
+  uint8_t other_mem_base[kMemSize] = {0};
+  for (uint8_t *mem_base : {mem_base_, other_mem_base}) {
+    model_.SetKnownNodeAddrNotChanged(false);
+    model_.UpdateMemBase(mem_base);
+    EXPECT_EQ(model_.UpdateKnownNodeArgs(inputs, outputs), SUCCESS);
+    vector<void *> expected_addrs = {input_buffer, mem_base + kFeatureMapOffset, output_buffer};
+    EXPECT_EQ(model_.total_io_addrs_, expected_addrs);
+    ASSERT_EQ(model_.known_io_arg_slots_.size(), slots.size());
+    for (size_t i = 0; i < slots.size(); ++i) {
+      EXPECT_EQ(model_.known_io_arg_slots_[i].io_addr_index, slots[i].io_addr_index);
+      EXPECT_EQ(model_.known_io_arg_slots_[i].is_input, slots[i].is_input);
+    }
+  }
+}
+}  // namespace ge
@@ -62,6 +62,12 @@ class UtestModelManagerModelManager : public testing::Test {
     model.SetGraph(graph);
   }
 
+  static void SetNullModel(ModelManager &manager, uint32_t id) {
+    ModelManager::DavinciModelMap model_map(*manager.model_map_);
+    model_map[id] = nullptr;
+    manager.PublishModelMap(std::make_shared<const ModelManager::DavinciModelMap>(model_map));
+  }
+
   void SetUp() {}
 
   void TearDown() {}
@@ -380,7 +386,7 @@ TEST_F(UtestModelManagerModelManager, command_profile_failed) {
 // test Start
 TEST_F(UtestModelManagerModelManager, start_fail) {
   ModelManager manager;
-  manager.model_map_[2] = nullptr;
+  SetNullModel(manager, 2);
   EXPECT_EQ(ge::PARAM_INVALID, manager.Start(2));
 }
 
@@ -388,14 +394,14 @@ TEST_F(UtestModelManagerModelManager, start_fail) {
 TEST_F(UtestModelManagerModelManager, get_max_used_memory_fail) {
   ModelManager manager;
   uint64_t max_size = 0;
-  manager.model_map_[2] = nullptr;
+  SetNullModel(manager, 2);
   EXPECT_EQ(ge::PARAM_INVALID, manager.GetMaxUsedMemory(2, max_size));
 }
 
 // test GetInputOutputDescInfo
 TEST_F(UtestModelManagerModelManager, get_input_output_desc_info_fail) {
   ModelManager manager;
-  manager.model_map_[2] = nullptr;
+  SetNullModel(manager, 2);
   vector<InputOutputDescInfo> input_shape;
   vector<InputOutputDescInfo> output_shape;
   EXPECT_EQ(ge::PARAM_INVALID, manager.GetInputOutputDescInfo(2, input_shape, output_shape));
@@ -404,7 +410,7 @@ TEST_F(UtestModelManagerModelManager, get_input_output_desc_info_fail) {
 // test GetInputOutputDescInfo fail
 TEST_F(UtestModelManagerModelManager, get_input_output_desc_info_zero_copy_fail) {
   ModelManager manager;
-  manager.model_map_[2] = nullptr;
+  SetNullModel(manager, 2);
   vector<InputOutputDescInfo> input_shape;
   vector<InputOutputDescInfo> output_shape;
   EXPECT_EQ(ge::PARAM_INVALID, manager.GetInputOutputDescInfoForZeroCopy(2, input_shape, output_shape));
@@ -413,7 +419,7 @@ TEST_F(UtestModelManagerModelManager, get_input_output_desc_info_zero_copy_fail)
 // test Stop
 TEST_F(UtestModelManagerModelManager, stop_fail) {
   ModelManager manager;
-  manager.model_map_[2] = nullptr;
+  SetNullModel(manager, 2);
   EXPECT_EQ(ge::PARAM_INVALID, manager.Stop(2));
 }
 
@@ -0,0 +1,132 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#define protected public
+#define private public
+#include "graph/load/new_model_manager/davinci_model.h"
+#include "graph/load/new_model_manager/model_manager.h"
+#undef private
+#undef protected
+
+using namespace std;
+using namespace testing;
+
+namespace ge {
+class UtestModelRegistry : public testing::Test {
+ protected:
+  void SetUp() {}
+
+  void TearDown() {}
+
+  static shared_ptr<DavinciModel> CreateModel(uint32_t id) {
+    auto davinci_model = std::make_shared<DavinciModel>(0, nullptr);
+    davinci_model->SetId(id);
+    return davinci_model;
+  }
+};
+
+TEST_F(UtestModelRegistry, insert_get_delete) {
+  ModelManager manager;
+  auto davinci_model = CreateModel(1);
+  manager.InsertModel(1, davinci_model);
+  EXPECT_EQ(manager.GetModel(1), davinci_model);
+  EXPECT_EQ(manager.GetModel(2), nullptr);
+
+  EXPECT_EQ(manager.DeleteModel(1), SUCCESS);
+  EXPECT_EQ(manager.GetModel(1), nullptr);
+  EXPECT_NE(manager.DeleteModel(1), SUCCESS);
+}
+
+TEST_F(UtestModelRegistry, snapshot_keeps_unloaded_model) {
+  ModelManager manager;
+  auto davinci_model = CreateModel(1);
+  manager.InsertModel(1, davinci_model);
+  auto snapshot = manager.GetModelMapSnapshot();
+  auto executing_model = manager.GetModel(1);
+  davinci_model.reset();
+
+  // an execution that already fetched the model keeps it until it returns
+  EXPECT_EQ(manager.DeleteModel(1), SUCCESS);
+  EXPECT_EQ(manager.GetModel(1), nullptr);
+  ASSERT_NE(executing_model, nullptr);
+  EXPECT_EQ(executing_model->Id(), 1);
+  // a published snapshot is never modified
+  ASSERT_EQ(snapshot->count(1), 1);
+  EXPECT_EQ(snapshot->at(1), executing_model);
+  EXPECT_TRUE(manager.GetModelMapSnapshot()->empty());
+}
+
+// reader threads look up all models while a writer keeps unloading and reloading one of them
+TEST_F(UtestModelRegistry, get_model_concurrent_with_load_unload) {
+  const uint32_t kThreadNum = 4;
+  const uint32_t kModelNum = 16;
+  const uint32_t kLookupPerThread = 20000;
+  const uint32_t kChurnModelId = 1;
+  ModelManager manager;
+  for (uint32_t id = 1; id <= kModelNum; ++id) {
+    auto davinci_model = CreateModel(id);
+    manager.InsertModel(id, davinci_model);
+  }
+
+  std::atomic<bool> stop(false);
+  std::atomic<uint32_t> reload_count(0);
+  std::thread writer([&]() {
+    do {
+      (void)manager.DeleteModel(kChurnModelId);
+      auto davinci_model = CreateModel(kChurnModelId);
+      manager.InsertModel(kChurnModelId, davinci_model);
+      reload_count++;
+    } while (!stop.load());
+  });
+
+  std::atomic<uint32_t> mismatch(0);
+  std::vector<std::thread> readers;
+  for (uint32_t i = 0; i < kThreadNum; ++i) {
+    readers.emplace_back([&, i]() {
+      for (uint32_t n = 0; n < kLookupPerThread; ++n) {
+        uint32_t id = (i + n) % kModelNum + 1;
+        auto davinci_model = manager.GetModel(id);
+        if (davinci_model == nullptr) {
+          // only the model being reloaded may be missing
+          if (id != kChurnModelId) {
+            mismatch++;
+          }
+          continue;
+        }
+        if (davinci_model->Id() != id) {
+          mismatch++;
+        }
+      }
+    });
+  }
+  for (auto &reader : readers) {
+    reader.join();
+  }
+  stop = true;
+  writer.join();
+
+  EXPECT_EQ(mismatch.load(), 0);
+  EXPECT_GT(reload_count.load(), 0);
+  EXPECT_NE(manager.GetModel(kChurnModelId), nullptr);
+  EXPECT_EQ(manager.GetModelMapSnapshot()->size(), kModelNum);
+}
+}  // namespace ge
@@ -0,0 +1,73 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "graph/load/new_model_manager/task_args_arena.h"
+
+using namespace ge;
+using namespace std;
+using namespace testing;
+
+class UtestTaskArgsArena : public testing::Test {
+ protected:
+  void SetUp() {}
+
+  void TearDown() {}
+};
+
+TEST_F(UtestTaskArgsArena, allocate_reserved_buffers) {
+  TaskArgsArena arena;
+  arena.Reserve(24);
+  arena.Reserve(100);
+  EXPECT_EQ(arena.Malloc(), SUCCESS);
+
+  uint8_t data[100] = {0};
+  void *first = arena.Allocate(data, 24);
+  void *second = arena.Allocate(data, 100);
+  ASSERT_NE(first, nullptr);
+  ASSERT_NE(second, nullptr);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(second) % 64, reinterpret_cast<uintptr_t>(first) % 64);
+  EXPECT_TRUE(arena.Contains(first));
+  EXPECT_TRUE(arena.Contains(second));
+  EXPECT_FALSE(arena.Contains(data));
+
+  // out of reserved space, left to the caller
+  EXPECT_EQ(arena.Allocate(data, 24), nullptr);
+  EXPECT_EQ(arena.Upload(), SUCCESS);
+  EXPECT_EQ(arena.GetStats().alloc_count, 2);
+  EXPECT_EQ(arena.GetStats().fallback_count, 1);
+}
+
+TEST_F(UtestTaskArgsArena, allocate_after_upload) {
+  TaskArgsArena arena;
+  arena.Reserve(8);
+  arena.Reserve(8);
+  EXPECT_EQ(arena.Malloc(), SUCCESS);
+  uint64_t value = 1;
+  EXPECT_NE(arena.Allocate(&value, sizeof(value)), nullptr);
+  EXPECT_EQ(arena.Upload(), SUCCESS);
+  EXPECT_EQ(arena.Allocate(&value, sizeof(value)), nullptr);
+}
+
+TEST_F(UtestTaskArgsArena, nothing_reserved) {
+  TaskArgsArena arena;
+  EXPECT_EQ(arena.Malloc(), SUCCESS);
+  uint64_t value = 1;
+  EXPECT_EQ(arena.Allocate(&value, sizeof(value)), nullptr);
+  EXPECT_FALSE(arena.Contains(&value));
+  EXPECT_EQ(arena.Upload(), SUCCESS);
+}
@@ -0,0 +1,116 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "graph/common/op_signature.h"
+
+#include "common/types.h"
+#include "graph/utils/attr_utils.h"
+
+using namespace ge;
+
+class UtestOpSignature : public testing::Test {
+ protected:
+  void SetUp() {}
+
+  void TearDown() {}
+};
+
+namespace {
+OpDescPtr CreateOpDesc(const std::string &name, const std::vector<int64_t> &dims) {
+  OpDescPtr op_desc = std::make_shared<OpDesc>(name, RELU);
+  GeTensorDesc tensor_desc(GeShape(dims), FORMAT_NCHW, DT_FLOAT);
+  op_desc->AddInputDesc(tensor_desc);
+  op_desc->AddOutputDesc(tensor_desc);
+  return op_desc;
+}
+}  // namespace
+
+TEST_F(UtestOpSignature, same_signature_for_clones) {
+  auto op_desc = CreateOpDesc("relu", {1, 3, 16, 16});
+  auto cloned_op_desc = CreateOpDesc("relu_batch_1", {1, 3, 16, 16});
+  (void)AttrUtils::SetStr(cloned_op_desc, "_batch_label", "Batch_1");
+
+  std::string signature;
+  std::string cloned_signature;
+  EXPECT_TRUE(OpSignature::Generate(op_desc, signature));
+  EXPECT_TRUE(OpSignature::Generate(cloned_op_desc, cloned_signature));
+  EXPECT_EQ(signature, cloned_signature);
+}
+
+TEST_F(UtestOpSignature, different_signature_for_content) {
+  auto op_desc = CreateOpDesc("relu", {1, 3, 16, 16});
+  auto other_shape_op_desc = CreateOpDesc("relu", {2, 3, 16, 16});
+  auto other_attr_op_desc = CreateOpDesc("relu", {1, 3, 16, 16});
+  (void)AttrUtils::SetInt(other_attr_op_desc, "axis", 1);
+
+  std::string signature;
+  std::string other_shape_signature;
+  std::string other_attr_signature;
+  EXPECT_TRUE(OpSignature::Generate(op_desc, signature));
+  EXPECT_TRUE(OpSignature::Generate(other_shape_op_desc, other_shape_signature));
+  EXPECT_TRUE(OpSignature::Generate(other_attr_op_desc, other_attr_signature));
+  EXPECT_NE(signature, other_shape_signature);
+  EXPECT_NE(signature, other_attr_signature);
+}
+
+TEST_F(UtestOpSignature, tensor_attr_not_keyed) {
+  auto op_desc = CreateOpDesc("relu", {1, 3, 16, 16});
+  (void)AttrUtils::SetTensor(op_desc, "value", GeTensor());
+
+  std::string signature;
+  EXPECT_FALSE(OpSignature::Generate(op_desc, signature));
+}
+
+TEST_F(UtestOpSignature, different_signature_for_origin_desc) {
+  auto op_desc = CreateOpDesc("relu", {1, 3, 16, 16});
+  auto other_format_op_desc = CreateOpDesc("relu", {1, 3, 16, 16});
+  other_format_op_desc->MutableInputDesc(0)->SetOriginFormat(FORMAT_NHWC);
+  auto other_shape_op_desc = CreateOpDesc("relu", {1, 3, 16, 16});
+  other_shape_op_desc->MutableOutputDesc(0)->SetOriginShape(GeShape({1, 16, 16, 3}));
+
+  std::string signature;
+  std::string other_format_signature;
+  std::string other_shape_signature;
+  EXPECT_TRUE(OpSignature::Generate(op_desc, signature));
+  EXPECT_TRUE(OpSignature::Generate(other_format_op_desc, other_format_signature));
+  EXPECT_TRUE(OpSignature::Generate(other_shape_op_desc, other_shape_signature));
+  EXPECT_NE(signature, other_format_signature);
+  EXPECT_NE(signature, other_shape_signature);
+}
+
+TEST_F(UtestOpSignature, tensor_signature_by_desc_and_data) {
+  std::vector<uint8_t> data{1, 2, 3, 4};
+  GeTensorDesc tensor_desc(GeShape({4}), FORMAT_ND, DT_UINT8);
+  GeTensor tensor(tensor_desc, data);
+  GeTensor same_tensor(tensor_desc, data);
+  GeTensor other_desc_tensor(GeTensorDesc(GeShape({2, 2}), FORMAT_ND, DT_UINT8), data);
+  data[3] = 5;
+  GeTensor other_data_tensor(tensor_desc, data);
+
+  std::string signature;
+  std::string same_signature;
+  std::string other_desc_signature;
+  std::string other_data_signature;
+  OpSignature::AppendTensor(signature, tensor);
+  OpSignature::AppendTensor(same_signature, same_tensor);
+  OpSignature::AppendTensor(other_desc_signature, other_desc_tensor);
+  OpSignature::AppendTensor(other_data_signature, other_data_tensor);
+  EXPECT_EQ(signature, same_signature);
+  EXPECT_NE(signature, other_desc_signature);
+  EXPECT_NE(signature, other_data_signature);
+}
@@ -0,0 +1,252 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "graph/debug/ge_attr_define.h"
+#include "graph/manager/graph_manager_utils.h"
+#include "graph/partition/optimized_partition_cache.h"
+#include "graph/passes/graph_builder_utils.h"
+#include "graph/utils/attr_utils.h"
+#include "graph/utils/graph_utils.h"
+
+#define protected public
+#define private public
+#include "graph/partition/graph_partition.h"
+#undef private
+#undef protected
+
+using namespace std;
+using namespace testing;
+
+namespace ge {
+namespace {
+const char *const kBuildContext = "ge.socVersion=Ascend910;";
+const float kWeight = 1.5f;
+
+// a graph cut into two partitions by the order of the partitions
+struct PartitionedGraph {
+  ComputeGraphPtr root_graph;
+  SubGraphInfoPtr producer;
+  SubGraphInfoPtr consumer;
+  NodePtr end;
+  NodePtr pld;
+};
+}  // namespace
+
+class UtestGraphPartition : public testing::Test {
+ protected:
+  void SetUp() {}
+  void TearDown() {}
+
+  ///   producer:                consumer:
+  ///   data  const              pld
+  ///    |                        |
+  ///   relu                    square
+  ///    |                        |
+  ///   end                     netoutput
+  ///
+  /// names and peer attrs of end and pld change with the order of partitions, weight is the value of const
+  static PartitionedGraph BuildPartitions(GraphPartitioner &partitioner, int64_t order, float weight = kWeight) {
+    PartitionedGraph partitioned_graph;
+    partitioned_graph.root_graph = std::make_shared<ComputeGraph>("root");
+
+    auto producer_builder = ut::GraphBuilder("partition" + std::to_string(order));
+    auto data = producer_builder.AddNode("data", "Data", 0, 1);
+    auto constant = producer_builder.AddNode("const", "Const", 0, 1);
+    GeTensorDesc weight_desc(GeShape({1}), FORMAT_ND, DT_FLOAT);
+    auto weight_tensor =
+      std::make_shared<GeTensor>(weight_desc, reinterpret_cast<const uint8_t *>(&weight), sizeof(weight));
+    (void)AttrUtils::SetTensor(constant->GetOpDesc(), ATTR_NAME_WEIGHTS, weight_tensor);
+    auto relu = producer_builder.AddNode("relu", "Relu", 1, 1);
+    auto end = producer_builder.AddNode("end_" + std::to_string(order), "End", 1, 0);
+    (void)AttrUtils::SetInt(end->GetOpDesc(), "peerIndex", order);
+    producer_builder.AddDataEdge(data, 0, relu, 0);
+    producer_builder.AddDataEdge(relu, 0, end, 0);
+
+    auto consumer_builder = ut::GraphBuilder("partition" + std::to_string(order + 1));
+    auto pld = consumer_builder.AddNode("pld_" + std::to_string(order), "PlaceHolder", 0, 1);
+    (void)AttrUtils::SetInt(pld->GetOpDesc(), "peerIndex", order);
+    (void)AttrUtils::SetStr(pld->GetOpDesc(), "_peerNodeName", end->GetName());
+    auto square = consumer_builder.AddNode("square", "Square", 1, 1);
+    auto netoutput = consumer_builder.AddNode("netoutput", "NetOutput", 1, 0);
+    consumer_builder.AddDataEdge(pld, 0, square, 0);
+    consumer_builder.AddDataEdge(square, 0, netoutput, 0);
+
+    auto &graph_info = partitioner.graph_2_graph_partition_info_[partitioned_graph.root_graph];
+    graph_info.end_2_pld_[end] = pld;
+    graph_info.pld_2_end_[pld] = end;
+    graph_info.index_2_end_[order] = end;
+    graph_info.rank_2_partitions_ = {producer_builder.GetGraph(), consumer_builder.GetGraph()};
+    graph_info.partitions_2_rank_[producer_builder.GetGraph()] = 0;
+    graph_info.partitions_2_rank_[consumer_builder.GetGraph()] = 1;
+
+    partitioned_graph.producer = std::make_shared<SubGraphInfo>();
+    partitioned_graph.producer->SetSubGraph(producer_builder.GetGraph());
+    partitioned_graph.producer->SetEngineName("AIcoreEngine");
+    partitioned_graph.consumer = std::make_shared<SubGraphInfo>();
+    partitioned_graph.consumer->SetSubGraph(consumer_builder.GetGraph());
+    partitioned_graph.consumer->SetEngineName("VectorEngine");
+    partitioner.graph_2_subgraph_list_[partitioned_graph.root_graph] = {partitioned_graph.producer,
+                                                                       partitioned_graph.consumer};
+    partitioner.graph_info_ = graph_info;
+    for (auto &sub_graph_info : partitioner.graph_2_subgraph_list_[partitioned_graph.root_graph]) {
+      partitioner.AddEndPldInformationToSubGraphInfo(sub_graph_info);
+    }
+    partitioned_graph.end = end;
+    partitioned_graph.pld = pld;
+    return partitioned_graph;
+  }
+
+  static std::string GetFingerprint(GraphPartitioner &partitioner, const PartitionedGraph &partitioned_graph,
+                                    const SubGraphInfoPtr &sub_graph_info,
+                                    std::map<std::string, std::string> &cut_edge_names) {
+    std::string fingerprint;
+    EXPECT_EQ(partitioner.GetPartitionFingerprint(partitioned_graph.root_graph, sub_graph_info, kBuildContext,
+                                                  fingerprint, cut_edge_names),
+              SUCCESS);
+    return fingerprint;
+  }
+};
+
+TEST_F(UtestGraphPartition, fingerprint_stable_across_rebuilds) {
+  GraphPartitioner partitioner;
+  auto partitioned_graph = BuildPartitions(partitioner, 0);
+  std::map<std::string, std::string> cut_edge_names;
+  std::string producer_fingerprint = GetFingerprint(partitioner, partitioned_graph, partitioned_graph.producer,
+                                                    cut_edge_names);
+  std::string consumer_fingerprint = GetFingerprint(partitioner, partitioned_graph, partitioned_graph.consumer,
+                                                    cut_edge_names);
+  EXPECT_NE(producer_fingerprint, consumer_fingerprint);
+  EXPECT_EQ(cut_edge_names["end_0"], "relu:0->square:0");
+  EXPECT_EQ(cut_edge_names["pld_0"], "relu:0->square:0");
+
+  // the rebuilt graph has another order of partitions
+  GraphPartitioner rebuild_partitioner;
+  auto rebuilt_graph = BuildPartitions(rebuild_partitioner, 3);
+  std::map<std::string, std::string> rebuilt_cut_edge_names;
+  EXPECT_EQ(GetFingerprint(rebuild_partitioner, rebuilt_graph, rebuilt_graph.producer, rebuilt_cut_edge_names),
+            producer_fingerprint);
+  EXPECT_EQ(GetFingerprint(rebuild_partitioner, rebuilt_graph, rebuilt_graph.consumer, rebuilt_cut_edge_names),
+            consumer_fingerprint);
+  EXPECT_EQ(rebuilt_cut_edge_names["pld_3"], "relu:0->square:0");
+}
+
+TEST_F(UtestGraphPartition, fingerprint_covers_attrs_and_weights) {
+  GraphPartitioner partitioner;
+  auto partitioned_graph = BuildPartitions(partitioner, 0);
+  std::map<std::string, std::string> cut_edge_names;
+  std::string producer_fingerprint = GetFingerprint(partitioner, partitioned_graph, partitioned_graph.producer,
+                                                    cut_edge_names);
+  std::string consumer_fingerprint = GetFingerprint(partitioner, partitioned_graph, partitioned_graph.consumer,
+                                                    cut_edge_names);
+
+  GraphPartitioner weight_partitioner;
+  auto weight_changed = BuildPartitions(weight_partitioner, 0, -kWeight);
+  EXPECT_NE(GetFingerprint(weight_partitioner, weight_changed, weight_changed.producer, cut_edge_names),
+            producer_fingerprint);
+
+  auto square = partitioned_graph.consumer->GetSubGraph()->FindNode("square");
+  ASSERT_NE(square, nullptr);
+  (void)AttrUtils::SetInt(square->GetOpDesc(), "alpha", 1);
+  EXPECT_NE(GetFingerprint(partitioner, partitioned_graph, partitioned_graph.consumer, cut_edge_names),
+            consumer_fingerprint);
+}
+
+TEST_F(UtestGraphPartition, fingerprint_keeps_digest_of_weights) {
+  GraphPartitioner partitioner;
+  auto partitioned_graph = BuildPartitions(partitioner, 0);
+  std::map<std::string, std::string> cut_edge_names;
+  std::string fingerprint = GetFingerprint(partitioner, partitioned_graph, partitioned_graph.producer,
+                                           cut_edge_names);
+
+  auto constant = partitioned_graph.producer->GetSubGraph()->FindNode("const");
+  ASSERT_NE(constant, nullptr);
+  const size_t weight_num = 1024 * 1024;
+  GeTensorDesc weight_desc(GeShape({static_cast<int64_t>(weight_num)}), FORMAT_ND, DT_FLOAT);
+  std::vector<float> weights(weight_num, kWeight);
+  auto weight_tensor = std::make_shared<GeTensor>(weight_desc, reinterpret_cast<const uint8_t *>(weights.data()),
+                                                  weight_num * sizeof(float));
+  (void)AttrUtils::SetTensor(constant->GetOpDesc(), ATTR_NAME_WEIGHTS, weight_tensor);
+  std::string large_fingerprint = GetFingerprint(partitioner, partitioned_graph, partitioned_graph.producer,
+                                                 cut_edge_names);
+  EXPECT_NE(large_fingerprint, fingerprint);
+  EXPECT_LT(large_fingerprint.size(), weight_num);
+}
+
+TEST_F(UtestGraphPartition, replace_partition_relinks_end_and_pld) {
+  OptimizedPartitionCache cache(1);
+  GraphPartitioner partitioner;
+  auto partitioned_graph = BuildPartitions(partitioner, 0);
+  std::map<std::string, std::string> cut_edge_names;
+  std::string fingerprint = GetFingerprint(partitioner, partitioned_graph, partitioned_graph.consumer,
+                                           cut_edge_names);
+  EXPECT_EQ(cache.Save(fingerprint, partitioned_graph.consumer->GetSubGraph(), cut_edge_names), SUCCESS);
+
+  GraphPartitioner rebuild_partitioner;
+  auto rebuilt_graph = BuildPartitions(rebuild_partitioner, 3);
+  const ComputeGraphPtr rebuilt_consumer = rebuilt_graph.consumer->GetSubGraph();
+  std::map<std::string, std::string> rebuilt_cut_edge_names;
+  ComputeGraphPtr optimized_graph = nullptr;
+  ASSERT_TRUE(cache.Find(GetFingerprint(rebuild_partitioner, rebuilt_graph, rebuilt_graph.consumer,
+                                        rebuilt_cut_edge_names),
+                         rebuilt_consumer, optimized_graph, cut_edge_names));
+  ASSERT_EQ(rebuild_partitioner.ReplacePartition(rebuilt_graph.root_graph, rebuilt_graph.consumer, optimized_graph,
+                                                 cut_edge_names),
+            SUCCESS);
+
+  // the placeholder of the copy takes the name and peer of the current one
+  EXPECT_EQ(rebuilt_graph.consumer->GetSubGraph(), optimized_graph);
+  EXPECT_EQ(optimized_graph->GetName(), rebuilt_consumer->GetName());
+  auto new_pld = optimized_graph->FindNode("pld_3");
+  ASSERT_NE(new_pld, nullptr);
+  EXPECT_NE(new_pld, rebuilt_graph.pld);
+  int64_t peer_index = 0;
+  EXPECT_TRUE(AttrUtils::GetInt(new_pld->GetOpDesc(), "peerIndex", peer_index));
+  EXPECT_EQ(peer_index, 3);
+
+  auto &graph_info = rebuild_partitioner.graph_2_graph_partition_info_[rebuilt_graph.root_graph];
+  EXPECT_EQ(graph_info.end_2_pld_[rebuilt_graph.end], new_pld);
+  EXPECT_EQ(graph_info.pld_2_end_.count(rebuilt_graph.pld), 0);
+  EXPECT_EQ(graph_info.pld_2_end_[new_pld], rebuilt_graph.end);
+  EXPECT_EQ(graph_info.partitions_2_rank_.count(rebuilt_consumer), 0);
+  EXPECT_EQ(graph_info.partitions_2_rank_[optimized_graph], 1);
+  EXPECT_EQ(graph_info.rank_2_partitions_[1], optimized_graph);
+  EXPECT_EQ(rebuilt_graph.producer->GetEnd2PldMap().at(rebuilt_graph.end), new_pld);
+  EXPECT_EQ(rebuilt_graph.consumer->GetPld2EndMap().at(new_pld), rebuilt_graph.end);
+}
+
+TEST_F(UtestGraphPartition, replace_partition_refuses_other_cut_edges) {
+  GraphPartitioner partitioner;
+  auto partitioned_graph = BuildPartitions(partitioner, 0);
+  const ComputeGraphPtr consumer = partitioned_graph.consumer->GetSubGraph();
+  std::vector<NodePtr> input_nodes;
+  std::vector<NodePtr> output_nodes;
+  ComputeGraphPtr optimized_graph = GraphUtils::CloneGraph(consumer, "", input_nodes, output_nodes);
+  ASSERT_NE(optimized_graph, nullptr);
+
+  std::map<std::string, std::string> cut_edge_names = {{"pld_0", "data:0->square:0"}};
+  EXPECT_NE(partitioner.ReplacePartition(partitioned_graph.root_graph, partitioned_graph.consumer, optimized_graph,
+                                         cut_edge_names),
+            SUCCESS);
+  EXPECT_EQ(partitioned_graph.consumer->GetSubGraph(), consumer);
+  auto &graph_info = partitioner.graph_2_graph_partition_info_[partitioned_graph.root_graph];
+  EXPECT_EQ(graph_info.end_2_pld_[partitioned_graph.end], partitioned_graph.pld);
+}
+}  // namespace ge
@@ -0,0 +1,130 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "graph/debug/ge_attr_define.h"
+#include "graph/partition/optimized_partition_cache.h"
+#include "graph/passes/graph_builder_utils.h"
+#include "graph/utils/attr_utils.h"
+
+namespace ge {
+class UtestOptimizedPartitionCache : public testing::Test {
+ protected:
+  void SetUp() {}
+  void TearDown() {}
+};
+
+namespace {
+const float kWeight = 1.5f;
+
+///   end1
+///    |
+///   relu1     const1
+///    |
+///   pld1
+///
+/// const1 is only added with a weight
+ComputeGraphPtr BuildPartition(const std::string &name, float weight = 0) {
+  auto builder = ut::GraphBuilder(name);
+  auto pld1 = builder.AddNode("pld1", "PlaceHolder", 0, 1);
+  auto relu1 = builder.AddNode("relu1", "Relu", 1, 1);
+  auto end1 = builder.AddNode("end1", "End", 1, 0);
+  builder.AddDataEdge(pld1, 0, relu1, 0);
+  builder.AddDataEdge(relu1, 0, end1, 0);
+  if (weight != 0) {
+    auto const1 = builder.AddNode("const1", "Const", 0, 1);
+    GeTensorDesc weight_desc(GeShape({1}), FORMAT_ND, DT_FLOAT);
+    auto weight_tensor =
+      std::make_shared<GeTensor>(weight_desc, reinterpret_cast<const uint8_t *>(&weight), sizeof(weight));
+    (void)AttrUtils::SetTensor(const1->GetOpDesc(), ATTR_NAME_WEIGHTS, weight_tensor);
+  }
+  return builder.GetGraph();
+}
+}  // namespace
+
+TEST_F(UtestOptimizedPartitionCache, find_returns_copy) {
+  OptimizedPartitionCache cache(2);
+  auto partition = BuildPartition("partition1");
+  std::map<std::string, std::string> cut_edge_names = {{"pld1", "data:0->relu1:0"}, {"end1", "relu1:0->out:0"}};
+  EXPECT_EQ(cache.Save("partition1", partition, cut_edge_names), SUCCESS);
+
+  ComputeGraphPtr found = nullptr;
+  std::map<std::string, std::string> found_cut_edge_names;
+  EXPECT_FALSE(cache.Find("partition2", partition, found, found_cut_edge_names));
+  EXPECT_TRUE(cache.Find("partition1", partition, found, found_cut_edge_names));
+  ASSERT_NE(found, nullptr);
+  EXPECT_NE(found, partition);
+  EXPECT_EQ(found->GetDirectNodesSize(), partition->GetDirectNodesSize());
+  EXPECT_EQ(found_cut_edge_names, cut_edge_names);
+
+  // the cached partition is not changed by the users of its copies
+  found->FindNode("relu1")->GetOpDesc()->SetName("relu2");
+  ComputeGraphPtr found_again = nullptr;
+  EXPECT_TRUE(cache.Find("partition1", partition, found_again, found_cut_edge_names));
+  EXPECT_NE(found_again->FindNode("relu1"), nullptr);
+}
+
+TEST_F(UtestOptimizedPartitionCache, evict_least_recently_used) {
+  OptimizedPartitionCache cache(2);
+  auto partition = BuildPartition("partition");
+  std::map<std::string, std::string> cut_edge_names;
+  EXPECT_EQ(cache.Save("partition1", BuildPartition("partition1"), cut_edge_names), SUCCESS);
+  EXPECT_EQ(cache.Save("partition2", BuildPartition("partition2"), cut_edge_names), SUCCESS);
+
+  ComputeGraphPtr found = nullptr;
+  EXPECT_TRUE(cache.Find("partition1", partition, found, cut_edge_names));
+  EXPECT_EQ(cache.Save("partition3", BuildPartition("partition3"), cut_edge_names), SUCCESS);
+  EXPECT_EQ(cache.Size(), 2);
+  EXPECT_TRUE(cache.Find("partition1", partition, found, cut_edge_names));
+  EXPECT_FALSE(cache.Find("partition2", partition, found, cut_edge_names));
+  EXPECT_TRUE(cache.Find("partition3", partition, found, cut_edge_names));
+
+  cache.Clear();
+  EXPECT_EQ(cache.Size(), 0);
+  EXPECT_FALSE(cache.Find("partition1", partition, found, cut_edge_names));
+}
+
+TEST_F(UtestOptimizedPartitionCache, find_compares_whole_fingerprint) {
+  OptimizedPartitionCache cache(2);
+  std::map<std::string, std::string> cut_edge_names;
+  std::string fingerprint = "AIcoreEngine\nrelu1";
+  auto partition = BuildPartition("partition1");
+  EXPECT_EQ(cache.Save(fingerprint, partition, cut_edge_names), SUCCESS);
+
+  ComputeGraphPtr found = nullptr;
+  EXPECT_FALSE(cache.Find(fingerprint + "\nweights 4", partition, found, cut_edge_names));
+  EXPECT_FALSE(cache.Find(fingerprint.substr(0, fingerprint.size() - 1), partition, found, cut_edge_names));
+  EXPECT_TRUE(cache.Find(fingerprint, partition, found, cut_edge_names));
+}
+
+TEST_F(UtestOptimizedPartitionCache, find_confirms_weights) {
+  OptimizedPartitionCache cache(2);
+  std::map<std::string, std::string> cut_edge_names;
+  auto partition = BuildPartition("partition1", kWeight);
+  EXPECT_EQ(cache.Save("partition1", partition, cut_edge_names), SUCCESS);
+
+  // same fingerprint, other weights
+  ComputeGraphPtr found = nullptr;
+  EXPECT_FALSE(cache.Find("partition1", BuildPartition("partition1", -kWeight), found, cut_edge_names));
+  EXPECT_TRUE(cache.Find("partition1", BuildPartition("partition1", kWeight), found, cut_edge_names));
+
+  // a const node dropped by the optimizing leaves the weights to the fingerprint
+  auto optimized = BuildPartition("partition2");
+  EXPECT_EQ(cache.Save("partition2", optimized, cut_edge_names), SUCCESS);
+  EXPECT_TRUE(cache.Find("partition2", BuildPartition("partition2", kWeight), found, cut_edge_names));
+}
+}  // namespace ge
@@ -16,6 +16,7 @@
 
 #include "graph/passes/constant_folding_pass.h"
 
+#include <cstring>
 #include <string>
 #include <vector>
 #include <gtest/gtest.h>
@@ -23,6 +24,7 @@
 #include "common/types.h"
 #include "ge/common/ge/ge_util.h"
 #include "graph/passes/base_pass.h"
+#include "graph/passes/constant_folding_cache.h"
 #include "graph/passes/dimension_compute_pass.h"
 #include "graph_builder_utils.h"
 #include "inc/kernel.h"
@@ -527,6 +529,43 @@ ComputeGraphPtr BuildWrongGraph6() {
   builder.AddDataEdge(op, 0, conv, 0);
   return builder.GetGraph();
 }
+
+///     netoutput1
+///      /      \
+///  shapeNo1  shapeNo2
+///     |        |
+///  addYes1     |
+///     |  \     |
+///     |  const3
+///   addnYes1 --+
+///    /    \
+///  /       \
+/// const1   const2
+ComputeGraphPtr BuildGraph11() {
+  auto builder = ut::GraphBuilder("test");
+  auto const1 = builder.AddNode("const1", CONSTANT, 0, 1);
+  auto const2 = builder.AddNode("const2", CONSTANT, 0, 1);
+  auto const3 = builder.AddNode("const3", CONSTANT, 0, 1);
+  auto addn1 = builder.AddNode("addn1", AddNYes, 2, 1);
+  auto add1 = builder.AddNode("add1", AddYes, 2, 1);
+  auto shape1 = builder.AddNode("shape1", ShapeNo, 1, 1);
+  auto shape2 = builder.AddNode("shape2", ShapeNo, 1, 1);
+  std::vector<uint8_t> weight_data{1, 2, 3};
+  GeTensorDesc weight_desc(GeShape({3}), FORMAT_ND, DT_UINT8);
+  OpDescUtils::SetWeights(const3, {std::make_shared<GeTensor>(weight_desc, weight_data)});
+  auto netoutput1 = builder.AddNode("netoutput", NETOUTPUT, 2, 0);
+
+  builder.AddDataEdge(const1, 0, addn1, 0);
+  builder.AddDataEdge(const2, 0, addn1, 1);
+  builder.AddDataEdge(addn1, 0, add1, 0);
+  builder.AddDataEdge(const3, 0, add1, 1);
+  builder.AddDataEdge(add1, 0, shape1, 0);
+  builder.AddDataEdge(addn1, 0, shape2, 0);
+  builder.AddDataEdge(shape1, 0, netoutput1, 0);
+  builder.AddDataEdge(shape2, 0, netoutput1, 1);
+
+  return builder.GetGraph();
+}
 }  // namespace
 
 TEST_F(UtestGraphPassesConstantFoldingPass, folding_addn) {
@@ -774,4 +813,90 @@ TEST_F(UtestGraphPassesConstantFoldingPass, unlikely6) {
     delete name_to_pass.second;
   }
 }
+
+TEST_F(UtestGraphPassesConstantFoldingPass, fold_constant_region) {
+  auto graph = BuildGraph11();
+  NamesToPass names_to_pass;
+  names_to_pass.push_back({"Test", new ConstantFoldingPass});
+
+  GEPass pass(graph);
+  EXPECT_EQ(pass.Run(names_to_pass), SUCCESS);
+  // addn1 and add1 are folded together, only the results consumed by shape1 and shape2 become consts
+  EXPECT_EQ(graph->GetAllNodes().size(), 5);
+  EXPECT_EQ(graph->FindNode("addn1"), nullptr);
+  EXPECT_EQ(graph->FindNode("add1"), nullptr);
+
+  auto shape1 = graph->FindNode("shape1");
+  EXPECT_NE(shape1, nullptr);
+  EXPECT_EQ(shape1->GetInDataNodes().size(), 1);
+  EXPECT_EQ(shape1->GetInDataNodes().at(0)->GetType(), CONSTANT);
+  auto shape2 = graph->FindNode("shape2");
+  EXPECT_NE(shape2, nullptr);
+  EXPECT_EQ(shape2->GetInDataNodes().size(), 1);
+  auto folded_const = shape2->GetInDataNodes().at(0);
+  EXPECT_EQ(folded_const->GetType(), CONSTANT);
+  EXPECT_EQ(folded_const->GetOpDesc()->GetOutputDesc(0).GetShape().GetDims(), std::vector<int64_t>({3}));
+
+  for (auto &name_to_pass : names_to_pass) {
+    delete name_to_pass.second;
+  }
+}
+
+TEST_F(UtestGraphPassesConstantFoldingPass, folding_cache_key_by_content) {
+  std::vector<uint8_t> data{1, 2, 3, 4};
+  GeTensorDesc tensor_desc(GeShape({4}), FORMAT_ND, DT_UINT8);
+  ConstGeTensorPtr input = std::make_shared<GeTensor>(tensor_desc, data);
+  ConstGeTensorPtr input_copy = std::make_shared<GeTensor>(tensor_desc, data);
+  data[3] = 5;
+  ConstGeTensorPtr other_input = std::make_shared<GeTensor>(tensor_desc, data);
+
+  auto op_desc1 = std::make_shared<OpDesc>("add_batch_0", AddNYes);
+  auto op_desc2 = std::make_shared<OpDesc>("add_batch_1", AddNYes);
+  for (auto &op_desc : {op_desc1, op_desc2}) {
+    op_desc->AddInputDesc(tensor_desc);
+    op_desc->AddOutputDesc(tensor_desc);
+    AttrUtils::SetInt(op_desc, "N", 1);
+    AttrUtils::SetStr(op_desc, "_origin_name", op_desc->GetName());
+  }
+
+  std::string key1;
+  std::string key2;
+  std::string key3;
+  EXPECT_TRUE(ConstantFoldingCache::GenerateKey(op_desc1, {input}, key1));
+  EXPECT_TRUE(ConstantFoldingCache::GenerateKey(op_desc2, {input_copy}, key2));
+  EXPECT_TRUE(ConstantFoldingCache::GenerateKey(op_desc2, {other_input}, key3));
+  EXPECT_EQ(key1, key2);
+  EXPECT_NE(key1, key3);
+
+  AttrUtils::SetInt(op_desc2, "N", 2);
+  EXPECT_TRUE(ConstantFoldingCache::GenerateKey(op_desc2, {input_copy}, key2));
+  EXPECT_NE(key1, key2);
+
+  const uint64_t session_id = 1024;
+  auto output = std::make_shared<GeTensor>(tensor_desc, data);
+  std::vector<GeTensorPtr> outputs;
+  EXPECT_FALSE(ConstantFoldingCache::Instance().Find(session_id, key1, outputs));
+  ConstantFoldingCache::Instance().Add(session_id, key1, {output});
+  EXPECT_TRUE(ConstantFoldingCache::Instance().Find(session_id, key1, outputs));
+  ASSERT_EQ(outputs.size(), 1);
+  EXPECT_NE(outputs[0], output);
+  EXPECT_EQ(outputs[0]->GetData().size(), data.size());
+  EXPECT_EQ(memcmp(outputs[0]->GetData().data(), data.data(), data.size()), 0);
+
+  // a hit hands out copies, modifying one does not change the cache
+  outputs[0]->MutableData().data()[0] = 9;
+  std::vector<GeTensorPtr> outputs_again;
+  EXPECT_TRUE(ConstantFoldingCache::Instance().Find(session_id, key1, outputs_again));
+  ASSERT_EQ(outputs_again.size(), 1);
+  EXPECT_EQ(outputs_again[0]->GetData().data()[0], data[0]);
+
+  // inputs of other content have another digest in the key
+  std::vector<GeTensorPtr> other_outputs;
+  EXPECT_FALSE(ConstantFoldingCache::Instance().Find(session_id, key3, other_outputs));
+  EXPECT_TRUE(other_outputs.empty());
+
+  EXPECT_FALSE(ConstantFoldingCache::Instance().Find(session_id + 1, key1, outputs));
+  ConstantFoldingCache::Instance().RemoveSession(session_id);
+  EXPECT_FALSE(ConstantFoldingCache::Instance().Find(session_id, key1, outputs));
+}
 }  // namespace ge
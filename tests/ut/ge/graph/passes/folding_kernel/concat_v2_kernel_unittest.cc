@@ -288,3 +288,49 @@ TEST_F(UtestGraphPassesFoldingKernelConcatV2Kernel, CheckNotChange) {
   status = kernel->Compute(op_desc_ptr, input_not_support, outputs);
   EXPECT_EQ(status, NOT_CHANGED);
 }
+
+TEST_F(UtestGraphPassesFoldingKernelConcatV2Kernel, CheckInt32LargeSuccess) {
+  OpDescPtr op_desc_ptr = std::make_shared<OpDesc>("ConcatV2", "ConcatV2");
+  AttrUtils::SetInt(op_desc_ptr, ATTR_NAME_T, (int64_t)DT_INT32);
+
+  vector<int64_t> dims_vec_0 = {1024, 100};
+  vector<int32_t> data_vec_0(1024 * 100);
+  for (size_t i = 0; i < data_vec_0.size(); i++) {
+    data_vec_0[i] = static_cast<int32_t>(i);
+  }
+  GeTensorDesc tensor_desc_0(GeShape(dims_vec_0), FORMAT_NCHW, DT_INT32);
+  ConstGeTensorPtr tensor_0 =
+      std::make_shared<GeTensor>(tensor_desc_0, (uint8_t *)data_vec_0.data(), data_vec_0.size() * sizeof(int32_t));
+
+  vector<int64_t> dims_vec_1 = {1024, 28};
+  vector<int32_t> data_vec_1(1024 * 28);
+  for (size_t i = 0; i < data_vec_1.size(); i++) {
+    data_vec_1[i] = -static_cast<int32_t>(i);
+  }
+  GeTensorDesc tensor_desc_1(GeShape(dims_vec_1), FORMAT_NCHW, DT_INT32);
+  ConstGeTensorPtr tensor_1 =
+      std::make_shared<GeTensor>(tensor_desc_1, (uint8_t *)data_vec_1.data(), data_vec_1.size() * sizeof(int32_t));
+
+  vector<int64_t> dims_vec_2 = {1};
+  vector<int32_t> data_vec_2 = {1};
+  GeTensorDesc tensor_desc_2(GeShape(dims_vec_2), FORMAT_NCHW, DT_INT32);
+  ConstGeTensorPtr tensor_2 =
+      std::make_shared<GeTensor>(tensor_desc_2, (uint8_t *)data_vec_2.data(), data_vec_2.size() * sizeof(int32_t));
+
+  vector<ConstGeTensorPtr> input = {tensor_0, tensor_1, tensor_2};
+  vector<GeTensorPtr> outputs;
+
+  shared_ptr<ge::Kernel> kernel = ge::KernelFactory::Instance().Create(CONCATV2);
+  Status status = kernel->Compute(op_desc_ptr, input, outputs);
+  EXPECT_EQ(status, SUCCESS);
+
+  GeTensorPtr out = outputs[0];
+  EXPECT_EQ(out->GetData().size(), 1024 * 128 * sizeof(int32_t));
+  int32_t *out_data = (int32_t *)out->GetData().data();
+  for (int64_t i = 0; i < 1024; i++) {
+    for (int64_t j = 0; j < 128; j++) {
+      int32_t expect = j < 100 ? data_vec_0[i * 100 + j] : data_vec_1[i * 28 + j - 100];
+      ASSERT_EQ(out_data[i * 128 + j], expect);
+    }
+  }
+}
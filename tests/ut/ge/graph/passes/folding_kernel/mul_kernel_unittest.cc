@@ -226,3 +226,69 @@ TEST_F(UtestGraphPassesFoldingKernelMulKernel, MulOptimizerErrtypeFail) {
   status = kernel->Compute(op_desc_ptr, input_other3, outputs);
   EXPECT_EQ(status, NOT_CHANGED);
 }
+
+TEST_F(UtestGraphPassesFoldingKernelMulKernel, Int32LargeBroadcastSuccess) {
+  OpDescPtr op_desc_ptr = std::make_shared<OpDesc>("Mul", "Mul");
+
+  vector<int64_t> dims_vec_0 = {64, 1, 32};
+  vector<int32_t> data_vec_0(64 * 32);
+  for (size_t i = 0; i < data_vec_0.size(); i++) {
+    data_vec_0[i] = static_cast<int32_t>(i % 97) - 48;
+  }
+  GeTensorDesc tensor_desc_0(GeShape(dims_vec_0), FORMAT_NCHW, DT_INT32);
+  ConstGeTensorPtr tensor_0 =
+      std::make_shared<GeTensor>(tensor_desc_0, (uint8_t *)data_vec_0.data(), data_vec_0.size() * sizeof(int32_t));
+
+  vector<int64_t> dims_vec_1 = {256, 1};
+  vector<int32_t> data_vec_1(256);
+  for (size_t i = 0; i < data_vec_1.size(); i++) {
+    data_vec_1[i] = static_cast<int32_t>(i % 13) - 6;
+  }
+  GeTensorDesc tensor_desc_1(GeShape(dims_vec_1), FORMAT_NCHW, DT_INT32);
+  ConstGeTensorPtr tensor_1 =
+      std::make_shared<GeTensor>(tensor_desc_1, (uint8_t *)data_vec_1.data(), data_vec_1.size() * sizeof(int32_t));
+
+  vector<ConstGeTensorPtr> input = {tensor_0, tensor_1};
+  vector<GeTensorPtr> outputs;
+
+  shared_ptr<Kernel> kernel = KernelFactory::Instance().Create(MUL);
+  Status status = kernel->Compute(op_desc_ptr, input, outputs);
+
+  EXPECT_EQ(SUCCESS, status);
+  EXPECT_EQ(outputs[0]->GetData().size(), 64 * 256 * 32 * sizeof(int32_t));
+  int32_t *out_data = (int32_t *)outputs[0]->GetData().data();
+  for (int64_t i = 0; i < 64; i++) {
+    for (int64_t j = 0; j < 256; j++) {
+      for (int64_t k = 0; k < 32; k++) {
+        ASSERT_EQ(out_data[(i * 256 + j) * 32 + k], data_vec_0[i * 32 + k] * data_vec_1[j]);
+      }
+    }
+  }
+}
+
+TEST_F(UtestGraphPassesFoldingKernelMulKernel, Int32LargeBroadcastOverflow) {
+  OpDescPtr op_desc_ptr = std::make_shared<OpDesc>("Mul", "Mul");
+
+  vector<int64_t> dims_vec_0 = {64, 1, 32};
+  vector<int32_t> data_vec_0(64 * 32, 2);
+  // overflows in the middle of the broadcast, the parallel blocks after it must not be computed on
+  data_vec_0[40 * 32 + 7] = INT32_MAX;
+  GeTensorDesc tensor_desc_0(GeShape(dims_vec_0), FORMAT_NCHW, DT_INT32);
+  ConstGeTensorPtr tensor_0 =
+      std::make_shared<GeTensor>(tensor_desc_0, (uint8_t *)data_vec_0.data(), data_vec_0.size() * sizeof(int32_t));
+
+  vector<int64_t> dims_vec_1 = {256, 1};
+  vector<int32_t> data_vec_1(256, 3);
+  GeTensorDesc tensor_desc_1(GeShape(dims_vec_1), FORMAT_NCHW, DT_INT32);
+  ConstGeTensorPtr tensor_1 =
+      std::make_shared<GeTensor>(tensor_desc_1, (uint8_t *)data_vec_1.data(), data_vec_1.size() * sizeof(int32_t));
+
+  vector<ConstGeTensorPtr> input = {tensor_0, tensor_1};
+  vector<GeTensorPtr> outputs;
+
+  shared_ptr<Kernel> kernel = KernelFactory::Instance().Create(MUL);
+  Status status = kernel->Compute(op_desc_ptr, input, outputs);
+
+  EXPECT_EQ(NOT_CHANGED, status);
+  EXPECT_TRUE(outputs.empty());
+}
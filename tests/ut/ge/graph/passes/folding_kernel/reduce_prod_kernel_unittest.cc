@@ -193,3 +193,41 @@ TEST_F(UtestGraphPassesFoldingKernelReduceProdKernel, OverflowDataNotChanged) {
 
   EXPECT_EQ(NOT_CHANGED, status);
 }
+
+TEST_F(UtestGraphPassesFoldingKernelReduceProdKernel, Int32LargeSuccess) {
+  OpDescPtr op_desc_ptr = std::make_shared<OpDesc>("ReduceProd", REDUCEPROD);
+
+  vector<int64_t> dims_vec_0 = {128, 3, 1024};
+  vector<int32_t> data_vec_0(128 * 3 * 1024);
+  for (size_t i = 0; i < data_vec_0.size(); i++) {
+    data_vec_0[i] = static_cast<int32_t>(i % 11) - 5;
+  }
+  GeTensorDesc tensor_desc_0(GeShape(dims_vec_0), FORMAT_NCHW, DT_INT32);
+  ConstGeTensorPtr tensor_0 =
+      std::make_shared<GeTensor>(tensor_desc_0, (uint8_t *)data_vec_0.data(), data_vec_0.size() * sizeof(int32_t));
+
+  vector<int64_t> dims_vec_1 = {1};
+  vector<int32_t> data_vec_1 = {1};
+  GeTensorDesc tensor_desc_1(GeShape(dims_vec_1), FORMAT_NCHW, DT_INT32);
+  ConstGeTensorPtr tensor_1 =
+      std::make_shared<GeTensor>(tensor_desc_1, (uint8_t *)data_vec_1.data(), data_vec_1.size() * sizeof(int32_t));
+
+  vector<ConstGeTensorPtr> input = {tensor_0, tensor_1};
+  vector<GeTensorPtr> outputs;
+
+  shared_ptr<Kernel> kernel = KernelFactory::Instance().Create(REDUCEPROD);
+  Status status = kernel->Compute(op_desc_ptr, input, outputs);
+
+  EXPECT_EQ(SUCCESS, status);
+  EXPECT_EQ(outputs[0]->GetData().size(), 128 * 1024 * sizeof(int32_t));
+  int32_t *out_data = (int32_t *)outputs[0]->GetData().data();
+  for (int64_t i = 0; i < 128; i++) {
+    for (int64_t j = 0; j < 1024; j++) {
+      int32_t expect = 1;
+      for (int64_t k = 0; k < 3; k++) {
+        expect *= data_vec_0[(i * 3 + k) * 1024 + j];
+      }
+      ASSERT_EQ(out_data[i * 1024 + j], expect);
+    }
+  }
+}
@@ -0,0 +1,259 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <map>
+#include <vector>
+
+#include "common/types.h"
+#include "graph/compute_graph.h"
+#include "graph/debug/ge_attr_define.h"
+#include "graph/manager/graph_mem_allocator.h"
+#include "graph/manager/graph_var_manager.h"
+#include "graph/manager/trans_var_data_utils.h"
+#include "graph/utils/attr_utils.h"
+#include "graph/utils/tensor_utils.h"
+#include "rt_call_recorder.h"
+
+namespace ge {
+namespace {
+const uint64_t kSessionId = 3001;
+const uint32_t kGraphId = 1;
+const int64_t kVarElementNum = 16 * 16;
+// fp16 of 1.0, 1.5, 2.0 and -2.0
+const std::vector<float> kFp32Values = {1.0f, 1.5f, 2.0f, -2.0f};
+const std::vector<uint16_t> kFp16Values = {0x3C00, 0x3E00, 0x4000, 0xC000};
+}  // namespace
+
+class UtestTransVarDataUtils : public testing::Test {
+ protected:
+  void SetUp() {
+    MemManager::Instance().Initialize(std::vector<rtMemType_t>({RT_MEMORY_HBM}));
+    VarManager::Instance(kSessionId)->Init(0, kSessionId, 0, 0);
+  }
+  void TearDown() {
+    VarManagerPool::Instance().RemoveVarManager(kSessionId);
+    MemManager::Instance().Finalize();
+  }
+
+  NodePtr AddVar(const ComputeGraphPtr &graph, const std::string &name, DataType data_type) {
+    GeTensorDesc tensor_desc(GeShape({16, 16}), FORMAT_NCHW, data_type);
+    TensorUtils::SetSize(tensor_desc, 16 * 16 * GetSizeByDataType(data_type));
+    auto op_desc = std::make_shared<OpDesc>(name, VARIABLE);
+    op_desc->AddOutputDesc(tensor_desc);
+    EXPECT_EQ(VarManager::Instance(kSessionId)->AssignVarMem(name, tensor_desc, RT_MEMORY_HBM), SUCCESS);
+    return graph->AddNode(op_desc);
+  }
+
+  // the var is changed to fp16 by a cast when it is allocated in kGraphId, and is transformed in kGraphId + 1
+  void SetCastRoad(const NodePtr &var, const std::string &node_type) {
+    GeTensorDesc input_desc = var->GetOpDesc()->GetOutputDesc(0);
+    GeTensorDesc output_desc(GeShape({16, 16}), FORMAT_NCHW, DT_FLOAT16);
+    TensorUtils::SetSize(output_desc, kVarElementNum * sizeof(uint16_t));
+    ASSERT_EQ(VarManager::Instance(kSessionId)->AssignVarMem(var->GetName(), output_desc, RT_MEMORY_HBM), SUCCESS);
+    VarTransRoad trans_road = {{node_type, input_desc, output_desc}};
+    ASSERT_EQ(VarManager::Instance(kSessionId)->SetTransRoad(var->GetName(), trans_road), SUCCESS);
+    ASSERT_EQ(VarManager::Instance(kSessionId)->SetAllocatedGraphId(var->GetName(), kGraphId), SUCCESS);
+    ASSERT_EQ(VarManager::Instance(kSessionId)->SetChangedGraphId(var->GetName(), kGraphId + 1), SUCCESS);
+  }
+
+  static uint8_t *GetVarMem(const std::string &var_name, const GeTensorDesc &tensor_desc) {
+    uint8_t *var_logic = nullptr;
+    EXPECT_EQ(VarManager::Instance(kSessionId)->GetVarAddr(var_name, tensor_desc, &var_logic), SUCCESS);
+    return VarManager::Instance(kSessionId)->GetVarMemoryAddr(var_logic, RT_MEMORY_HBM);
+  }
+
+  static void FillVar(const NodePtr &var, float value) {
+    auto var_mem = reinterpret_cast<float *>(GetVarMem(var->GetName(), var->GetOpDesc()->GetOutputDesc(0)));
+    ASSERT_NE(var_mem, nullptr);
+    for (int64_t i = 0; i < kVarElementNum; ++i) {
+      var_mem[i] = value;
+    }
+  }
+
+  static void CheckFp16Var(const NodePtr &var, uint16_t value) {
+    GeTensorDesc fp16_desc(GeShape({16, 16}), FORMAT_NCHW, DT_FLOAT16);
+    auto var_mem = reinterpret_cast<const uint16_t *>(GetVarMem(var->GetName(), fp16_desc));
+    ASSERT_NE(var_mem, nullptr);
+    for (int64_t i = 0; i < kVarElementNum; ++i) {
+      ASSERT_EQ(var_mem[i], value) << "var " << var->GetName() << " index " << i;
+    }
+  }
+
+  static bool HasChangedGraphId(const NodePtr &var) {
+    uint32_t graph_id = 0;
+    return VarManager::Instance(kSessionId)->GetChangedGraphId(var->GetName(), graph_id) == SUCCESS;
+  }
+
+  // the stubbed device memory is host memory, let the runtime copy it so that the transformed bytes can be checked
+  static void StartRecording() {
+    RtCallRecorder::Instance().SetMemcpyEnabled(true);
+    RtCallRecorder::Instance().Start(false);
+  }
+
+  static std::map<std::string, uint64_t> StopRecording() {
+    auto call_counts = RtCallRecorder::Instance().GetCallCounts();
+    RtCallRecorder::Instance().Stop();
+    RtCallRecorder::Instance().SetMemcpyEnabled(false);
+    return call_counts;
+  }
+};
+
+TEST_F(UtestTransVarDataUtils, copy_var_data) {
+  auto graph = std::make_shared<ComputeGraph>("graph");
+  auto var_src = AddVar(graph, "var_fp32", DT_FLOAT);
+  // same layout is copied on device, the other one is transformed on host
+  auto var_same = AddVar(graph, "var_fp32_copy", DT_FLOAT);
+  auto var_fp16 = AddVar(graph, "var_fp16", DT_FLOAT16);
+  (void)AttrUtils::SetStr(var_same->GetOpDesc(), "_copy_from_var_node", var_src->GetName());
+  (void)AttrUtils::SetStr(var_fp16->GetOpDesc(), "_copy_from_var_node", var_src->GetName());
+  ASSERT_EQ(VarManager::Instance(kSessionId)->MallocVarMemory(1024 * 1024), SUCCESS);
+
+  EXPECT_EQ(TransVarDataUtils::CopyVarData(graph, kSessionId, 0), SUCCESS);
+  bool copy_value = false;
+  EXPECT_TRUE(AttrUtils::GetBool(var_same->GetOpDesc(), "_copy_value", copy_value));
+  EXPECT_TRUE(copy_value);
+  copy_value = false;
+  EXPECT_TRUE(AttrUtils::GetBool(var_fp16->GetOpDesc(), "_copy_value", copy_value));
+  EXPECT_TRUE(copy_value);
+  EXPECT_FALSE(AttrUtils::HasAttr(var_src->GetOpDesc(), "_copy_value"));
+}
+
+TEST_F(UtestTransVarDataUtils, copy_var_data_without_var_memory) {
+  auto graph = std::make_shared<ComputeGraph>("graph");
+  auto var_src = AddVar(graph, "var_fp32", DT_FLOAT);
+  auto var_dst = AddVar(graph, "var_fp16", DT_FLOAT16);
+  (void)AttrUtils::SetStr(var_dst->GetOpDesc(), "_copy_from_var_node", var_src->GetName());
+
+  EXPECT_NE(TransVarDataUtils::CopyVarData(graph, kSessionId, 0), SUCCESS);
+  EXPECT_FALSE(AttrUtils::HasAttr(var_dst->GetOpDesc(), "_copy_value"));
+  EXPECT_NE(TransVarDataUtils::CopyVarData(nullptr, kSessionId, 0), SUCCESS);
+}
+
+TEST_F(UtestTransVarDataUtils, trans_all_var_data_without_changed_var) {
+  auto graph = std::make_shared<ComputeGraph>("graph");
+  auto var = AddVar(graph, "var", DT_FLOAT);
+  ASSERT_EQ(VarManager::Instance(kSessionId)->SetAllocatedGraphId(var->GetName(), kGraphId), SUCCESS);
+  ASSERT_EQ(VarManager::Instance(kSessionId)->MallocVarMemory(1024 * 1024), SUCCESS);
+
+  rtContext_t context = nullptr;
+  (void)rtCtxGetCurrent(&context);
+  EXPECT_EQ(TransVarDataUtils::TransAllVarData({var}, kSessionId, context, kGraphId), SUCCESS);
+}
+
+TEST_F(UtestTransVarDataUtils, trans_all_var_data_with_trans_road) {
+  auto graph = std::make_shared<ComputeGraph>("graph");
+  auto var = AddVar(graph, "var", DT_FLOAT);
+  SetCastRoad(var, CAST);
+  ASSERT_EQ(VarManager::Instance(kSessionId)->MallocVarMemory(1024 * 1024), SUCCESS);
+  FillVar(var, kFp32Values[1]);
+
+  rtContext_t context = nullptr;
+  (void)rtCtxGetCurrent(&context);
+  // not changed in the graph allocating it
+  EXPECT_EQ(TransVarDataUtils::TransAllVarData({var}, kSessionId, context, kGraphId), SUCCESS);
+  EXPECT_TRUE(HasChangedGraphId(var));
+
+  StartRecording();
+  EXPECT_EQ(TransVarDataUtils::TransAllVarData({var}, kSessionId, context, kGraphId + 1), SUCCESS);
+  auto call_counts = StopRecording();
+  CheckFp16Var(var, kFp16Values[1]);
+  // transformed once only
+  EXPECT_FALSE(HasChangedGraphId(var));
+  // the host transform starts when the event recorded after the copy to host is done
+  EXPECT_EQ(call_counts["rtEventCreate"], 1);
+  EXPECT_EQ(call_counts["rtEventRecord"], 1);
+  EXPECT_EQ(call_counts["rtEventSynchronize"], 1);
+  EXPECT_EQ(call_counts["rtEventDestroy"], 1);
+  EXPECT_EQ(call_counts["rtMallocHost"], 1);
+  EXPECT_EQ(call_counts["rtFreeHost"], 1);
+}
+
+TEST_F(UtestTransVarDataUtils, trans_all_var_data_shares_staging_buffers) {
+  auto graph = std::make_shared<ComputeGraph>("graph");
+  std::vector<NodePtr> vars;
+  for (size_t i = 0; i < kFp32Values.size(); ++i) {
+    vars.emplace_back(AddVar(graph, "var" + std::to_string(i), DT_FLOAT));
+    SetCastRoad(vars.back(), CAST);
+  }
+  ASSERT_EQ(VarManager::Instance(kSessionId)->MallocVarMemory(1024 * 1024), SUCCESS);
+  for (size_t i = 0; i < vars.size(); ++i) {
+    FillVar(vars[i], kFp32Values[i]);
+  }
+
+  rtContext_t context = nullptr;
+  (void)rtCtxGetCurrent(&context);
+  StartRecording();
+  EXPECT_EQ(TransVarDataUtils::TransAllVarData(vars, kSessionId, context, kGraphId + 1, 1), SUCCESS);
+  auto call_counts = StopRecording();
+  for (size_t i = 0; i < vars.size(); ++i) {
+    CheckFp16Var(vars[i], kFp16Values[i]);
+    EXPECT_FALSE(HasChangedGraphId(vars[i]));
+  }
+  // a buffer released by a finished transform is taken by the next variable, all of them are freed at the end
+  EXPECT_EQ(call_counts["rtEventCreate"], vars.size());
+  EXPECT_EQ(call_counts["rtEventDestroy"], vars.size());
+  EXPECT_GE(call_counts["rtMallocHost"], 1);
+  EXPECT_LE(call_counts["rtMallocHost"], vars.size());
+  EXPECT_EQ(call_counts["rtFreeHost"], call_counts["rtMallocHost"]);
+}
+
+TEST_F(UtestTransVarDataUtils, trans_all_var_data_with_unsupported_trans_road) {
+  auto graph = std::make_shared<ComputeGraph>("graph");
+  auto var_cast = AddVar(graph, "var_cast", DT_FLOAT);
+  auto var_unsupported = AddVar(graph, "var_unsupported", DT_FLOAT);
+  SetCastRoad(var_cast, CAST);
+  SetCastRoad(var_unsupported, "NoSuchTransNode");
+  ASSERT_EQ(VarManager::Instance(kSessionId)->MallocVarMemory(1024 * 1024), SUCCESS);
+
+  rtContext_t context = nullptr;
+  (void)rtCtxGetCurrent(&context);
+  RtCallRecorder::Instance().Start(false);
+  EXPECT_EQ(TransVarDataUtils::TransAllVarData({var_cast, var_unsupported}, kSessionId, context, kGraphId + 1),
+            UNSUPPORTED);
+  auto call_counts = RtCallRecorder::Instance().GetCallCounts();
+  RtCallRecorder::Instance().Stop();
+  // nothing is marked as done, the transform is retried by the next load
+  EXPECT_TRUE(HasChangedGraphId(var_cast));
+  EXPECT_TRUE(HasChangedGraphId(var_unsupported));
+  // events and staging buffers of the failed pipeline are released
+  EXPECT_EQ(call_counts["rtEventCreate"], 2);
+  EXPECT_EQ(call_counts["rtEventDestroy"], 2);
+  EXPECT_EQ(call_counts["rtFreeHost"], call_counts["rtMallocHost"]);
+}
+
+TEST_F(UtestTransVarDataUtils, trans_all_var_data_without_var_memory) {
+  auto graph = std::make_shared<ComputeGraph>("graph");
+  auto var = AddVar(graph, "var", DT_FLOAT);
+  SetCastRoad(var, CAST);
+  rtContext_t context = nullptr;
+  (void)rtCtxGetCurrent(&context);
+  EXPECT_EQ(TransVarDataUtils::TransAllVarData({var}, kSessionId, context, kGraphId + 1), INTERNAL_ERROR);
+  EXPECT_TRUE(HasChangedGraphId(var));
+
+  // a var allocated without the memory of the end of its road
+  auto var_not_assigned = AddVar(graph, "var_not_assigned", DT_FLOAT);
+  VarTransRoad trans_road = {{CAST, var_not_assigned->GetOpDesc()->GetOutputDesc(0),
+                              GeTensorDesc(GeShape({16, 16}), FORMAT_NCHW, DT_FLOAT16)}};
+  ASSERT_EQ(VarManager::Instance(kSessionId)->SetTransRoad(var_not_assigned->GetName(), trans_road), SUCCESS);
+  ASSERT_EQ(VarManager::Instance(kSessionId)->SetAllocatedGraphId(var_not_assigned->GetName(), kGraphId), SUCCESS);
+  ASSERT_EQ(VarManager::Instance(kSessionId)->SetChangedGraphId(var_not_assigned->GetName(), kGraphId + 1), SUCCESS);
+  ASSERT_EQ(VarManager::Instance(kSessionId)->MallocVarMemory(1024 * 1024), SUCCESS);
+  EXPECT_EQ(TransVarDataUtils::TransAllVarData({var_not_assigned}, kSessionId, context, kGraphId + 1),
+            INTERNAL_ERROR);
+  EXPECT_TRUE(HasChangedGraphId(var_not_assigned));
+}
+}  // namespace ge
@@ -0,0 +1,170 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <sys/stat.h>
+#include <cstdio>
+
+#include "graph/manager/var_checkpoint_engine.h"
+#include "graph/utils/tensor_utils.h"
+#include "rt_call_recorder.h"
+
+namespace ge {
+class UtestVarCheckpointEngine : public testing::Test {
+ protected:
+  // the stubbed device memory is host memory, let the runtime copy it so that the saved bytes can be checked
+  void SetUp() { RtCallRecorder::Instance().SetMemcpyEnabled(true); }
+  void TearDown() {
+    RtCallRecorder::Instance().SetMemcpyEnabled(false);
+    for (const auto &file : files_) {
+      (void)std::remove(file.c_str());
+    }
+  }
+
+  VarCheckpointItem CreateVar(const std::string &name, const std::vector<int64_t> &dims, uint8_t *addr) {
+    VarCheckpointItem var;
+    var.var_name = name;
+    var.tensor_desc = GeTensorDesc(GeShape(dims), FORMAT_NCHW, DT_FLOAT);
+    var.addr = addr;
+    var.size = static_cast<uint64_t>(GeShape(dims).GetShapeSize()) * sizeof(float);
+    return var;
+  }
+
+  static void FillVarMem(std::vector<uint8_t> &var_mem, uint8_t seed) {
+    for (size_t i = 0; i < var_mem.size(); ++i) {
+      var_mem[i] = static_cast<uint8_t>(i * 7 + seed);
+    }
+  }
+
+  static std::vector<uint8_t> GetVarData(const VarCheckpointItem &var) {
+    return std::vector<uint8_t>(var.addr, var.addr + var.size);
+  }
+
+  static int64_t GetFileSize(const std::string &file) {
+    struct stat file_stat;
+    return stat(file.c_str(), &file_stat) == 0 ? file_stat.st_size : -1;
+  }
+
+  std::vector<std::string> files_;
+};
+
+TEST_F(UtestVarCheckpointEngine, save_and_read) {
+  std::vector<uint8_t> var_mem(1024 * sizeof(float));
+  FillVarMem(var_mem, 1);
+  std::vector<VarCheckpointItem> vars;
+  vars.emplace_back(CreateVar("var1", {2, 16}, var_mem.data()));
+  vars.emplace_back(CreateVar("var2", {4, 8, 8}, var_mem.data() + 32 * sizeof(float)));
+  files_ = {"ut_var_checkpoint_full", "ut_var_checkpoint_full.tmp"};
+
+  VarCheckpointEngine engine(0);
+  EXPECT_EQ(engine.Save(files_[0], vars, false), SUCCESS);
+  EXPECT_EQ(engine.Wait(), SUCCESS);
+
+  GeTensorDesc tensor_desc;
+  std::vector<uint8_t> data;
+  EXPECT_EQ(VarCheckpointEngine::ReadVar(files_[0], "var2", tensor_desc, data), SUCCESS);
+  EXPECT_EQ(tensor_desc.GetShape().GetDims(), std::vector<int64_t>({4, 8, 8}));
+  EXPECT_EQ(tensor_desc.GetFormat(), FORMAT_NCHW);
+  EXPECT_EQ(tensor_desc.GetDataType(), DT_FLOAT);
+  EXPECT_EQ(data, GetVarData(vars[1]));
+  EXPECT_EQ(VarCheckpointEngine::ReadVar(files_[0], "var1", tensor_desc, data), SUCCESS);
+  EXPECT_EQ(data, GetVarData(vars[0]));
+  EXPECT_NE(VarCheckpointEngine::ReadVar(files_[0], "var3", tensor_desc, data), SUCCESS);
+  EXPECT_NE(VarCheckpointEngine::ReadVar("ut_var_checkpoint_not_exist", "var1", tensor_desc, data), SUCCESS);
+}
+
+TEST_F(UtestVarCheckpointEngine, incremental_save_refers_to_last_checkpoint) {
+  std::vector<uint8_t> var_mem(1024 * sizeof(float));
+  FillVarMem(var_mem, 1);
+  std::vector<VarCheckpointItem> vars;
+  vars.emplace_back(CreateVar("var1", {2, 16}, var_mem.data()));
+  vars.emplace_back(CreateVar("var2", {4, 8, 8}, var_mem.data() + 32 * sizeof(float)));
+  files_ = {"ut_var_checkpoint_base", "ut_var_checkpoint_delta1", "ut_var_checkpoint_delta2"};
+
+  VarCheckpointEngine engine(0);
+  EXPECT_EQ(engine.Save(files_[0], vars, true), SUCCESS);
+  std::vector<uint8_t> var2_base = GetVarData(vars[1]);
+  // the second one is taken while the first one may still be in writing
+  EXPECT_EQ(engine.Save(files_[1], vars, true), SUCCESS);
+  // only var1 is changed before the third one
+  for (uint64_t i = 0; i < vars[0].size; ++i) {
+    var_mem[i] = static_cast<uint8_t>(var_mem[i] + 1);
+  }
+  EXPECT_EQ(engine.Save(files_[2], vars, true), SUCCESS);
+  EXPECT_EQ(engine.Wait(), SUCCESS);
+
+  // nothing changed, data of variables are left in the base file
+  EXPECT_LT(GetFileSize(files_[1]), GetFileSize(files_[0]));
+  EXPECT_GT(GetFileSize(files_[2]), GetFileSize(files_[1]));
+
+  GeTensorDesc tensor_desc;
+  std::vector<uint8_t> data;
+  EXPECT_EQ(VarCheckpointEngine::ReadVar(files_[1], "var1", tensor_desc, data), SUCCESS);
+  EXPECT_EQ(tensor_desc.GetShape().GetDims(), std::vector<int64_t>({2, 16}));
+  EXPECT_EQ(data.size(), vars[0].size);
+  EXPECT_NE(data, GetVarData(vars[0]));
+  EXPECT_EQ(VarCheckpointEngine::ReadVar(files_[2], "var1", tensor_desc, data), SUCCESS);
+  EXPECT_EQ(data, GetVarData(vars[0]));
+  EXPECT_EQ(VarCheckpointEngine::ReadVar(files_[2], "var2", tensor_desc, data), SUCCESS);
+  EXPECT_EQ(data, var2_base);
+}
+
+TEST_F(UtestVarCheckpointEngine, incremental_save_to_same_path_writes_all) {
+  std::vector<uint8_t> var_mem(1024 * sizeof(float));
+  FillVarMem(var_mem, 1);
+  std::vector<VarCheckpointItem> vars;
+  vars.emplace_back(CreateVar("var1", {2, 16}, var_mem.data()));
+  vars.emplace_back(CreateVar("var2", {4, 8, 8}, var_mem.data() + 32 * sizeof(float)));
+  files_ = {"ut_var_checkpoint_same", "ut_var_checkpoint_same_delta"};
+
+  VarCheckpointEngine engine(0);
+  EXPECT_EQ(engine.Save(files_[0], vars, true), SUCCESS);
+  EXPECT_EQ(engine.Save(files_[0], vars, true), SUCCESS);
+  EXPECT_EQ(engine.Wait(), SUCCESS);
+  GeTensorDesc tensor_desc;
+  std::vector<uint8_t> data;
+  EXPECT_EQ(VarCheckpointEngine::ReadVar(files_[0], "var2", tensor_desc, data), SUCCESS);
+  EXPECT_EQ(data, GetVarData(vars[1]));
+
+  // replacing the base of the last checkpoint writes all variables too
+  EXPECT_EQ(engine.Save(files_[1], vars, true), SUCCESS);
+  EXPECT_EQ(engine.Save(files_[0], vars, true), SUCCESS);
+  EXPECT_EQ(engine.Wait(), SUCCESS);
+  EXPECT_EQ(VarCheckpointEngine::ReadVar(files_[0], "var1", tensor_desc, data), SUCCESS);
+  EXPECT_EQ(data, GetVarData(vars[0]));
+  EXPECT_EQ(VarCheckpointEngine::ReadVar(files_[1], "var1", tensor_desc, data), SUCCESS);
+  EXPECT_EQ(data, GetVarData(vars[0]));
+}
+
+TEST_F(UtestVarCheckpointEngine, read_var_detects_cycle_of_base_files) {
+  std::vector<uint8_t> var_mem(32 * sizeof(float));
+  FillVarMem(var_mem, 1);
+  std::vector<VarCheckpointItem> vars;
+  vars.emplace_back(CreateVar("var1", {2, 16}, var_mem.data()));
+  files_ = {"ut_var_checkpoint_cycle", "ut_var_checkpoint_cycle_delta"};
+
+  VarCheckpointEngine engine(0);
+  EXPECT_EQ(engine.Save(files_[0], vars, true), SUCCESS);
+  EXPECT_EQ(engine.Save(files_[1], vars, true), SUCCESS);
+  EXPECT_EQ(engine.Wait(), SUCCESS);
+  // the delta refers to the file it replaces
+  ASSERT_EQ(std::rename(files_[1].c_str(), files_[0].c_str()), 0);
+  GeTensorDesc tensor_desc;
+  std::vector<uint8_t> data;
+  EXPECT_EQ(VarCheckpointEngine::ReadVar(files_[0], "var1", tensor_desc, data), FAILED);
+}
+}  // namespace ge
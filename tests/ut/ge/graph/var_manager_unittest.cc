@@ -0,0 +1,167 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "graph/manager/graph_var_manager.h"
+#include "graph/utils/tensor_utils.h"
+
+namespace ge {
+namespace {
+const uint64_t kSessionId = 2001;
+const uint64_t kConcurrentSessionId = 2002;
+
+GeTensorDesc CreateVarDesc(Format format) {
+  GeTensorDesc tensor_desc(GeShape({16, 16}), format, DT_FLOAT);
+  TensorUtils::SetSize(tensor_desc, 16 * 16 * sizeof(float));
+  return tensor_desc;
+}
+}  // namespace
+
+class UtestVarManager : public testing::Test {
+ protected:
+  void SetUp() {}
+  void TearDown() {
+    VarManagerPool::Instance().RemoveVarManager(kSessionId);
+    VarManagerPool::Instance().RemoveVarManager(kConcurrentSessionId);
+  }
+};
+
+TEST_F(UtestVarManager, lookup_by_var_id) {
+  auto var_manager = VarManager::Instance(kSessionId);
+  ASSERT_NE(var_manager, nullptr);
+  ASSERT_EQ(var_manager->Init(0, kSessionId, 0, 0), SUCCESS);
+  auto tensor_desc = CreateVarDesc(FORMAT_NCHW);
+  // more than one batch of names, so that lookups go through both the published and the recent ones
+  const int var_num = 200;
+  for (int i = 0; i < var_num; ++i) {
+    ASSERT_EQ(var_manager->AssignVarMem("var_" + std::to_string(i), tensor_desc, RT_MEMORY_HBM), SUCCESS);
+  }
+
+  for (int i = 0; i < var_num; ++i) {
+    std::string var_name = "var_" + std::to_string(i);
+    VarId var_id = var_manager->GetVarId(var_name);
+    EXPECT_EQ(var_id, static_cast<VarId>(i));
+    uint8_t *addr_by_name = nullptr;
+    uint8_t *addr_by_id = nullptr;
+    rtMemType_t memory_type = RT_MEMORY_DDR;
+    EXPECT_EQ(var_manager->GetVarAddr(var_name, tensor_desc, &addr_by_name), SUCCESS);
+    EXPECT_EQ(var_manager->GetVarAddr(var_id, tensor_desc, &addr_by_id, memory_type), SUCCESS);
+    EXPECT_EQ(addr_by_name, addr_by_id);
+    EXPECT_EQ(memory_type, RT_MEMORY_HBM);
+    EXPECT_TRUE(var_manager->IsVarExist(var_name));
+    EXPECT_TRUE(var_manager->IsVarExist(var_name, tensor_desc));
+    EXPECT_FALSE(var_manager->IsVarExist(var_name, CreateVarDesc(FORMAT_NHWC)));
+  }
+  EXPECT_EQ(var_manager->GetVarId("var_not_exist"), kInvalidVarId);
+  EXPECT_FALSE(var_manager->IsVarExist("var_not_exist"));
+  uint8_t *addr = nullptr;
+  rtMemType_t memory_type = RT_MEMORY_HBM;
+  EXPECT_NE(var_manager->GetVarAddr(kInvalidVarId, tensor_desc, &addr, memory_type), SUCCESS);
+}
+
+TEST_F(UtestVarManager, renew_cur_var_desc_moves_addr) {
+  auto var_manager = VarManager::Instance(kSessionId);
+  ASSERT_NE(var_manager, nullptr);
+  ASSERT_EQ(var_manager->Init(0, kSessionId, 0, 0), SUCCESS);
+  auto nchw_desc = CreateVarDesc(FORMAT_NCHW);
+  ASSERT_EQ(var_manager->AssignVarMem("var", nchw_desc, RT_MEMORY_HBM), SUCCESS);
+  uint8_t *nchw_addr = nullptr;
+  ASSERT_EQ(var_manager->GetVarAddr("var", nchw_desc, &nchw_addr), SUCCESS);
+
+  auto op_desc = std::make_shared<OpDesc>("var", "Variable");
+  auto nhwc_desc = CreateVarDesc(FORMAT_NHWC);
+  op_desc->AddOutputDesc(nhwc_desc);
+  EXPECT_EQ(var_manager->RenewCurVarDesc("var", op_desc), SUCCESS);
+
+  GeTensorDesc cur_desc;
+  EXPECT_EQ(var_manager->GetCurVarDesc("var", cur_desc), SUCCESS);
+  EXPECT_EQ(cur_desc.GetFormat(), FORMAT_NHWC);
+  uint8_t *nhwc_addr = nullptr;
+  EXPECT_EQ(var_manager->GetVarAddr("var", nhwc_desc, &nhwc_addr), SUCCESS);
+  EXPECT_EQ(nhwc_addr, nchw_addr);
+  EXPECT_FALSE(var_manager->IsVarExist("var", nchw_desc));
+
+  std::unordered_map<std::string, VarAddrMgr> var_addr_mgr_map;
+  var_manager->GetAllVarAddrMgr(var_addr_mgr_map);
+  EXPECT_EQ(var_addr_mgr_map.size(), 1);
+}
+
+// lookups without lock from several threads while new variables are assigned and the session is inited again
+TEST_F(UtestVarManager, lookup_concurrent_with_assign_and_init) {
+  auto var_manager = VarManager::Instance(kConcurrentSessionId);
+  ASSERT_NE(var_manager, nullptr);
+  ASSERT_EQ(var_manager->Init(0, kConcurrentSessionId, 0, 0), SUCCESS);
+  auto tensor_desc = CreateVarDesc(FORMAT_NCHW);
+  const int var_num = 256;
+  std::vector<std::string> var_names;
+  for (int i = 0; i < var_num; ++i) {
+    var_names.emplace_back("var_" + std::to_string(i));
+    ASSERT_EQ(var_manager->AssignVarMem(var_names.back(), tensor_desc, RT_MEMORY_HBM), SUCCESS);
+  }
+
+  const int thread_num = 4;
+  const int round_num = 16;
+  std::atomic<int> failed_num(0);
+  std::atomic<bool> stop_assign(false);
+  std::thread writer([&]() {
+    for (int i = 0; !stop_assign; ++i) {
+      (void)var_manager->AssignVarMem("new_var_" + std::to_string(i), tensor_desc, RT_MEMORY_HBM);
+    }
+  });
+  std::vector<std::thread> readers;
+  for (int t = 0; t < thread_num; ++t) {
+    readers.emplace_back([&]() {
+      for (int round = 0; round < round_num; ++round) {
+        for (int i = 0; i < var_num; ++i) {
+          uint8_t *addr = nullptr;
+          if ((var_manager->GetVarAddr(var_names[i], tensor_desc, &addr) != SUCCESS) || (addr == nullptr)) {
+            ++failed_num;
+          }
+        }
+      }
+    });
+  }
+  for (auto &reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(failed_num, 0);
+
+  // readers of the resource replaced by Init do not crash, they find the variables assigned again or nothing
+  std::atomic<bool> stop_init(false);
+  std::thread reader([&]() {
+    while (!stop_init) {
+      uint8_t *addr = nullptr;
+      if ((var_manager->GetVarAddr(var_names[0], tensor_desc, &addr) == SUCCESS) && (addr == nullptr)) {
+        ++failed_num;
+      }
+    }
+  });
+  for (int i = 0; i < round_num; ++i) {
+    ASSERT_EQ(var_manager->Init(0, kConcurrentSessionId, 0, 0), SUCCESS);
+  }
+  stop_init = true;
+  reader.join();
+  stop_assign = true;
+  writer.join();
+  EXPECT_EQ(failed_num, 0);
+  EXPECT_FALSE(var_manager->IsVarExist(var_names[0]));
+}
+}  // namespace ge
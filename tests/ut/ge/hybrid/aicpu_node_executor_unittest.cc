@@ -0,0 +1,138 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "graph/compute_graph.h"
+#include "graph/manager/graph_mem_allocator.h"
+#include "graph/utils/tensor_utils.h"
+
+#define protected public
+#define private public
+#include "hybrid/executor/hybrid_execution_context.h"
+#include "hybrid/node_executor/aicpu/aicpu_node_executor.h"
+#include "hybrid/node_executor/task_context.h"
+#undef private
+#undef protected
+
+using namespace std;
+using namespace testing;
+
+namespace ge {
+namespace hybrid {
+namespace {
+const int64_t kMaxElementNum = 8;
+// int32 data of at most 8 elements and one dim of shape
+const uint64_t kDataBound = kMaxElementNum * sizeof(int32_t);
+const uint64_t kShapeBound = sizeof(int64_t);
+}  // namespace
+
+class UtestAicpuNodeExecutor : public testing::Test {
+ protected:
+  void SetUp() { MemManager::Instance().Initialize(std::vector<rtMemType_t>({RT_MEMORY_HBM})); }
+
+  void TearDown() {
+    task_.reset();
+    node_item_.reset();
+    MemManager::Instance().Finalize();
+  }
+
+  void CreateTask(int64_t range_min, int64_t range_max) {
+    GeTensorDesc tensor_desc(GeShape({-1}), FORMAT_ND, DT_INT32);
+    tensor_desc.SetShapeRange({{range_min, range_max}});
+    auto op_desc = std::make_shared<OpDesc>("unique", "Unique");
+    op_desc->AddOutputDesc("y", tensor_desc);
+    auto node = graph_->AddNode(op_desc);
+    node_item_.reset(new NodeItem(node));
+    ASSERT_EQ(node_item_->Init(), SUCCESS);
+    node_item_->is_dynamic = true;
+    node_item_->shape_inference_type = DEPEND_COMPUTE;
+    task_.reset(new AicpuTfNodeTask(node_item_.get(), task_def_));
+  }
+
+  // outputs are allocated by the bound and the summary reports the given sizes after compute
+  void PrepareBoundedOutputs(uint64_t raw_data_size, uint64_t shape_data_size) {
+    task_->output_data_bounds_ = {kDataBound};
+    task_->output_shape_bounds_ = {kShapeBound};
+    task_->output_summary_.resize(1);
+    ASSERT_EQ(AicpuNodeTaskBase::AllocTensorBuffer(sizeof(aicpu::FWKAdapter::ResultSummary),
+                                                   task_->output_summary_[0]),
+              SUCCESS);
+    task_->bounded_out_shape_hbm_.resize(1);
+    ASSERT_EQ(AicpuNodeTaskBase::AllocTensorBuffer(kShapeBound, task_->bounded_out_shape_hbm_[0]), SUCCESS);
+    task_->output_summary_host_.resize(1);
+    task_->output_summary_host_[0].raw_data_size = raw_data_size;
+    task_->output_summary_host_[0].shape_data_size = shape_data_size;
+    task_->use_bounded_outputs_ = true;
+  }
+
+  ComputeGraphPtr graph_ = std::make_shared<ComputeGraph>("test");
+  domi::TaskDef task_def_;
+  GraphExecutionContext execution_context_;
+  std::unique_ptr<NodeItem> node_item_;
+  std::unique_ptr<AicpuTfNodeTask> task_;
+};
+
+TEST_F(UtestAicpuNodeExecutor, output_bound_from_shape_range) {
+  CreateTask(kMaxElementNum, kMaxElementNum);
+  uint64_t data_bound = 0;
+  uint64_t shape_bound = 0;
+  EXPECT_TRUE(task_->GetOutputBound(0, data_bound, shape_bound));
+  EXPECT_EQ(data_bound, kDataBound);
+  EXPECT_EQ(shape_bound, kShapeBound);
+}
+
+TEST_F(UtestAicpuNodeExecutor, no_output_bound_if_unlimited_or_smaller_than_bound) {
+  uint64_t data_bound = 0;
+  uint64_t shape_bound = 0;
+  CreateTask(1, -1);
+  EXPECT_FALSE(task_->GetOutputBound(0, data_bound, shape_bound));
+  CreateTask(0, kMaxElementNum);
+  EXPECT_FALSE(task_->GetOutputBound(0, data_bound, shape_bound));
+  // copying the bound would read past the end of an output of 1 element
+  CreateTask(1, kMaxElementNum);
+  EXPECT_FALSE(task_->GetOutputBound(0, data_bound, shape_bound));
+}
+
+TEST_F(UtestAicpuNodeExecutor, bounded_outputs_in_bound) {
+  CreateTask(kMaxElementNum, kMaxElementNum);
+  PrepareBoundedOutputs(kDataBound, kShapeBound);
+  TaskContext task_context(&execution_context_, node_item_.get(), nullptr);
+  EXPECT_EQ(task_->UpdateShapeAndDataByResultSummary(task_context), SUCCESS);
+  EXPECT_TRUE(task_->use_bounded_outputs_);
+  EXPECT_EQ(node_item_->op_desc->GetOutputDescPtr(0)->GetShape().GetDimNum(), 1);
+}
+
+TEST_F(UtestAicpuNodeExecutor, bounded_outputs_smaller_than_bound) {
+  CreateTask(kMaxElementNum, kMaxElementNum);
+  PrepareBoundedOutputs(kDataBound / 2, kShapeBound);
+  TaskContext task_context(&execution_context_, node_item_.get(), nullptr);
+  EXPECT_EQ(task_->UpdateShapeAndDataByResultSummary(task_context), INTERNAL_ERROR);
+  // later executions copy the size in the summary after compute
+  EXPECT_FALSE(task_->use_bounded_outputs_);
+}
+
+TEST_F(UtestAicpuNodeExecutor, bounded_outputs_over_bound) {
+  CreateTask(kMaxElementNum, kMaxElementNum);
+  PrepareBoundedOutputs(kDataBound * 2, kShapeBound);
+  TaskContext task_context(&execution_context_, node_item_.get(), nullptr);
+  EXPECT_EQ(task_->UpdateShapeAndDataByResultSummary(task_context), INTERNAL_ERROR);
+  // later executions allocate the outputs after compute
+  EXPECT_FALSE(task_->use_bounded_outputs_);
+}
+}  // namespace hybrid
+}  // namespace ge
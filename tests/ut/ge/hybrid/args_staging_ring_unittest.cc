@@ -0,0 +1,83 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "hybrid/executor/args_staging_ring.h"
+#include "rt_call_recorder.h"
+
+using namespace std;
+using namespace testing;
+
+namespace ge {
+namespace hybrid {
+class UtestArgsStagingRing : public testing::Test {
+ protected:
+  void SetUp() {}
+
+  void TearDown() {}
+};
+
+TEST_F(UtestArgsStagingRing, stage_and_flush) {
+  ArgsStagingRing ring(nullptr);
+  uint64_t dev_buf[4] = {0};
+  uint64_t args[4] = {1, 2, 3, 4};
+  // not allocated before reset
+  EXPECT_FALSE(ring.Stage(dev_buf, args, sizeof(args)));
+
+  EXPECT_EQ(ring.Reset(), SUCCESS);
+  EXPECT_TRUE(ring.Stage(dev_buf, args, sizeof(uint64_t) * 2));
+  EXPECT_TRUE(ring.Stage(dev_buf + 2, args + 2, sizeof(uint64_t) * 2));
+  EXPECT_EQ(ring.Flush(), SUCCESS);
+  EXPECT_EQ(ring.Flush(), SUCCESS);
+}
+
+TEST_F(UtestArgsStagingRing, grow_after_overflow) {
+  ArgsStagingRing ring(nullptr);
+  EXPECT_EQ(ring.Reset(), SUCCESS);
+  std::vector<uint8_t> dev_buf(1536 * 1024);
+  std::vector<uint8_t> args(dev_buf.size(), 1);
+  EXPECT_FALSE(ring.Stage(dev_buf.data(), args.data(), args.size()));
+  EXPECT_TRUE(ring.Stage(dev_buf.data(), args.data(), 1024));
+
+  EXPECT_EQ(ring.Flush(), SUCCESS);
+  EXPECT_EQ(ring.Reset(), SUCCESS);
+  EXPECT_TRUE(ring.Stage(dev_buf.data(), args.data(), args.size()));
+  EXPECT_EQ(ring.Flush(), SUCCESS);
+}
+
+TEST_F(UtestArgsStagingRing, reset_waits_for_issued_copies) {
+  ArgsStagingRing ring(nullptr);
+  uint64_t dev_buf[2] = {0};
+  uint64_t args[2] = {1, 2};
+  auto &recorder = RtCallRecorder::Instance();
+  recorder.Start(false);
+  EXPECT_EQ(ring.Reset(), SUCCESS);
+  EXPECT_EQ(recorder.GetCallCounts()["rtStreamSynchronize"], 0);
+
+  // the execution fails after the copies are issued, without synchronizing the stream
+  EXPECT_TRUE(ring.Stage(dev_buf, args, sizeof(args)));
+  EXPECT_EQ(ring.Flush(), SUCCESS);
+  EXPECT_EQ(ring.Reset(), SUCCESS);
+  EXPECT_EQ(recorder.GetCallCounts()["rtStreamSynchronize"], 1);
+  // nothing issued since
+  EXPECT_EQ(ring.Reset(), SUCCESS);
+  EXPECT_EQ(recorder.GetCallCounts()["rtStreamSynchronize"], 1);
+  recorder.Stop();
+}
+}  // namespace hybrid
+}  // namespace ge
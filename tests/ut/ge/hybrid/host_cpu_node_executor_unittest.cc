@@ -0,0 +1,209 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "graph/compute_graph.h"
+#include "graph/utils/tensor_utils.h"
+
+#define protected public
+#define private public
+#include "hybrid/executor/hybrid_execution_context.h"
+#include "hybrid/executor/subgraph_context.h"
+#include "hybrid/model/graph_item.h"
+#include "hybrid/node_executor/host_cpu/host_cpu_node_executor.h"
+#include "hybrid/node_executor/task_context.h"
+#undef private
+#undef protected
+
+using namespace std;
+using namespace testing;
+
+namespace ge {
+namespace hybrid {
+namespace {
+const int64_t kElementNum = 4;
+
+// doubles input x into output y
+class DoubleHostCpuOp : public HostCpuOp {
+ public:
+  graphStatus Compute(Operator &op, const std::map<std::string, const Tensor> &inputs,
+                      std::map<std::string, Tensor> &outputs) override {
+    ++compute_count;
+    const Tensor &x = inputs.at("x");
+    Tensor &y = outputs.at("y");
+    auto x_data = reinterpret_cast<const int32_t *>(x.GetData());
+    auto y_data = reinterpret_cast<int32_t *>(y.GetData());
+    if ((y_data == nullptr) || (y.GetSize() < x.GetSize())) {
+      return GRAPH_FAILED;
+    }
+    for (size_t i = 0; i < x.GetSize() / sizeof(int32_t); ++i) {
+      y_data[i] = x_data[i] * 2;
+    }
+    output_data = y_data;
+    return GRAPH_SUCCESS;
+  }
+
+  int compute_count = 0;
+  const void *output_data = nullptr;
+};
+}  // namespace
+
+class UtestHostCpuNodeExecutor : public testing::Test {
+ protected:
+  void SetUp() {
+    execution_context_.allocator = NpuMemoryAllocator::GetAllocator(0);
+    input_data_ = {1, 2, 3, 4};
+  }
+
+  void TearDown() {
+    task_context_.reset();
+    subgraph_context_.reset();
+    node_item_.reset();
+  }
+
+  NodePtr AddNode(const std::string &type, DataType output_data_type) {
+    GeTensorDesc tensor_desc(GeShape({kElementNum}), FORMAT_ND, DT_INT32);
+    TensorUtils::SetSize(tensor_desc, kElementNum * sizeof(int32_t));
+    GeTensorDesc output_desc(GeShape({kElementNum}), FORMAT_ND, output_data_type);
+    TensorUtils::SetSize(output_desc, kElementNum * sizeof(int32_t));
+    auto op_desc = std::make_shared<OpDesc>("node_" + type, type);
+    op_desc->AddInputDesc("x", tensor_desc);
+    op_desc->AddOutputDesc("y", output_desc);
+    return graph_->AddNode(op_desc);
+  }
+
+  void CreateTaskContext(const NodePtr &node) {
+    node_item_.reset(new NodeItem(node));
+    ASSERT_EQ(node_item_->Init(), SUCCESS);
+    node_item_->input_start = 0;
+    node_item_->output_start = 0;
+    graph_item_.node_items_ = {node_item_.get()};
+    graph_item_.total_inputs_ = node_item_->num_inputs;
+    graph_item_.total_outputs_ = node_item_->num_outputs;
+    subgraph_context_.reset(new SubgraphContext(&graph_item_));
+    ASSERT_EQ(subgraph_context_->Init(), SUCCESS);
+    task_context_ = TaskContext::Create(*node_item_, &execution_context_, subgraph_context_.get());
+    ASSERT_NE(task_context_, nullptr);
+    TensorValue input(input_data_.data(), input_data_.size() * sizeof(int32_t));
+    ASSERT_EQ(subgraph_context_->SetInput(0, input), SUCCESS);
+  }
+
+  ComputeGraphPtr graph_ = std::make_shared<ComputeGraph>("test");
+  GraphExecutionContext execution_context_;
+  GraphItem graph_item_;
+  std::unique_ptr<NodeItem> node_item_;
+  std::unique_ptr<SubgraphContext> subgraph_context_;
+  std::unique_ptr<TaskContext> task_context_;
+  std::vector<int32_t> input_data_;
+};
+
+TEST_F(UtestHostCpuNodeExecutor, cpu_kernel_writes_outputs_in_place) {
+  auto node = AddNode("Double", DT_INT32);
+  CreateTaskContext(node);
+  CpuKernelNodeTask task(node);
+  auto op_kernel = new DoubleHostCpuOp();
+  task.op_kernel_.reset(op_kernel);
+  task.input_names_ = {"x"};
+  task.output_names_ = {"y"};
+
+  const void *first_output_data = nullptr;
+  for (int iteration = 0; iteration < 2; ++iteration) {
+    task_context_->Reset();
+    bool done = false;
+    ASSERT_EQ(task.ExecuteAsync(*task_context_, [&done]() { done = true; }), SUCCESS);
+    EXPECT_TRUE(done);
+    auto output = task_context_->GetOutput(0);
+    ASSERT_NE(output, nullptr);
+    ASSERT_NE(output->GetData(), nullptr);
+    // the output is the buffer the kernel wrote, and it is reused once the previous output is released
+    EXPECT_EQ(output->GetData(), op_kernel->output_data);
+    if (iteration == 0) {
+      first_output_data = output->GetData();
+    } else {
+      EXPECT_EQ(output->GetData(), first_output_data);
+    }
+    auto output_data = reinterpret_cast<const int32_t *>(output->GetData());
+    for (int64_t i = 0; i < kElementNum; ++i) {
+      EXPECT_EQ(output_data[i], input_data_[i] * 2);
+    }
+  }
+  EXPECT_EQ(op_kernel->compute_count, 2);
+}
+
+TEST_F(UtestHostCpuNodeExecutor, cpu_kernel_copies_to_bound_output) {
+  auto node = AddNode("Double", DT_INT32);
+  CreateTaskContext(node);
+  CpuKernelNodeTask task(node);
+  auto op_kernel = new DoubleHostCpuOp();
+  task.op_kernel_.reset(op_kernel);
+  task.input_names_ = {"x"};
+  task.output_names_ = {"y"};
+
+  // bound as net output before the node runs
+  std::vector<int32_t> net_output(kElementNum);
+  task_context_->Reset();
+  ASSERT_EQ(task_context_->SetOutput(0, TensorValue(net_output.data(), net_output.size() * sizeof(int32_t))),
+            SUCCESS);
+  ASSERT_EQ(task.ExecuteAsync(*task_context_, nullptr), SUCCESS);
+  auto output = task_context_->GetOutput(0);
+  ASSERT_NE(output, nullptr);
+  EXPECT_EQ(output->GetData(), net_output.data());
+  for (int64_t i = 0; i < kElementNum; ++i) {
+    EXPECT_EQ(net_output[i], input_data_[i] * 2);
+  }
+}
+
+TEST_F(UtestHostCpuNodeExecutor, cpu_kernel_rejects_unsupported_output_data_type) {
+  auto node = AddNode("Double", DT_STRING);
+  CreateTaskContext(node);
+  CpuKernelNodeTask task(node);
+  auto op_kernel = new DoubleHostCpuOp();
+  task.op_kernel_.reset(op_kernel);
+  task.input_names_ = {"x"};
+  task.output_names_ = {"y"};
+
+  EXPECT_EQ(task.ExecuteAsync(*task_context_, nullptr), PARAM_INVALID);
+  EXPECT_EQ(op_kernel->compute_count, 0);
+}
+
+TEST_F(UtestHostCpuNodeExecutor, host_kernel_created_once_at_load) {
+  auto node = AddNode(NOOP, DT_INT32);
+  CreateTaskContext(node);
+  HostCpuNodeTask task(node);
+  EXPECT_EQ(task.host_kernel_, nullptr);
+  ASSERT_EQ(task.Init(), SUCCESS);
+  auto host_kernel = task.host_kernel_;
+  ASSERT_NE(host_kernel, nullptr);
+
+  for (int iteration = 0; iteration < 2; ++iteration) {
+    task_context_->Reset();
+    bool done = false;
+    ASSERT_EQ(task.ExecuteAsync(*task_context_, [&done]() { done = true; }), SUCCESS);
+    EXPECT_TRUE(done);
+    EXPECT_EQ(task.host_kernel_, host_kernel);
+  }
+}
+
+TEST_F(UtestHostCpuNodeExecutor, host_kernel_init_fails_for_unknown_type) {
+  auto node = AddNode("NoSuchHostKernel", DT_INT32);
+  HostCpuNodeTask task(node);
+  EXPECT_EQ(task.Init(), UNSUPPORTED);
+  EXPECT_EQ(task.host_kernel_, nullptr);
+}
+}  // namespace hybrid
+}  // namespace ge
@@ -0,0 +1,107 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "hybrid/executor/node_done_manager.h"
+
+using namespace std;
+using namespace testing;
+
+namespace ge {
+namespace hybrid {
+class UtestNodeDoneManager : public testing::Test {
+ protected:
+  void SetUp() {}
+
+  void TearDown() {}
+};
+
+TEST_F(UtestNodeDoneManager, await_done_node) {
+  NodeDoneManager manager;
+  manager.Init(2);
+  manager.NodeDone(1);
+  EXPECT_TRUE(manager.Await(1));
+
+  std::thread waiter([&manager]() { EXPECT_TRUE(manager.Await(0)); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  manager.NodeDone(0);
+  waiter.join();
+}
+
+TEST_F(UtestNodeDoneManager, await_fail_after_destroy) {
+  NodeDoneManager manager;
+  manager.Init(2);
+  std::thread waiter([&manager]() { EXPECT_FALSE(manager.Await(0)); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  manager.Destroy();
+  waiter.join();
+
+  manager.NodeDone(1);
+  EXPECT_FALSE(manager.Await(1));
+  EXPECT_FALSE(manager.Await(2));
+}
+
+TEST_F(UtestNodeDoneManager, reset_for_next_execution) {
+  NodeDoneManager manager;
+  manager.Init(1);
+  manager.NodeDone(0);
+  manager.Destroy();
+  manager.Reset();
+
+  std::thread waiter([&manager]() { EXPECT_TRUE(manager.Await(0)); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  manager.NodeDone(0);
+  waiter.join();
+}
+
+// node i waits for node i - 1 and node i / 2, nodes are executed by threads in turn, so most edges cross threads
+TEST_F(UtestNodeDoneManager, fine_grained_dependencies) {
+  const int kNodeNum = 1024;
+  const int kThreadNum = 4;
+  const int kIterations = 4;
+  NodeDoneManager manager;
+  manager.Init(kNodeNum);
+
+  for (int iteration = 0; iteration < kIterations; ++iteration) {
+    manager.Reset();
+    std::atomic<int> failed_num(0);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < kThreadNum; ++t) {
+      workers.emplace_back([&manager, &failed_num, t, kNodeNum, kThreadNum]() {
+        for (int i = t; i < kNodeNum; i += kThreadNum) {
+          if ((i > 0) && (!manager.Await(i - 1) || !manager.Await(i / 2))) {
+            failed_num++;
+          }
+          manager.NodeDone(i);
+        }
+      });
+    }
+    for (auto &worker : workers) {
+      worker.join();
+    }
+    EXPECT_EQ(failed_num.load(), 0);
+    for (int i = 0; i < kNodeNum; ++i) {
+      EXPECT_TRUE(manager.Await(i));
+    }
+  }
+}
+}  // namespace hybrid
+}  // namespace ge
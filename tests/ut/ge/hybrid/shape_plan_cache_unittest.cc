@@ -0,0 +1,206 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "graph/compute_graph.h"
+#include "graph/utils/tensor_utils.h"
+
+#define protected public
+#define private public
+#include "hybrid/executor/hybrid_execution_context.h"
+#include "hybrid/executor/shape_plan_cache.h"
+#include "hybrid/model/graph_item.h"
+#include "hybrid/node_executor/task_context.h"
+#undef private
+#undef protected
+
+using namespace std;
+using namespace testing;
+
+namespace ge {
+namespace hybrid {
+namespace {
+const int64_t kElementNum = 4;
+
+class TestTilingSnapshot : public TilingSnapshot {
+ public:
+  explicit TestTilingSnapshot(int64_t tiling_key) : tiling_key(tiling_key) {}
+  int64_t tiling_key;
+};
+
+// the tiling key is the element num of the output
+class TilingNodeTask : public NodeTask {
+ public:
+  Status UpdateArgs(TaskContext &context) override { return SUCCESS; }
+
+  Status ExecuteAsync(TaskContext &context, std::function<void()> done_callback) override { return SUCCESS; }
+
+  Status SaveTilingData(TaskContext &context, std::unique_ptr<TilingSnapshot> &snapshot) override {
+    int64_t tiling_key = context.GetNodeItem().op_desc->GetOutputDescPtr(0)->GetShape().GetShapeSize();
+    snapshot.reset(new TestTilingSnapshot(tiling_key));
+    return SUCCESS;
+  }
+};
+}  // namespace
+
+class UtestShapePlanCache : public testing::Test {
+ protected:
+  void SetUp() {
+    auto op_desc = std::make_shared<OpDesc>("node", "Test");
+    op_desc->AddOutputDesc("y", CreateTensorDesc(kElementNum));
+    node_item_.reset(new NodeItem(graph_->AddNode(op_desc)));
+    ASSERT_EQ(node_item_->Init(), SUCCESS);
+    node_item_->is_dynamic = true;
+    node_item_->index_in_graph = 0;
+    graph_item_.node_items_ = {node_item_.get()};
+    graph_item_.is_dynamic_ = true;
+    node_task_ = std::make_shared<TilingNodeTask>();
+  }
+
+  void TearDown() {}
+
+  static GeTensorDesc CreateTensorDesc(int64_t element_num) {
+    GeTensorDesc tensor_desc(GeShape({element_num}), FORMAT_ND, DT_INT32);
+    TensorUtils::SetSize(tensor_desc, element_num * sizeof(int32_t));
+    return tensor_desc;
+  }
+
+  static std::vector<ConstGeTensorDescPtr> CreateInputDesc(int64_t element_num) {
+    return {std::make_shared<GeTensorDesc>(CreateTensorDesc(element_num))};
+  }
+
+  // records the plan of the current shapes of the node
+  void RecordPlan(ShapePlanCache &cache, int64_t element_num) {
+    node_item_->op_desc->UpdateOutputDesc(0, CreateTensorDesc(element_num));
+    bool is_recording = false;
+    ShapePlan *plan = cache.Acquire(CreateInputDesc(element_num), is_recording);
+    ASSERT_NE(plan, nullptr);
+    ASSERT_TRUE(is_recording);
+    NodeState node_state(*node_item_, nullptr);
+    node_state.SetKernelTask(node_task_);
+    TaskContext task_context(&execution_context_, node_item_.get(), nullptr);
+    ASSERT_EQ(plan->Freeze(node_state, &task_context), SUCCESS);
+    cache.Release(plan, is_recording, SUCCESS);
+  }
+
+  ComputeGraphPtr graph_ = std::make_shared<ComputeGraph>("test");
+  GraphExecutionContext execution_context_;
+  GraphItem graph_item_;
+  std::unique_ptr<NodeItem> node_item_;
+  std::shared_ptr<TilingNodeTask> node_task_;
+};
+
+TEST_F(UtestShapePlanCache, is_supported) {
+  EXPECT_TRUE(ShapePlanCache::IsSupported(graph_item_));
+
+  // the shapes of the node depend on the values of its inputs
+  node_item_->dependents_for_shape_inference = {node_item_.get()};
+  EXPECT_FALSE(ShapePlanCache::IsSupported(graph_item_));
+  node_item_->dependents_for_shape_inference.clear();
+
+  node_item_->shape_inference_type = DEPEND_COMPUTE;
+  EXPECT_FALSE(ShapePlanCache::IsSupported(graph_item_));
+  node_item_->shape_inference_type = DEPEND_SHAPE_RANGE;
+  EXPECT_FALSE(ShapePlanCache::IsSupported(graph_item_));
+
+  graph_item_.is_dynamic_ = false;
+  EXPECT_FALSE(ShapePlanCache::IsSupported(graph_item_));
+}
+
+TEST_F(UtestShapePlanCache, record_at_threshold_and_restore) {
+  ShapePlanCache cache(&graph_item_, 2, 4);
+  bool is_recording = true;
+  EXPECT_EQ(cache.Acquire(CreateInputDesc(kElementNum), is_recording), nullptr);
+  EXPECT_FALSE(is_recording);
+  RecordPlan(cache, kElementNum);
+  EXPECT_EQ(cache.GetPlanCount(), 1);
+
+  ShapePlan *plan = cache.Acquire(CreateInputDesc(kElementNum), is_recording);
+  ASSERT_NE(plan, nullptr);
+  EXPECT_FALSE(is_recording);
+  EXPECT_EQ(cache.GetHitCount(), 1);
+  EXPECT_EQ(cache.GetLookupCount(), 3);
+
+  // shapes of another execution are replaced by the frozen ones
+  node_item_->op_desc->UpdateOutputDesc(0, CreateTensorDesc(1));
+  NodeState node_state(*node_item_, nullptr);
+  ASSERT_EQ(plan->Restore(node_state), SUCCESS);
+  auto output_desc = node_item_->op_desc->GetOutputDescPtr(0);
+  EXPECT_EQ(output_desc->GetShape().GetDims(), std::vector<int64_t>({kElementNum}));
+  int64_t size = 0;
+  (void)TensorUtils::GetSize(*output_desc, size);
+  EXPECT_EQ(size, kElementNum * sizeof(int32_t));
+  EXPECT_EQ(node_state.GetKernelTask(), node_task_);
+  auto tiling = dynamic_cast<const TestTilingSnapshot *>(node_state.GetFrozenTiling());
+  ASSERT_NE(tiling, nullptr);
+  EXPECT_EQ(tiling->tiling_key, kElementNum);
+  cache.Release(plan, is_recording, SUCCESS);
+}
+
+TEST_F(UtestShapePlanCache, drop_failed_or_abandoned_recording) {
+  ShapePlanCache cache(&graph_item_, 1, 4);
+  bool is_recording = false;
+  ShapePlan *plan = cache.Acquire(CreateInputDesc(kElementNum), is_recording);
+  ASSERT_NE(plan, nullptr);
+  ASSERT_TRUE(is_recording);
+  // the node is not frozen
+  EXPECT_FALSE(plan->IsComplete());
+  cache.Release(plan, is_recording, SUCCESS);
+  EXPECT_EQ(cache.GetPlanCount(), 0);
+
+  plan = cache.Acquire(CreateInputDesc(kElementNum), is_recording);
+  ASSERT_NE(plan, nullptr);
+  NodeState node_state(*node_item_, nullptr);
+  ASSERT_EQ(plan->Freeze(node_state, nullptr), SUCCESS);
+  EXPECT_TRUE(plan->IsComplete());
+  plan->Abandon();
+  EXPECT_FALSE(plan->IsComplete());
+  cache.Release(plan, is_recording, SUCCESS);
+  EXPECT_EQ(cache.GetPlanCount(), 0);
+
+  plan = cache.Acquire(CreateInputDesc(kElementNum), is_recording);
+  ASSERT_NE(plan, nullptr);
+  ASSERT_EQ(plan->Freeze(node_state, nullptr), SUCCESS);
+  cache.Release(plan, is_recording, FAILED);
+  EXPECT_EQ(cache.GetPlanCount(), 0);
+}
+
+TEST_F(UtestShapePlanCache, evict_least_recently_used) {
+  ShapePlanCache cache(&graph_item_, 1, 2);
+  RecordPlan(cache, 1);
+  RecordPlan(cache, 2);
+  bool is_recording = true;
+  ShapePlan *plan = cache.Acquire(CreateInputDesc(1), is_recording);
+  ASSERT_NE(plan, nullptr);
+  EXPECT_FALSE(is_recording);
+  cache.Release(plan, is_recording, SUCCESS);
+
+  // the plan of 2 elements is the least recently used
+  RecordPlan(cache, 3);
+  EXPECT_EQ(cache.GetPlanCount(), 2);
+  EXPECT_NE(cache.Acquire(CreateInputDesc(1), is_recording), nullptr);
+  EXPECT_FALSE(is_recording);
+  EXPECT_NE(cache.Acquire(CreateInputDesc(3), is_recording), nullptr);
+  EXPECT_FALSE(is_recording);
+  plan = cache.Acquire(CreateInputDesc(2), is_recording);
+  EXPECT_NE(plan, nullptr);
+  EXPECT_TRUE(is_recording);
+  cache.Release(plan, is_recording, FAILED);
+}
+}  // namespace hybrid
+}  // namespace ge
@@ -0,0 +1,265 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "common/opskernel/ops_kernel_info_store.h"
+#include "common/thread_pool.h"
+#include "graph/compute_graph.h"
+#include "graph/manager/graph_mem_allocator.h"
+#include "graph/utils/tensor_utils.h"
+
+#define protected public
+#define private public
+#include "hybrid/executor/hybrid_execution_context.h"
+#include "hybrid/executor/subgraph_context.h"
+#include "hybrid/executor/subgraph_executor.h"
+#include "hybrid/model/graph_item.h"
+#include "hybrid/node_executor/node_executor.h"
+#include "hybrid/node_executor/task_context.h"
+#undef private
+#undef protected
+
+using namespace std;
+using namespace testing;
+
+namespace ge {
+namespace hybrid {
+namespace {
+const int64_t kElementNum = 4;
+const char *const kTestKernelLib = "test_kernel_lib";
+
+class TestTilingSnapshot : public TilingSnapshot {
+ public:
+  explicit TestTilingSnapshot(int64_t tiling_key) : tiling_key(tiling_key) {}
+  int64_t tiling_key;
+};
+
+// fails the launch of the first failure_num executions, the tiling key is the element num of the output
+class FailingNodeTask : public NodeTask {
+ public:
+  Status UpdateArgs(TaskContext &context) override { return SUCCESS; }
+
+  Status UpdateTilingData(TaskContext &context) override {
+    ++update_tiling_count;
+    tiling_key = context.GetNodeItem().op_desc->GetOutputDescPtr(0)->GetShape().GetShapeSize();
+    return SUCCESS;
+  }
+
+  Status SaveTilingData(TaskContext &context, std::unique_ptr<TilingSnapshot> &snapshot) override {
+    if (save_tiling_status == SUCCESS) {
+      snapshot.reset(new TestTilingSnapshot(tiling_key));
+    }
+    return save_tiling_status;
+  }
+
+  Status RestoreTilingData(TaskContext &context, const TilingSnapshot &snapshot) override {
+    ++restore_tiling_count;
+    tiling_key = static_cast<const TestTilingSnapshot &>(snapshot).tiling_key;
+    return SUCCESS;
+  }
+
+  Status ExecuteAsync(TaskContext &context, std::function<void()> done_callback) override {
+    ++execute_count;
+    auto output = context.GetOutput(0);
+    if ((output == nullptr) || (output->GetData() == nullptr)) {
+      return INTERNAL_ERROR;
+    }
+    if (execute_count <= failure_num) {
+      return FAILED;
+    }
+    if (done_callback != nullptr) {
+      done_callback();
+    }
+    return SUCCESS;
+  }
+
+  int failure_num = 0;
+  int execute_count = 0;
+  int update_tiling_count = 0;
+  int restore_tiling_count = 0;
+  int64_t tiling_key = 0;
+  Status save_tiling_status = SUCCESS;
+};
+
+class TestNodeExecutor : public NodeExecutor {};
+
+// calculates the output sizes of dynamic nodes from their shapes
+class TestOpsKernelInfoStore : public OpsKernelInfoStore {
+ public:
+  Status Initialize(const map<string, string> &options) override { return SUCCESS; }
+  Status Finalize() override { return SUCCESS; }
+  void GetAllOpsKernelInfo(map<string, OpInfo> &infos) const override {}
+  bool CheckSupported(const OpDescPtr &op_desc, std::string &reason) const override { return true; }
+  Status GenerateTask(const Node &node, RunContext &context, std::vector<domi::TaskDef> &tasks) override {
+    return SUCCESS;
+  }
+
+  Status CalcOpRunningParam(Node &node) override {
+    ++calc_count;
+    auto output_desc = node.GetOpDesc()->MutableOutputDesc(0);
+    TensorUtils::SetSize(*output_desc, output_desc->GetShape().GetShapeSize() * sizeof(int32_t));
+    return SUCCESS;
+  }
+
+  int calc_count = 0;
+};
+}  // namespace
+
+class UtestSubgraphExecutor : public testing::Test {
+ protected:
+  void SetUp() {
+    MemManager::Instance().Initialize(std::vector<rtMemType_t>({RT_MEMORY_HBM}));
+    execution_context_.allocator = NpuMemoryAllocator::GetAllocator(0);
+    GeTensorDesc tensor_desc(GeShape({kElementNum}), FORMAT_ND, DT_INT32);
+    TensorUtils::SetSize(tensor_desc, kElementNum * sizeof(int32_t));
+    auto op_desc = std::make_shared<OpDesc>("node", "Test");
+    op_desc->AddOutputDesc("y", tensor_desc);
+    auto node = graph_->AddNode(op_desc);
+    node_item_.reset(new NodeItem(node));
+    ASSERT_EQ(node_item_->Init(), SUCCESS);
+    node_item_->input_start = 0;
+    node_item_->output_start = 0;
+    node_item_->outputs.resize(node_item_->num_outputs);
+    node_item_->node_executor = &node_executor_;
+    node_task_ = std::make_shared<FailingNodeTask>();
+    node_item_->kernel_task = node_task_;
+
+    graph_item_.node_items_ = {node_item_.get()};
+    graph_item_.total_inputs_ = node_item_->num_inputs;
+    graph_item_.total_outputs_ = node_item_->num_outputs;
+    graph_item_.is_dynamic_ = true;
+  }
+
+  void TearDown() {
+    NodeExecutorManager::GetInstance().kernel_stores_.erase(kTestKernelLib);
+    MemManager::Instance().Finalize();
+  }
+
+  // shapes of the node are prepared by every execution unless a shape plan restores them
+  void SetDynamic() {
+    node_item_->is_dynamic = true;
+    node_item_->index_in_graph = 0;
+    node_item_->op_desc->SetOpKernelLibName(kTestKernelLib);
+    NodeExecutorManager::GetInstance().kernel_stores_[kTestKernelLib] = &kernel_store_;
+  }
+
+  int64_t GetOutputElementNum() { return node_item_->op_desc->GetOutputDescPtr(0)->GetShape().GetShapeSize(); }
+
+  ComputeGraphPtr graph_ = std::make_shared<ComputeGraph>("test");
+  GraphExecutionContext execution_context_;
+  GraphItem graph_item_;
+  TestNodeExecutor node_executor_;
+  TestOpsKernelInfoStore kernel_store_;
+  std::unique_ptr<NodeItem> node_item_;
+  std::shared_ptr<FailingNodeTask> node_task_;
+};
+
+TEST_F(UtestSubgraphExecutor, failed_execution_followed_by_successful_one) {
+  node_task_->failure_num = 1;
+  SubgraphExecutor executor(&graph_item_, &execution_context_);
+  std::vector<TensorValue> inputs;
+  std::vector<ConstGeTensorDescPtr> input_desc;
+  EXPECT_NE(executor.ExecuteAsync(inputs, input_desc), SUCCESS);
+  EXPECT_EQ(node_task_->execute_count, 1);
+
+  // the callback never runs for a failed launch, the outputs are released anyway
+  auto node_state = executor.subgraph_context_->GetOrCreateNodeState(node_item_.get());
+  ASSERT_NE(node_state, nullptr);
+  ASSERT_NE(node_state->task_context_, nullptr);
+  EXPECT_EQ(node_state->task_context_->GetOutput(0)->GetData(), nullptr);
+  EXPECT_EQ(node_state->task_context_->ref_count_.load(), 0);
+
+  // the context and node states of the failed execution are reused
+  execution_context_.status = SUCCESS;
+  EXPECT_EQ(executor.ExecuteAsync(inputs, input_desc), SUCCESS);
+  EXPECT_EQ(node_task_->execute_count, 2);
+  EXPECT_EQ(executor.subgraph_context_->GetOrCreateNodeState(node_item_.get()), node_state);
+  EXPECT_EQ(node_state->task_context_->GetOutput(0)->GetData(), nullptr);
+  EXPECT_EQ(node_state->task_context_->ref_count_.load(), 0);
+}
+
+TEST_F(UtestSubgraphExecutor, reset_waits_for_prepare_tasks) {
+  SubgraphContext subgraph_context(&graph_item_);
+  ASSERT_EQ(subgraph_context.Init(), SUCCESS);
+  auto node_state = subgraph_context.GetOrCreateNodeState(node_item_.get());
+  ASSERT_NE(node_state, nullptr);
+
+  ThreadPool pool(1);
+  std::atomic<bool> prepared(false);
+  auto prepare_future = pool.commit([&prepared]() -> Status {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    prepared = true;
+    return FAILED;
+  });
+  node_state->SetPrepareFuture(std::move(prepare_future));
+
+  subgraph_context.OnError(FAILED);
+  subgraph_context.Reset();
+  EXPECT_TRUE(prepared);
+  EXPECT_EQ(node_state->WaitForPrepareDone(), SUCCESS);
+}
+
+TEST_F(UtestSubgraphExecutor, restore_run_gives_recorded_shapes_and_tiling) {
+  SetDynamic();
+  ShapePlan shape_plan(graph_item_);
+  SubgraphExecutor executor(&graph_item_, &execution_context_);
+  std::vector<TensorValue> inputs;
+  std::vector<ConstGeTensorDescPtr> input_desc;
+  executor.SetShapePlan(&shape_plan, true);
+  EXPECT_EQ(executor.ExecuteAsync(inputs, input_desc), SUCCESS);
+  EXPECT_TRUE(shape_plan.IsComplete());
+  EXPECT_EQ(kernel_store_.calc_count, 1);
+  EXPECT_EQ(node_task_->update_tiling_count, 1);
+  EXPECT_EQ(node_task_->tiling_key, kElementNum);
+
+  // the shape and the tiling left by an execution of other shapes are replaced by the recorded ones
+  GeTensorDesc tensor_desc(GeShape({1}), FORMAT_ND, DT_INT32);
+  TensorUtils::SetSize(tensor_desc, sizeof(int32_t));
+  node_item_->op_desc->UpdateOutputDesc(0, tensor_desc);
+  node_task_->tiling_key = 1;
+  executor.SetShapePlan(&shape_plan, false);
+  EXPECT_EQ(executor.ExecuteAsync(inputs, input_desc), SUCCESS);
+  executor.SetShapePlan(nullptr, false);
+  EXPECT_EQ(node_task_->execute_count, 2);
+  EXPECT_EQ(GetOutputElementNum(), kElementNum);
+  EXPECT_EQ(kernel_store_.calc_count, 1);
+  EXPECT_EQ(node_task_->update_tiling_count, 1);
+  EXPECT_EQ(node_task_->restore_tiling_count, 1);
+  EXPECT_EQ(node_task_->tiling_key, kElementNum);
+}
+
+TEST_F(UtestSubgraphExecutor, failed_freeze_abandons_recording) {
+  SetDynamic();
+  node_task_->save_tiling_status = FAILED;
+  ShapePlan shape_plan(graph_item_);
+  SubgraphExecutor executor(&graph_item_, &execution_context_);
+  std::vector<TensorValue> inputs;
+  std::vector<ConstGeTensorDescPtr> input_desc;
+  executor.SetShapePlan(&shape_plan, true);
+  // the plan only saves work of later executions, the recording one goes on without it
+  EXPECT_EQ(executor.ExecuteAsync(inputs, input_desc), SUCCESS);
+  executor.SetShapePlan(nullptr, false);
+  EXPECT_EQ(node_task_->execute_count, 1);
+  EXPECT_TRUE(shape_plan.IsAbandoned());
+  EXPECT_FALSE(shape_plan.IsComplete());
+}
+}  // namespace hybrid
+}  // namespace ge
@@ -0,0 +1,102 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdio>
+
+#define protected public
+#define private public
+#include "opskernel_manager/ops_kernel_manager.h"
+#undef private
+#undef protected
+
+using namespace ge;
+using namespace std;
+
+class UtestOpsKernelManager : public testing::Test {
+ protected:
+  void SetUp() override {
+    OpInfo op_info = {};
+    op_info.engine = "AIcoreEngine";
+    op_info.opKernelLib = "AIcoreKernelLib";
+    ops_kernel_manager_.ops_kernel_info_["Add"] = {op_info};
+  }
+
+  void TearDown() override {}
+
+  OpsKernelManager ops_kernel_manager_;
+};
+
+TEST_F(UtestOpsKernelManager, eager_init_plugins_ready) {
+  ops_kernel_manager_.lazy_init_ = false;
+  EXPECT_EQ(ops_kernel_manager_.EnsurePluginsInitialized(), SUCCESS);
+  EXPECT_EQ(ops_kernel_manager_.GetOpsKernelInfo("Add").size(), 1);
+  EXPECT_EQ(ops_kernel_manager_.GetAllOpsKernelInfo().size(), 1);
+}
+
+TEST_F(UtestOpsKernelManager, lazy_init_failure_kept) {
+  ops_kernel_manager_.lazy_init_ = true;
+  ops_kernel_manager_.plugins_init_status_ = GE_OPS_GET_NO_VALID_SO;
+  ops_kernel_manager_.plugins_initialized_ = true;
+
+  // every caller sees the failure of the deferred initialization, not the partial state it left
+  EXPECT_EQ(ops_kernel_manager_.EnsurePluginsInitialized(), GE_OPS_GET_NO_VALID_SO);
+  EXPECT_EQ(ops_kernel_manager_.EnsurePluginsInitialized(), GE_OPS_GET_NO_VALID_SO);
+  EXPECT_TRUE(ops_kernel_manager_.GetOpsKernelInfo("Add").empty());
+  EXPECT_TRUE(ops_kernel_manager_.GetAllOpsKernelInfo().empty());
+  EXPECT_TRUE(ops_kernel_manager_.GetAllOpsKernelInfoStores().empty());
+  EXPECT_TRUE(ops_kernel_manager_.GetAllGraphOptimizerObjs().empty());
+  EXPECT_TRUE(ops_kernel_manager_.GetAllGraphOptimizerObjsByPriority().empty());
+  EXPECT_EQ(ops_kernel_manager_.GetOpsKernelInfoStore("AIcoreKernelLib"), nullptr);
+  vector<GraphOptimizerPtr> graph_optimizers;
+  ops_kernel_manager_.GetGraphOptimizerByEngine("AIcoreEngine", graph_optimizers);
+  EXPECT_TRUE(graph_optimizers.empty());
+}
+
+TEST_F(UtestOpsKernelManager, lazy_init_op_info_from_cache) {
+  string cache_file = "./ut_startup_cache/ops_kernel_info.cache";
+  ops_kernel_manager_.ops_kernel_info_["Add"][0].computeCost = 2;
+  ops_kernel_manager_.ops_kernel_info_["Add"][0].isAtomic = true;
+  ops_kernel_manager_.ops_kernel_info_cache_file_ = cache_file;
+  ops_kernel_manager_.ops_kernel_info_fingerprint_ = "plugins";
+  ops_kernel_manager_.SaveOpsKernelInfoCache();
+
+  // plugins are never initialized, the op infos come from the cache
+  OpsKernelManager ops_kernel_manager;
+  ops_kernel_manager.lazy_init_ = true;
+  ops_kernel_manager.ops_kernel_info_cache_file_ = cache_file;
+  ops_kernel_manager.ops_kernel_info_fingerprint_ = "plugins";
+  ops_kernel_manager.LoadOpsKernelInfoCache();
+  EXPECT_TRUE(ops_kernel_manager.ops_kernel_info_cached_);
+  const auto &op_infos = ops_kernel_manager.GetOpsKernelInfo("Add");
+  ASSERT_EQ(op_infos.size(), 1);
+  EXPECT_EQ(op_infos[0].engine, "AIcoreEngine");
+  EXPECT_EQ(op_infos[0].opKernelLib, "AIcoreKernelLib");
+  EXPECT_EQ(op_infos[0].computeCost, 2);
+  EXPECT_TRUE(op_infos[0].isAtomic);
+  EXPECT_FALSE(op_infos[0].flagAsync);
+  EXPECT_TRUE(ops_kernel_manager.GetOpsKernelInfo("Sub").empty());
+  EXPECT_EQ(ops_kernel_manager.GetAllOpsKernelInfo().size(), 1);
+  EXPECT_FALSE(ops_kernel_manager.plugins_initialized_);
+
+  // saved with other plugins
+  OpsKernelManager outdated_manager;
+  outdated_manager.ops_kernel_info_cache_file_ = cache_file;
+  outdated_manager.ops_kernel_info_fingerprint_ = "other plugins";
+  outdated_manager.LoadOpsKernelInfoCache();
+  EXPECT_FALSE(outdated_manager.ops_kernel_info_cached_);
+  (void)remove(cache_file.c_str());
+}
@@ -0,0 +1,89 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <dlfcn.h>
+#include <gtest/gtest.h>
+#include <cstdio>
+
+#include "common/ge/plugin_manager.h"
+
+using namespace ge;
+using namespace std;
+
+class UtestPluginManager : public testing::Test {
+ protected:
+  void SetUp() override {}
+
+  void TearDown() override {}
+
+  // path of a library surely loadable in the test process
+  static string GetLibcPath() {
+    Dl_info dl_info;
+    if (dladdr(reinterpret_cast<void *>(&printf), &dl_info) == 0) {
+      return string();
+    }
+    return dl_info.dli_fname;
+  }
+};
+
+TEST_F(UtestPluginManager, fast_load_skip_invalid_path) {
+  PluginManager plugin_manager;
+  plugin_manager.SetFastLoad(true);
+  EXPECT_EQ(plugin_manager.LoadSo("/not_exist/liba.so:/not_exist/libb.so"), SUCCESS);
+  EXPECT_TRUE(plugin_manager.GetSoList().empty());
+}
+
+TEST_F(UtestPluginManager, fast_load_valid_so) {
+  string libc_path = GetLibcPath();
+  ASSERT_FALSE(libc_path.empty());
+  string file_name = libc_path.substr(libc_path.rfind('/') + 1);
+
+  PluginManager plugin_manager;
+  plugin_manager.SetFastLoad(true);
+  EXPECT_EQ(plugin_manager.LoadSo("/not_exist/liba.so:" + libc_path, {"printf"}), SUCCESS);
+  ASSERT_EQ(plugin_manager.GetSoList().size(), 1);
+  EXPECT_EQ(plugin_manager.GetSoList()[0], file_name);
+}
+
+TEST_F(UtestPluginManager, fast_load_check_functions) {
+  string libc_path = GetLibcPath();
+  ASSERT_FALSE(libc_path.empty());
+
+  PluginManager plugin_manager;
+  plugin_manager.SetFastLoad(true);
+  EXPECT_EQ(plugin_manager.LoadSo(libc_path, {"printf", "NotExistFunction"}), SUCCESS);
+  EXPECT_TRUE(plugin_manager.GetSoList().empty());
+}
+
+TEST_F(UtestPluginManager, startup_cache_saved_and_loaded) {
+  string libc_path = GetLibcPath();
+  ASSERT_FALSE(libc_path.empty());
+  string fingerprint = PluginManager::GetFingerprint({libc_path, "/not_exist/liba.so"});
+  EXPECT_EQ(fingerprint.find(libc_path + ":"), 0);
+  EXPECT_EQ(fingerprint.find("/not_exist/liba.so"), string::npos);
+
+  string cache_file = "./ut_startup_cache/plugin_manager.cache";
+  ASSERT_EQ(PluginManager::SaveStartupCache(cache_file, fingerprint, {"Add\tlib_a", "Sub\t"}), SUCCESS);
+  vector<string> lines;
+  PluginManager::LoadStartupCache(cache_file, fingerprint, lines);
+  EXPECT_EQ(lines, vector<string>({"Add\tlib_a", "Sub\t"}));
+
+  // a cache saved with other libraries is not used
+  lines.clear();
+  PluginManager::LoadStartupCache(cache_file, fingerprint + "changed", lines);
+  EXPECT_TRUE(lines.empty());
+  (void)remove(cache_file.c_str());
+}
@@ -0,0 +1,104 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/helper/model_helper.h"
+
+#define protected public
+#define private public
+#include "single_op/compiled_single_op.h"
+#undef private
+#undef protected
+
+using namespace std;
+using namespace testing;
+using namespace ge;
+
+class UtestCompiledSingleOp : public testing::Test {
+ protected:
+  void SetUp() {}
+
+  void TearDown() {}
+};
+
+TEST_F(UtestCompiledSingleOp, test_compiled_op_key) {
+  string model_data_str = "123456789";
+  string copied_str = model_data_str;
+  string other_str = "123456780";
+  ModelData model_data;
+  model_data.model_data = const_cast<char *>(model_data_str.data());
+  model_data.model_len = model_data_str.size();
+  ModelData copied_data;
+  copied_data.model_data = const_cast<char *>(copied_str.data());
+  copied_data.model_len = copied_str.size();
+  ModelData other_data;
+  other_data.model_data = const_cast<char *>(other_str.data());
+  other_data.model_len = other_str.size();
+
+  // keyed by content, not by the address of model data
+  ASSERT_EQ(CompiledSingleOpCache::GenerateKey(model_data), CompiledSingleOpCache::GenerateKey(copied_data));
+  ASSERT_NE(CompiledSingleOpCache::GenerateKey(model_data), CompiledSingleOpCache::GenerateKey(other_data));
+
+  CompiledSingleOpPtr compiled_op;
+  ASSERT_NE(CompiledSingleOpCache::GetInstance().GetCompiledOp("model", model_data, compiled_op), SUCCESS);
+  ASSERT_EQ(compiled_op, nullptr);
+}
+
+TEST_F(UtestCompiledSingleOp, test_compiled_op_same_model) {
+  string model_data_str = "123456789";
+  string copied_str = model_data_str;
+  string other_str = "123456780";
+  ModelData model_data;
+  model_data.model_data = const_cast<char *>(model_data_str.data());
+  model_data.model_len = model_data_str.size();
+
+  CompiledSingleOp compiled_op("model");
+  compiled_op.model_bytes_ = model_data_str;
+  ASSERT_TRUE(compiled_op.IsSameModel(model_data));
+  model_data.model_data = const_cast<char *>(copied_str.data());
+  ASSERT_TRUE(compiled_op.IsSameModel(model_data));
+  model_data.model_data = const_cast<char *>(other_str.data());
+  ASSERT_FALSE(compiled_op.IsSameModel(model_data));
+  model_data.model_len = model_data_str.size() - 1;
+  ASSERT_FALSE(compiled_op.IsSameModel(model_data));
+}
+
+TEST_F(UtestCompiledSingleOp, test_compiled_op_weights_per_device) {
+  vector<uint8_t> weights(64, 1);
+  CompiledSingleOp compiled_op("model");
+  compiled_op.ge_model_ = std::make_shared<GeModel>();
+  ASSERT_NE(compiled_op.ge_model_, nullptr);
+  compiled_op.ge_model_->SetWeight(Buffer::CopyFrom(weights.data(), weights.size()));
+
+  uint8_t *device0_weights = nullptr;
+  uint8_t *device1_weights = nullptr;
+  uint8_t *reused_weights = nullptr;
+  ASSERT_EQ(compiled_op.GetDeviceWeightBase(0, weights.size(), device0_weights), SUCCESS);
+  ASSERT_EQ(compiled_op.GetDeviceWeightBase(1, weights.size(), device1_weights), SUCCESS);
+  ASSERT_EQ(compiled_op.GetDeviceWeightBase(0, weights.size(), reused_weights), SUCCESS);
+  ASSERT_NE(device0_weights, nullptr);
+  ASSERT_NE(device1_weights, nullptr);
+  ASSERT_NE(device0_weights, device1_weights);
+  ASSERT_EQ(device0_weights, reused_weights);
+  ASSERT_EQ(compiled_op.weight_bases_.size(), 2);
+}
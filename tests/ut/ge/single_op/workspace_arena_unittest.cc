@@ -0,0 +1,97 @@
+/**
+ * Copyright 2019-2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "runtime/rt.h"
+
+#define protected public
+#define private public
+#include "single_op/stream_resource.h"
+#include "single_op/workspace_arena.h"
+#undef private
+#undef protected
+
+using namespace std;
+using namespace testing;
+using namespace ge;
+
+class UtestWorkspaceArena : public testing::Test {
+ protected:
+  void SetUp() {}
+
+  void TearDown() {}
+};
+
+TEST_F(UtestWorkspaceArena, test_allocate_free_trim) {
+  WorkspaceArena arena;
+  uint8_t *block = arena.Allocate("test", 1000);
+  ASSERT_NE(block, nullptr);
+  ASSERT_EQ(arena.GetStats().allocated_size, 1024);
+  ASSERT_EQ(arena.GetStats().in_use_size, 1024);
+
+  // freed block is reused by later allocation of the same size class
+  arena.Free(block);
+  ASSERT_EQ(arena.Allocate("test", 600), block);
+  ASSERT_EQ(arena.GetStats().reuse_count, 1);
+
+  // block of a larger size class is not reused for a much smaller request
+  uint8_t *large_block = arena.Allocate("test", 8192);
+  arena.Free(large_block);
+  uint8_t *small_block = arena.Allocate("test", 100);
+  ASSERT_NE(small_block, large_block);
+  ASSERT_EQ(arena.GetStats().malloc_count, 3);
+  ASSERT_EQ(arena.GetStats().high_water_mark, 1024 + 8192 + 512);
+
+  arena.Free(block);
+  arena.Free(small_block);
+  ASSERT_EQ(arena.Trim(), SUCCESS);
+  ASSERT_EQ(arena.GetStats().allocated_size, 0);
+  ASSERT_EQ(arena.GetStats().in_use_size, 0);
+  ASSERT_EQ(arena.GetStats().trim_count, 1);
+}
+
+TEST_F(UtestWorkspaceArena, test_stream_resource_arena) {
+  rtStream_t stream = nullptr;
+  ASSERT_EQ(rtStreamCreate(&stream, 0), RT_ERROR_NONE);
+  {
+    StreamResource res(reinterpret_cast<uintptr_t>(stream));
+    res.SetStream(stream);
+    auto &arena = res.GetWorkspaceArena();
+    ASSERT_EQ(arena.stream_, stream);
+
+    // blocks in use are kept by trim, and released by the stream resource
+    uint8_t *block = arena.Allocate("test", 100);
+    ASSERT_NE(block, nullptr);
+    uint8_t *cached_block = arena.Allocate("test", 2000);
+    ASSERT_NE(cached_block, nullptr);
+    arena.Free(cached_block);
+    ASSERT_EQ(arena.Trim(), SUCCESS);
+    ASSERT_EQ(arena.GetStats().allocated_size, 512);
+    ASSERT_EQ(arena.GetStats().in_use_size, 512);
+    ASSERT_EQ(arena.GetStats().trim_count, 1);
+
+    arena.Free(block);
+    ASSERT_EQ(res.GetWorkspaceArena().Allocate("test", 400), block);
+  }
+  (void)rtStreamDestroy(stream);
+}